@@ -6,13 +6,20 @@ include(CTest) # Required to avoid errors along the lines of "Cannot find file:
 # added below to force ctest to run with additional default parameters.
 if (CMAKE_CONFIGURATION_TYPES)
     add_custom_target(check COMMAND ${CMAKE_CTEST_COMMAND}
-        --force-new-ctest-process --output-on-failure
+        --force-new-ctest-process --output-on-failure --label-exclude benchmark
         --build-config "$<CONFIGURATION>")
 else()
     add_custom_target(check COMMAND ${CMAKE_CTEST_COMMAND}
-        --force-new-ctest-process --output-on-failure)
+        --force-new-ctest-process --output-on-failure --label-exclude benchmark)
 endif()
 
+# The benchmark tests are slow and are thus only added when this option is enabled. They are excluded from the `check`
+# target and can be run using the `benchmark` target (or `ctest -L benchmark`).
+option(ENABLE_BENCHMARK_TESTS "Add the benchmark tests (label: benchmark)" OFF)
+
+add_custom_target(benchmark COMMAND ${CMAKE_CTEST_COMMAND}
+    --force-new-ctest-process --output-on-failure --label-regex benchmark)
+
 # Add a test with input test name and an arbitrary number of trailing command line arguments.
 function(add_test_DPG test_exec)
 	# The optional command line arguments should be passed as a string and are stored in ${ARGV1} if present.
@@ -44,8 +51,43 @@ function(add_test_DPG_w_path exec_path test_exec)
 		add_test(NAME ${test_exec}___${ARGV2} COMMAND ${exec_path}${test_exec} ${ARGV2} WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/bin)
 	elseif (n_extra_args EQUAL 2)
 		add_test(NAME ${test_exec}___${ARGV2} COMMAND ${exec_path}${test_exec} ${ARGV2} ${ARGV3} WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/bin)
+	elseif (n_extra_args EQUAL 3)
+		add_test(NAME ${test_exec}___${ARGV2} COMMAND ${exec_path}${test_exec} ${ARGV2} ${ARGV3} ${ARGV4} WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/bin)
+	elseif (n_extra_args EQUAL 4)
+		add_test(NAME ${test_exec}___${ARGV2} COMMAND ${exec_path}${test_exec} ${ARGV2} ${ARGV3} ${ARGV4} ${ARGV5} WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/bin)
 	else ()
 		message(FATAL_ERROR "Invalid number of command line arguments." )
 	endif()
 endfunction()
 
+
+# Add a test comparing the solution computed using the input number of mpi processes with that computed using a single
+# process. The serial solve is added as a separate test outputting the reference solution, which is run first as it is
+# the fixture required by the parallel solve.
+function(add_test_DPG_mpi exec_path test_exec n_procs ctrl_name petsc_options)
+	if (MPIEXEC_EXECUTABLE)
+		set(mpiexec ${MPIEXEC_EXECUTABLE})
+	else ()
+		set(mpiexec ${MPIEXEC}) # CMake < 3.10
+	endif()
+
+	set(test_name ${test_exec}___${ctrl_name})
+	add_test(NAME ${test_name}___serial
+	         COMMAND ${exec_path}${test_exec} "serial" ${ctrl_name} ${petsc_options}
+	         WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/bin)
+	add_test(NAME ${test_name}___mpi
+	         COMMAND ${mpiexec} ${MPIEXEC_NUMPROC_FLAG} ${n_procs} ${MPIEXEC_PREFLAGS}
+	                 ${exec_path}${test_exec} ${MPIEXEC_POSTFLAGS} "mpi" ${ctrl_name} ${petsc_options}
+	         WORKING_DIRECTORY ${CMAKE_BINARY_DIR}/bin)
+	set_tests_properties(${test_name}___serial PROPERTIES FIXTURES_SETUP    ${test_name})
+	set_tests_properties(${test_name}___mpi    PROPERTIES FIXTURES_REQUIRED ${test_name}
+	                                                      PROCESSORS        ${n_procs})
+endfunction()
+
+# Add a benchmark test with input test name and command line argument (only if ENABLE_BENCHMARK_TESTS is set).
+function(add_benchmark_DPG test_exec test_arg)
+	if (ENABLE_BENCHMARK_TESTS)
+		add_test_DPG(${test_exec} ${test_arg})
+		set_tests_properties(${test_exec}___${test_arg} PROPERTIES LABELS benchmark)
+	endif()
+endfunction()
@@ -0,0 +1,67 @@
+#!/bin/bash
+#PBS -A rck-371-aa
+#PBS -l walltime=02:00:00
+#PBS -l nodes=2:ppn=12
+#PBS -q hb
+#PBS -o outputfile
+#PBS -e errorfile
+#PBS -V
+#PBS -N pz_scaling
+
+# Strong and weak scaling study for the distributed (DG) implicit solver.
+#
+# The steady diffusion problem is solved on the structured QUAD meshes of the unit square (n-cube/2d.geo) with p = 2.
+#
+# Strong scaling: the finest mesh level is run on an increasing number of processors.
+# Weak scaling:   the mesh level is refined as the number of processors is increased such that the number of volumes per
+#                 processor remains constant (4x volumes per level in 2D).
+#
+# The wall time of each run is appended to ${TIMEFILE}.
+
+# Executable and command line arguments
+EXECUTABLE=@CMAKE_BINARY_DIR@/bin/test_integration_convergence
+CTRL_BASE="diffusion/steady/default/dg/scaling/TEST_Diffusion_Steady_Default_DG_QUAD_scaling"
+PETSC_OPTIONS_FILE="petsc_options_gmres_default"
+
+# Petsc options passed through the environment (overriding the options file): mesh partitioner, a preconditioner which
+# is available for distributed matrices and the performance summary.
+export PETSC_OPTIONS="-mat_partitioning_type parmetis -pc_type bjacobi -sub_pc_type ilu -log_view"
+
+# Strong scaling: mesh level and processor counts.
+STRONG_ML="7"
+STRONG_N_PROCS="1 2 4 8 16 24"
+
+# Weak scaling: "mesh_level:n_procs" pairs (control files are available for mesh levels 4-7).
+WEAK_ML_N_PROCS="4:1 5:4 6:16"
+
+# Specify the name of the file where timings should be placed
+TIMEFILE="scaling_timings.txt"
+
+# Specify the path to the mpi executable (mpiexec)
+MPI_DIR=""
+
+
+# DO NOT MODIFY ANYTHING BELOW THIS LINE
+
+run_case ()
+{
+	local ML=$1
+	local N_PROCS=$2
+	local TYPE=$3
+
+	local T_START=$(date +%s.%N)
+	${MPI_DIR}mpiexec -n ${N_PROCS} ${EXECUTABLE} ${CTRL_BASE}__ml${ML}__p2 ${PETSC_OPTIONS_FILE} > log_${TYPE}_ml${ML}_np${N_PROCS}
+	local T_END=$(date +%s.%N)
+
+	echo "${TYPE} ml${ML} n_procs ${N_PROCS} wall_time $(echo "${T_END} - ${T_START}" | bc)" >> ${TIMEFILE}
+}
+
+echo "# type mesh_level n_procs wall_time[s]" > ${TIMEFILE}
+
+for N_PROCS in ${STRONG_N_PROCS}; do
+	run_case ${STRONG_ML} ${N_PROCS} strong
+done
+
+for ML_N_PROCS in ${WEAK_ML_N_PROCS}; do
+	run_case ${ML_N_PROCS%%:*} ${ML_N_PROCS##*:} weak
+done
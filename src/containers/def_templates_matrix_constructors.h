@@ -25,6 +25,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #define constructor_empty_Matrix_T       constructor_empty_Matrix_d
 #define constructor_empty_const_Matrix_T constructor_empty_const_Matrix_d
+#define constructor_empty_Matrix_T_scratch constructor_empty_Matrix_d_scratch
 #define constructor_zero_Matrix_T        constructor_zero_Matrix_d
 
 #define constructor_copy_Matrix_T                constructor_copy_Matrix_d
@@ -78,6 +79,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_mm_diag_const_Matrix_R_T      constructor_mm_diag_const_Matrix_d_d_2
 #define constructor_mm_diag_Matrix_T              constructor_mm_diag_Matrix_d
 #define constructor_mm_diag_const_Matrix_T        constructor_mm_diag_const_Matrix_d
+#define constructor_sparse_Matrix_CSR_T           constructor_sparse_Matrix_CSR_d
+#define constructor_sparse_const_Matrix_CSR_T     constructor_sparse_const_Matrix_CSR_d
 #define set_Matrix_from_Multiarray_T              set_Matrix_from_Multiarray_d
 #define set_const_Matrix_from_Multiarray_T        set_const_Matrix_from_Multiarray_d
 #define set_Matrix_from_Multiarray_Matrix_T       set_Matrix_from_Multiarray_Matrix_d
@@ -87,6 +90,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #define destructor_const_Matrix_T             destructor_const_Matrix_d
 #define destructor_conditional_Matrix_T       destructor_conditional_Matrix_d
 #define destructor_conditional_const_Matrix_T destructor_conditional_const_Matrix_d
+#define destructor_Matrix_CSR_T               destructor_Matrix_CSR_d
+#define destructor_const_Matrix_CSR_T         destructor_const_Matrix_CSR_d
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
@@ -97,6 +102,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #define constructor_empty_Matrix_T       constructor_empty_Matrix_c
 #define constructor_empty_const_Matrix_T constructor_empty_const_Matrix_c
+#define constructor_empty_Matrix_T_scratch constructor_empty_Matrix_c_scratch
 #define constructor_zero_Matrix_T        constructor_zero_Matrix_c
 
 #define constructor_copy_Matrix_T                constructor_copy_Matrix_c
@@ -150,6 +156,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_mm_diag_const_Matrix_R_T      constructor_mm_diag_const_Matrix_d_c
 #define constructor_mm_diag_Matrix_T              constructor_mm_diag_Matrix_c
 #define constructor_mm_diag_const_Matrix_T        constructor_mm_diag_const_Matrix_c
+#define constructor_sparse_Matrix_CSR_T           constructor_sparse_Matrix_CSR_c
+#define constructor_sparse_const_Matrix_CSR_T     constructor_sparse_const_Matrix_CSR_c
 #define set_Matrix_from_Multiarray_T              set_Matrix_from_Multiarray_c
 #define set_const_Matrix_from_Multiarray_T        set_const_Matrix_from_Multiarray_c
 #define set_Matrix_from_Multiarray_Matrix_T       set_Matrix_from_Multiarray_Matrix_c
@@ -159,6 +167,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #define destructor_const_Matrix_T             destructor_const_Matrix_c
 #define destructor_conditional_Matrix_T       destructor_conditional_Matrix_c
 #define destructor_conditional_const_Matrix_T destructor_conditional_const_Matrix_c
+#define destructor_Matrix_CSR_T               destructor_Matrix_CSR_c
+#define destructor_const_Matrix_CSR_T         destructor_const_Matrix_CSR_c
 ///\}
 
 #endif
@@ -199,6 +209,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_default_const_Matrix_T constructor_default_const_Matrix_i
 
 #define constructor_empty_Matrix_T constructor_empty_Matrix_i
+#define constructor_empty_Matrix_T_scratch constructor_empty_Matrix_i_scratch
 
 #define constructor_copy_Matrix_T_T             constructor_copy_Matrix_i_i
 #define constructor_copy_const_Matrix_T_T       constructor_copy_const_Matrix_i_i
@@ -221,8 +232,10 @@ You should have received a copy of the GNU General Public License along with DPG
 #define set_Matrix_from_Multiarray_Matrix_T       set_Matrix_from_Multiarray_Matrix_i
 #define set_const_Matrix_from_Multiarray_Matrix_T set_const_Matrix_from_Multiarray_Matrix_i
 
-#define destructor_Matrix_T       destructor_Matrix_i
-#define destructor_const_Matrix_T destructor_const_Matrix_i
+#define destructor_Matrix_T           destructor_Matrix_i
+#define destructor_const_Matrix_T     destructor_const_Matrix_i
+#define destructor_Matrix_CSR_T       destructor_Matrix_CSR_i
+#define destructor_const_Matrix_CSR_T destructor_const_Matrix_CSR_i
 ///\}
 
 #define constructor_move_Matrix_R_R           constructor_move_Matrix_d_d
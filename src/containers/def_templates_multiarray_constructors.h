@@ -38,6 +38,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #define constructor_zero_Multiarray_T             constructor_zero_Multiarray_d
 #define constructor_zero_Multiarray_T_dyn_extents constructor_zero_Multiarray_d_dyn_extents
+#define constructor_zero_Multiarray_T_scratch      constructor_zero_Multiarray_d_scratch
 
 #define constructor_copy_Multiarray_T          constructor_copy_Multiarray_d
 #define constructor_copy_const_Multiarray_T    constructor_copy_const_Multiarray_d
@@ -105,6 +106,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #define constructor_zero_Multiarray_T             constructor_zero_Multiarray_c
 #define constructor_zero_Multiarray_T_dyn_extents constructor_zero_Multiarray_c_dyn_extents
+#define constructor_zero_Multiarray_T_scratch      constructor_zero_Multiarray_c_scratch
 
 #define constructor_copy_Multiarray_T                    constructor_copy_Multiarray_c
 #define constructor_copy_const_Multiarray_T              constructor_copy_const_Multiarray_c
@@ -198,6 +200,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #define constructor_zero_Multiarray_T             constructor_zero_Multiarray_i
 #define constructor_zero_Multiarray_T_dyn_extents constructor_zero_Multiarray_i_dyn_extents
+#define constructor_zero_Multiarray_T_scratch      constructor_zero_Multiarray_i_scratch
 
 #define constructor_copy_Multiarray_T          constructor_copy_Multiarray_i
 #define constructor_copy_const_Multiarray_T    constructor_copy_const_Multiarray_i
@@ -34,6 +34,8 @@ struct Matrix_T {
 
 	bool owns_data; ///< Flag for whether the data should be freed when calling the destructor.
 	Type* data;     ///< The data.
+
+	bool in_scratch; ///< Flag for whether the container was allocated from the scratch arena.
 };
 
 /// \brief `const` version of \ref Matrix_T.
@@ -45,11 +47,14 @@ struct const_Matrix_T { ///\{
 
 	const bool owns_data;
 	const Type*const data;
+
+	const bool in_scratch;
 }; ///\}
 
 /** \brief Templated Matrix in 'C'ompressed 'S'parse 'R'ow storage format.
  *
- *  Further details regarding the CSR storage format can be found on [this intel mkl page][mkl_csr].
+ *  Further details regarding the CSR storage format can be found on [this intel mkl page][mkl_csr]. The indices are
+ *  stored as `int` such that they can be passed directly to the (lp64) intel mkl sparse routines.
  *
  *  <!-- References: -->
  *  [mkl_csr]: https://software.intel.com/en-us/mkl-developer-reference-fortran-sparse-blas-csr-matrix-storage-format
@@ -58,8 +63,8 @@ struct Matrix_CSR_T {
 	ptrdiff_t ext_0, ///< Defined in \ref Matrix_T.
 	          ext_1; ///< Defined in \ref Matrix_T.
 
-	ptrdiff_t* row_index; ///< Indices of the entries at the start of each row (`pointerB` on the intel mkl page).
-	ptrdiff_t* columns;   ///< Indices of the column corresponding to each entry in the matrix.
+	int* row_index; ///< Indices of the entries at the start of each row (`pointerB` on the intel mkl page).
+	int* columns;   ///< Indices of the column corresponding to each entry in the matrix.
 
 	bool owns_data; ///< Defined in \ref Matrix_T.
 	Type* data;     ///< Defined in \ref Matrix_T.
@@ -70,8 +75,8 @@ struct const_Matrix_CSR_T { ///\{
 	const ptrdiff_t ext_0,
 	                ext_1;
 
-	const ptrdiff_t*const row_index;
-	const ptrdiff_t*const columns;
+	const int*const row_index;
+	const int*const columns;
 
 	const bool owns_data;
 	const Type*const data;
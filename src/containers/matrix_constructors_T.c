@@ -17,11 +17,14 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include <stdlib.h>
 #include <assert.h>
+#include <math.h>
 #include "definitions_mkl.h"
 #include "mkl.h"
 
 #include "macros.h"
+#include "scratch_arena.h"
 
+#include "def_templates_math_functions.h"
 #include "def_templates_matrix.h"
 #include "def_templates_multiarray.h"
 #include "def_templates_vector.h"
@@ -57,6 +60,20 @@ const struct const_Matrix_T* constructor_empty_const_Matrix_T
 	return (struct const_Matrix_T*) constructor_empty_Matrix_T(layout,ext_0,ext_1);
 }
 
+struct Matrix_T* constructor_empty_Matrix_T_scratch (const char layout, const ptrdiff_t ext_0, const ptrdiff_t ext_1)
+{
+	struct Matrix_T* dest = malloc_scratch(sizeof *dest); // returned
+
+	dest->layout     = layout;
+	dest->ext_0      = ext_0;
+	dest->ext_1      = ext_1;
+	dest->owns_data  = true;
+	dest->data       = malloc_scratch((size_t)(ext_0*ext_1) * sizeof *dest->data); // keep
+	dest->in_scratch = in_scratch_scope();
+
+	return dest;
+}
+
 // Empty constructors *********************************************************************************************** //
 
 struct Matrix_T* constructor_zero_Matrix_T (const char layout, const ptrdiff_t ext_0, const ptrdiff_t ext_1)
@@ -607,6 +624,54 @@ const struct const_Matrix_T* constructor_mm_diag_const_Matrix_T
 {
 	return (const struct const_Matrix_T*) constructor_mm_diag_Matrix_T(alpha,a,b,side,invert_diag);
 }
+
+struct Matrix_CSR_T* constructor_sparse_Matrix_CSR_T (const struct const_Matrix_T*const a, const Real tol)
+{
+	const ptrdiff_t ext_0 = a->ext_0,
+	                ext_1 = a->ext_1;
+	const bool row_major = (a->layout == 'R');
+
+	int* row_index = malloc((size_t)(ext_0+1) * sizeof *row_index); // keep
+	row_index[0] = 0;
+	for (ptrdiff_t i = 0; i < ext_0; ++i) {
+		row_index[i+1] = row_index[i];
+		for (ptrdiff_t j = 0; j < ext_1; ++j) {
+			const Type val = ( row_major ? a->data[i*ext_1+j] : a->data[i+j*ext_0] );
+			if (abs_T(val) > tol)
+				++row_index[i+1];
+		}
+	}
+
+	const int n_nz = row_index[ext_0];
+	int* columns = malloc((size_t)n_nz * sizeof *columns); // keep
+	Type* data   = malloc((size_t)n_nz * sizeof *data);    // keep
+	for (ptrdiff_t i = 0, ind = 0; i < ext_0; ++i) {
+		for (ptrdiff_t j = 0; j < ext_1; ++j) {
+			const Type val = ( row_major ? a->data[i*ext_1+j] : a->data[i+j*ext_0] );
+			if (!(abs_T(val) > tol))
+				continue;
+			columns[ind] = (int)j;
+			data[ind]    = val;
+			++ind;
+		}
+	}
+
+	struct Matrix_CSR_T* dest = calloc(1,sizeof *dest); // returned
+	dest->ext_0     = ext_0;
+	dest->ext_1     = ext_1;
+	dest->row_index = row_index;
+	dest->columns   = columns;
+	dest->owns_data = true;
+	dest->data      = data;
+
+	return dest;
+}
+
+const struct const_Matrix_CSR_T* constructor_sparse_const_Matrix_CSR_T
+	(const struct const_Matrix_T*const a, const Real tol)
+{
+	return (const struct const_Matrix_CSR_T*) constructor_sparse_Matrix_CSR_T(a,tol);
+}
 #endif
 
 void set_Matrix_from_Multiarray_T (struct Matrix_T* dest, struct Multiarray_T* src, const ptrdiff_t*const sub_indices)
@@ -649,6 +714,9 @@ void destructor_Matrix_T (struct Matrix_T* a)
 {
 	assert(a != NULL);
 
+	if (a->in_scratch) // Released when the scratch scope is closed.
+		return;
+
 	if (a->owns_data)
 		free(a->data);
 	free(a);
@@ -670,9 +738,27 @@ void destructor_conditional_const_Matrix_T (const struct const_Matrix_T* a)
 	destructor_conditional_Matrix_T ((struct Matrix_T*)a);
 }
 
+void destructor_Matrix_CSR_T (struct Matrix_CSR_T* a)
+{
+	assert(a != NULL);
+
+	if (a->owns_data) {
+		free(a->row_index);
+		free(a->columns);
+		free(a->data);
+	}
+	free(a);
+}
+
+void destructor_const_Matrix_CSR_T (const struct const_Matrix_CSR_T* a)
+{
+	destructor_Matrix_CSR_T((struct Matrix_CSR_T*)a);
+}
+
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
+#include "undef_templates_math_functions.h"
 #include "undef_templates_matrix.h"
 #include "undef_templates_multiarray.h"
 #include "undef_templates_vector.h"
@@ -26,6 +26,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "def_templates_vector.h"
 
 struct Matrix_R;
+struct Matrix_CSR_T;
 struct Multiarray_T;
 struct Multiarray_Matrix_T;
 struct const_Vector_R;
@@ -33,6 +34,7 @@ struct const_Vector_T;
 struct const_Vector_i;
 struct const_Matrix_T;
 struct const_Matrix_R;
+struct const_Matrix_CSR_T;
 struct const_Multiarray_T;
 struct const_Multiarray_Matrix_T;
 
@@ -64,6 +66,14 @@ const struct const_Matrix_T* constructor_empty_const_Matrix_T
 	 const ptrdiff_t ext_1  ///< Standard.
 	);
 
+/** \brief Same as \ref constructor_empty_Matrix_T but using \ref malloc_scratch for all allocations.
+ *  \return Standard. */
+struct Matrix_T* constructor_empty_Matrix_T_scratch
+	(const char layout,     ///< Standard.
+	 const ptrdiff_t ext_0, ///< Standard.
+	 const ptrdiff_t ext_1  ///< Standard.
+	);
+
 // Zero constructors ************************************************************************************************ //
 
 /** \brief Same as \ref constructor_empty_Matrix_T but with data calloc'ed.
@@ -502,6 +512,24 @@ const struct const_Matrix_T* constructor_mm_diag_const_Matrix_T
 	 const char side,                     ///< See brief.
 	 const bool invert_diag               ///< See brief.
 	);
+
+/** \brief Constructor for a \ref Matrix_CSR_T\* from the entries of the input dense matrix having magnitude greater
+ *         than the tolerance.
+ *  \return Standard.
+ *
+ *  The columns of each row are stored in increasing order independently of the layout of the input.
+ */
+struct Matrix_CSR_T* constructor_sparse_Matrix_CSR_T
+	(const struct const_Matrix_T*const a, ///< The dense input matrix.
+	 const Real tol                       ///< The tolerance below which entries are treated as zero.
+	);
+
+/** \brief `const` version of \ref constructor_sparse_Matrix_CSR_T.
+ *  \return See brief. */
+const struct const_Matrix_CSR_T* constructor_sparse_const_Matrix_CSR_T
+	(const struct const_Matrix_T*const a, ///< See brief.
+	 const Real tol                       ///< See brief.
+	);
 #endif
 
 /// \brief Set a \ref Matrix_T\* from a sub range of a \ref Multiarray_T\*.
@@ -554,6 +582,16 @@ void destructor_conditional_const_Matrix_T
 	(const struct const_Matrix_T* a ///< Standard.
 	);
 
+/// \brief Destructs a \ref Matrix_CSR_T\*.
+void destructor_Matrix_CSR_T
+	(struct Matrix_CSR_T* a ///< Standard.
+	);
+
+/// \brief `const` version of \ref destructor_Matrix_CSR_T.
+void destructor_const_Matrix_CSR_T
+	(const struct const_Matrix_CSR_T* a ///< Standard.
+	);
+
 #include "undef_templates_matrix.h"
 #include "undef_templates_multiarray.h"
 #include "undef_templates_vector.h"
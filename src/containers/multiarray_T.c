@@ -240,16 +240,25 @@ struct Vector_T* collapse_Multiarray_Vector_T (const struct Multiarray_Vector_T*
 
 void resize_Multiarray_T (struct Multiarray_T* a, const int order, const ptrdiff_t* extents)
 {
+	if (a->in_scratch)
+		EXIT_ERROR("Multiarrays allocated from the scratch arena cannot be resized.");
 #if 1
 	assert(a->order == order); // Make flexible if needed.
 #else
 	a->extents = realloc(a->extents,order * sizeof *a->extents);
 #endif
+	const ptrdiff_t size_i = compute_size(a->order,a->extents);
 	a->order   = order;
 	for (int i = 0; i < order; ++i)
 		a->extents[i] = extents[i];
 
-	a->data = realloc(a->data,(size_t)compute_size(order,extents) * sizeof *a->data);
+	const ptrdiff_t size = compute_size(order,extents);
+	if (size == size_i)
+		return;
+
+	if (!a->owns_data)
+		EXIT_ERROR("Multiarrays not owning their data cannot be resized.");
+	a->data = realloc(a->data,(size_t)size * sizeof *a->data);
 }
 
 const struct const_Vector_T* get_const_Multiarray_Vector_T
@@ -346,7 +355,6 @@ void copy_into_Multiarray_T (struct Multiarray_T*const dest, const struct const_
 	for (int i = 0; i < src->order; ++i)
 		assert(dest->extents[i] == src->extents[i]);
 	assert(dest->layout == src->layout);
-	assert(dest->owns_data == true);
 
 	const ptrdiff_t size = compute_size(src->order,src->extents);
 	for (int i = 0; i < size; ++i)
@@ -360,7 +368,6 @@ void copy_into_Multiarray_T_from_R (struct Multiarray_T*const dest, const struct
 	for (int i = 0; i < src->order; ++i)
 		assert(dest->extents[i] == src->extents[i]);
 	assert(dest->layout == src->layout);
-	assert(dest->owns_data == true);
 
 	const ptrdiff_t size = compute_size(src->order,src->extents);
 	for (int i = 0; i < size; ++i)
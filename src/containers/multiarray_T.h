@@ -35,6 +35,8 @@ struct Multiarray_T {
 	bool owns_data; /**< Flag for whether the data should be freed in the destructor. This would be false if a move
 	                     constructor was used. */
 	Type* data; ///< The data.
+
+	bool in_scratch; ///< Flag for whether the container was allocated from the scratch arena.
 };
 
 /// \brief `const` version of \ref Multiarray_T.
@@ -46,6 +48,8 @@ struct const_Multiarray_T { ///\{
 
 	const bool owns_data;
 	const Type*const data;
+
+	const bool in_scratch;
 }; ///\}
 
 /// \brief Templated Multiarray of \ref Vector_T\*s.
@@ -177,7 +181,11 @@ struct Vector_T* collapse_Multiarray_Vector_T
 	(const struct Multiarray_Vector_T*const src ///< The source.
 	);
 
-/// \brief Resize a \ref Multiarray_T\* using realloc (i.e. copying as much of the data as fits in the new memory).
+/** \brief Resize a \ref Multiarray_T\* using realloc (i.e. copying as much of the data as fits in the new memory).
+ *
+ *  The data is left untouched if the size is unchanged such that containers not owning their data (e.g. views into a
+ *  \ref Solution_Pool) may be reshaped.
+ */
 void resize_Multiarray_T
 	(struct Multiarray_T* a,  ///< The multiarray.
 	 const int order,         ///< Defined in \ref Multiarray_T.
@@ -238,14 +246,18 @@ struct Vector_T interpret_Multiarray_slice_as_Vector_T
 	 const ptrdiff_t*const sub_indices    ///< Defined for \ref interpret_Multiarray_as_slice_T.
 	);
 
-/// \brief Copy data from the source into the destination \ref Multiarray_T.
+/** \brief Copy data from the source into the destination \ref Multiarray_T.
+ *
+ *  The destination need not own its data (e.g. views into a \ref Solution_Pool). */
 void copy_into_Multiarray_T
 	(struct Multiarray_T*const dest,           ///< The destination.
 	 const struct const_Multiarray_T*const src ///< The source.
 	);
 
 #ifdef TYPE_RC
-/// \brief Copy data from the source into the destination \ref Multiarray_T.
+/** \brief Copy data from the source into the destination \ref Multiarray_T.
+ *
+ *  The destination need not own its data (e.g. views into a \ref Solution_Pool). */
 void copy_into_Multiarray_T_from_R
 	(struct Multiarray_T*const dest,           ///< The destination.
 	 const struct const_Multiarray_R*const src ///< The source.
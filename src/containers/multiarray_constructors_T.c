@@ -19,6 +19,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <assert.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_core.h"
 
 #include "def_templates_matrix.h"
@@ -161,6 +162,23 @@ struct Multiarray_T* constructor_zero_Multiarray_T_dyn_extents
 	return constructor_move_Multiarray_T_dyn_extents(layout,order,(ptrdiff_t*)extents_i,true,data);
 }
 
+struct Multiarray_T* constructor_zero_Multiarray_T_scratch
+	(const char layout, const int order, const ptrdiff_t*const extents_i)
+{
+	struct Multiarray_T* dest = malloc_scratch(sizeof *dest); // returned
+
+	dest->layout     = layout;
+	dest->order      = order;
+	dest->extents    = malloc_scratch((size_t)order * sizeof *dest->extents); // keep
+	dest->owns_data  = true;
+	dest->in_scratch = in_scratch_scope();
+	for (int i = 0; i < order; ++i)
+		dest->extents[i] = extents_i[i];
+	dest->data = calloc_scratch((size_t)compute_size(order,extents_i),sizeof *dest->data); // keep
+
+	return dest;
+}
+
 // Copy constructors ************************************************************************************************ //
 
 struct Multiarray_T* constructor_copy_Multiarray_T (struct Multiarray_T* src)
@@ -548,6 +566,9 @@ void destructor_Multiarray_T (const struct Multiarray_T* a)
 {
 	assert(a != NULL);
 
+	if (a->in_scratch) // Released when the scratch scope is closed.
+		return;
+
 	free(a->extents);
 	if (a->owns_data)
 		free(a->data);
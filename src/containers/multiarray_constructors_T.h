@@ -169,6 +169,14 @@ struct Multiarray_T* constructor_zero_Multiarray_T
 	 const ptrdiff_t*const extents_i ///< The input extents.
 	);
 
+/** \brief Same as \ref constructor_zero_Multiarray_T but using \ref malloc_scratch for all allocations.
+ *  \return Standard. */
+struct Multiarray_T* constructor_zero_Multiarray_T_scratch
+	(const char layout,              ///< Defined in \ref Multiarray_T.
+	 const int order,                ///< Defined in \ref Multiarray_T.
+	 const ptrdiff_t*const extents_i ///< The input extents.
+	);
+
 /** \brief Same as \ref constructor_empty_Multiarray_T_dyn_extents but with data calloc'ed.
  *  \return Standard. */
 struct Multiarray_T* constructor_zero_Multiarray_T_dyn_extents
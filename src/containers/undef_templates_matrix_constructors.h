@@ -21,6 +21,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #undef constructor_empty_Matrix_T
 #undef constructor_empty_const_Matrix_T
+#undef constructor_empty_Matrix_T_scratch
 #undef constructor_zero_Matrix_T
 
 #undef constructor_copy_Matrix_T
@@ -74,6 +75,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef constructor_mm_diag_const_Matrix_R_T
 #undef constructor_mm_diag_Matrix_T
 #undef constructor_mm_diag_const_Matrix_T
+#undef constructor_sparse_Matrix_CSR_T
+#undef constructor_sparse_const_Matrix_CSR_T
 #undef set_Matrix_from_Multiarray_T
 #undef set_const_Matrix_from_Multiarray_T
 #undef set_Matrix_from_Multiarray_Matrix_T
@@ -83,6 +86,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef destructor_const_Matrix_T
 #undef destructor_conditional_Matrix_T
 #undef destructor_conditional_const_Matrix_T
+#undef destructor_Matrix_CSR_T
+#undef destructor_const_Matrix_CSR_T
 
 
 #undef constructor_default_Matrix_R
@@ -34,6 +34,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #undef constructor_zero_Multiarray_T
 #undef constructor_zero_Multiarray_T_dyn_extents
+#undef constructor_zero_Multiarray_T_scratch
 
 #undef constructor_copy_Multiarray_T
 #undef constructor_copy_const_Multiarray_T
@@ -984,9 +984,15 @@ constructor_grad_basis_fptr get_constructor_grad_basis_by_super_type (const int
 		else if (strcmp(ref_basis_name,"bezier") == 0)
 			return  constructor_grad_basis_tp_bezier;
 	} else if (s_type == ST_SI) {
-		return  constructor_grad_basis_si_orthonormal;
+		if (strcmp(ref_basis_name,"orthonormal") == 0)
+			return  constructor_grad_basis_si_orthonormal;
+		else if (strcmp(ref_basis_name,"bezier") == 0)
+			return  constructor_grad_basis_si_bezier;
 	} else if (s_type == ST_PYR) {
-		return  constructor_grad_basis_pyr_orthonormal;
+		if (strcmp(ref_basis_name,"orthonormal") == 0)
+			return  constructor_grad_basis_pyr_orthonormal;
+		else if (strcmp(ref_basis_name,"bezier") == 0)
+			return  constructor_grad_basis_pyr_bezier;
 	}
 
 	EXIT_ERROR("Did not find the basis with the specified inputs: (%d, %s)\n",s_type,ref_basis_name);
@@ -52,6 +52,11 @@ You should have received a copy of the GNU General Public License along with DPG
 #define OP_T_UNUSED 9999 ///< Name to be used when the operator type is not used.
 ///\}
 
+///\{ \name Sparse operator parameters.
+#define OP_CSR_DENSITY_MAX 0.3   ///< Maximum fraction of non-zero entries for which the CSR operator is stored.
+#define OP_CSR_TOL         1e-14 ///< Tolerance below which operator entries are treated as zero.
+///\}
+
 // Operator Range Options ******************************************************************************************* //
 
 ///\{ \name Invalid operator index
@@ -90,6 +95,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define OP_R_P_P1    17 ///< Order = p_reference to 1.
 #define OP_R_P_PM0   13 ///< Order = p_reference +/- 0.
 #define OP_R_P_PM1   14 ///< Order = p_reference +/- 1.
+#define OP_R_P_LPM1  18 ///< Order = p_reference +/- 1 including the (l)ower orders (min(1,p_min):p_max).
 #define OP_R_P_ALL   15 ///< Order = p_min:p_max.
 ///\}
 
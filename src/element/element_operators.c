@@ -42,6 +42,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "nodes_correspondence.h"
 #include "nodes_operators.h"
 #include "operator.h"
+#include "operator_cache.h"
 #include "simulation.h"
 
 // Static function declarations ************************************************************************************* //
@@ -140,9 +141,10 @@ static int extract_p_g_fixed
 	(const char* geom_rep ///< \ref Simulation::geom_rep.
 	);
 
-/// \brief Transpose the computed operators.
+/// \brief Transpose the computed operators in the input index range.
 static void transpose_operators
-	(struct Multiarray_Operator* op ///< Multiarray of operators.
+	(struct Multiarray_Operator* op, ///< Multiarray of operators.
+	 const ptrdiff_t ind_range[2]    ///< The range [begin,end) of the indices of the operators.
 	);
 
 /** \brief Return the names of the basis types to use for the constructor in \ref constructor_operators_bt.
@@ -186,6 +188,56 @@ static bool op_should_use_L2
 	 const struct Operator_Info*const op_info ///< Standard.
 		);
 
+/** \brief Set the operators corresponding to the input row of \ref Operator_Info::values_op (i.e. those for all values
+ *         of the differentiation index) using \ref Operator_Info::set_operator or from the operator cache.
+ *
+ *  The operators are transposed if required. See \ref operator_cache.h for the operator cache.
+ */
+static void set_operators_row
+	(ptrdiff_t ind_range[2],                    ///< Set to the range [begin,end) of the indices of the operators.
+	 ptrdiff_t*const ind_values,                ///< Defined for \ref set_operator_fptr. Incremented past the row(s).
+	 const struct Multiarray_Operator*const op, ///< Defined for \ref set_operator_fptr.
+	 const struct Operator_Info*const op_info,  ///< Defined for \ref set_operator_fptr.
+	 const struct Simulation*const sim          ///< Defined for \ref set_operator_fptr.
+	);
+
+/// Container for the data required for the lazy construction of the operators (see \ref constructor_operators_lazy).
+struct Operator_Info_Lazy {
+	struct Operator_Info* op_info; ///< \ref Operator_Info.
+	const struct Simulation* sim;  ///< \ref Simulation.
+
+	/** \ref Element::type. The \ref Operator_Info::element is reset before constructing the operators as the element
+	 *  list is reallocated whenever derived elements are constructed. */
+	int e_type;
+
+	/// The index of the first row of \ref Operator_Info::values_op used to set each operator (-1 if not set).
+	ptrdiff_t* ind_values;
+};
+
+/** \brief Constructor for the \ref Operator_Info_Lazy::ind_values member.
+ *  \return See brief. */
+static ptrdiff_t* constructor_ind_values_lazy
+	(const struct Operator_Info*const op_info, ///< \ref Operator_Info.
+	 const struct Multiarray_Operator*const op ///< The multiarray of operators.
+	);
+
+/** \brief Version of \ref construct_operators_lazy_fptr for operators set using \ref Operator_Info::set_operator.
+ *
+ *  All of the operators set by a single call to \ref Operator_Info::set_operator (i.e. those for all values of the
+ *  differentiation index) are constructed.
+ */
+static void construct_operators_lazy
+	(ptrdiff_t ind_range[2],                    ///< See brief.
+	 const struct Multiarray_Operator*const op, ///< See brief.
+	 const ptrdiff_t ind,                       ///< See brief.
+	 void*const data                            ///< See brief.
+	);
+
+/// \brief Version of \ref destructor_lazy_data_fptr for \ref Operator_Info_Lazy.
+static void destructor_Operator_Info_Lazy
+	(void*const data ///< See brief.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 const struct Multiarray_Operator* constructor_operators
@@ -199,16 +251,39 @@ const struct Multiarray_Operator* constructor_operators
 	const struct Multiarray_Operator* op = constructor_empty_Multiarray_Operator_V(op_info->extents_op); // returned
 
 	const ptrdiff_t row_max = op_info->values_op->ext_0;
-	for (ptrdiff_t row = 0; row < row_max; ) // row is incremented when setting the operators.
-		op_info->set_operator(&row,op,op_info,sim);
+	for (ptrdiff_t row = 0; row < row_max; ) { // row is incremented when setting the operators.
+		ptrdiff_t ind_range[2];
+		set_operators_row(ind_range,&row,op,op_info,sim);
+	}
 
-	if (op_info->transpose)
-		transpose_operators((struct Multiarray_Operator*)op);
+	if (get_set_op_format(0) == 'c')
+		set_operators_csr((struct Multiarray_Operator*)op,(ptrdiff_t[]){0,compute_size(op->order,op->extents)});
 	destructor_Operator_Info(op_info);
 
 	return op;
 }
 
+const struct Multiarray_Operator* constructor_operators_lazy
+	(const char*const name_type, const char*const name_in, const char*const name_out, const char*const name_range,
+	 const struct const_Element* element, const struct Simulation* sim)
+{
+	struct Operator_Info* op_info =
+		constructor_Operator_Info(name_type,name_in,name_out,name_range,element,sim); // destructed (with op)
+	assert((op_info->range_d == OP_R_D_0) || (op_info->range_d == OP_R_D_ALL));
+
+	const struct Multiarray_Operator* op = constructor_empty_Multiarray_Operator_V(op_info->extents_op); // returned
+
+	struct Operator_Info_Lazy* op_info_l = malloc(sizeof *op_info_l); // destructed (with op)
+	op_info_l->op_info    = op_info;
+	op_info_l->sim        = sim;
+	op_info_l->e_type     = element->type;
+	op_info_l->ind_values = constructor_ind_values_lazy(op_info,op); // destructed (with op)
+
+	set_lazy_Multiarray_Operator(op,op_info_l,construct_operators_lazy,destructor_Operator_Info_Lazy);
+
+	return op;
+}
+
 const struct const_Multiarray_Vector_i* constructor_operators_nc
 	(const char*const name_in, const char*const name_out, const char*const name_range,
 	 const struct const_Element* element, const struct Simulation* sim)
@@ -278,6 +353,12 @@ const struct Multiarray_Operator* constructor_operators_bt
 	const ptrdiff_t row_max = op_info->values_op->ext_0;
 	for (ptrdiff_t row = 0; row < row_max; ++row) {
 		const int* op_values = get_row_const_Matrix_i(row,op_info->values_op);
+
+		const ptrdiff_t ind_op = get_ind_op(op_info,op_values,op),
+		                ind_range[2] = { ind_op, ind_op+1, };
+		if (set_operators_from_cache(op,ind_range,row,op_info,basis_type,sim))
+			continue;
+
 		set_current_op_io(op_info,op_values);
 
 		const struct Op_IO* op_io = op_info->op_io;
@@ -292,8 +373,8 @@ const struct Multiarray_Operator* constructor_operators_bt
 		destructor_const_Matrix_d(cv_i);
 		destructor_const_Matrix_d(cv_o);
 
-		ptrdiff_t ind_op = get_ind_op(op_info,op_values,op);
 		const_constructor_move_const_Matrix_d(&op->data[ind_op]->op_std,op_io0);
+		write_operators_to_cache(op,ind_range,row,op_info,basis_type,sim);
 	}
 	destructor_Operator_Info(op_info);
 
@@ -353,7 +434,7 @@ const struct Multiarray_Operator* constructor_operators_tens3
 
 	for (ptrdiff_t sz = 0; sz < size; sz++) {
 		const ptrdiff_t ind_op_r = compute_index_sub_container(order,0,extents,counter);
-		const struct const_Matrix_d* op_r_M_ptr = op_r->data[ind_op_r]->op_std;
+		const struct const_Matrix_d* op_r_M_ptr = get_Multiarray_Operator_ind(op_r,ind_op_r)->op_std;
 		if (op_r_M_ptr == NULL) {
 			increment_counter_MaO(order,extents,counter);
 			continue;
@@ -366,7 +447,7 @@ const struct Multiarray_Operator* constructor_operators_tens3
 		const int ind_c = order-order_l;
 		const ptrdiff_t ind_op_l = compute_index_sub_container(order_l,0,extents_l,&counter[ind_c]);
 
-		const struct const_Matrix_d* op_l_M_ptr = op_l->data[ind_op_l]->op_std;
+		const struct const_Matrix_d* op_l_M_ptr = get_Multiarray_Operator_ind(op_l,ind_op_l)->op_std;
 		assert(op_l_M_ptr != NULL);
 
 		const struct const_Matrix_d*const op_l_M = constructor_copy_const_Matrix_d(op_l_M_ptr); // destructed
@@ -569,6 +650,26 @@ const struct const_Vector_i* constructor_indices_Vector_i
 	return (const struct const_Vector_i*)indices;
 }
 
+void set_operators_csr (struct Multiarray_Operator* op, const ptrdiff_t ind_range[2])
+{
+	for (ptrdiff_t i = ind_range[0]; i < ind_range[1]; ++i) {
+		struct mutable_Operator* op_i = (struct mutable_Operator*) op->data[i];
+		if (!op_i->op_std)
+			continue;
+
+		const struct const_Matrix_d*const op_std = (const struct const_Matrix_d*) op_i->op_std;
+		struct Matrix_CSR_d* op_csr = constructor_sparse_Matrix_CSR_d(op_std,OP_CSR_TOL); // moved/destructed
+
+		const double density = op_csr->row_index[op_csr->ext_0]/(double)(op_std->ext_0*op_std->ext_1);
+		if (density <= OP_CSR_DENSITY_MAX) {
+			op_i->op_csr     = op_csr;
+			op_i->op_csr_mkl = constructor_sparse_matrix_mkl((struct const_Matrix_CSR_d*)op_csr); // destructed
+		} else {
+			destructor_Matrix_CSR_d(op_csr);
+		}
+	}
+}
+
 int compute_super_type_op (const char ce, const int h_op, const struct const_Element* element)
 {
 	const int sub_e_type = compute_elem_type_sub_ce(element->type,ce,h_op);
@@ -884,6 +985,8 @@ static int convert_to_range (const char type_range, const char*const name_range)
 			return OP_R_P_PM0;
 		else if (strstr(name_range,"P_PM1"))
 			return OP_R_P_PM1;
+		else if (strstr(name_range,"P_LPM1"))
+			return OP_R_P_LPM1;
 		else if (strstr(name_range,"P_ALL"))
 			return OP_R_P_ALL;
 		else
@@ -1005,6 +1108,7 @@ static void set_up_extents (struct Operator_Info* op_info)
 			break;
 		case OP_R_P_PM0:   // fallthrough
 		case OP_R_P_PM1:   // fallthrough
+		case OP_R_P_LPM1:  // fallthrough
 		case OP_R_P_ALL:
 			push_back_Vector_i(extents_op,op_info->p_ref[1]+1,false,false);
 			push_back_Vector_i(extents_op,op_info->p_ref[1]+1,false,false);
@@ -1083,10 +1187,9 @@ static int extract_p_g_fixed (const char* geom_rep)
 }
 
 
-static void transpose_operators (struct Multiarray_Operator* op)
+static void transpose_operators (struct Multiarray_Operator* op, const ptrdiff_t ind_range[2])
 {
-	const ptrdiff_t size = compute_size(op->order,op->extents);
-	for (ptrdiff_t i = 0; i < size; ++i) {
+	for (ptrdiff_t i = ind_range[0]; i < ind_range[1]; ++i) {
 		struct Matrix_d* op_std = (struct Matrix_d*) op->data[i]->op_std;
 		if (!op_std)
 			continue;
@@ -1104,6 +1207,9 @@ static const int* get_basis_types (const char* name_type, const struct Simulatio
 	} else if (strstr(name_type,"BS")) {
 		basis_type[0] = BASIS_BEZIER;
 		basis_type[1] = get_basis_i_from_s(sim->basis_sol);
+	} else if (strstr(name_type,"GB")) {
+		basis_type[0] = get_basis_i_from_s(sim->basis_geom);
+		basis_type[1] = BASIS_BEZIER;
 	} else {
 		EXIT_ADD_SUPPORT;
 	}
@@ -1224,6 +1330,78 @@ static bool op_should_use_L2 (const int*const op_values, const struct Operator_I
 	return false;
 }
 
+static void set_operators_row
+	(ptrdiff_t ind_range[2], ptrdiff_t*const ind_values, const struct Multiarray_Operator*const op,
+	 const struct Operator_Info*const op_info, const struct Simulation*const sim)
+{
+	const ptrdiff_t row  = *ind_values;
+	const int* op_values = get_row_const_Matrix_i(row,op_info->values_op);
+	const int n_op       = get_n_op(op_info->range_d,op_info->element->d);
+
+	ind_range[0] = get_ind_op(op_info,op_values,op);
+	ind_range[1] = ind_range[0]+n_op;
+
+	if (set_operators_from_cache(op,ind_range,row,op_info,NULL,sim)) {
+		*ind_values += n_op;
+		return;
+	}
+
+	op_info->set_operator(ind_values,op,op_info,sim);
+	assert(*ind_values == row+n_op);
+
+	if (op_info->transpose)
+		transpose_operators((struct Multiarray_Operator*)op,ind_range);
+	write_operators_to_cache(op,ind_range,row,op_info,NULL,sim);
+}
+
+static ptrdiff_t* constructor_ind_values_lazy
+	(const struct Operator_Info*const op_info, const struct Multiarray_Operator*const op)
+{
+	const ptrdiff_t size = compute_size(op->order,op->extents);
+	ptrdiff_t*const ind_values = malloc((size_t)size * sizeof *ind_values); // returned
+	for (ptrdiff_t i = 0; i < size; ++i)
+		ind_values[i] = -1;
+
+	const int n_op = get_n_op(op_info->range_d,op_info->element->d);
+	const ptrdiff_t row_max = op_info->values_op->ext_0;
+	for (ptrdiff_t row = 0; row < row_max; row += n_op) {
+		const int* op_values   = get_row_const_Matrix_i(row,op_info->values_op);
+		const ptrdiff_t ind_op = get_ind_op(op_info,op_values,op);
+		for (int i = 0; i < n_op; ++i)
+			ind_values[ind_op+i] = row;
+	}
+	return ind_values;
+}
+
+static void construct_operators_lazy
+	(ptrdiff_t ind_range[2], const struct Multiarray_Operator*const op, const ptrdiff_t ind, void*const data)
+{
+	const struct Operator_Info_Lazy*const op_info_l = data;
+	const struct Simulation*const sim = op_info_l->sim;
+
+	struct Operator_Info*const op_info = op_info_l->op_info;
+	op_info->element = get_element_by_type(sim->elements,op_info_l->e_type);
+
+	ptrdiff_t row = op_info_l->ind_values[ind];
+	if (row == -1) { // Operator not included in the range (also not set by constructor_operators).
+		ind_range[0] = ind;
+		ind_range[1] = ind+1;
+		return;
+	}
+
+	set_operators_row(ind_range,&row,op,op_info,sim);
+	if (get_set_op_format(0) == 'c')
+		set_operators_csr((struct Multiarray_Operator*)op,ind_range);
+}
+
+static void destructor_Operator_Info_Lazy (void*const data)
+{
+	struct Operator_Info_Lazy*const op_info_l = data;
+	destructor_Operator_Info(op_info_l->op_info);
+	free(op_info_l->ind_values);
+	free(op_info_l);
+}
+
 // Level 1 ********************************************************************************************************** //
 
 /** \brief Constructor for the \*c0_\*\*\*_\*\*\* operator from input to output computational element.
@@ -1636,6 +1814,10 @@ static void compute_range (int x_mm[2], const struct Operator_Info* op_info, con
 			x_mm[0] = op_info->p_ref[0];
 			x_mm[1] = op_info->p_ref[1]+1;
 			break;
+		case OP_R_P_LPM1:
+			x_mm[0] = GSL_MIN(1,op_info->p_ref[0]);
+			x_mm[1] = op_info->p_ref[1]+1;
+			break;
 		default:
 			EXIT_UNSUPPORTED;
 			break;
@@ -1668,6 +1850,10 @@ static void compute_range_p_o (int p_o_mm[2], const struct Operator_Info* op_inf
 		p_o_mm[0] = GSL_MAX(p_i-1,p_ref[0]);
 		p_o_mm[1] = GSL_MIN(p_i+1,p_ref[1])+1;
 		break;
+	case OP_R_P_LPM1:
+		p_o_mm[0] = GSL_MAX(p_i-1,GSL_MIN(1,p_ref[0]));
+		p_o_mm[1] = GSL_MIN(p_i+1,p_ref[1])+1;
+		break;
 	case OP_R_P_1PPM1:
 		p_o_mm[0] = GSL_MAX(p_ref[0]-1,p_ref[0]);
 		p_o_mm[1] = GSL_MIN(p_ref[1]+1,p_ref[1])+1;
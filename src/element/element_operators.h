@@ -30,7 +30,7 @@ You should have received a copy of the GNU General Public License along with DPG
  *  	- cvcv: 3-tensor of standard cv operator multiplied by each column of another cv operator.
  *  	        See \ref constructor_operators_tens3.
  *  (t): Optional 't'ranspose.
- *  (i): Optional 'i'nput basis. Options: 'S'olution, 'B'ezier.
+ *  (i): Optional 'i'nput basis. Options: 'S'olution, 'G'eometry, 'B'ezier.
  *  (o): Optional 'o'output basis. Options: 'S'olution, 'B'ezier.
  *
  *  \note For collocated schemes, `tw` operators also include premultiplication by the inverse weights.
@@ -162,6 +162,24 @@ const struct Multiarray_Operator* constructor_operators
 	 const struct Simulation* sim         ///< \ref Simulation.
 	);
 
+/** \brief Version of \ref constructor_operators for which the operators are only constructed when first accessed (see
+ *         \ref Lazy_Operators).
+ *  \return See brief.
+ *
+ *  This avoids the construction of the (potentially large number of) operators for the polynomial degrees and
+ *  h-refinement indices in the operator range which are not used in the simulation.
+ *
+ *  \warning The \ref Simulation must remain valid for the lifetime of the returned \ref Multiarray_Operator\*.
+ */
+const struct Multiarray_Operator* constructor_operators_lazy
+	(const char*const name_type,          ///< Defined for \ref constructor_operators.
+	 const char*const name_in,            ///< Defined for \ref constructor_operators.
+	 const char*const name_out,           ///< Defined for \ref constructor_operators.
+	 const char*const name_range,         ///< Defined for \ref constructor_operators.
+	 const struct const_Element* element, ///< Defined for \ref constructor_operators.
+	 const struct Simulation* sim         ///< Defined for \ref constructor_operators.
+	);
+
 /** \brief Constructor for a \ref const_Multiarray_Vector_T\* of 'n'ode 'c'orrespondence vectors.
  *  \return See brief. */
 const struct const_Multiarray_Vector_i* constructor_operators_nc
@@ -242,6 +260,16 @@ const struct const_Vector_i* constructor_indices_Vector_i
 	 const bool*const indices_skip ///< Indices to skip (if not NULL).
 	);
 
+/** \brief Set the sparse (CSR) versions of the computed operators (\ref Operator::op_csr) in the input index range if
+ *         they are sufficiently sparse (see \ref OP_CSR_DENSITY_MAX).
+ *
+ *  The associated mkl handles (\ref Operator::op_csr_mkl) are constructed at the same time such that they are not
+ *  recreated for each operator application. */
+void set_operators_csr
+	(struct Multiarray_Operator* op, ///< Multiarray of operators.
+	 const ptrdiff_t ind_range[2]    ///< The range [begin,end) of the indices of the operators.
+	);
+
 /** \brief Compute the super type of the nodes based on the kind of operator.
  *  \return See brief. */
 int compute_super_type_op
@@ -124,6 +124,8 @@ const struct Multiarray_Operator* constructor_operators_tp
 			const_constructor_move_const_Matrix_d(&op->data[ind_op]->ops_tp->data[i],sub_op_info.sub_op_Md[i]);
 	}
 	construct_operators_std(op);
+	if (get_set_op_format(0) == 'c')
+		set_operators_csr((struct Multiarray_Operator*)op,(ptrdiff_t[]){0,compute_size(op->order,op->extents)});
 
 	destructor_Operator_Info(op_info);
 
@@ -401,7 +403,7 @@ static void set_ops_Md
 		const int ind_sub_op = (int)compute_index_sub_container_pi(op_MO[i]->order,0,op_MO[i]->extents,inds_op->data);
 		destructor_const_Vector_i(inds_op);
 
-		op_Md[i] = op_MO[i]->data[ind_sub_op]->op_std;
+		op_Md[i] = get_Multiarray_Operator_ind(op_MO[i],ind_sub_op)->op_std;
 	}
 	destructor_Matrix_i(sub_op_values);
 }
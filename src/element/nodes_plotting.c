@@ -44,6 +44,13 @@ You should have received a copy of the GNU General Public License along with DPG
 #define VTK_POLY_LINE  4
 ///\}
 
+///\{ \name Values of VTK Lagrange cell types.
+#define VTK_LAGRANGE_CURVE         68
+#define VTK_LAGRANGE_TRIANGLE      69
+#define VTK_LAGRANGE_QUADRILATERAL 70
+#define VTK_LAGRANGE_HEXAHEDRON    72
+///\}
+
 /** \brief Sets up (and allocates memory for) coordinates and connectivity information of plotting nodes.
  *  This function needs modernizing.
  */
@@ -61,6 +68,19 @@ static void plotting_element_info
 	 const int e_type ///< \ref Element::type.
 	);
 
+/** \brief Constructor for the connectivity of the VTK Lagrange cell of the input order and element type.
+ *  \return See brief; `NULL` if Lagrange cells are not supported for the element type.
+ *
+ *  The entries are the indices of the plotting nodes in the order expected by VTK: the vertices, the edge nodes, the
+ *  face nodes and finally the interior nodes. Lagrange cells are currently not supported for the TET, WEDGE and PYR
+ *  elements for which the sub-elements of \ref Plotting_Nodes::connect are used.
+ */
+static struct Vector_i* constructor_connect_lagrange
+	(const int p,          ///< The order of the plotting nodes.
+	 const int e_type,     ///< \ref Element::type.
+	 int*const vtk_type_l ///< Set to the index of the VTK Lagrange cell type.
+	);
+
 /** \brief Get the number of corners of the element of the input vtk_type.
  *  \return See brief. */
 static int get_vtk_n_corners
@@ -129,6 +149,20 @@ const struct const_Plotting_Nodes* constructor_const_Plotting_Nodes (const int p
 	p_nodes->vtk_types_e = constructor_empty_Vector_i(n_edge); // destructed
 	set_to_value_Vector_i(p_nodes->vtk_types_e,VTK_POLY_LINE);
 
+	int vtk_type_l = -1;
+	struct Vector_i* connect_l = constructor_connect_lagrange(p_p,e_type,&vtk_type_l); // moved
+	if (connect_l) {
+		struct Vector_i** data_conn_l = malloc(1 * sizeof *data_conn_l); // keep
+		data_conn_l[0] = connect_l;
+
+		ptrdiff_t* exts_conn_l = malloc(1 * sizeof *exts_conn_l); // keep
+		exts_conn_l[0] = 1;
+		p_nodes->connect_l = constructor_move_Multiarray_Vector_i_dyn_extents(1,exts_conn_l,true,data_conn_l); // dest.
+
+		p_nodes->vtk_types_l = constructor_empty_Vector_i(1); // destructed
+		set_to_value_Vector_i(p_nodes->vtk_types_l,vtk_type_l);
+	}
+
 	return (const struct const_Plotting_Nodes*) p_nodes;
 }
 
@@ -185,6 +219,34 @@ static int get_n_e_type
 	(const int e_type ///< \ref Element::type.
 	);
 
+/** \brief Get the index of the node in the VTK Lagrange node ordering of the tensor-product element of the input
+ *         dimension.
+ *  \return See brief.
+ *
+ *  This is a copy of the `PointIndexFromIJK` functions of the VTK higher-order curve, quadrilateral and hexahedron
+ *  classes for elements of equal order in each direction.
+ */
+static int get_ind_lagrange_tp
+	(const int i, ///< The index of the node in the 1st direction.
+	 const int j, ///< The index of the node in the 2nd direction.
+	 const int k, ///< The index of the node in the 3rd direction.
+	 const int p, ///< The order.
+	 const int d  ///< The dimension.
+	);
+
+/** \brief Set the connectivity of the VTK Lagrange triangle.
+ *
+ *  The nodes are ordered as: the vertices, the edge nodes (counter-clockwise), followed by the interior nodes which are
+ *  ordered recursively as a triangle of order `n-3`.
+ */
+static void set_connect_lagrange_tri
+	(int*const connect, ///< The connectivity to be set.
+	 int*const ind,     ///< The index of the next entry of the connectivity.
+	 const int o,       ///< The offset of the first vertex of the current (sub-)triangle in each direction.
+	 const int n,       ///< The order of the current (sub-)triangle.
+	 const int p        ///< The order of the plotting nodes.
+	);
+
 static void destructor_Plotting_Nodes (struct Plotting_Nodes* p_nodes)
 {
 	destructor_Plotting_Nodes_part(p_nodes);
@@ -201,6 +263,10 @@ static void destructor_Plotting_Nodes_part (struct Plotting_Nodes* p_nodes)
 	destructor_Multiarray_Vector_i(p_nodes->connect_e);
 	destructor_Vector_i(p_nodes->vtk_types);
 	destructor_Vector_i(p_nodes->vtk_types_e);
+	if (p_nodes->connect_l) {
+		destructor_Multiarray_Vector_i(p_nodes->connect_l);
+		destructor_Vector_i(p_nodes->vtk_types_l);
+	}
 }
 
 static void plotting_element_info
@@ -887,6 +953,53 @@ static void plotting_element_info
 	}
 }
 
+static struct Vector_i* constructor_connect_lagrange (const int p, const int e_type, int*const vtk_type_l)
+{
+	const int n = p+1;
+
+	struct Vector_i* connect = NULL;
+	switch (e_type) {
+		case LINE:
+			*vtk_type_l = VTK_LAGRANGE_CURVE;
+			connect = constructor_empty_Vector_i(n); // returned
+			for (int i = 0; i < n; ++i)
+				connect->data[get_ind_lagrange_tp(i,0,0,p,1)] = i;
+			break;
+		case QUAD:
+			*vtk_type_l = VTK_LAGRANGE_QUADRILATERAL;
+			connect = constructor_empty_Vector_i(n*n); // returned
+			for (int j = 0; j < n; ++j) {
+			for (int i = 0; i < n; ++i) {
+				connect->data[get_ind_lagrange_tp(i,j,0,p,2)] = i+n*j;
+			}}
+			break;
+		case HEX:
+			*vtk_type_l = VTK_LAGRANGE_HEXAHEDRON;
+			connect = constructor_empty_Vector_i(n*n*n); // returned
+			for (int k = 0; k < n; ++k) {
+			for (int j = 0; j < n; ++j) {
+			for (int i = 0; i < n; ++i) {
+				connect->data[get_ind_lagrange_tp(i,j,k,p,3)] = i+n*(j+n*k);
+			}}}
+			break;
+		case TRI: {
+			*vtk_type_l = VTK_LAGRANGE_TRIANGLE;
+			connect = constructor_empty_Vector_i(n*(n+1)/2); // returned
+
+			int ind = 0;
+			set_connect_lagrange_tri(connect->data,&ind,0,p,p);
+			assert(ind == connect->ext_0);
+			break;
+		} case TET: case WEDGE: case PYR:
+			return NULL;
+			break;
+		default:
+			EXIT_ERROR("Unsupported: %d\n",e_type);
+			break;
+	}
+	return connect;
+}
+
 static int get_vtk_n_corners (const int vtk_type)
 {
 	switch (vtk_type) {
@@ -905,6 +1018,79 @@ static int get_vtk_n_corners (const int vtk_type)
 
 // Level 1 ********************************************************************************************************** //
 
+/** \brief Get the index of the triangle plotting node of the input barycentric lattice indices.
+ *  \return See brief. */
+static int get_ind_tri
+	(const int i, ///< The index in the direction of the 2nd vertex.
+	 const int j, ///< The index in the direction of the 3rd vertex.
+	 const int p  ///< The order of the plotting nodes.
+	);
+
+static int get_ind_lagrange_tp (const int i, const int j, const int k, const int p, const int d)
+{
+	const bool i_b = (i == 0 || i == p),
+	           j_b = (d < 2) || (j == 0 || j == p),
+	           k_b = (d < 3) || (k == 0 || k == p);
+	const int n_b = i_b + j_b + k_b,
+	          n_i = p-1;
+
+	if (n_b == 3) // Vertex
+		return (i ? (j ? 2 : 1) : (j ? 3 : 0)) + (k ? 4 : 0);
+
+	int offset = (d == 1 ? 2 : (d == 2 ? 4 : 8));
+	if (d == 1)
+		return offset + (i-1);
+
+	if (n_b == 2) { // Edge
+		if (!i_b)
+			return offset + (i-1) + (j ? 2*n_i : 0) + (k ? 4*n_i : 0);
+		if (!j_b)
+			return offset + (j-1) + (i ? n_i : 3*n_i) + (k ? 4*n_i : 0);
+		offset += 8*n_i;
+		return offset + (k-1) + n_i*(i ? (j ? 3 : 1) : (j ? 2 : 0));
+	}
+
+	offset += (d == 2 ? 4 : 12)*n_i;
+	if (d == 2)
+		return offset + (i-1) + n_i*(j-1);
+
+	if (n_b == 1) { // Face
+		if (i_b)
+			return offset + (j-1) + n_i*(k-1) + (i ? n_i*n_i : 0);
+		offset += 2*n_i*n_i;
+		if (j_b)
+			return offset + (i-1) + n_i*(k-1) + (j ? n_i*n_i : 0);
+		offset += 2*n_i*n_i;
+		return offset + (i-1) + n_i*(j-1) + (k ? n_i*n_i : 0);
+	}
+
+	offset += 6*n_i*n_i;
+	return offset + (i-1) + n_i*((j-1) + n_i*(k-1));
+}
+
+static void set_connect_lagrange_tri (int*const connect, int*const ind, const int o, const int n, const int p)
+{
+	if (n < 0)
+		return;
+
+	if (n == 0) {
+		connect[(*ind)++] = get_ind_tri(o,o,p);
+		return;
+	}
+
+	connect[(*ind)++] = get_ind_tri(o,  o,  p);
+	connect[(*ind)++] = get_ind_tri(o+n,o,  p);
+	connect[(*ind)++] = get_ind_tri(o,  o+n,p);
+	for (int m = 1; m < n; ++m)
+		connect[(*ind)++] = get_ind_tri(o+m,o,p);
+	for (int m = 1; m < n; ++m)
+		connect[(*ind)++] = get_ind_tri(o+n-m,o+m,p);
+	for (int m = 1; m < n; ++m)
+		connect[(*ind)++] = get_ind_tri(o,o+n-m,p);
+
+	set_connect_lagrange_tri(connect,ind,o+1,n-3,p);
+}
+
 static int get_n_e_type (const int e_type)
 {
 	switch (e_type) {
@@ -918,3 +1104,11 @@ static int get_n_e_type (const int e_type)
 		default: EXIT_ERROR("Unsupported: %d\n",e_type); break;
 	}
 }
+
+// Level 2 ********************************************************************************************************** //
+
+static int get_ind_tri (const int i, const int j, const int p)
+{
+	// The nodes are ordered by rows of constant `j`, each having `p+1-j` nodes.
+	return j*(p+1) - (j*(j-1))/2 + i;
+}
@@ -37,6 +37,13 @@ struct Plotting_Nodes {
 
 	/// Indices equal to the polyline VTK element type used by paraview. Edges are always represented by polylines.
 	struct Vector_i* vtk_types_e;
+
+	/** The node connectivity of the single VTK Lagrange cell representing the element (i.e. the plotting nodes in the
+	 *  VTK Lagrange node ordering). `NULL` for element types for which Lagrange cells are not supported. */
+	struct Multiarray_Vector_i* connect_l;
+
+	/// The index of the VTK Lagrange cell type (`NULL` if \ref Plotting_Nodes::connect_l is `NULL`).
+	struct Vector_i* vtk_types_l;
 };
 
 /// `const` version of \ref Plotting_Nodes.
@@ -48,6 +55,9 @@ struct const_Plotting_Nodes {
 
 	const struct const_Vector_i*const vtk_types;   ///< Defined in \ref Plotting_Nodes.
 	const struct const_Vector_i*const vtk_types_e; ///< Defined in \ref Plotting_Nodes.
+
+	const struct const_Multiarray_Vector_i*const connect_l; ///< Defined in \ref Plotting_Nodes.
+	const struct const_Vector_i*const vtk_types_l;          ///< Defined in \ref Plotting_Nodes.
 };
 
 // Constructor functions ******************************************************************************************** //
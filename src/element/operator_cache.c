@@ -0,0 +1,315 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "operator_cache.h"
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "macros.h"
+#include "definitions_alloc.h"
+#include "definitions_core.h"
+#include "definitions_element_operators.h"
+
+#include "matrix.h"
+
+#include "element.h"
+#include "element_operators.h"
+
+#include "mapped_file.h"
+#include "multiarray_operator.h"
+#include "operator.h"
+#include "simulation.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define OP_CACHE_VERSION 1  ///< The version of the cache format. **Must** be incremented if operators are changed.
+#define OP_CACHE_N_KEY   24 ///< The number of entries of the key identifying an operator.
+#define OP_CACHE_ALIGN   64 ///< The alignment (in bytes) of the operator data relative to the start of the file.
+
+/// The string identifying operator cache files.
+static const char op_cache_magic[8] = { 'D','P','G','O','P','C','\0','\0', };
+
+/// Container for the header of the operator cache files.
+struct Operator_Cache_Header {
+	char magic[8]; ///< \ref op_cache_magic.
+	int version;   ///< \ref OP_CACHE_VERSION.
+
+	int key[OP_CACHE_N_KEY]; ///< The key identifying the operator.
+	uint64_t hash_sim;       ///< The hash of the \ref Simulation parameters influencing the operator.
+
+	char layout;   ///< \ref Matrix_T::layout.
+	int64_t ext_0, ///< \ref Matrix_T::ext_0.
+	        ext_1; ///< \ref Matrix_T::ext_1.
+};
+
+/// The offset (in bytes) of the operator data from the start of the file.
+#define OP_CACHE_OFFSET \
+	((sizeof(struct Operator_Cache_Header)+OP_CACHE_ALIGN-1)/OP_CACHE_ALIGN*OP_CACHE_ALIGN)
+
+/** \brief Check whether the operator cache is being used.
+ *  \return See brief. */
+static bool using_operator_cache ( );
+
+/** \brief Compute the hash of the \ref Simulation parameters which influence the operators.
+ *  \return See brief. */
+static uint64_t compute_hash_sim
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/// \brief Set the key identifying the operator corresponding to the input row of \ref Operator_Info::values_op.
+static void set_op_cache_key
+	(int key[OP_CACHE_N_KEY],                  ///< To hold the key.
+	 const ptrdiff_t row,                      ///< The row of \ref Operator_Info::values_op.
+	 const struct Operator_Info*const op_info, ///< \ref Operator_Info.
+	 const int*const basis_type                ///< Defined for \ref set_operators_from_cache.
+	);
+
+/// \brief Set the name of the operator cache file for the input key.
+static void set_op_cache_file_name
+	(char*const file_name,          ///< To hold the file name. Must have size STRLEN_MAX.
+	 const int key[OP_CACHE_N_KEY], ///< The key.
+	 const uint64_t hash_sim        ///< The value returned by \ref compute_hash_sim.
+	);
+
+/** \brief Set the \ref Operator::op_std from the operator cache if present.
+ *  \return `true` if the operator was set; `false` otherwise. */
+static bool set_operator_from_cache
+	(struct mutable_Operator*const op, ///< The operator.
+	 const int key[OP_CACHE_N_KEY],    ///< The key.
+	 const uint64_t hash_sim           ///< The value returned by \ref compute_hash_sim.
+	);
+
+/// \brief Write the \ref Operator::op_std to the operator cache.
+static void write_operator_to_cache
+	(const struct Operator*const op, ///< The operator.
+	 const int key[OP_CACHE_N_KEY],  ///< The key.
+	 const uint64_t hash_sim         ///< The value returned by \ref compute_hash_sim.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+bool set_operators_from_cache
+	(const struct Multiarray_Operator*const op, const ptrdiff_t ind_range[2], const ptrdiff_t row,
+	 const struct Operator_Info*const op_info, const int*const basis_type, const struct Simulation*const sim)
+{
+	if (!using_operator_cache())
+		return false;
+
+	const uint64_t hash_sim = compute_hash_sim(sim);
+	for (ptrdiff_t i = ind_range[0]; i < ind_range[1]; ++i) {
+		int key[OP_CACHE_N_KEY];
+		set_op_cache_key(key,row+(i-ind_range[0]),op_info,basis_type);
+
+		struct mutable_Operator*const op_i = (struct mutable_Operator*) op->data[i];
+		assert(op_i->op_std == NULL);
+		if (set_operator_from_cache(op_i,key,hash_sim))
+			continue;
+
+		// Remove any operators which were already set such that the full range is recomputed.
+		for (ptrdiff_t j = ind_range[0]; j < i; ++j) {
+			struct mutable_Operator*const op_j = (struct mutable_Operator*) op->data[j];
+			destructor_Matrix_d(op_j->op_std);
+			destructor_Mapped_File(op_j->op_std_map);
+			op_j->op_std     = NULL;
+			op_j->op_std_map = NULL;
+		}
+		return false;
+	}
+	return true;
+}
+
+void write_operators_to_cache
+	(const struct Multiarray_Operator*const op, const ptrdiff_t ind_range[2], const ptrdiff_t row,
+	 const struct Operator_Info*const op_info, const int*const basis_type, const struct Simulation*const sim)
+{
+	if (!using_operator_cache())
+		return;
+
+	const uint64_t hash_sim = compute_hash_sim(sim);
+	for (ptrdiff_t i = ind_range[0]; i < ind_range[1]; ++i) {
+		int key[OP_CACHE_N_KEY];
+		set_op_cache_key(key,row+(i-ind_range[0]),op_info,basis_type);
+		write_operator_to_cache(op->data[i],key,hash_sim);
+	}
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/// \brief Update the FNV-1a hash with the input bytes.
+static void update_hash
+	(uint64_t*const hash, ///< The hash.
+	 const void*const b,  ///< The bytes.
+	 const size_t n_b     ///< The number of bytes.
+	);
+
+static bool using_operator_cache ( )
+{
+	return get_set_op_cache_dir(NULL)[0] != '\0';
+}
+
+static uint64_t compute_hash_sim (const struct Simulation*const sim)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (int i = 0; i < N_ST_STD; ++i) {
+		update_hash(&hash,sim->nodes_interp[i],strlen(sim->nodes_interp[i])+1);
+		update_hash(&hash,sim->geom_blending[i],strlen(sim->geom_blending[i])+1);
+	}
+	update_hash(&hash,sim->basis_geom,strlen(sim->basis_geom)+1);
+	update_hash(&hash,sim->basis_sol,strlen(sim->basis_sol)+1);
+	update_hash(&hash,sim->geom_rep,strlen(sim->geom_rep)+1);
+
+	const int vals[] = { DIM, sim->method, sim->collocated, wedges_present(sim->elements),
+	                     sim->p_s_v_p, sim->p_s_f_p, sim->p_sg_v_p, sim->p_sg_f_p,
+	                     sim->p_c_x[0], sim->p_c_x[1], sim->p_c_p[0], sim->p_c_p[1], sim->p_t_p[0], sim->p_t_p[1], };
+	update_hash(&hash,vals,sizeof(vals));
+
+	return hash;
+}
+
+static void set_op_cache_key
+	(int key[OP_CACHE_N_KEY], const ptrdiff_t row, const struct Operator_Info*const op_info,
+	 const int*const basis_type)
+{
+	const int* op_values = get_row_const_Matrix_i(row,op_info->values_op);
+	const struct Op_IO* op_io = op_info->op_io;
+
+	int n = 0;
+	key[n++] = op_info->element->type;
+	key[n++] = op_info->op_type;
+	key[n++] = op_info->transpose;
+	key[n++] = op_info->range_d;
+	key[n++] = op_info->range_ce;
+	for (int i = 0; i < 2; ++i) {
+		key[n++] = op_io[i].ce;
+		key[n++] = op_io[i].kind;
+		key[n++] = op_io[i].sc;
+	}
+	for (int i = 0; i < OP_ORDER_MAX; ++i)
+		key[n++] = op_values[i];
+	for (int i = 0; i < 2; ++i)
+		key[n++] = ( basis_type ? basis_type[i] : -1 );
+
+	assert(n <= OP_CACHE_N_KEY);
+	while (n < OP_CACHE_N_KEY)
+		key[n++] = 0;
+}
+
+static void set_op_cache_file_name (char*const file_name, const int key[OP_CACHE_N_KEY], const uint64_t hash_sim)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	update_hash(&hash,key,OP_CACHE_N_KEY*sizeof(*key));
+	update_hash(&hash,&hash_sim,sizeof(hash_sim));
+
+	const int n_c = snprintf(file_name,STRLEN_MAX,"%s/op_%016" PRIx64 ".bin",get_set_op_cache_dir(NULL),hash);
+	if (n_c < 0 || n_c >= STRLEN_MAX)
+		EXIT_ERROR("The operator cache directory name is too long: %s.",get_set_op_cache_dir(NULL));
+}
+
+static bool set_operator_from_cache
+	(struct mutable_Operator*const op, const int key[OP_CACHE_N_KEY], const uint64_t hash_sim)
+{
+	char file_name[STRLEN_MAX];
+	set_op_cache_file_name(file_name,key,hash_sim);
+
+	const struct Mapped_File*const mapped_file = constructor_Mapped_File(file_name); // moved
+	if (mapped_file == NULL)
+		return false;
+
+	bool valid = (mapped_file->size >= OP_CACHE_OFFSET);
+	const struct Operator_Cache_Header*const header = mapped_file->data;
+	if (valid) {
+		valid = (memcmp(header->magic,op_cache_magic,sizeof(op_cache_magic)) == 0) &&
+		        (header->version == OP_CACHE_VERSION) &&
+		        (memcmp(header->key,key,OP_CACHE_N_KEY*sizeof(*key)) == 0) &&
+		        (header->hash_sim == hash_sim) &&
+		        (header->ext_0 >= 0 && header->ext_1 >= 0) &&
+		        (mapped_file->size == OP_CACHE_OFFSET+(size_t)(header->ext_0*header->ext_1)*sizeof(double));
+	}
+	if (!valid) {
+		destructor_Mapped_File(mapped_file);
+		return false;
+	}
+
+	const double*const data = (const double*) BYTE_ADD(mapped_file->data,OP_CACHE_OFFSET);
+	op->op_std     = (struct Matrix_d*) constructor_move_const_Matrix_d_d(
+		header->layout,(ptrdiff_t)header->ext_0,(ptrdiff_t)header->ext_1,false,data); // destructed
+	op->op_std_map = mapped_file;
+
+	return true;
+}
+
+static void write_operator_to_cache
+	(const struct Operator*const op, const int key[OP_CACHE_N_KEY], const uint64_t hash_sim)
+{
+	const struct const_Matrix_d*const op_std = op->op_std;
+	if (op_std == NULL || op->op_std_map != NULL)
+		return;
+
+	char file_name[STRLEN_MAX],
+	     file_name_tmp[STRLEN_MAX+32];
+	set_op_cache_file_name(file_name,key,hash_sim);
+	sprintf(file_name_tmp,"%s.%ld.tmp",file_name,(long)getpid());
+
+	FILE* file = fopen(file_name_tmp,"wb");
+	if (file == NULL) {
+		// Try to create the cache directory once; failure to write to the cache is not an error.
+		mkdir(get_set_op_cache_dir(NULL),0777);
+		file = fopen(file_name_tmp,"wb");
+		if (file == NULL)
+			return;
+	}
+
+	char buffer[OP_CACHE_OFFSET];
+	memset(buffer,0,sizeof(buffer));
+
+	struct Operator_Cache_Header header;
+	memset(&header,0,sizeof(header));
+	memcpy(header.magic,op_cache_magic,sizeof(op_cache_magic));
+	header.version = OP_CACHE_VERSION;
+	memcpy(header.key,key,OP_CACHE_N_KEY*sizeof(*key));
+	header.hash_sim = hash_sim;
+	header.layout   = op_std->layout;
+	header.ext_0    = op_std->ext_0;
+	header.ext_1    = op_std->ext_1;
+	memcpy(buffer,&header,sizeof(header));
+
+	const size_t n_data = (size_t)(op_std->ext_0*op_std->ext_1);
+	const bool written = (fwrite(buffer,1,sizeof(buffer),file) == sizeof(buffer)) &&
+	                     (fwrite(op_std->data,sizeof(*op_std->data),n_data,file) == n_data);
+
+	// Renaming is atomic such that concurrent runs never map partially written files.
+	if ((fclose(file) != 0) || !written || (rename(file_name_tmp,file_name) != 0))
+		remove(file_name_tmp);
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static void update_hash (uint64_t*const hash, const void*const b, const size_t n_b)
+{
+	const unsigned char*const bytes = b;
+	for (size_t i = 0; i < n_b; ++i) {
+		*hash ^= bytes[i];
+		*hash *= 1099511628211ULL;
+	}
+}
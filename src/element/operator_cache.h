@@ -0,0 +1,64 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__operator_cache_h__INCLUDED
+#define DPG__operator_cache_h__INCLUDED
+/** \file
+ *  \brief Provides an on-disk cache of the reference element operators.
+ *
+ *  The cache is enabled by specifying the `op_cache_dir` in the control file (see \ref get_set_op_cache_dir). Each
+ *  operator is stored in a separate binary file in this directory, named according to a hash of the key identifying
+ *  the operator, which is written the first time that the operator is computed. Subsequent runs map the file
+ *  read-only (see \ref Mapped_File) and use the data directly as \ref Operator::op_std such that concurrent runs on
+ *  a node share the physical pages.
+ *
+ *  The key is composed of the element type, the \ref Operator_Info parameters, the row of
+ *  \ref Operator_Info::values_op (differentiation index, computational element, h-refinement and polynomial degree
+ *  indices) and a hash of all of the \ref Simulation parameters which influence the operators (basis and node types,
+ *  geometry representation, order offsets, ...). The full key and a version number are stored in the file header and
+ *  checked before use; files for which either does not match are recomputed and overwritten.
+ *
+ *  \warning Cached operators are mapped read-only and must not be modified in-place.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct Multiarray_Operator;
+struct Operator_Info;
+struct Simulation;
+
+/** \brief Set the operators in the input index range from the operator cache if all are present.
+ *  \return `true` if the operators were set; `false` otherwise (including when the cache is not used). */
+bool set_operators_from_cache
+	(const struct Multiarray_Operator*const op, ///< The multiarray of operators.
+	 const ptrdiff_t ind_range[2],              ///< The range [begin,end) of the indices of the operators.
+	 const ptrdiff_t row,                       ///< The row of \ref Operator_Info::values_op of the first operator.
+	 const struct Operator_Info*const op_info,  ///< \ref Operator_Info.
+	 const int*const basis_type,                ///< The basis types for 'b'asis 't'ransformation operators or `NULL`.
+	 const struct Simulation*const sim          ///< \ref Simulation.
+	);
+
+/// \brief Write the operators in the input index range to the operator cache (if used).
+void write_operators_to_cache
+	(const struct Multiarray_Operator*const op, ///< Defined for \ref set_operators_from_cache.
+	 const ptrdiff_t ind_range[2],              ///< Defined for \ref set_operators_from_cache.
+	 const ptrdiff_t row,                       ///< Defined for \ref set_operators_from_cache.
+	 const struct Operator_Info*const op_info,  ///< Defined for \ref set_operators_from_cache.
+	 const int*const basis_type,                ///< Defined for \ref set_operators_from_cache.
+	 const struct Simulation*const sim          ///< Defined for \ref set_operators_from_cache.
+	);
+
+#endif // DPG__operator_cache_h__INCLUDED
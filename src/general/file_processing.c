@@ -84,13 +84,20 @@ const char* extract_path (const char*const name_full)
 	const size_t len = strlen(name_full);
 
 	size_t path_len = len;
-	while (name_full[path_len] != '/')
+	while (path_len > 0 && name_full[path_len] != '/')
 		--path_len; // Do nothing
 
-	assert(path_len != len);
-	assert(path_len != 0);
-
 	static char name_path[STRLEN_MAX] = { 0, };
+	if (name_full[path_len] != '/') { // No path: the current directory.
+		strcpy(name_path,".");
+		return name_path;
+	} else if (path_len == 0) {
+		strcpy(name_path,"/");
+		return name_path;
+	}
+
+	assert(path_len != len);
+	assert(path_len < STRLEN_MAX);
 	for (size_t i = 0; i < path_len; ++i)
 		name_path[i] = name_full[i];
 	name_path[path_len] = 0;
@@ -28,7 +28,7 @@ You should have received a copy of the GNU General Public License along with DPG
 // Opening files **************************************************************************************************** //
 
 /** \brief Extract the path from the string input.
- *  \return The path (no free necessary). */
+ *  \return The path (no free necessary); "." if the input does not include a path. */
 const char* extract_path
 	(const char*const name_full ///< The full input.
 	);
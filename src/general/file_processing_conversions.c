@@ -21,11 +21,13 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <string.h>
 
 #include "macros.h"
+#include "definitions_adaptation.h"
 #include "definitions_alloc.h"
 #include "definitions_bc.h"
 #include "definitions_dpg.h"
 #include "definitions_opg.h"
 #include "definitions_geometry.h"
+#include "definitions_mesh.h"
 #include "definitions_physics.h"
 #include "definitions_numerical_flux.h"
 #include "definitions_solution.h"
@@ -86,6 +88,22 @@ static int get_define (const char*const def_str, const char*const def_type)
 	} else if (strcmp(def_type,"solver_type_i") == 0) {
 		if      (strcmp(def_str,"direct")    == 0) def_i = SOLVER_I_DIRECT;
 		else if (strcmp(def_str,"iterative") == 0) def_i = SOLVER_I_ITERATIVE;
+		else if (strcmp(def_str,"p_mg")      == 0) def_i = SOLVER_I_P_MG;
+		else
+			EXIT_ERROR("Unsupported: %s\n",def_str);
+	} else if (strcmp(def_type,"pmg_smoother") == 0) {
+		if      (strcmp(def_str,"block_jacobi") == 0) def_i = PMG_SMOOTHER_BLOCK_JACOBI;
+		else if (strcmp(def_str,"ilu")          == 0) def_i = PMG_SMOOTHER_ILU;
+		else
+			EXIT_ERROR("Unsupported: %s\n",def_str);
+	} else if (strcmp(def_type,"bc_hessian") == 0) {
+		if      (strcmp(def_str,"complex_step") == 0) def_i = BC_HESSIAN_CMPLX_STEP;
+		else if (strcmp(def_str,"jacobian_fd")  == 0) def_i = BC_HESSIAN_JACOBIAN_FD;
+		else
+			EXIT_ERROR("Unsupported: %s\n",def_str);
+	} else if (strcmp(def_type,"jfnk_method") == 0) {
+		if      (strcmp(def_str,"finite_difference") == 0) def_i = JFNK_FINITE_DIFF;
+		else if (strcmp(def_str,"complex_step")      == 0) def_i = JFNK_CMPLX_STEP;
 		else
 			EXIT_ERROR("Unsupported: %s\n",def_str);
 	} else if (strcmp(def_type,"lhs_terms") == 0) {
@@ -93,6 +111,12 @@ static int get_define (const char*const def_str, const char*const def_type)
 		else if (strcmp(def_str,"cfl_ramping") == 0) def_i = LHS_CFL_RAMPING;
 		else
 			EXIT_ERROR("Unsupported: %s\n",def_str);
+	} else if (strcmp(def_type,"adapt_marking") == 0) {
+		if      (strcmp(def_str,"none")           == 0) def_i = ADAPT_MARK_NONE;
+		else if (strcmp(def_str,"dorfler")        == 0) def_i = ADAPT_MARK_DORFLER;
+		else if (strcmp(def_str,"fixed_fraction") == 0) def_i = ADAPT_MARK_FIXED_FRACTION;
+		else
+			EXIT_ERROR("Unsupported: %s\n",def_str);
 	} else if (strcmp(def_type,"num_flux_1st") == 0) {
 		if      (strcmp(def_str,"upwind")         == 0) def_i = NUM_FLUX_UPWIND;
 		else if (strcmp(def_str,"Roe-Pike")       == 0) def_i = NUM_FLUX_ROE_PIKE;
@@ -147,6 +171,13 @@ static int get_define (const char*const def_str, const char*const def_type)
 		else if (strcmp(def_str,"trigonometric_x") == 0) def_i = BOUNDARY_PERTURB_TYPE_TRIG_X;
 		else
 			EXIT_ERROR("Unsupported: %s\n",def_str);
+	} else if (strcmp(def_type,"reorder_type") == 0) {
+		if      (strcmp(def_str,"none")    == 0) def_i = REORDER_NONE;
+		else if (strcmp(def_str,"hilbert") == 0) def_i = REORDER_HILBERT;
+		else if (strcmp(def_str,"morton")  == 0) def_i = REORDER_MORTON;
+		else if (strcmp(def_str,"rcm")     == 0) def_i = REORDER_RCM;
+		else
+			EXIT_ERROR("Unsupported: %s\n",def_str);
 	} else if (strcmp(def_type,"method_name") == 0) {
 		if      (strcmp(def_str,"discontinuous_galerkin")        == 0) def_i = METHOD_DG;
 		else if (strcmp(def_str,"discontinuous_petrov_galerkin") == 0) def_i = METHOD_DPG;
@@ -0,0 +1,64 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "mapped_file.h"
+
+#include <assert.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "macros.h"
+
+// Static function declarations ************************************************************************************* //
+
+// Interface functions ********************************************************************************************** //
+
+const struct Mapped_File* constructor_Mapped_File (const char*const name)
+{
+	const int fd = open(name,O_RDONLY);
+	if (fd == -1)
+		return NULL;
+
+	struct stat st;
+	if (fstat(fd,&st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return NULL;
+	}
+
+	const size_t size = (size_t)st.st_size;
+	void*const data = mmap(NULL,size,PROT_READ,MAP_SHARED,fd,0);
+	close(fd); // The mapping remains valid after the file is closed.
+	if (data == MAP_FAILED)
+		return NULL;
+
+	struct Mapped_File*const mapped_file = malloc(sizeof *mapped_file); // returned
+	mapped_file->size = size;
+	mapped_file->data = data;
+
+	return mapped_file;
+}
+
+void destructor_Mapped_File (const struct Mapped_File*const mapped_file)
+{
+	assert(mapped_file != NULL);
+	if (munmap((void*)mapped_file->data,mapped_file->size) != 0)
+		EXIT_ERROR("Failed to unmap the file.");
+	free((void*)mapped_file);
+}
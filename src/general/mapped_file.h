@@ -0,0 +1,44 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__mapped_file_h__INCLUDED
+#define DPG__mapped_file_h__INCLUDED
+/** \file
+ *  \brief Provides read-only memory mapped files.
+ *
+ *  Mapping files (as opposed to reading them into allocated memory) allows for the operating system to share the
+ *  physical pages between all processes on a node which map the same file.
+ */
+
+#include <stddef.h>
+
+/// Container for a read-only memory mapped file.
+struct Mapped_File {
+	size_t size;      ///< The size of the file in bytes.
+	const void* data; ///< The mapped memory.
+};
+
+/** \brief Constructor for a \ref Mapped_File.
+ *  \return See brief; `NULL` if the file could not be opened or is empty. */
+const struct Mapped_File* constructor_Mapped_File
+	(const char*const name ///< The name of the file.
+	);
+
+/// \brief Destructor for a \ref Mapped_File.
+void destructor_Mapped_File
+	(const struct Mapped_File*const mapped_file ///< Standard.
+	);
+
+#endif // DPG__mapped_file_h__INCLUDED
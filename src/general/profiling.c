@@ -0,0 +1,343 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "profiling.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "petscsys.h"
+#include "petsclog.h"
+
+#include "macros.h"
+#include "definitions_alloc.h"
+#include "definitions_elements.h"
+
+#include "file_processing.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define PROF_N_E_TYPE (POINT+1) ///< The number of slots for the kernel counts (indexed by the element type).
+
+/// \brief Container for the accumulated data of a phase timer.
+struct Phase_Timer {
+	double time;    ///< The accumulated wall-clock time (in seconds).
+	double t_start; ///< The time at which the outermost call of the current timing started.
+	long n_calls;   ///< The number of (outermost) calls.
+	int depth;      ///< The current nesting depth of the calls.
+	bool pushed;    ///< Flag for whether the PETSc log stage was pushed for the current timing.
+};
+
+/// \brief Container for the accumulated counts of the operator kernels.
+struct Kernel_Counts {
+	double n_calls, ///< The number of calls.
+	       n_flop,  ///< The number of floating point operations.
+	       n_byte;  ///< The number of bytes moved.
+};
+
+/// \brief Container for the kernel counts of a thread, aligned such that threads do not share cache lines.
+struct Thread_Counts {
+	_Alignas(64) struct Kernel_Counts e_type[PROF_N_E_TYPE]; ///< The counts for each of the element types.
+};
+
+static bool profiling = false; ///< Flag for whether profiling is enabled (see \ref get_set_profile_name).
+
+static int n_runs_open = 0;                     ///< The number of currently open runs.
+static struct Phase_Timer timers[PROF_N_PHASE]; ///< The phase timers.
+static struct Thread_Counts* counts = NULL;     ///< The kernel counts of each of the threads.
+static int n_threads = 0;                       ///< The number of entries in \ref counts.
+
+/// The element type to which the kernel counts of the calling thread are attributed (0 if unknown).
+static _Thread_local int e_type_curr = 0;
+
+/** \brief Return the name of the input phase.
+ *  \return See brief. */
+static const char* get_phase_name
+	(const int phase ///< Defined for \ref start_profile.
+	);
+
+/** \brief Return the name of the input element type.
+ *  \return See brief. */
+static const char* get_e_type_name
+	(const int e_type ///< Defined for \ref set_profile_element_type.
+	);
+
+/** \brief Return the current wall-clock time.
+ *  \return See brief. */
+static double get_time ( );
+
+/** \brief Return the PETSc log stage of the input phase, registering the stages if not already done.
+ *  \return See brief. */
+static PetscLogStage get_log_stage
+	(const int phase ///< Defined for \ref start_profile.
+	);
+
+/// \brief Sum the kernel counts over the threads.
+static void sum_kernel_counts
+	(struct Kernel_Counts k_counts[PROF_N_E_TYPE] ///< To hold the summed counts.
+	);
+
+/// \brief Output the profile in json format.
+static void output_profile_json
+	(const int mpi_rank,                                ///< Defined for \ref close_profile_run.
+	 const struct Kernel_Counts k_counts[PROF_N_E_TYPE] ///< The kernel counts summed over the threads.
+	);
+
+/// \brief Output the profile in csv format.
+static void output_profile_csv
+	(const int mpi_rank,                                ///< Defined for \ref close_profile_run.
+	 const struct Kernel_Counts k_counts[PROF_N_E_TYPE] ///< The kernel counts summed over the threads.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+const char* get_set_profile_name (const char*const new_name)
+{
+	static char profile_name[STRLEN_MAX] = "";
+	if (new_name) {
+		EXIT_IF_IN_PARALLEL;
+		assert(strlen(new_name) < STRLEN_MAX);
+		strcpy(profile_name,new_name);
+		profiling = ( strlen(profile_name) > 0 );
+	}
+	return profile_name;
+}
+
+void open_profile_run ( )
+{
+	EXIT_IF_IN_PARALLEL;
+	if (n_runs_open++ > 0)
+		return;
+
+	for (int i = 0; i < PROF_N_PHASE; ++i)
+		timers[i] = (struct Phase_Timer) { .time = 0.0, .n_calls = 0, .depth = 0, .pushed = false, };
+
+	assert(counts == NULL);
+	n_threads = MAX_THREADS_OMP;
+	counts = aligned_alloc(_Alignof(struct Thread_Counts),(size_t)n_threads * sizeof *counts); // free
+	memset(counts,0,(size_t)n_threads * sizeof *counts);
+}
+
+void close_profile_run (const int mpi_rank)
+{
+	EXIT_IF_IN_PARALLEL;
+	assert(n_runs_open > 0);
+	if (--n_runs_open > 0)
+		return;
+
+	if (profiling) {
+		struct Kernel_Counts k_counts[PROF_N_E_TYPE];
+		sum_kernel_counts(k_counts);
+		output_profile_json(mpi_rank,k_counts);
+		output_profile_csv(mpi_rank,k_counts);
+	}
+	free(counts);
+	counts    = NULL;
+	n_threads = 0;
+}
+
+void start_profile (const int phase)
+{
+	assert(phase >= 0 && phase < PROF_N_PHASE);
+	if (!profiling || IN_PARALLEL_OMP)
+		return;
+
+	struct Phase_Timer*const timer = &timers[phase];
+	if (timer->depth++ > 0)
+		return;
+
+	PetscBool petsc_initialized = PETSC_FALSE;
+	PetscInitialized(&petsc_initialized);
+	timer->pushed = petsc_initialized;
+	if (timer->pushed)
+		PetscLogStagePush(get_log_stage(phase));
+
+	timer->t_start = get_time();
+}
+
+void stop_profile (const int phase)
+{
+	assert(phase >= 0 && phase < PROF_N_PHASE);
+	if (!profiling || IN_PARALLEL_OMP)
+		return;
+
+	struct Phase_Timer*const timer = &timers[phase];
+	assert(timer->depth > 0);
+	if (--timer->depth > 0)
+		return;
+
+	timer->time += get_time()-timer->t_start;
+	++timer->n_calls;
+	if (timer->pushed)
+		PetscLogStagePop();
+}
+
+void set_profile_element_type (const int e_type)
+{
+	e_type_curr = ( (e_type > 0 && e_type < PROF_N_E_TYPE) ? e_type : 0 );
+}
+
+void add_profile_kernel (const double n_flop, const double n_byte)
+{
+	if (!profiling || !counts)
+		return;
+
+	const int thread = THREAD_NUM_OMP;
+	assert(thread < n_threads);
+
+	struct Kernel_Counts*const k_counts = &counts[thread].e_type[e_type_curr];
+	k_counts->n_calls += 1.0;
+	k_counts->n_flop  += n_flop;
+	k_counts->n_byte  += n_byte;
+}
+
+void add_profile_mm (const ptrdiff_t ext_0, const ptrdiff_t ext_1, const ptrdiff_t n_col, const int n_real)
+{
+	if (!profiling)
+		return;
+
+	const double n_op = (double)ext_0*(double)ext_1,
+	             n_bc = (double)(ext_0+ext_1)*(double)n_col*n_real;
+	add_profile_kernel(2.0*n_op*(double)n_col*n_real,(n_op+n_bc)*sizeof(double));
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static const char* get_phase_name (const int phase)
+{
+	switch (phase) {
+	case PROF_MESH_READ:    return "mesh_read";
+	case PROF_CONNECTIVITY: return "connectivity";
+	case PROF_GEOMETRY:     return "geometry";
+	case PROF_OPERATORS:    return "operators";
+	case PROF_VOLUME_RLHS:  return "volume_rlhs";
+	case PROF_FACE_RLHS:    return "face_rlhs";
+	case PROF_ASSEMBLY:     return "assembly";
+	case PROF_KSP_SETUP:    return "ksp_setup";
+	case PROF_KSP_SOLVE:    return "ksp_solve";
+	case PROF_ADAPTATION:   return "adaptation";
+	case PROF_OUTPUT:       return "output";
+	default:
+		EXIT_ERROR("Unsupported: %d\n",phase);
+		break;
+	}
+	return NULL;
+}
+
+static const char* get_e_type_name (const int e_type)
+{
+	switch (e_type) {
+	case 0:     return "unknown";
+	case POINT: return "point";
+	case LINE:  return "line";
+	case TRI:   return "tri";
+	case QUAD:  return "quad";
+	case TET:   return "tet";
+	case HEX:   return "hex";
+	case WEDGE: return "wedge";
+	case PYR:   return "pyr";
+	default:
+		EXIT_ERROR("Unsupported: %d\n",e_type);
+		break;
+	}
+	return NULL;
+}
+
+static double get_time ( )
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC,&t);
+	return (double)t.tv_sec + 1e-9*(double)t.tv_nsec;
+}
+
+static PetscLogStage get_log_stage (const int phase)
+{
+	static bool registered = false;
+	static PetscLogStage stages[PROF_N_PHASE];
+	if (!registered) {
+		for (int i = 0; i < PROF_N_PHASE; ++i)
+			PetscLogStageRegister(get_phase_name(i),&stages[i]);
+		registered = true;
+	}
+	return stages[phase];
+}
+
+static void sum_kernel_counts (struct Kernel_Counts k_counts[PROF_N_E_TYPE])
+{
+	for (int e = 0; e < PROF_N_E_TYPE; ++e) {
+		k_counts[e] = (struct Kernel_Counts) { .n_calls = 0.0, .n_flop = 0.0, .n_byte = 0.0, };
+		for (int t = 0; t < n_threads; ++t) {
+			k_counts[e].n_calls += counts[t].e_type[e].n_calls;
+			k_counts[e].n_flop  += counts[t].e_type[e].n_flop;
+			k_counts[e].n_byte  += counts[t].e_type[e].n_byte;
+		}
+	}
+}
+
+static void output_profile_json (const int mpi_rank, const struct Kernel_Counts k_counts[PROF_N_E_TYPE])
+{
+	FILE* file = fopen_sp_output_file('s',get_set_profile_name(NULL),"json",mpi_rank); // closed
+	if (!file)
+		EXIT_ERROR("Could not open the profile output file: %s.\n",get_set_profile_name(NULL));
+
+	fprintf(file,"{\n");
+	fprintf(file,"\t\"mpi_rank\": %d,\n",mpi_rank);
+	fprintf(file,"\t\"n_threads\": %d,\n",n_threads);
+
+	fprintf(file,"\t\"phases\": [\n");
+	for (int i = 0; i < PROF_N_PHASE; ++i) {
+		fprintf(file,"\t\t{ \"name\": \"%s\", \"n_calls\": %ld, \"time\": %.6e }%s\n",
+		        get_phase_name(i),timers[i].n_calls,timers[i].time,( i+1 < PROF_N_PHASE ? "," : "" ));
+	}
+	fprintf(file,"\t],\n");
+
+	fprintf(file,"\t\"kernels\": [\n");
+	bool first = true;
+	for (int e = 0; e < PROF_N_E_TYPE; ++e) {
+		if (k_counts[e].n_calls == 0.0)
+			continue;
+		fprintf(file,"%s\t\t{ \"element\": \"%s\", \"n_calls\": %.0f, \"n_flop\": %.6e, \"n_byte\": %.6e }",
+		        ( first ? "" : ",\n" ),get_e_type_name(e),k_counts[e].n_calls,k_counts[e].n_flop,k_counts[e].n_byte);
+		first = false;
+	}
+	fprintf(file,"%s\t]\n",( first ? "" : "\n" ));
+	fprintf(file,"}\n");
+
+	fclose(file);
+}
+
+static void output_profile_csv (const int mpi_rank, const struct Kernel_Counts k_counts[PROF_N_E_TYPE])
+{
+	FILE* file = fopen_sp_output_file('s',get_set_profile_name(NULL),"csv",mpi_rank); // closed
+	if (!file)
+		EXIT_ERROR("Could not open the profile output file: %s.\n",get_set_profile_name(NULL));
+
+	fprintf(file,"section,name,n_calls,time,n_flop,n_byte\n");
+	for (int i = 0; i < PROF_N_PHASE; ++i)
+		fprintf(file,"phase,%s,%ld,%.6e,,\n",get_phase_name(i),timers[i].n_calls,timers[i].time);
+	for (int e = 0; e < PROF_N_E_TYPE; ++e) {
+		if (k_counts[e].n_calls == 0.0)
+			continue;
+		fprintf(file,"kernel,%s,%.0f,,%.6e,%.6e\n",
+		        get_e_type_name(e),k_counts[e].n_calls,k_counts[e].n_flop,k_counts[e].n_byte);
+	}
+
+	fclose(file);
+}
@@ -0,0 +1,99 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__profiling_h__INCLUDED
+#define DPG__profiling_h__INCLUDED
+/** \file
+ *  \brief Provides the phase timers and the operator kernel counters used to profile a run.
+ *
+ *  Profiling is enabled by specifying the `profile_name` in the control file (see \ref get_set_profile_name). The
+ *  wall-clock time spent in each of the phases is accumulated between the calls to \ref start_profile and
+ *  \ref stop_profile and each phase is additionally registered as a PETSc log stage such that the output of
+ *  `-log_view` is broken down by phase. The number of floating point operations and bytes moved by the operator
+ *  kernels are accumulated for the element type set on the calling thread (\ref set_profile_element_type).
+ *
+ *  The profile of a run (i.e. from the construction to the destruction of the outermost \ref Simulation) is output in
+ *  json and csv formats for each process when the run is closed (\ref close_profile_run).
+ *
+ *  \note The phase timers are ignored when called from within threaded regions; nested calls for the same phase are
+ *        only timed for the outermost call.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+///\{ \name The profiled phases.
+#define PROF_MESH_READ    0
+#define PROF_CONNECTIVITY 1
+#define PROF_GEOMETRY     2
+#define PROF_OPERATORS    3
+#define PROF_VOLUME_RLHS  4
+#define PROF_FACE_RLHS    5
+#define PROF_ASSEMBLY     6
+#define PROF_KSP_SETUP    7
+#define PROF_KSP_SOLVE    8
+#define PROF_ADAPTATION   9
+#define PROF_OUTPUT       10
+#define PROF_N_PHASE      11 ///< The number of phases.
+///\}
+
+/** \brief Return the statically allocated name (including the full path) of the profile output files.
+ *  \return See brief. An empty string indicates that profiling is disabled.
+ *
+ *  Passing a non-NULL input for `new_name` sets the statically allocated name to that of the input.
+ */
+const char* get_set_profile_name
+	(const char*const new_name ///< The new name if non-NULL.
+	);
+
+/// \brief Open a profiled run, resetting the timers and counters if no run is currently open.
+void open_profile_run ( );
+
+/// \brief Close a profiled run, outputting the profile if this was the outermost open run.
+void close_profile_run
+	(const int mpi_rank ///< The mpi rank.
+	);
+
+/// \brief Start the timer (and PETSc log stage) of the input phase.
+void start_profile
+	(const int phase ///< The phase. Options: see \ref PROF_N_PHASE.
+	);
+
+/// \brief Stop the timer (and PETSc log stage) of the input phase.
+void stop_profile
+	(const int phase ///< Defined for \ref start_profile.
+	);
+
+/// \brief Set the element type to which the operator kernel counts of the calling thread are attributed.
+void set_profile_element_type
+	(const int e_type ///< The element type. Options: see \ref definitions_elements.h.
+	);
+
+/// \brief Add the counts of an operator kernel call to those of the current element type of the calling thread.
+void add_profile_kernel
+	(const double n_flop, ///< The number of floating point operations.
+	 const double n_byte  ///< The minimum number of bytes moved (operator, input and output).
+	);
+
+/** \brief Version of \ref add_profile_kernel for the multiplication of a dense real operator with `n_col` columns of
+ *         input data, each entry of which is formed of `n_real` real values (i.e. 2 for complex data). */
+void add_profile_mm
+	(const ptrdiff_t ext_0, ///< The number of rows of the operator.
+	 const ptrdiff_t ext_1, ///< The number of columns of the operator.
+	 const ptrdiff_t n_col, ///< The number of columns of the input/output.
+	 const int n_real       ///< The number of real values per entry of the input/output.
+	);
+
+#endif // DPG__profiling_h__INCLUDED
@@ -0,0 +1,190 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "scratch_arena.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "macros.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define SCRATCH_ALIGN    64        ///< The alignment (in bytes) of the memory returned from the arena.
+#define SCRATCH_SIZE_MIN (1 << 16) ///< The minimum size (in bytes) of the arena blocks.
+
+/// \brief Container for a block of memory of the scratch arena.
+struct Scratch_Block {
+	struct Scratch_Block* prev; ///< The previous block (or `NULL`).
+
+	size_t capacity; ///< The number of bytes available in \ref Scratch_Block::data.
+	size_t used;     ///< The number of bytes currently in use.
+
+	char* data; ///< The (aligned) memory.
+};
+
+/// \brief Container for the scratch arena of a thread.
+struct Scratch_Arena {
+	struct Scratch_Block* block; ///< The current (most recently allocated) block.
+
+	int n_scopes;         ///< The number of currently open scopes.
+	size_t capacity_hint; ///< The total capacity required by the arena up to this point.
+};
+
+/// The scratch arena of the calling thread.
+static _Thread_local struct Scratch_Arena arena = { .block = NULL, .n_scopes = 0, .capacity_hint = SCRATCH_SIZE_MIN, };
+
+/** \brief Add a new block of at least the input capacity to the arena.
+ *  \return The new block. */
+static struct Scratch_Block* add_scratch_block
+	(const size_t capacity ///< The required capacity.
+	);
+
+/// \brief Free the input block.
+static void destructor_Scratch_Block
+	(struct Scratch_Block*const block ///< Standard.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+struct Scratch_Scope open_scratch_scope ( )
+{
+	++arena.n_scopes;
+	return (struct Scratch_Scope) { .block = arena.block, .used = ( arena.block ? arena.block->used : 0 ), };
+}
+
+void close_scratch_scope (const struct Scratch_Scope scope)
+{
+	assert(arena.n_scopes > 0);
+
+	// Blocks added in the scope are freed, with their capacity being accounted for in the hint.
+	size_t capacity = 0;
+	while (arena.block != scope.block) {
+		struct Scratch_Block*const prev = arena.block->prev;
+		capacity += arena.block->capacity;
+		destructor_Scratch_Block(arena.block);
+		arena.block = prev;
+	}
+	if (arena.block) {
+		capacity += arena.block->capacity;
+		arena.block->used = scope.used;
+	}
+
+	if (capacity > arena.capacity_hint)
+		arena.capacity_hint = capacity;
+
+	// Once all scopes are closed, the arena is replaced by a single block if it was found to be too small.
+	if (--arena.n_scopes == 0 && arena.block && arena.block->capacity < arena.capacity_hint) {
+		assert(arena.block->prev == NULL);
+		destructor_Scratch_Block(arena.block);
+		arena.block = NULL;
+	}
+}
+
+void* malloc_scratch (const size_t size)
+{
+	if (arena.n_scopes == 0)
+		return malloc(size);
+
+	const size_t size_a = (size+SCRATCH_ALIGN-1)/SCRATCH_ALIGN*SCRATCH_ALIGN;
+
+	struct Scratch_Block* block = arena.block;
+	if (!block || block->used+size_a > block->capacity)
+		block = add_scratch_block(size_a);
+
+	void*const p = block->data+block->used;
+	block->used += size_a;
+	return p;
+}
+
+void* calloc_scratch (const size_t n, const size_t size)
+{
+	if (arena.n_scopes == 0)
+		return calloc(n,size);
+
+	void*const p = malloc_scratch(n*size);
+	memset(p,0,n*size);
+	return p;
+}
+
+void free_scratch (void*const p, const bool in_scratch)
+{
+	if (!in_scratch)
+		free(p);
+}
+
+bool in_scratch_scope ( )
+{
+	return arena.n_scopes > 0;
+}
+
+bool is_scratch_memory (const void*const p)
+{
+	const uintptr_t p_i = (uintptr_t)p;
+	for (const struct Scratch_Block* block = arena.block; block; block = block->prev) {
+		const uintptr_t b_i = (uintptr_t)block->data;
+		if (p_i >= b_i && p_i < b_i+block->capacity)
+			return true;
+	}
+	return false;
+}
+
+void destructor_scratch_arena ( )
+{
+	assert(arena.n_scopes == 0);
+	while (arena.block) {
+		struct Scratch_Block*const prev = arena.block->prev;
+		destructor_Scratch_Block(arena.block);
+		arena.block = prev;
+	}
+}
+
+void destructor_scratch_arenas ( )
+{
+	PRAGMA_OMP(parallel)
+	destructor_scratch_arena();
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static struct Scratch_Block* add_scratch_block (const size_t capacity)
+{
+	size_t capacity_b = ( arena.block ? 2*arena.block->capacity : arena.capacity_hint );
+	if (capacity_b < capacity)
+		capacity_b = capacity;
+
+	struct Scratch_Block*const block = malloc(sizeof *block + capacity_b + SCRATCH_ALIGN); // freed
+	if (block == NULL)
+		EXIT_ERROR("Failed to allocate %zu bytes for the scratch arena.",capacity_b);
+
+	const uintptr_t data_i = (uintptr_t)(block+1);
+	block->data     = (char*)((data_i+SCRATCH_ALIGN-1)/SCRATCH_ALIGN*SCRATCH_ALIGN);
+	block->capacity = capacity_b;
+	block->used     = 0;
+	block->prev     = arena.block;
+
+	arena.block = block;
+	return block;
+}
+
+static void destructor_Scratch_Block (struct Scratch_Block*const block)
+{
+	free(block);
+}
@@ -0,0 +1,105 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__scratch_arena_h__INCLUDED
+#define DPG__scratch_arena_h__INCLUDED
+/** \file
+ *  \brief Provides a thread-local scratch arena (bump allocator) for short-lived temporaries.
+ *
+ *  While a scratch scope is open on the calling thread (\ref open_scratch_scope), \ref malloc_scratch returns memory
+ *  from the arena of the thread which is released all at once when the scope is closed (\ref close_scratch_scope).
+ *  Outside of a scope, the functions fall back to the standard heap functions such that the constructors of
+ *  temporaries may call them unconditionally.
+ *
+ *  The typical usage is to open a scope for each computational element in the rlhs loops, removing all malloc/free
+ *  calls for the temporaries from the hot path once the arena has grown to the required size. The arenas are kept
+ *  across the rlhs calls and are released by \ref destructor_scratch_arenas when the \ref Simulation is destructed.
+ *
+ *  \warning Memory obtained in a scope must not outlive the scope and must be released using \ref free_scratch (a
+ *           no-op for arena memory) and not `free`.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+struct Scratch_Block;
+
+/// \brief Container for the state of the scratch arena when a scope was opened.
+struct Scratch_Scope {
+	struct Scratch_Block* block; ///< The current block of the arena.
+	size_t used;                 ///< The number of bytes used in the current block.
+};
+
+/** \brief Open a scratch scope on the calling thread.
+ *  \return The \ref Scratch_Scope to be passed to \ref close_scratch_scope. */
+struct Scratch_Scope open_scratch_scope ( );
+
+/// \brief Close the scratch scope, releasing all arena memory obtained since it was opened.
+void close_scratch_scope
+	(const struct Scratch_Scope scope ///< The scope returned by the corresponding \ref open_scratch_scope.
+	);
+
+/** \brief Allocate memory from the scratch arena if a scope is open on the calling thread and using malloc otherwise.
+ *  \return See brief. */
+void* malloc_scratch
+	(const size_t size ///< The number of bytes.
+	);
+
+/** \brief `calloc` version of \ref malloc_scratch.
+ *  \return See brief. */
+void* calloc_scratch
+	(const size_t n,   ///< The number of members.
+	 const size_t size ///< The size of each member.
+	);
+
+/** \brief Free the input memory if it was not obtained from the scratch arena.
+ *
+ *  The caller passes the value of \ref in_scratch_scope recorded when the memory was allocated such that no search of
+ *  the arena blocks is required.
+ */
+void free_scratch
+	(void*const p,         ///< The memory.
+	 const bool in_scratch ///< Flag for whether the memory was obtained from the scratch arena.
+	);
+
+/** \brief Check whether a scratch scope is open on the calling thread (i.e. whether \ref malloc_scratch currently
+ *         returns arena memory).
+ *  \return `true` if yes; `false` otherwise.
+ *
+ *  Containers allocated using the scratch functions record the returned value such that their destructors need not
+ *  call \ref is_scratch_memory.
+ */
+bool in_scratch_scope ( );
+
+/** \brief Check whether the input memory was obtained from the scratch arena of the calling thread.
+ *  \return `true` if yes; `false` otherwise.
+ *
+ *  \note The cost of the search is linear in the number of arena blocks; this is intended for assertions and testing.
+ */
+bool is_scratch_memory
+	(const void*const p ///< The memory.
+	);
+
+/** \brief Destructor for the scratch arena of the calling thread.
+ *
+ *  Must be called outside of any scope. The size of the arena is remembered such that it is allocated as a single
+ *  block when next used. */
+void destructor_scratch_arena ( );
+
+/** \brief Destructor for the scratch arenas of all threads, calling \ref destructor_scratch_arena in a parallel region
+ *         (and only for the calling thread without OpenMP). */
+void destructor_scratch_arenas ( );
+
+#endif // DPG__scratch_arena_h__INCLUDED
@@ -224,6 +224,22 @@ void insert_List_into_List
 	curr->prev = sub->last;
 }
 
+struct Intrusive_Link** constructor_array_Link (const struct Intrusive_List*const lst, ptrdiff_t*const n_links)
+{
+	ptrdiff_t n = 0;
+	for (struct Intrusive_Link* curr = lst->first; curr; curr = curr->next)
+		++n;
+
+	struct Intrusive_Link** links = malloc((size_t)n * sizeof *links); // returned
+
+	n = 0;
+	for (struct Intrusive_Link* curr = lst->first; curr; curr = curr->next)
+		links[n++] = curr;
+
+	*n_links = n;
+	return links;
+}
+
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
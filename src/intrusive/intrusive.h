@@ -32,6 +32,7 @@ You should have received a copy of the GNU General Public License along with DPG
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 /// \brief A doubly-linked list structure to hold intrusive containers.
 struct Intrusive_List {
@@ -179,5 +180,12 @@ void insert_List_into_List
 	 struct Intrusive_Link*const curr  ///< The current link.
 	);
 
+/** \brief Constructor for an array of pointers to the links of the input list (allowing for random access).
+ *  \return See brief. */
+struct Intrusive_Link** constructor_array_Link
+	(const struct Intrusive_List*const lst, ///< The list.
+	 ptrdiff_t*const n_links                ///< Set to the number of links in the list.
+	);
+
 
 #endif // DPG__Intrusive_h__INCLUDED
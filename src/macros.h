@@ -57,8 +57,40 @@ You should have received a copy of the GNU General Public License along with DPG
 /// Macro to add `b` bytes to the pointer address `a`.
 #define BYTE_ADD(a,b) ((char*)a+b)
 
+/// Macro to force the inlining of (point-wise) kernel functions called from within loops which should be vectorized.
+#define FORCE_INLINE inline __attribute__((always_inline))
+
 ///\{ \name Macro to output on successful termination.
 #define OUTPUT_SUCCESS ({printf("\n\nSuccessful termination.\n\n\n");})
 ///\}
 
+/**\{ \name OpenMP related macros.
+ *
+ *  `PRAGMA_OMP` expands to `#pragma omp ...` when compiled with OpenMP support and to nothing otherwise.
+ *
+ *  `EXIT_IF_IN_PARALLEL` should be used when setting statically allocated values (e.g. in the `get_set_*` functions);
+ *  these functions are only thread-safe when the values are set outside of threaded regions, after which they are
+ *  only read. */
+#ifdef _OPENMP
+	#include <omp.h>
+	#define DO_PRAGMA(...)  _Pragma(#__VA_ARGS__)
+	#define PRAGMA_OMP(...) DO_PRAGMA(omp __VA_ARGS__)
+	#define EXIT_IF_IN_PARALLEL ({ if (omp_in_parallel()) EXIT_ERROR("Set static values in serial regions only."); })
+	#define MAX_THREADS_OMP omp_get_max_threads()
+	#define THREAD_NUM_OMP  omp_get_thread_num()
+	#define IN_PARALLEL_OMP omp_in_parallel()
+	#define SET_THREADS_OMP(n) omp_set_num_threads(n)
+#else
+	#define PRAGMA_OMP(...)
+	#define EXIT_IF_IN_PARALLEL
+	#define MAX_THREADS_OMP 1
+	#define THREAD_NUM_OMP  0
+	#define IN_PARALLEL_OMP 0
+	#define SET_THREADS_OMP(n)
+#endif
+
+/// The chunk size used for the dynamic scheduling of loops over the computational elements.
+#define CHUNK_OMP 16
+///\}
+
 #endif // DPG__macros_h__INCLUDED
@@ -37,6 +37,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "element_solver_opg.h"
 
 #include "intrusive.h"
+#include "profiling.h"
 #include "simulation.h"
 
 // Templated functions ********************************************************************************************** //
@@ -106,6 +107,7 @@ static const struct const_Intrusive_Link* constructor_base_const_Intrusive_Link
 
 void constructor_derived_Elements (struct Simulation* sim, const int derived_name)
 {
+	start_profile(PROF_OPERATORS);
 	struct Derived_Elements_Info de_i = get_c_Derived_Elements_Info(derived_name,sim);
 
 	const struct const_Intrusive_List* base = sim->elements;
@@ -133,6 +135,7 @@ void constructor_derived_Elements (struct Simulation* sim, const int derived_nam
 
 	// Destruct the base list.
 	destructor_const_IL_base(sim->elements);
+	stop_profile(PROF_OPERATORS);
 }
 
 void destructor_derived_Elements (struct Simulation* sim, const int base_name)
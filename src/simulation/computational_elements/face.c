@@ -163,6 +163,94 @@ void destructor_Faces (struct Intrusive_List* faces)
 	destructor_IL(faces,true);
 }
 
+struct Face_Colouring* constructor_Face_Colouring (const struct Intrusive_List*const faces)
+{
+	ptrdiff_t n_f = 0;
+	struct Intrusive_Link**const links = constructor_array_Link(faces,&n_f); // free
+
+	int n_v = 0;
+	for (ptrdiff_t i = 0; i < n_f; ++i) {
+		const struct Face*const face = (struct Face*) links[i];
+		for (int j = 0; j < 2; ++j) {
+			const struct Volume*const vol = face->neigh_info[j].volume;
+			if (vol && vol->index >= n_v)
+				n_v = vol->index+1;
+		}
+	}
+
+	// Bit `c` of `used[v]` is set if a face of colour `c` neighbours the volume of index `v`.
+	unsigned long long*const used = calloc((size_t)n_v,sizeof *used); // free
+	int*const colour = malloc((size_t)n_f * sizeof *colour); // free
+	int n_colours = 0;
+	for (ptrdiff_t i = 0; i < n_f; ++i) {
+		const struct Face*const face = (struct Face*) links[i];
+
+		unsigned long long used_f = 0;
+		for (int j = 0; j < 2; ++j) {
+			const struct Volume*const vol = face->neigh_info[j].volume;
+			if (vol) {
+				assert(vol->index >= 0);
+				used_f |= used[vol->index];
+			}
+		}
+
+		int c = 0;
+		while (used_f & (1ULL << c))
+			++c;
+		assert(c < (int)(8*sizeof(used_f)));
+
+		colour[i] = c;
+		if (c >= n_colours)
+			n_colours = c+1;
+		for (int j = 0; j < 2; ++j) {
+			const struct Volume*const vol = face->neigh_info[j].volume;
+			if (vol)
+				used[vol->index] |= (1ULL << c);
+		}
+	}
+	free(used);
+
+	struct Face_Colouring*const face_colouring = malloc(sizeof *face_colouring); // returned
+	face_colouring->n_colours  = n_colours;
+	face_colouring->n_f        = n_f;
+	face_colouring->ind_colour = calloc((size_t)(n_colours+1),sizeof *face_colouring->ind_colour); // free
+	face_colouring->ind_f      = malloc((size_t)n_f * sizeof *face_colouring->ind_f); // free
+
+	ptrdiff_t*const ind_colour = face_colouring->ind_colour;
+	for (ptrdiff_t i = 0; i < n_f; ++i)
+		++ind_colour[colour[i]+1];
+	for (int c = 0; c < n_colours; ++c)
+		ind_colour[c+1] += ind_colour[c];
+
+	ptrdiff_t ind_curr[n_colours+1];
+	for (int c = 0; c <= n_colours; ++c)
+		ind_curr[c] = ind_colour[c];
+	for (ptrdiff_t i = 0; i < n_f; ++i)
+		face_colouring->ind_f[ind_curr[colour[i]]++] = i;
+
+	free(colour);
+	free(links);
+	return face_colouring;
+}
+
+void destructor_Face_Colouring (struct Face_Colouring*const face_colouring)
+{
+	free(face_colouring->ind_colour);
+	free(face_colouring->ind_f);
+	free(face_colouring);
+}
+
+void update_Face_Colouring (struct Simulation*const sim)
+{
+	if (sim->face_colouring) {
+		destructor_Face_Colouring(sim->face_colouring);
+		sim->face_colouring = NULL;
+	}
+
+	if (MAX_THREADS_OMP > 1)
+		sim->face_colouring = constructor_Face_Colouring(sim->faces);
+}
+
 void const_cast_Face (const struct Face*const* dest, const struct Face*const src)
 {
 	*(struct Face**) dest = (struct Face*) src;
@@ -335,6 +423,16 @@ double compute_h_face (const struct Face*const face)
 	EXIT_ERROR("Should not have reached this point.");
 }
 
+void update_index_faces (const struct Simulation*const sim)
+{
+	int index = 0;
+	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+		struct Face* face = (struct Face*) curr;
+		const_cast_i(&face->index,index);
+		++index;
+	}
+}
+
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
@@ -22,6 +22,7 @@ You should have received a copy of the GNU General Public License along with DPG
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "intrusive.h"
 
@@ -97,6 +98,25 @@ struct Face {
 	                  *   Face; this is generally referred to as the left volume. */
 };
 
+/** \brief Container for a colouring of a list of faces such that faces of the same colour do not share any neighbouring
+ *         volumes.
+ *
+ *  This allows for face contributions to be computed concurrently for all faces of a given colour.
+ *
+ *  The faces are referenced by their position in the list such that the colouring remains valid when derived lists are
+ *  constructed (which preserves the order of the faces). It must be updated whenever faces are added, removed or
+ *  reordered (see \ref update_Face_Colouring).
+ */
+struct Face_Colouring {
+	int n_colours; ///< The number of colours.
+	ptrdiff_t n_f; ///< The number of faces.
+
+	/// Index of the first face of each colour in \ref Face_Colouring::ind_f (length: n_colours+1).
+	ptrdiff_t* ind_colour;
+
+	ptrdiff_t* ind_f; ///< The positions of the faces in the list, sorted by colour.
+};
+
 // Constructor/Destructor functions ********************************************************************************* //
 
 /** \brief Constructs the base \ref Face \ref Intrusive_List.
@@ -111,6 +131,24 @@ void destructor_Faces
 	(struct Intrusive_List* faces ///< Standard.
 	);
 
+/** \brief Constructor for a \ref Face_Colouring of the input list of faces (greedy colouring).
+ *  \return Standard. */
+struct Face_Colouring* constructor_Face_Colouring
+	(const struct Intrusive_List*const faces ///< The list of \ref Face\*s.
+	);
+
+/// \brief Destructor for a \ref Face_Colouring.
+void destructor_Face_Colouring
+	(struct Face_Colouring*const face_colouring ///< Standard.
+	);
+
+/** \brief Update \ref Simulation::face_colouring for the current list of faces.
+ *
+ *  The colouring is only required for threaded face loops and is set to `NULL` when a single thread is available. */
+void update_Face_Colouring
+	(struct Simulation*const sim ///< Standard.
+	);
+
 /// \brief Cast from \ref Face\* to `const` \ref Face `*const`.
 void const_cast_Face
 	(const struct Face*const* dest, ///< Destination.
@@ -185,4 +223,9 @@ double compute_h_face
 	(const struct Face*const face ///< \ref Face.
 	);
 
+/// \brief Set \ref Face::index to the position of each face in \ref Simulation::faces.
+void update_index_faces
+	(const struct Simulation*const sim ///< Standard.
+	);
+
 #endif // DPG__face_h__INCLUDED
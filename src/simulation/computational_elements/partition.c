@@ -0,0 +1,206 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "partition.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "mpi.h"
+#include "petscmat.h"
+#include "petscis.h"
+
+#include "macros.h"
+
+#include "multiarray.h"
+#include "vector.h"
+
+#include "face.h"
+#include "volume.h"
+
+#include "const_cast.h"
+#include "intrusive.h"
+#include "mesh.h"
+#include "mesh_connectivity.h"
+#include "simulation.h"
+
+// Static function declarations ************************************************************************************* //
+
+/** \brief Compute the rank of the process owning each of the volumes of the mesh.
+ *  \return The Petsc error code. */
+static PetscErrorCode compute_volume_ranks
+	(int*const ranks,                                    ///< To hold the volume ranks.
+	 const int n_parts,                                  ///< The number of partitions.
+	 const struct const_Multiarray_Vector_i*const v_to_v ///< \ref Mesh_Connectivity::v_to_v.
+	);
+
+/// \brief Set the volume ranks such that each partition is a contiguous block of volumes (in index order).
+static void set_contiguous_ranks
+	(int*const ranks,   ///< The volume ranks.
+	 const int n_parts, ///< The number of partitions.
+	 const int n_v      ///< The number of volumes.
+	);
+
+/** \brief Check whether any of the partitions are empty.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_partition_degenerate
+	(const int*const ranks, ///< The volume ranks.
+	 const int n_parts,     ///< The number of partitions.
+	 const int n_v          ///< The number of volumes.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+void partition_volumes (const struct Simulation*const sim, const struct Mesh*const mesh)
+{
+	if (!check_distributed(sim))
+		return;
+
+	const struct const_Multiarray_Vector_i*const v_to_v = mesh->mesh_conn->v_to_v;
+	const int n_v = (int)v_to_v->extents[0];
+
+	int*const ranks = malloc((size_t)n_v * sizeof *ranks); // free
+
+	// Partition on a single process and broadcast such that all processes are guaranteed to agree.
+	if (sim->mpi_rank == 0) {
+		const PetscErrorCode ierr = compute_volume_ranks(ranks,sim->mpi_size,v_to_v);
+		if (ierr)
+			EXIT_ERROR("Mesh partitioning failed (Petsc error code: %d).\n",ierr);
+	}
+	MPI_Bcast(ranks,n_v,MPI_INT,0,MPI_COMM_WORLD);
+
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Volume* vol = (struct Volume*) curr;
+		assert(vol->index >= 0 && vol->index < n_v);
+		const_cast_i(&vol->rank,ranks[vol->index]);
+	}
+	free(ranks);
+}
+
+bool check_distributed (const struct Simulation*const sim)
+{
+	return sim->mpi_size > 1;
+}
+
+bool is_volume_owned (const struct Volume*const vol, const struct Simulation*const sim)
+{
+	return vol->rank == sim->mpi_rank;
+}
+
+bool is_face_local (const struct Face*const face, const struct Simulation*const sim)
+{
+	for (int i = 0; i < 2; ++i) {
+		const struct Volume*const vol = face->neigh_info[i].volume;
+		if (vol && is_volume_owned(vol,sim))
+			return true;
+	}
+	return false;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static PetscErrorCode compute_volume_ranks
+	(int*const ranks, const int n_parts, const struct const_Multiarray_Vector_i*const v_to_v)
+{
+	const PetscInt n_v = (PetscInt)v_to_v->extents[0];
+
+	// The adjacency arrays are freed by MatDestroy.
+	PetscInt* ia = NULL;
+	CHKERRQ(PetscMalloc1(n_v+1,&ia));
+
+	ia[0] = 0;
+	for (PetscInt v = 0; v < n_v; ++v) {
+		const struct const_Vector_i*const v_to_v_V = v_to_v->data[v];
+		ia[v+1] = ia[v];
+		for (int i = 0; i < v_to_v_V->ext_0; ++i) {
+			const int v_n = v_to_v_V->data[i];
+			if (v_n >= 0 && v_n != v)
+				++ia[v+1];
+		}
+	}
+
+	PetscInt* ja = NULL;
+	CHKERRQ(PetscMalloc1(ia[n_v],&ja));
+	for (PetscInt v = 0, ind = 0; v < n_v; ++v) {
+		const struct const_Vector_i*const v_to_v_V = v_to_v->data[v];
+		for (int i = 0; i < v_to_v_V->ext_0; ++i) {
+			const int v_n = v_to_v_V->data[i];
+			if (v_n >= 0 && v_n != v)
+				ja[ind++] = v_n;
+		}
+	}
+
+	Mat adj;
+	CHKERRQ(MatCreateMPIAdj(PETSC_COMM_SELF,n_v,n_v,ia,ja,NULL,&adj)); // destroyed
+
+	MatPartitioning part;
+	CHKERRQ(MatPartitioningCreate(PETSC_COMM_SELF,&part)); // destroyed
+	CHKERRQ(MatPartitioningSetAdjacency(part,adj));
+	CHKERRQ(MatPartitioningSetNParts(part,n_parts));
+	CHKERRQ(MatPartitioningSetFromOptions(part));
+
+	/* The default type ("current") assigns all volumes to the partition of the calling process such that contiguous
+	 * blocks of volumes are used when no graph partitioner was requested. */
+	MatPartitioningType type = NULL;
+	CHKERRQ(MatPartitioningGetType(part,&type));
+	if (strcmp(type,MATPARTITIONINGCURRENT) == 0) {
+		set_contiguous_ranks(ranks,n_parts,(int)n_v);
+	} else {
+		IS is_part;
+		CHKERRQ(MatPartitioningApply(part,&is_part)); // destroyed
+
+		const PetscInt* ranks_i = NULL;
+		CHKERRQ(ISGetIndices(is_part,&ranks_i));
+		for (PetscInt v = 0; v < n_v; ++v)
+			ranks[v] = (int)ranks_i[v];
+		CHKERRQ(ISRestoreIndices(is_part,&ranks_i));
+		CHKERRQ(ISDestroy(&is_part));
+
+		if (check_partition_degenerate(ranks,n_parts,(int)n_v))
+			EXIT_ERROR("Empty partition returned by the '%s' partitioner (n_v: %d, n_parts: %d).\n",
+			           type,(int)n_v,n_parts);
+	}
+
+	CHKERRQ(MatPartitioningDestroy(&part));
+	CHKERRQ(MatDestroy(&adj));
+	return 0;
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static void set_contiguous_ranks (int*const ranks, const int n_parts, const int n_v)
+{
+	for (int v = 0; v < n_v; ++v)
+		ranks[v] = (int)(((long)v*n_parts)/n_v);
+}
+
+static bool check_partition_degenerate (const int*const ranks, const int n_parts, const int n_v)
+{
+	int n_v_part[n_parts];
+	for (int i = 0; i < n_parts; ++i)
+		n_v_part[i] = 0;
+	for (int v = 0; v < n_v; ++v)
+		++n_v_part[ranks[v]];
+
+	for (int i = 0; i < n_parts; ++i) {
+		if (n_v_part[i] == 0)
+			return true;
+	}
+	return false;
+}
@@ -0,0 +1,64 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__partition_h__INCLUDED
+#define DPG__partition_h__INCLUDED
+/** \file
+ *  \brief Provides functions relating to the distribution of the computational elements over the mpi processes.
+ *
+ *  This provides a parallel PETSc solve with a replicated mesh: the mesh and the solution data are stored on all
+ *  processes and only the assembly of the global system (for the volumes/faces owned by/adjacent to the current
+ *  process) and the linear solve are distributed. The solution increment is gathered to all processes after each
+ *  linear solve. Only the DG method without Schur complement is supported when running on multiple processes.
+ *
+ *  The volumes are partitioned based on the dual graph of the mesh (\ref Mesh_Connectivity::v_to_v) using the PETSc
+ *  `MatPartitioning` interface with the type selected using the `-mat_partitioning_type` option (parmetis is
+ *  recommended). Contiguous blocks of volumes are used if no type is selected.
+ */
+
+#include <stdbool.h>
+
+struct Simulation;
+struct Mesh;
+struct Volume;
+struct Face;
+
+/// \brief Set \ref Volume::rank for all volumes based on a partitioning of the mesh dual graph.
+void partition_volumes
+	(const struct Simulation*const sim, ///< Standard.
+	 const struct Mesh*const mesh       ///< Standard.
+	);
+
+/** \brief Check whether the simulation is distributed over multiple mpi processes.
+ *  \return `true` if yes; `false` otherwise. */
+bool check_distributed
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Check whether the input volume is owned by the current mpi process.
+ *  \return `true` if yes; `false` otherwise. */
+bool is_volume_owned
+	(const struct Volume*const vol,    ///< The \ref Volume.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Check whether the input face is adjacent to at least one volume owned by the current mpi process.
+ *  \return `true` if yes; `false` otherwise. */
+bool is_face_local
+	(const struct Face*const face,     ///< The \ref Face.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+#endif // DPG__partition_h__INCLUDED
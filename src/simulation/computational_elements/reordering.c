@@ -0,0 +1,470 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "reordering.h"
+
+#include <assert.h>
+#include <float.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "macros.h"
+#include "definitions_core.h"
+#include "definitions_elements.h"
+#include "definitions_mesh.h"
+
+#include "multiarray.h"
+#include "matrix.h"
+
+#include "face.h"
+#include "volume.h"
+
+#include "intrusive.h"
+#include "simulation.h"
+
+// Static function declarations ************************************************************************************* //
+
+/// \brief Container for the sort key of a computational element.
+struct Element_Key {
+	uint64_t key[2]; ///< The sort keys (compared lexicographically).
+	int ind;         ///< The index of the element in the list before reordering (used for a stable ordering).
+};
+
+/** \brief Set the keys of the volumes according to the position of their centroids along the space-filling curve
+ *         specified by \ref Simulation::reorder_type. */
+static void set_keys_sfc
+	(struct Element_Key*const keys,           ///< The keys to be set.
+	 struct Intrusive_Link*const*const links, ///< The links of the volumes.
+	 const ptrdiff_t n_v,                     ///< The number of volumes.
+	 const int reorder_type                   ///< \ref Simulation::reorder_type.
+	);
+
+/** \brief Set the keys of the volumes according to the reverse Cuthill-McKee ordering of the mesh dual graph.
+ *
+ *  \ref Volume::index must be equal to the position of each volume in the list.
+ */
+static void set_keys_rcm
+	(struct Element_Key*const keys,    ///< The keys to be set.
+	 const ptrdiff_t n_v,              ///< The number of volumes.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Set the keys of the faces according to the indices of their neighbouring volumes such that the faces are
+ *         visited in the same order as the volumes. */
+static void set_keys_faces
+	(struct Element_Key*const keys,           ///< The keys to be set.
+	 struct Intrusive_Link*const*const links, ///< The links of the faces.
+	 const ptrdiff_t n_f                      ///< The number of faces.
+	);
+
+/** \brief Comparison function for std::qsort between \ref Element_Key\*s `a` and `b`.
+ *  \return The lexicographical comparison of the keys followed by the indices. */
+static int cmp_Element_Key
+	(const void *a, ///< Variable 1.
+	 const void *b  ///< Variable 2.
+	);
+
+/// \brief Relink the input list in the order of the sorted keys.
+static void relink_list
+	(struct Intrusive_List*const lst,         ///< The list.
+	 struct Intrusive_Link*const*const links, ///< The links of the list before reordering.
+	 const struct Element_Key*const keys,     ///< The sorted keys.
+	 const ptrdiff_t n_l                      ///< The number of links in the list.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+void reorder_computational_elements (const struct Simulation*const sim)
+{
+	if (sim->reorder_type == REORDER_NONE)
+		return;
+
+	update_index_volumes(sim);
+
+	ptrdiff_t n_v = 0;
+	struct Intrusive_Link**const links_v = constructor_array_Link(sim->volumes,&n_v); // free
+	struct Element_Key*const keys_v = calloc((size_t)n_v,sizeof *keys_v);            // free
+
+	switch (sim->reorder_type) {
+	case REORDER_HILBERT: // fallthrough
+	case REORDER_MORTON:
+		set_keys_sfc(keys_v,links_v,n_v,sim->reorder_type);
+		break;
+	case REORDER_RCM:
+		set_keys_rcm(keys_v,n_v,sim);
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",sim->reorder_type);
+		break;
+	}
+	qsort(keys_v,(size_t)n_v,sizeof *keys_v,cmp_Element_Key);
+	relink_list(sim->volumes,links_v,keys_v,n_v);
+	update_index_volumes(sim);
+	free(keys_v);
+	free(links_v);
+
+	ptrdiff_t n_f = 0;
+	struct Intrusive_Link**const links_f = constructor_array_Link(sim->faces,&n_f); // free
+	struct Element_Key*const keys_f = calloc((size_t)n_f,sizeof *keys_f);          // free
+
+	set_keys_faces(keys_f,links_f,n_f);
+	qsort(keys_f,(size_t)n_f,sizeof *keys_f,cmp_Element_Key);
+	relink_list(sim->faces,links_f,keys_f,n_f);
+	update_index_faces(sim);
+	free(keys_f);
+	free(links_f);
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/// \brief Transform the input integer coordinates to the transpose of the index along the Hilbert curve.
+static void transpose_axes_hilbert
+	(uint32_t*const x, ///< The integer coordinates (`DIM` entries).
+	 const int n_b     ///< The number of bits used for each coordinate.
+	);
+
+/** \brief Interleave the bits of the input integer coordinates (with the most significant bit of the first coordinate
+ *         being the most significant bit of the result).
+ *  \return See brief. */
+static uint64_t interleave_bits
+	(const uint32_t*const x, ///< The integer coordinates (`DIM` entries).
+	 const int n_b           ///< The number of bits used for each coordinate.
+	);
+
+/** \brief Append the nodes of the connected component of the dual graph containing the input root to the
+ *         Cuthill-McKee ordering, marking them as visited.
+ *  \return The updated number of nodes in the ordering. */
+static int append_cuthill_mckee
+	(int*const order,         ///< The Cuthill-McKee ordering.
+	 int n_o,                 ///< The number of nodes already in the ordering.
+	 bool*const visited,      ///< Flags for whether the nodes have been added to the ordering.
+	 const int root,          ///< The root node.
+	 const int*const ind_adj, ///< The indices of the first adjacency entry of each node (CSR format).
+	 const int*const adj      ///< The adjacency entries.
+	);
+
+/** \brief Find a pseudo-peripheral node of the connected component of the dual graph containing the input node (the
+ *         George-Liu algorithm).
+ *  \return See brief. */
+static int find_pseudo_peripheral
+	(const int node,           ///< The initial node.
+	 const bool*const visited, ///< Flags for nodes which have already been ordered (excluded from the search).
+	 const int*const ind_adj,  ///< See \ref append_cuthill_mckee.
+	 const int*const adj,      ///< See \ref append_cuthill_mckee.
+	 const int n_v             ///< The number of nodes.
+	);
+
+static void set_keys_sfc
+	(struct Element_Key*const keys, struct Intrusive_Link*const*const links, const ptrdiff_t n_v,
+	 const int reorder_type)
+{
+	// The keys are stored in 64 bits.
+	const int n_b = ( DIM == 1 ? 32 : 63/DIM );
+
+	double*const centroids = malloc((size_t)(n_v*DIM) * sizeof *centroids); // free
+	double xyz_min[DIM], xyz_max[DIM];
+	for (int d = 0; d < DIM; ++d) {
+		xyz_min[d] =  DBL_MAX;
+		xyz_max[d] = -DBL_MAX;
+	}
+
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		const struct Volume*const vol = (struct Volume*) links[v];
+		const struct const_Matrix_d xyz_ve = interpret_const_Multiarray_as_Matrix_d(vol->xyz_ve);
+
+		double*const centroid = &centroids[v*DIM];
+		set_to_row_avg_const_Matrix_d(centroid,&xyz_ve);
+		for (int d = 0; d < DIM; ++d) {
+			if (centroid[d] < xyz_min[d])
+				xyz_min[d] = centroid[d];
+			if (centroid[d] > xyz_max[d])
+				xyz_max[d] = centroid[d];
+		}
+	}
+
+	const double n_cells = (double)(((uint64_t)1 << n_b) - 1);
+	double scale[DIM];
+	for (int d = 0; d < DIM; ++d)
+		scale[d] = ( xyz_max[d] > xyz_min[d] ? n_cells/(xyz_max[d]-xyz_min[d]) : 0.0 );
+
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		uint32_t x[DIM];
+		for (int d = 0; d < DIM; ++d)
+			x[d] = (uint32_t)((centroids[v*DIM+d]-xyz_min[d])*scale[d]);
+
+		if (reorder_type == REORDER_HILBERT)
+			transpose_axes_hilbert(x,n_b);
+
+		keys[v].key[0] = interleave_bits(x,n_b);
+		keys[v].ind    = (int)v;
+	}
+	free(centroids);
+}
+
+static void set_keys_rcm (struct Element_Key*const keys, const ptrdiff_t n_v, const struct Simulation*const sim)
+{
+	// Construct the adjacency of the dual graph in CSR format (including duplicate entries for non-conforming faces).
+	int*const ind_adj = calloc((size_t)(n_v+1),sizeof *ind_adj); // free
+	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+		const struct Face*const face = (struct Face*) curr;
+		if (face->neigh_info[1].volume == NULL)
+			continue;
+		++ind_adj[face->neigh_info[0].volume->index+1];
+		++ind_adj[face->neigh_info[1].volume->index+1];
+	}
+	for (ptrdiff_t v = 0; v < n_v; ++v)
+		ind_adj[v+1] += ind_adj[v];
+
+	int*const adj = malloc((size_t)(ind_adj[n_v]+1) * sizeof *adj); // free
+	int*const n_adj = calloc((size_t)n_v,sizeof *n_adj);             // free
+	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+		const struct Face*const face = (struct Face*) curr;
+		if (face->neigh_info[1].volume == NULL)
+			continue;
+
+		const int ind_v[2] = { face->neigh_info[0].volume->index, face->neigh_info[1].volume->index, };
+		assert(ind_v[0] >= 0 && ind_v[0] < n_v && ind_v[1] >= 0 && ind_v[1] < n_v);
+		adj[ind_adj[ind_v[0]]+n_adj[ind_v[0]]++] = ind_v[1];
+		adj[ind_adj[ind_v[1]]+n_adj[ind_v[1]]++] = ind_v[0];
+	}
+	free(n_adj);
+
+	int*const order = malloc((size_t)n_v * sizeof *order);        // free
+	bool*const visited = calloc((size_t)n_v,sizeof *visited); // free
+
+	int n_o = 0;
+	while (n_o < n_v) {
+		// Start each connected component from the unvisited node of minimal degree.
+		int root = -1;
+		for (int v = 0; v < n_v; ++v) {
+			if (visited[v])
+				continue;
+			if (root == -1 || ind_adj[v+1]-ind_adj[v] < ind_adj[root+1]-ind_adj[root])
+				root = v;
+		}
+		root = find_pseudo_peripheral(root,visited,ind_adj,adj,(int)n_v);
+		n_o = append_cuthill_mckee(order,n_o,visited,root,ind_adj,adj);
+	}
+	assert(n_o == n_v);
+
+	for (int i = 0; i < n_v; ++i) {
+		struct Element_Key*const key = &keys[order[i]];
+		key->key[0] = (uint64_t)(n_v-1-i);
+		key->ind    = order[i];
+	}
+
+	free(visited);
+	free(order);
+	free(adj);
+	free(ind_adj);
+}
+
+static void set_keys_faces
+	(struct Element_Key*const keys, struct Intrusive_Link*const*const links, const ptrdiff_t n_f)
+{
+	for (ptrdiff_t f = 0; f < n_f; ++f) {
+		const struct Face*const face = (struct Face*) links[f];
+
+		const int ind_0 = face->neigh_info[0].volume->index,
+		          ind_1 = ( face->neigh_info[1].volume ? face->neigh_info[1].volume->index : ind_0 );
+
+		keys[f].key[0] = (uint64_t)( ind_0 < ind_1 ? ind_0 : ind_1 );
+		keys[f].key[1] = (uint64_t)( ind_0 < ind_1 ? ind_1 : ind_0 );
+		keys[f].ind    = (int)f;
+	}
+}
+
+static int cmp_Element_Key (const void *a, const void *b)
+{
+	const struct Element_Key*const ka = (const struct Element_Key*) a,
+	                        *const kb = (const struct Element_Key*) b;
+
+	for (int i = 0; i < 2; ++i) {
+		if (ka->key[i] != kb->key[i])
+			return ( ka->key[i] < kb->key[i] ? -1 : 1 );
+	}
+	return ( ka->ind < kb->ind ? -1 : ( ka->ind > kb->ind ? 1 : 0 ) );
+}
+
+static void relink_list
+	(struct Intrusive_List*const lst, struct Intrusive_Link*const*const links, const struct Element_Key*const keys,
+	 const ptrdiff_t n_l)
+{
+	struct Intrusive_Link* prev = NULL;
+	for (ptrdiff_t i = 0; i < n_l; ++i) {
+		struct Intrusive_Link*const curr = links[keys[i].ind];
+		curr->prev = prev;
+		if (prev)
+			prev->next = curr;
+		else
+			lst->first = curr;
+		prev = curr;
+	}
+	if (prev)
+		prev->next = NULL;
+	lst->last = prev;
+}
+
+// Level 1 ********************************************************************************************************** //
+
+/** \brief Perform a breadth-first search of the unvisited nodes from the input root.
+ *  \return The number of levels of the level structure rooted at the input node (its eccentricity + 1).
+ *
+ *  The node of minimal degree in the last level is returned in `node_last`.
+ */
+static int compute_level_structure
+	(int*const node_last,      ///< To hold the node of minimal degree in the last level.
+	 int*const level,          ///< Memory for the level of each node (set to -1 for all nodes on exit).
+	 int*const queue,          ///< Memory for the search queue.
+	 const int root,           ///< The root node.
+	 const bool*const visited, ///< See \ref find_pseudo_peripheral.
+	 const int*const ind_adj,  ///< See \ref append_cuthill_mckee.
+	 const int*const adj       ///< See \ref append_cuthill_mckee.
+	);
+
+static void transpose_axes_hilbert (uint32_t*const x, const int n_b)
+{
+	/*  The transpose of the Hilbert index is obtained using the algorithm of Skilling ("Programming the Hilbert
+	 *  curve", AIP Conference Proceedings 707, 2004), which is valid for any dimension. */
+	const uint32_t m = (uint32_t)1 << (n_b-1);
+
+	// Inverse undo.
+	for (uint32_t q = m; q > 1; q >>= 1) {
+		const uint32_t p = q-1;
+		for (int i = 0; i < DIM; ++i) {
+			if (x[i] & q) {
+				x[0] ^= p;
+			} else {
+				const uint32_t t = (x[0] ^ x[i]) & p;
+				x[0] ^= t;
+				x[i] ^= t;
+			}
+		}
+	}
+
+	// Gray encode.
+	for (int i = 1; i < DIM; ++i)
+		x[i] ^= x[i-1];
+	uint32_t t = 0;
+	for (uint32_t q = m; q > 1; q >>= 1) {
+		if (x[DIM-1] & q)
+			t ^= q-1;
+	}
+	for (int i = 0; i < DIM; ++i)
+		x[i] ^= t;
+}
+
+static uint64_t interleave_bits (const uint32_t*const x, const int n_b)
+{
+	uint64_t key = 0;
+	for (int b = n_b-1; b >= 0; --b) {
+	for (int d = 0; d < DIM; ++d) {
+		key = (key << 1) | ((x[d] >> b) & 1u);
+	}}
+	return key;
+}
+
+static int append_cuthill_mckee
+	(int*const order, int n_o, bool*const visited, const int root, const int*const ind_adj, const int*const adj)
+{
+	visited[root] = true;
+	order[n_o++] = root;
+	for (int i = n_o-1; i < n_o; ++i) {
+		const int node = order[i];
+
+		// Append the unvisited neighbours in order of increasing degree (insertion sort as the degree is small).
+		const int n_o_prev = n_o;
+		for (int j = ind_adj[node]; j < ind_adj[node+1]; ++j) {
+			const int node_n = adj[j];
+			if (visited[node_n])
+				continue;
+			visited[node_n] = true;
+
+			const int deg_n = ind_adj[node_n+1]-ind_adj[node_n];
+			int k = n_o++;
+			for ( ; k > n_o_prev && ind_adj[order[k-1]+1]-ind_adj[order[k-1]] > deg_n; --k)
+				order[k] = order[k-1];
+			order[k] = node_n;
+		}
+	}
+	return n_o;
+}
+
+static int find_pseudo_peripheral
+	(const int node, const bool*const visited, const int*const ind_adj, const int*const adj, const int n_v)
+{
+	enum { count_max = 8, }; // The maximum number of iterations (the eccentricity generally converges in 2-3).
+
+	int*const level = malloc((size_t)n_v * sizeof *level); // free
+	int*const queue = malloc((size_t)n_v * sizeof *queue); // free
+	for (int v = 0; v < n_v; ++v)
+		level[v] = -1;
+
+	int root = node,
+	    node_last = node;
+	int n_levels = compute_level_structure(&node_last,level,queue,root,visited,ind_adj,adj);
+	for (int count = 0; count < count_max; ++count) {
+		int node_last_c = node_last;
+		const int n_levels_c = compute_level_structure(&node_last_c,level,queue,node_last,visited,ind_adj,adj);
+		if (n_levels_c <= n_levels)
+			break;
+
+		root      = node_last;
+		node_last = node_last_c;
+		n_levels  = n_levels_c;
+	}
+
+	free(queue);
+	free(level);
+	return root;
+}
+
+// Level 2 ********************************************************************************************************** //
+
+static int compute_level_structure
+	(int*const node_last, int*const level, int*const queue, const int root, const bool*const visited,
+	 const int*const ind_adj, const int*const adj)
+{
+	int n_q = 0;
+	queue[n_q++] = root;
+	level[root] = 0;
+	for (int i = 0; i < n_q; ++i) {
+		const int node = queue[i];
+		for (int j = ind_adj[node]; j < ind_adj[node+1]; ++j) {
+			const int node_n = adj[j];
+			if (visited[node_n] || level[node_n] != -1)
+				continue;
+			level[node_n] = level[node]+1;
+			queue[n_q++] = node_n;
+		}
+	}
+
+	const int level_last = level[queue[n_q-1]];
+	*node_last = queue[n_q-1];
+	for (int i = n_q-1; i >= 0 && level[queue[i]] == level_last; --i) {
+		const int node = queue[i];
+		if (ind_adj[node+1]-ind_adj[node] < ind_adj[*node_last+1]-ind_adj[*node_last])
+			*node_last = node;
+	}
+
+	for (int i = 0; i < n_q; ++i)
+		level[queue[i]] = -1;
+
+	return level_last+1;
+}
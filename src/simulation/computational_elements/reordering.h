@@ -0,0 +1,43 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__reordering_h__INCLUDED
+#define DPG__reordering_h__INCLUDED
+/** \file
+ *  \brief Provides functions relating to the reordering of the computational elements for improved locality.
+ *
+ *  The order of \ref Simulation::volumes and \ref Simulation::faces determines the numbering of the global degrees of
+ *  freedom (see \ref update_ind_dof_T) as well as the order in which the elements are visited in all loops. Without
+ *  reordering, this is the order of the mesh file, which is further perturbed by h-adaptation where the children are
+ *  inserted in place of their parents.
+ *
+ *  Reordering the volumes along a space-filling curve or using the reverse Cuthill-McKee ordering of the mesh dual
+ *  graph results in neighbouring elements being close in memory and in a global system matrix with a small bandwidth
+ *  (reducing the fill of incomplete factorizations). The faces are subsequently ordered by their neighbouring volumes.
+ */
+
+struct Simulation;
+
+/** \brief Reorder the volumes and faces according to \ref Simulation::reorder_type, updating \ref Volume::index and
+ *         \ref Face::index to be consistent with the new order.
+ *
+ *  This is not used for the simulation of the restart mesh (see \ref constructor_Simulation_restart) as the restart
+ *  file is output in the order of the volumes of the simulation from which it was written.
+ */
+void reorder_computational_elements
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+#endif // DPG__reordering_h__INCLUDED
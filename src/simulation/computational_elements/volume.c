@@ -170,6 +170,7 @@ struct Volume* constructor_copy_Volume
 	struct Volume* volume = calloc(1,sizeof *volume); // returned
 
 	const_cast_i(&volume->index,vol_i->index);
+	const_cast_i(&volume->rank,vol_i->rank);
 
 	const_constructor_move_const_Multiarray_d
 		(&volume->xyz_ve,constructor_copy_const_Multiarray_d(vol_i->xyz_ve)); // destructed
@@ -244,6 +245,16 @@ ptrdiff_t compute_n_volumes (const struct Simulation*const sim)
 	return n_v;
 }
 
+void update_index_volumes (const struct Simulation*const sim)
+{
+	int index = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Volume* vol = (struct Volume*) curr;
+		const_cast_i(&vol->index,index);
+		++index;
+	}
+}
+
 const struct const_Matrix_d* constructor_volume_xyz_min_max (const struct Simulation*const sim)
 {
 	enum { min = 0, max = 1, };
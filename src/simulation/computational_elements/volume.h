@@ -37,6 +37,7 @@ struct Volume {
 	struct Intrusive_Link lnk; ///< The \ref Intrusive_Link.
 
 	const int index; ///< The index of the volume.
+	const int rank;  ///< The mpi rank of the process owning the volume (see \ref partition_volumes).
 
 	const struct const_Element*const element; ///< Pointer to the associated \ref const_Element.
 
@@ -129,6 +130,11 @@ ptrdiff_t compute_n_volumes
 	(const struct Simulation*const sim ///< Standard.
 	);
 
+/// \brief Set \ref Volume::index to the position of each volume in \ref Simulation::volumes.
+void update_index_volumes
+	(const struct Simulation*const sim ///< Standard.
+	);
+
 /** \brief Contructor for a \ref Matrix_T\* holding the values of the minimum and maximum xyz coordinates of the
  *         volumes.
  *  \return See brief. */
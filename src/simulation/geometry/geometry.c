@@ -32,6 +32,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "intrusive.h"
 #include "operator.h"
 #include "multiarray_operator.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "test_case.h"
 #include "visualization.h"
@@ -168,6 +168,7 @@ void set_up_solver_geometry_T (struct Simulation* sim)
 	assert(sim->faces->name   == IL_FACE_SOLVER);
 	assert(list_is_derived_from("solver",'e',sim));
 
+	start_profile(PROF_GEOMETRY);
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next)
 		compute_geometry_volume_T(true,(struct Solver_Volume_T*)curr,sim);
 
@@ -175,6 +176,7 @@ void set_up_solver_geometry_T (struct Simulation* sim)
 		compute_geometry_face_T((struct Solver_Face_T*)curr,sim);
 
 	correct_for_exact_normals_T(sim);
+	stop_profile(PROF_GEOMETRY);
 
 #if TYPE_RC == TYPE_REAL
 	if (OUTPUT_GEOMETRY) {
@@ -190,11 +192,13 @@ void set_up_solver_geometry_p1_T (struct Simulation*const sim)
 	assert(sim->faces->name   == IL_FACE_SOLVER);
 	assert(list_is_derived_from("solver",'e',sim));
 
+	start_profile(PROF_GEOMETRY);
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next)
 		compute_geometry_volume_p1_T((struct Solver_Volume_T*)curr);
 
 	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next)
 		compute_geometry_face_p1_T((struct Solver_Face_T*)curr);
+	stop_profile(PROF_GEOMETRY);
 }
 
 void compute_unit_normals_T
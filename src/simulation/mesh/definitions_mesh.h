@@ -28,6 +28,13 @@ You should have received a copy of the GNU General Public License along with DPG
 #define DOM_PARAMETRIC 3 ///< Parametric mesh. Generally non-affine.
 ///\}
 
+///\{ \name The supported reordering types of the computational elements (see \ref reordering.h).
+#define REORDER_NONE    1 ///< The order of the mesh file (and of the h-adaptation) is retained.
+#define REORDER_HILBERT 2 ///< Volumes ordered along the Hilbert curve through their centroids.
+#define REORDER_MORTON  3 ///< Volumes ordered along the Morton (Z-order) curve through their centroids.
+#define REORDER_RCM     4 ///< Volumes ordered using the reverse Cuthill-McKee ordering of the mesh dual graph.
+///\}
+
 ///\{ \name The node coordinate tolerance of the mesh vertices
 #define NODETOL_MESH 1.0e-5
 ///\}
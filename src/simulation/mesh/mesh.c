@@ -30,6 +30,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "mesh_vertices.h"
 #include "element.h"
 #include "file_processing.h"
+#include "profiling.h"
 
 // Static function declarations ************************************************************************************* //
 
@@ -45,8 +46,13 @@ struct Mesh* constructor_Mesh (const struct Mesh_Input* mesh_input, const struct
 
 	struct Mesh* mesh = calloc(1,sizeof *mesh); // returned
 
+	start_profile(PROF_MESH_READ);
 	*(struct Mesh_Data**)&         mesh->mesh_data = constructor_Mesh_Data(mesh_input->mesh_name_full,mesh_input->d);
+	stop_profile(PROF_MESH_READ);
+
+	start_profile(PROF_CONNECTIVITY);
 	*(struct Mesh_Connectivity**)& mesh->mesh_conn = constructor_Mesh_Connectivity(mesh->mesh_data,elements);
+	stop_profile(PROF_CONNECTIVITY);
 	*(struct Mesh_Vertices**)&     mesh->mesh_vert = constructor_Mesh_Vertices(mesh,elements,mesh_input);
 
 	if (!elements_provided)
@@ -16,6 +16,11 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "mesh_readers.h"
 
+#include <assert.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -29,8 +34,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "vector.h"
 
 #include "mesh.h"
-#include "file_processing.h"
 #include "const_cast.h"
+#include "mapped_file.h"
 
 // Static function declarations ************************************************************************************* //
 
@@ -40,8 +45,9 @@ You should have received a copy of the GNU General Public License along with DPG
 struct Element_Data {
 	ptrdiff_t n_elems; ///< The number of physical elements.
 
-	struct Vector_i* elem_types; ///< Defined in \ref Mesh_Data.
-	struct Matrix_i* elem_tags;  ///< Defined in \ref Mesh_Data.
+	struct Vector_i* elem_types;   ///< Defined in \ref Mesh_Data.
+	struct Matrix_i* elem_tags;    ///< Defined in \ref Mesh_Data.
+	struct Vector_i* elem_per_dim; ///< Defined in \ref Mesh_Data.
 
 	struct Multiarray_Vector_i* node_nums; ///< Defined in \ref Mesh_Data.
 };
@@ -53,20 +59,17 @@ struct Mesh_Data_l {
 	struct Matrix_i*     periodic_corr; ///< Define in \ref Mesh_Data.
 };
 
-/// /brief Read data from a mesh in gmsh format.
+/** \brief Read data from a mesh in gmsh format.
+ *
+ *	The file is memory mapped and parsed in a single pass. The ascii and binary variants of the 2.2 and 4.1 file formats
+ *	are supported.
+ */
 static void mesh_reader_gmsh
 	(const char*const mesh_name_full,     ///< The name of the mesh including the full path.
 	 const int d,                         ///< The dimension.
 	 struct Mesh_Data_l*const mesh_data_l ///< \ref Mesh_Data_l.
 	);
 
-/** \brief See return.
- *	\return The number of elements of each dimension.
- */
-static struct Vector_i* count_elements_per_dim
-	(const struct const_Vector_i*const elem_types ///< Defined in \ref Conn_info.
-	);
-
 // Interface functions ********************************************************************************************** //
 
 struct Mesh_Data* constructor_Mesh_Data (const char*const mesh_name_full, const int d)
@@ -90,8 +93,7 @@ struct Mesh_Data* constructor_Mesh_Data (const char*const mesh_name_full, const
 	else
 		*(struct const_Matrix_i**)&mesh_data->periodic_corr = NULL;
 
-	struct Vector_i* elem_per_dim = count_elements_per_dim(mesh_data->elem_types); // keep
-	const_constructor_move_Vector_i(&mesh_data->elem_per_dim,elem_per_dim);
+	const_constructor_move_Vector_i(&mesh_data->elem_per_dim,mesh_data_l.elem_data->elem_per_dim);
 
 	const ptrdiff_t ind_v = get_first_volume_index(mesh_data->elem_per_dim,d);
 
@@ -182,34 +184,79 @@ int get_n_nodes (const int elem_type)
 // Static functions ************************************************************************************************* //
 
 // Gmsh ************************************************************************************************************* //
+
+/// \brief Cursor into a memory mapped gmsh file.
+struct Gmsh_Cursor {
+	const char* pos; ///< The current position.
+	const char* end; ///< One past the last character of the file.
+
+	int version; ///< The file format version multiplied by 10 (e.g. 22 or 41).
+	bool binary; ///< Flag for whether the section data is stored in binary format.
+};
+
+/// \brief Container for the physical tags of the geometric entities (only present in the 4.1 file format).
+struct Gmsh_Entities {
+	/** The (entity tag, physical tag) pairs of the entities of each dimension. Entities without a physical tag are
+	 *  assigned a physical tag of 0 as in the 2.2 file format. */
+	struct Matrix_i* tags[DMAX+1];
+};
+
 // Level 0 ********************************************************************************************************** //
 
+/// \brief Read the file format and check that it is supported.
+static void read_mesh_format
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
+
+/** \brief Constructor for the \ref Gmsh_Entities from the mesh file.
+ *	\return Standard.
+ */
+static struct Gmsh_Entities* constructor_Gmsh_Entities
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
+
+/// \brief Destructor for a \ref Gmsh_Entities container.
+static void destructor_Gmsh_Entities
+	(struct Gmsh_Entities*const entities ///< Standard.
+	);
+
 /** \brief Read the nodes (xyz coordinates) from the mesh file.
  *	\return A \ref Matrix_T\* containing the \ref Mesh_Data::nodes.
  */
 static struct Matrix_d* read_nodes
-	(FILE* mesh_file, ///< The mesh file.
-	 const int d      ///< The dimension.
+	(struct Gmsh_Cursor*const gc, ///< \ref Gmsh_Cursor.
+	 const int d                  ///< The dimension.
 	);
 
 /** \brief Read the element data from the mesh file.
  *	\return A \ref Element_Data\* container holding the element related mesh data.
+ *
+ *	The number of elements of each dimension is counted as the elements are read.
  */
 static struct Element_Data* read_elements
-	(FILE* mesh_file ///< The mesh file.
+	(struct Gmsh_Cursor*const gc,              ///< \ref Gmsh_Cursor.
+	 const struct Gmsh_Entities*const entities ///< \ref Gmsh_Entities (4.1 file format only).
 	);
 
 /** \brief Reads periodic entity data.
  *	\return A \ref Matrix_T\* containing the \ref Mesh_Data::periodic_corr.
  *
- *	The use of `line_ptr` in the code below is required for passing the address of the `char[]` line to a `char**` as
- *	explained in [this SO answer][multidim_arrays].
- *
- *	[multidim_arrays]: https://stackoverflow.com/questions/1584100/converting-multidimensional-arrays-to-pointers-in-c
+ *	Only the correspondence of the `d-1` dimensional periodic entities is stored.
  */
 static struct Matrix_i* read_periodic
-	(FILE* mesh_file, ///< The mesh file.
-	 const int d      ///< The dimension.
+	(struct Gmsh_Cursor*const gc, ///< \ref Gmsh_Cursor.
+	 const int d                  ///< The dimension.
+	);
+
+/// \brief Advance the cursor past the end of the current line.
+static void skip_line
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
+
+/// \brief Advance the cursor past the line holding the end tag of the section (e.g. "$EndNodes" for "$Nodes").
+static void skip_section
+	(struct Gmsh_Cursor*const gc, ///< \ref Gmsh_Cursor.
+	 const char*const name        ///< The name of the section (without the leading '$').
 	);
 
 static void mesh_reader_gmsh (const char*const mesh_name_full, const int d, struct Mesh_Data_l*const mesh_data_l)
@@ -218,60 +265,63 @@ static void mesh_reader_gmsh (const char*const mesh_name_full, const int d, stru
 	mesh_data_l->elem_data     = NULL;
 	mesh_data_l->periodic_corr = NULL;
 
-	FILE* mesh_file = fopen_checked(mesh_name_full); // closed
-
-	char line[STRLEN_MAX];
-	while (fgets(line,sizeof(line),mesh_file)) {
-		if (strstr(line,"$Nodes"))
-			mesh_data_l->nodes = read_nodes(mesh_file,d); // keep
-
-		if (strstr(line,"$Elements"))
-			mesh_data_l->elem_data = read_elements(mesh_file); // keep
-
-		if (strstr(line,"Periodic"))
-			mesh_data_l->periodic_corr = read_periodic(mesh_file,d); // keep
+	const struct Mapped_File*const m_file = constructor_Mapped_File(mesh_name_full); // destructed
+	if (!m_file)
+		EXIT_ERROR("Could not open the mesh file: %s\n",mesh_name_full);
+
+	struct Gmsh_Cursor gc = { .pos = m_file->data, .end = (const char*)m_file->data+m_file->size, .version = 22, };
+	struct Gmsh_Entities* entities = NULL;
+	while (gc.pos < gc.end) {
+		const char*const line = gc.pos;
+		skip_line(&gc);
+		if (line[0] != '$')
+			continue;
+
+		char name[STRLEN_MIN] = { 0, };
+		for (int i = 0; i < STRLEN_MIN-1 && &line[i+1] < gc.end && !isspace((unsigned char)line[i+1]); ++i)
+			name[i] = line[i+1];
+
+		if (strcmp(name,"MeshFormat") == 0)
+			read_mesh_format(&gc);
+		else if (strcmp(name,"Entities") == 0)
+			entities = constructor_Gmsh_Entities(&gc); // destructed
+		else if (strcmp(name,"Nodes") == 0)
+			mesh_data_l->nodes = read_nodes(&gc,d); // keep
+		else if (strcmp(name,"Elements") == 0)
+			mesh_data_l->elem_data = read_elements(&gc,entities); // keep
+		else if (strcmp(name,"Periodic") == 0)
+			mesh_data_l->periodic_corr = read_periodic(&gc,d); // keep
+
+		// Unused sections (e.g. the solution data of restart files) are skipped.
+		skip_section(&gc,name);
 	}
-	fclose(mesh_file);
-}
 
-static struct Vector_i* count_elements_per_dim (const struct const_Vector_i*const elem_types)
-{
-	struct Vector_i* count = constructor_empty_Vector_i(DMAX+1); // returned
-	set_to_zero_Vector_i(count);
-	for (ptrdiff_t i = 0; i < elem_types->ext_0; i++) {
-		const int elem_type = elem_types->data[i];
-
-		switch (elem_type) {
-		case POINT:
-			count->data[0]++;
-			break;
-		case LINE:
-			count->data[1]++;
-			break;
-		case TRI: case QUAD:
-			count->data[2]++;
-			break;
-		case TET: case HEX: case WEDGE: case PYR:
-			count->data[3]++;
-			break;
-		default:
-			EXIT_ERROR("Unsupported: %d\n",elem_type);
-			break;
-		}
-	}
+	if (entities)
+		destructor_Gmsh_Entities(entities);
+	destructor_Mapped_File(m_file);
 
-	return count;
+	if (!mesh_data_l->nodes || !mesh_data_l->elem_data)
+		EXIT_ERROR("Did not find the nodes and elements in the mesh file: %s\n",mesh_name_full);
 }
 
 // Level 1 ********************************************************************************************************** //
 
-/** \brief Fill one row of the nodes \ref Matrix_T.
- *	Note that the first entry of the line is the node index and is discarded.
+/** \brief Version of \ref read_nodes for the 4.1 file format.
+ *	\return See brief.
+ *
+ *	The node tags are required to be numbered contiguously starting from 1 (the gmsh default).
+ */
+static struct Matrix_d* read_nodes_v4
+	(struct Gmsh_Cursor*const gc, ///< \ref Gmsh_Cursor.
+	 const int d                  ///< The dimension.
+	);
+
+/** \brief Version of \ref read_elements for the 4.1 file format.
+ *	\return See brief.
  */
-static void fill_nodes
-	(double*const node_row, ///< The current row.
-	 char* line,            ///< The current line of the file.
-	 const int d            ///< The dimension.
+static struct Element_Data* read_elements_v4
+	(struct Gmsh_Cursor*const gc,              ///< \ref Gmsh_Cursor.
+	 const struct Gmsh_Entities*const entities ///< \ref Gmsh_Entities.
 	);
 
 /** \brief Constructor for \ref Element_Data\*.
@@ -281,125 +331,375 @@ static struct Element_Data* constructor_Element_Data
 	(const ptrdiff_t n_elems ///< The number of elements.
 	);
 
-/// \brief Fill one row of the members of \ref Element_Data.
-static void fill_elements
-	(const ptrdiff_t row,                 ///< The current row.
-	 struct Element_Data*const elem_data, ///< The \ref Element_Data.
-	 char* line                           ///< The current line of the file.
+/** \brief Set the type and tags of the element in the current row of \ref Element_Data and update the count of the
+ *	       number of elements of each dimension.
+ *	\return The (resized) node numbers of the element in the current row.
+ */
+static struct Vector_i* set_element
+	(const ptrdiff_t row,                ///< The current row.
+	 const int elem_type,                ///< The element type.
+	 const int*const tags,               ///< The element tags.
+	 struct Element_Data*const elem_data ///< The \ref Element_Data.
 	);
 
-/// \brief Skips the current periodic entity
-static void skip_periodic_entity
-	(FILE* file,         ///< The file.
-	 char**const line,   ///< The pointer to the current line.
-	 const int line_size ///< The size of the line array.
+/** \brief Read the node number of an element vertex.
+ *	\return The (0-based) index of the node.
+ */
+static int read_node_index
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
 	);
 
-static struct Matrix_d* read_nodes (FILE* mesh_file, const int d)
-{
-	char line[STRLEN_MAX];
-	char* endptr = NULL;
+/** \brief Read a value stored as an `int` in the binary file format.
+ *	\return See brief.
+ */
+static long read_int_gmsh
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
 
-	if (fgets(line,sizeof(line),mesh_file) != NULL) {};
-	ptrdiff_t n_nodes = strtol(line,&endptr,10);
-	struct Matrix_d* nodes = constructor_empty_Matrix_d('R',n_nodes,d);
+/** \brief Read a value stored as a `size_t` in the binary file format (4.1 file format only).
+ *	\return See brief.
+ */
+static ptrdiff_t read_size_gmsh
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
 
-	ptrdiff_t row = 0;
-	while (fgets(line,sizeof(line),mesh_file) != NULL) {
-		if (strstr(line,"$EndNodes"))
-			break;
+/** \brief Read a value stored as a `double` in the binary file format.
+ *	\return See brief.
+ */
+static double read_double_gmsh
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
 
-		fill_nodes(get_row_Matrix_d(row,nodes),line,d);
+/** \brief Read an integer in ascii format.
+ *	\return See brief.
+ */
+static long parse_long
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
 
-		if (row++ == n_nodes)
-			EXIT_UNSUPPORTED;
+/** \brief Read a floating point value in ascii format.
+ *	\return See brief.
+ */
+static double parse_double
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
+
+/// \brief Copy the input number of bytes from the file and advance the cursor.
+static void read_bytes
+	(struct Gmsh_Cursor*const gc, ///< \ref Gmsh_Cursor.
+	 void*const dest,             ///< The destination.
+	 const size_t size            ///< The number of bytes.
+	);
+
+/// \brief Advance the cursor past any whitespace.
+static void skip_space
+	(struct Gmsh_Cursor*const gc ///< \ref Gmsh_Cursor.
+	);
+
+static void read_mesh_format (struct Gmsh_Cursor*const gc)
+{
+	const double version = parse_double(gc);
+	const long file_type = parse_long(gc),
+	           data_size = parse_long(gc);
+	skip_line(gc);
+
+	gc->version = (int)lround(10.0*version);
+	gc->binary  = (file_type == 1);
+	if (!(gc->version/10 == 2 || gc->version == 41))
+		EXIT_ERROR("Unsupported: %g (gmsh file format version)\n",version);
+	if (data_size != sizeof(double))
+		EXIT_ERROR("Unsupported: %ld (data size)\n",data_size);
+
+	if (gc->binary) {
+		int one = 0;
+		read_bytes(gc,&one,sizeof(one));
+		if (one != 1)
+			EXIT_ERROR("Unsupported: Binary mesh file written with a different byte order.\n");
 	}
-	return nodes;
 }
 
-static struct Element_Data* read_elements (FILE* mesh_file)
+static struct Gmsh_Entities* constructor_Gmsh_Entities (struct Gmsh_Cursor*const gc)
 {
-	char line[STRLEN_MAX];
-	char* endptr = NULL;
-
-	if (fgets(line,sizeof(line),mesh_file) != NULL) {};
-	ptrdiff_t n_elems = strtol(line,&endptr,10);
+	struct Gmsh_Entities* entities = calloc(1,sizeof *entities); // returned
+
+	ptrdiff_t n_ent[DMAX+1];
+	for (int dim = 0; dim <= DMAX; ++dim)
+		n_ent[dim] = read_size_gmsh(gc);
+
+	for (int dim = 0; dim <= DMAX; ++dim) {
+		entities->tags[dim] = constructor_empty_Matrix_i('R',n_ent[dim],2); // destructed
+		for (ptrdiff_t n = 0; n < n_ent[dim]; ++n) {
+			int*const tags = get_row_Matrix_i(n,entities->tags[dim]);
+			tags[0] = (int)read_int_gmsh(gc);
+			tags[1] = 0;
+
+			// Skip the point coordinates or the bounding box.
+			for (int i = 0; i < (dim == 0 ? 3 : 6); ++i)
+				read_double_gmsh(gc);
+
+			const ptrdiff_t n_phys = read_size_gmsh(gc);
+			for (ptrdiff_t i = 0; i < n_phys; ++i) {
+				const int tag_phys = (int)read_int_gmsh(gc);
+				if (i == 0)
+					tags[1] = tag_phys;
+			}
+
+			if (dim > 0) {
+				const ptrdiff_t n_bound = read_size_gmsh(gc);
+				for (ptrdiff_t i = 0; i < n_bound; ++i)
+					read_int_gmsh(gc);
+			}
+		}
+	}
+	return entities;
+}
 
-	struct Element_Data* elem_data = constructor_Element_Data(n_elems);
+static void destructor_Gmsh_Entities (struct Gmsh_Entities*const entities)
+{
+	for (int dim = 0; dim <= DMAX; ++dim)
+		destructor_Matrix_i(entities->tags[dim]);
+	free(entities);
+}
 
-	ptrdiff_t row = 0;
-	while (fgets(line,sizeof(line),mesh_file) != NULL) {
-		if (strstr(line,"$EndElements"))
-			break;
+static struct Matrix_d* read_nodes (struct Gmsh_Cursor*const gc, const int d)
+{
+	if (gc->version == 41)
+		return read_nodes_v4(gc,d);
+
+	// The number of nodes is stored in ascii format for both file types.
+	const ptrdiff_t n_nodes = parse_long(gc);
+	skip_line(gc);
+
+	struct Matrix_d* nodes = constructor_empty_Matrix_d('R',n_nodes,d); // returned
+	for (ptrdiff_t row = 0; row < n_nodes; ++row) {
+		read_int_gmsh(gc); // The node number is discarded.
+
+		double*const node_row = get_row_Matrix_d(row,nodes);
+		for (int dim = 0; dim < DMAX; ++dim) {
+			const double x = read_double_gmsh(gc);
+			if (dim < d)
+				node_row[dim] = x;
+		}
+	}
+	return nodes;
+}
 
-		fill_elements(row,elem_data,line);
+static struct Element_Data* read_elements (struct Gmsh_Cursor*const gc, const struct Gmsh_Entities*const entities)
+{
+	if (gc->version == 41)
+		return read_elements_v4(gc,entities);
+
+	// The number of elements is stored in ascii format for both file types.
+	const ptrdiff_t n_elems = parse_long(gc);
+	skip_line(gc);
+
+	struct Element_Data* elem_data = constructor_Element_Data(n_elems); // returned
+
+	for (ptrdiff_t row = 0; row < n_elems; ) {
+		// The element type and number of tags are given once per block of elements in the binary file format.
+		long elem_type = 0,
+		     n_tags    = 0;
+		ptrdiff_t n_block = 1;
+		if (gc->binary) {
+			elem_type = read_int_gmsh(gc);
+			n_block   = read_int_gmsh(gc);
+			n_tags    = read_int_gmsh(gc);
+		}
 
-		if (row++ == n_elems)
-			EXIT_UNSUPPORTED;
+		if (row+n_block > n_elems)
+			EXIT_ERROR("Inconsistent number of elements in the mesh file.\n");
+
+		for (ptrdiff_t n = 0; n < n_block; ++n, ++row) {
+			read_int_gmsh(gc); // The element number is discarded.
+			if (!gc->binary) {
+				elem_type = read_int_gmsh(gc);
+				n_tags    = read_int_gmsh(gc);
+			}
+			if (n_tags != GMSH_N_TAGS)
+				EXIT_UNSUPPORTED;
+
+			int tags[GMSH_N_TAGS];
+			for (int i = 0; i < GMSH_N_TAGS; ++i)
+				tags[i] = (int)read_int_gmsh(gc);
+
+			struct Vector_i*const node_nums = set_element(row,(int)elem_type,tags,elem_data);
+			for (int i = 0; i < node_nums->ext_0; ++i)
+				node_nums->data[i] = read_node_index(gc);
+			reorder_nodes_gmsh((int)elem_type,node_nums);
+		}
 	}
 	return elem_data;
 }
 
-static struct Matrix_i* read_periodic (FILE* mesh_file, const int d)
+static struct Matrix_i* read_periodic (struct Gmsh_Cursor*const gc, const int d)
 {
-	char line[STRLEN_MAX];
-	char* endptr = NULL;
-
-	if (fgets(line,sizeof(line),mesh_file) != NULL) {};
-	ptrdiff_t n_periodic_all = strtol(line,&endptr,10);
+	// The periodic section is stored in ascii format for both file types in the 2.2 file format.
+	const bool binary = gc->binary;
+	if (gc->version != 41)
+		gc->binary = false;
+
+	const ptrdiff_t n_periodic_all = (gc->version == 41 ? read_size_gmsh(gc) : parse_long(gc));
+	struct Matrix_i* periodic_corr = constructor_empty_Matrix_i('R',n_periodic_all,2); // returned
+
+	ptrdiff_t n_periodic = 0;
+	for (ptrdiff_t n = 0; n < n_periodic_all; ++n) {
+		const long dim_entity = read_int_gmsh(gc);
+		int tags[2];
+		for (int i = 0; i < 2; ++i)
+			tags[i] = (int)read_int_gmsh(gc);
+
+		if (gc->version == 41) {
+			const ptrdiff_t n_affine = read_size_gmsh(gc);
+			for (ptrdiff_t i = 0; i < n_affine; ++i)
+				read_double_gmsh(gc);
+		} else {
+			skip_space(gc);
+			if ((size_t)(gc->end-gc->pos) > strlen("Affine") && strncmp(gc->pos,"Affine",strlen("Affine")) == 0)
+				skip_line(gc);
+		}
 
-	// Skip over lower dimensional periodic entities if present
-	ptrdiff_t n_periodic_low = 0;
-	while (fgets(line,sizeof(line),mesh_file) != NULL) {
-		if (strstr(line,"$EndPeriodic"))
-			EXIT_UNSUPPORTED;
+		const ptrdiff_t n_nodes = (gc->version == 41 ? read_size_gmsh(gc) : parse_long(gc));
+		for (ptrdiff_t i = 0; i < 2*n_nodes; ++i) {
+			if (gc->version == 41)
+				read_size_gmsh(gc);
+			else
+				parse_long(gc);
+		}
 
-		ptrdiff_t dim_entity = strtol(line,&endptr,10);
+		if (dim_entity != d-1)
+			continue;
 
-		if (dim_entity < d-1) {
-			char* line_ptr[1] = {line};
-			skip_periodic_entity(mesh_file,line_ptr,sizeof(line));
-			++n_periodic_low;
-		} else {
-			break;
-		}
+		int*const corr = get_row_Matrix_i(n_periodic++,periodic_corr);
+		for (int i = 0; i < 2; ++i)
+			corr[i] = tags[i];
 	}
-
-	// Store periodic entity correspondence d-1 dimensional periodic entities.
-	ptrdiff_t n_periodic = n_periodic_all-n_periodic_low;
+	gc->binary = binary;
 
 	if (n_periodic == 0)
 		EXIT_UNSUPPORTED;
+	periodic_corr->ext_0 = n_periodic;
 
-	struct Matrix_i* periodic_corr = constructor_empty_Matrix_i('R',n_periodic,2);
+	return periodic_corr;
+}
 
-	ptrdiff_t row = 0;
-	do {
-		if (strstr(line,"$EndPeriodic"))
-			break;
-		char* line_ptr[1] = {line};
-		discard_line_values(line_ptr,1);
-		read_line_values_i(line_ptr,periodic_corr->ext_1,get_row_Matrix_i(row,periodic_corr),false);
-		skip_periodic_entity(mesh_file,line_ptr,sizeof(line));
+static void skip_line (struct Gmsh_Cursor*const gc)
+{
+	const char*const eol = memchr(gc->pos,'\n',(size_t)(gc->end-gc->pos));
+	gc->pos = (eol ? eol+1 : gc->end);
+}
 
-		if (row++ == n_periodic)
-			EXIT_UNSUPPORTED;
-	} while (fgets(line,sizeof(line),mesh_file) != NULL);
+static void skip_section (struct Gmsh_Cursor*const gc, const char*const name)
+{
+	char tag_end[STRLEN_MIN+4] = { 0, };
+	sprintf(tag_end,"$End%s",name);
+	const size_t len = strlen(tag_end);
 
-	return periodic_corr;
+	while (gc->pos < gc->end) {
+		const char*const pos = memchr(gc->pos,'$',(size_t)(gc->end-gc->pos));
+		if (!pos)
+			break;
+
+		gc->pos = pos+1;
+		if ((size_t)(gc->end-pos) >= len && memcmp(pos,tag_end,len) == 0) {
+			skip_line(gc);
+			return;
+		}
+	}
+	EXIT_ERROR("Did not find the end of the section: %s\n",name);
 }
 
 // Level 2 ********************************************************************************************************** //
 
-static void fill_nodes (double*const node_row, char* line, const int d)
+/** \brief Get the physical tag of the geometric entity.
+ *	\return See brief.
+ */
+static int get_physical_tag
+	(const struct Gmsh_Entities*const entities, ///< \ref Gmsh_Entities.
+	 const int dim,                             ///< The dimension of the entity.
+	 const int tag                              ///< The tag of the entity.
+	);
+
+/** \brief Get the dimension of the element of the given type.
+ *	\return See brief.
+ */
+static int get_elem_dim
+	(const int elem_type ///< The element type.
+	);
+
+static struct Matrix_d* read_nodes_v4 (struct Gmsh_Cursor*const gc, const int d)
 {
-	discard_line_values(&line,1);
+	const ptrdiff_t n_blocks = read_size_gmsh(gc),
+	                n_nodes  = read_size_gmsh(gc),
+	                tag_min  = read_size_gmsh(gc),
+	                tag_max  = read_size_gmsh(gc);
+	if (n_nodes > 0 && (tag_min != 1 || tag_max != n_nodes))
+		EXIT_ERROR("Unsupported: Non-contiguous node numbering (%td, %td, %td).\n",n_nodes,tag_min,tag_max);
+
+	struct Matrix_d* nodes = constructor_empty_Matrix_d('R',n_nodes,d); // returned
+	for (ptrdiff_t b = 0; b < n_blocks; ++b) {
+		const int dim_entity = (int)read_int_gmsh(gc);
+		read_int_gmsh(gc); // The entity tag is discarded.
+		const bool parametric = read_int_gmsh(gc);
+		const ptrdiff_t n_block = read_size_gmsh(gc);
+
+		// The node tags of the block are given before the coordinates.
+		ptrdiff_t*const tags = malloc((size_t)n_block * sizeof *tags); // free
+		for (ptrdiff_t n = 0; n < n_block; ++n) {
+			tags[n] = read_size_gmsh(gc);
+			if (tags[n] < 1 || tags[n] > n_nodes)
+				EXIT_ERROR("Invalid node tag: %td.\n",tags[n]);
+		}
 
-	char* endptr = NULL;
-	for (int dim = 0; dim < d; dim++) {
-		node_row[dim] = strtod(line,&endptr);
-		line = endptr;
+		const int n_param = (parametric ? dim_entity : 0);
+		for (ptrdiff_t n = 0; n < n_block; ++n) {
+			double*const node_row = get_row_Matrix_d(tags[n]-1,nodes);
+			for (int dim = 0; dim < DMAX+n_param; ++dim) {
+				const double x = read_double_gmsh(gc);
+				if (dim < d)
+					node_row[dim] = x;
+			}
+		}
+		free(tags);
 	}
+	return nodes;
+}
+
+static struct Element_Data* read_elements_v4 (struct Gmsh_Cursor*const gc, const struct Gmsh_Entities*const entities)
+{
+	if (!entities)
+		EXIT_ERROR("The $Entities section must precede the $Elements section.\n");
+
+	const ptrdiff_t n_blocks = read_size_gmsh(gc),
+	                n_elems  = read_size_gmsh(gc);
+	read_size_gmsh(gc); // The minimum and maximum element tags are discarded.
+	read_size_gmsh(gc);
+
+	struct Element_Data* elem_data = constructor_Element_Data(n_elems); // returned
+
+	ptrdiff_t row = 0;
+	for (ptrdiff_t b = 0; b < n_blocks; ++b) {
+		const int dim_entity = (int)read_int_gmsh(gc),
+		          tag_entity = (int)read_int_gmsh(gc),
+		          elem_type  = (int)read_int_gmsh(gc);
+		const ptrdiff_t n_block = read_size_gmsh(gc);
+
+		if (row+n_block > n_elems)
+			EXIT_ERROR("Inconsistent number of elements in the mesh file.\n");
+
+		const int tags[GMSH_N_TAGS] = { get_physical_tag(entities,dim_entity,tag_entity), tag_entity, };
+		for (ptrdiff_t n = 0; n < n_block; ++n, ++row) {
+			read_size_gmsh(gc); // The element tag is discarded.
+
+			struct Vector_i*const node_nums = set_element(row,elem_type,tags,elem_data);
+			for (int i = 0; i < node_nums->ext_0; ++i)
+				node_nums->data[i] = read_node_index(gc);
+			reorder_nodes_gmsh(elem_type,node_nums);
+		}
+	}
+	if (row != n_elems)
+		EXIT_ERROR("Inconsistent number of elements in the mesh file.\n");
+
+	return elem_data;
 }
 
 static struct Element_Data* constructor_Element_Data (const ptrdiff_t n_elems)
@@ -408,40 +708,155 @@ static struct Element_Data* constructor_Element_Data (const ptrdiff_t n_elems)
 
 	elem_data->n_elems = n_elems;
 
-	elem_data->elem_types = constructor_empty_Vector_i(n_elems);                    // keep
-	elem_data->elem_tags  = constructor_empty_Matrix_i('R',n_elems,GMSH_N_TAGS);    // keep
-	elem_data->node_nums  = constructor_empty_Multiarray_Vector_i(true,1,&n_elems); // keep
+	elem_data->elem_types   = constructor_empty_Vector_i(n_elems);                    // keep
+	elem_data->elem_tags    = constructor_empty_Matrix_i('R',n_elems,GMSH_N_TAGS);    // keep
+	elem_data->elem_per_dim = constructor_empty_Vector_i(DMAX+1);                     // keep
+	elem_data->node_nums    = constructor_empty_Multiarray_Vector_i(true,1,&n_elems); // keep
+
+	set_to_zero_Vector_i(elem_data->elem_per_dim);
 
 	return elem_data;
 }
 
-static void fill_elements (const ptrdiff_t row, struct Element_Data*const elem_data, char* line)
+static struct Vector_i* set_element
+	(const ptrdiff_t row, const int elem_type, const int*const tags, struct Element_Data*const elem_data)
 {
-	ptrdiff_t n_tags;
+	elem_data->elem_types->data[row] = elem_type;
+
+	int*const tags_r = get_row_Matrix_i(row,elem_data->elem_tags);
+	for (int i = 0; i < GMSH_N_TAGS; ++i)
+		tags_r[i] = tags[i];
 
-	discard_line_values(&line,1);
+	++elem_data->elem_per_dim->data[get_elem_dim(elem_type)];
 
-	read_line_values_i(&line,1,&elem_data->elem_types->data[row],false);
+	struct Vector_i*const node_nums = elem_data->node_nums->data[row];
+	resize_Vector_i(node_nums,get_n_nodes(elem_type));
+	return node_nums;
+}
 
-	read_line_values_l(&line,1,&n_tags,false);
-	if (n_tags != elem_data->elem_tags->ext_1)
+static int read_node_index (struct Gmsh_Cursor*const gc)
+{
+	const ptrdiff_t node_num = (gc->version == 41 ? read_size_gmsh(gc) : read_int_gmsh(gc));
+	if (!(node_num > 0))
 		EXIT_UNSUPPORTED;
+	return (int)(node_num-1);
+}
 
-	read_line_values_i(&line,n_tags,get_row_Matrix_i(row,elem_data->elem_tags),false);
+static long read_int_gmsh (struct Gmsh_Cursor*const gc)
+{
+	if (!gc->binary)
+		return parse_long(gc);
 
-	int n_nodes = get_n_nodes(elem_data->elem_types->data[row]);
-	resize_Vector_i(elem_data->node_nums->data[row],n_nodes);
+	int32_t val = 0;
+	read_bytes(gc,&val,sizeof(val));
+	return val;
+}
 
-	read_line_values_i(&line,n_nodes,elem_data->node_nums->data[row]->data,true);
-	reorder_nodes_gmsh(elem_data->elem_types->data[row],elem_data->node_nums->data[row]);
+static ptrdiff_t read_size_gmsh (struct Gmsh_Cursor*const gc)
+{
+	if (!gc->binary)
+		return parse_long(gc);
+
+	uint64_t val = 0;
+	read_bytes(gc,&val,sizeof(val));
+	return (ptrdiff_t)val;
+}
+
+static double read_double_gmsh (struct Gmsh_Cursor*const gc)
+{
+	if (!gc->binary)
+		return parse_double(gc);
+
+	double val = 0.0;
+	read_bytes(gc,&val,sizeof(val));
+	return val;
 }
 
-static void skip_periodic_entity (FILE* file, char**const line, const int line_size)
+static long parse_long (struct Gmsh_Cursor*const gc)
 {
+	skip_space(gc);
+
+	const char* pos = gc->pos;
+	const bool negative = (pos < gc->end && *pos == '-');
+	if (pos < gc->end && (*pos == '-' || *pos == '+'))
+		++pos;
+	if (!(pos < gc->end && isdigit((unsigned char)*pos)))
+		EXIT_ERROR("Expected an integer in the mesh file.\n");
+
+	long val = 0;
+	for ( ; pos < gc->end && isdigit((unsigned char)*pos); ++pos)
+		val = 10*val + (*pos-'0');
+
+	gc->pos = pos;
+	return (negative ? -val : val);
+}
+
+static double parse_double (struct Gmsh_Cursor*const gc)
+{
+	skip_space(gc);
+
+	// The token is copied as the mapped file is not null-terminated.
+	char token[STRLEN_MIN];
+	int len = 0;
+	for ( ; len < STRLEN_MIN-1 && gc->pos+len < gc->end && !isspace((unsigned char)gc->pos[len]); ++len)
+		token[len] = gc->pos[len];
+	token[len] = '\0';
+
 	char* endptr = NULL;
+	const double val = strtod(token,&endptr);
+	if (endptr == token)
+		EXIT_ERROR("Expected a floating point value in the mesh file.\n");
+
+	gc->pos += endptr-token;
+	return val;
+}
+
+static void read_bytes (struct Gmsh_Cursor*const gc, void*const dest, const size_t size)
+{
+	if ((size_t)(gc->end-gc->pos) < size)
+		EXIT_ERROR("The mesh file is truncated.\n");
+
+	memcpy(dest,gc->pos,size);
+	gc->pos += size;
+}
+
+static void skip_space (struct Gmsh_Cursor*const gc)
+{
+	while (gc->pos < gc->end && isspace((unsigned char)*gc->pos))
+		++gc->pos;
+}
+
+// Level 3 ********************************************************************************************************** //
+
+static int get_physical_tag (const struct Gmsh_Entities*const entities, const int dim, const int tag)
+{
+	assert(dim >= 0 && dim <= DMAX);
 
-	if (fgets(*line,line_size,file) != NULL) {};
-	ptrdiff_t n_skip = strtol(*line,&endptr,10);
+	const struct Matrix_i*const tags = entities->tags[dim];
+	for (ptrdiff_t n = 0; n < tags->ext_0; ++n) {
+		if (tags->data[2*n] == tag)
+			return tags->data[2*n+1];
+	}
+	EXIT_ERROR("Did not find the entity (dim: %d, tag: %d).\n",dim,tag);
+}
 
-	skip_lines_ptr(file,line,line_size,(int)n_skip);
+static int get_elem_dim (const int elem_type)
+{
+	switch (elem_type) {
+	case POINT:
+		return 0;
+		break;
+	case LINE:
+		return 1;
+		break;
+	case TRI: case QUAD:
+		return 2;
+		break;
+	case TET: case HEX: case WEDGE: case PYR:
+		return 3;
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",elem_type);
+		break;
+	}
 }
@@ -31,6 +31,12 @@ You should have received a copy of the GNU General Public License along with DPG
 #define mm_NN1_Operator_Multiarray_T  mm_NN1_Operator_Multiarray_d
 ///\}
 
+///\{ \name Static names
+#define mm_tp_NNC_Multiarray_T  mm_tp_NNC_Multiarray_d
+#define mm_csr_NNC_Multiarray_T mm_csr_NNC_Multiarray_d
+#define mm_sub_operator_T       mm_sub_operator_d
+///\}
+
 #elif TYPE_RC == TYPE_COMPLEX
 
 ///\{ \name Function names
@@ -46,6 +52,12 @@ You should have received a copy of the GNU General Public License along with DPG
 #define mm_NN1_Operator_Multiarray_T  mm_NN1_Operator_Multiarray_c
 ///\}
 
+///\{ \name Static names
+#define mm_tp_NNC_Multiarray_T  mm_tp_NNC_Multiarray_c
+#define mm_csr_NNC_Multiarray_T mm_csr_NNC_Multiarray_c
+#define mm_sub_operator_T       mm_sub_operator_c
+///\}
+
 #endif
 
 
@@ -53,5 +65,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_mm_NN1_Operator_Multiarray_R       constructor_mm_NN1_Operator_Multiarray_d
 #define constructor_mm_NN1_Operator_const_Multiarray_R constructor_mm_NN1_Operator_const_Multiarray_d
 
+#define set_ops_tp_n_rows_cols_R set_ops_tp_n_rows_cols
+
 #define mm_NN1C_Operator_Multiarray_R mm_NN1C_Operator_Multiarray_d
 ///\}
@@ -37,6 +37,8 @@ struct mutable_Multiarray_Operator {
 
 	bool owns_data;                 ///< Defined in \ref Multiarray_Operator.
 	struct mutable_Operator** data; ///< Defined in \ref Multiarray_Operator.
+
+	struct Lazy_Operators* lazy; ///< Defined in \ref Multiarray_Operator.
 };
 
 /** \brief Move constructor for a \ref Multiarray_Operator\* with the input extents having been previously
@@ -74,6 +76,13 @@ static struct mutable_Multiarray_Operator* alloc_mutable_MO_from_MO
 	 const ptrdiff_t*const sub_indices        ///< Defined for \ref set_mutable_MO_from_MO.
 	);
 
+/// \brief Construct any of the operators in the input index range which have not yet been constructed.
+static void construct_lazy_Multiarray_Operator
+	(const struct Multiarray_Operator*const src, ///< The source.
+	 const ptrdiff_t ind_b,                      ///< The first index of the range.
+	 const ptrdiff_t ind_e                       ///< One past the last index of the range.
+	);
+
 /// \brief Print the counter for the indices.
 static void print_counter_MaO
 	(const int order,              ///< Defined in \ref Multiarray_T.
@@ -115,6 +124,25 @@ const struct Multiarray_Operator* constructor_empty_Multiarray_Operator
 	return constructor_move_Multiarray_Operator_dyn_extents(order,extents,true,data);
 }
 
+void set_lazy_Multiarray_Operator
+	(const struct Multiarray_Operator*const op, void*const data, const construct_operators_lazy_fptr construct,
+	 const destructor_lazy_data_fptr destructor)
+{
+	struct mutable_Multiarray_Operator*const op_m = (struct mutable_Multiarray_Operator*) op;
+	assert(op_m->owns_data);
+	assert(op_m->lazy == NULL);
+
+	const ptrdiff_t size = compute_size(op_m->order,op_m->extents);
+
+	struct Lazy_Operators*const lazy = malloc(sizeof *lazy); // keep
+	lazy->data       = data;
+	lazy->construct  = construct;
+	lazy->destructor = destructor;
+	lazy->is_set     = calloc((size_t)size,sizeof *lazy->is_set); // keep
+
+	op_m->lazy = lazy;
+}
+
 // Destructors ****************************************************************************************************** //
 
 void destructor_Multiarray_Operator (const struct Multiarray_Operator* a)
@@ -151,6 +179,8 @@ struct Multiarray_Operator set_MO_from_MO
 {
 	struct mutable_Multiarray_Operator dest =
 		set_mutable_MO_from_MO((struct mutable_Multiarray_Operator*)src,order_o,sub_indices);
+	const ptrdiff_t ind_b = (const struct Operator**)dest.data-(const struct Operator**)src->data;
+	construct_lazy_Multiarray_Operator(src,ind_b,ind_b+dest.extents[0]);
 	return *(struct Multiarray_Operator*)& dest;
 }
 
@@ -159,6 +189,8 @@ const struct Multiarray_Operator* alloc_MO_from_MO
 {
 	struct mutable_Multiarray_Operator* dest =
 		alloc_mutable_MO_from_MO((struct mutable_Multiarray_Operator*)src,order_o,sub_indices);
+	const ptrdiff_t ind_b = (const struct Operator**)dest->data-(const struct Operator**)src->data;
+	construct_lazy_Multiarray_Operator(src,ind_b,ind_b+dest->extents[0]);
 	return (const struct Multiarray_Operator*) dest;
 }
 
@@ -171,7 +203,16 @@ const struct Operator* get_Multiarray_Operator
 	(const struct Multiarray_Operator* src, const ptrdiff_t*const sub_indices)
 {
 	assert(src != NULL);
-	const struct Operator*const op = src->data[compute_index_sub_container(src->order,0,src->extents,sub_indices)];
+	return get_Multiarray_Operator_ind(src,compute_index_sub_container(src->order,0,src->extents,sub_indices));
+}
+
+const struct Operator* get_Multiarray_Operator_ind (const struct Multiarray_Operator* src, const ptrdiff_t ind)
+{
+	assert(src != NULL);
+	assert(ind >= 0 && ind < compute_size(src->order,src->extents));
+	construct_lazy_Multiarray_Operator(src,ind,ind+1);
+
+	const struct Operator*const op = src->data[ind];
 	assert(op != NULL);
 	return op;
 }
@@ -197,7 +238,7 @@ void print_Multiarray_Operator_tol (const struct Multiarray_Operator*const a, co
 
 	for (ptrdiff_t i = 0; i < size; i++) {
 		print_counter_MaO(order,counter);
-		print_Operator_tol(a->data[i],tol);
+		print_Operator_tol(get_Multiarray_Operator_ind(a,i),tol);
 		increment_counter_MaO(order,extents,counter);
 	}
 	printf("\n");
@@ -246,6 +287,12 @@ static void destructor_mutable_Multiarray_Operator (struct mutable_Multiarray_Op
 	}
 	free(a->data);
 	free(a->extents);
+
+	if (a->lazy) {
+		a->lazy->destructor(a->lazy->data);
+		free(a->lazy->is_set);
+		free(a->lazy);
+	}
 	free(a);
 }
 
@@ -261,6 +308,7 @@ static struct mutable_Multiarray_Operator set_mutable_MO_from_MO
 	dest.order     = order_o;
 	dest.extents   = src->extents;
 	dest.data      = &src->data[compute_index_sub_container(src->order,dest.order,src->extents,sub_indices)];
+	dest.lazy      = NULL;
 
 	return dest;
 }
@@ -277,10 +325,42 @@ static struct mutable_Multiarray_Operator* alloc_mutable_MO_from_MO
 	dest->order     = order_o;
 	dest->extents   = src->extents;
 	dest->data      = &src->data[compute_index_sub_container(src->order,dest->order,src->extents,sub_indices)];
+	dest->lazy      = NULL;
 
 	return dest;
 }
 
+static void construct_lazy_Multiarray_Operator
+	(const struct Multiarray_Operator*const src, const ptrdiff_t ind_b, const ptrdiff_t ind_e)
+{
+	struct Lazy_Operators*const lazy = src->lazy;
+	if (lazy == NULL)
+		return;
+
+	bool*const is_set = lazy->is_set;
+	for (ptrdiff_t i = ind_b; i < ind_e; ++i) {
+		bool is_set_i = false;
+		PRAGMA_OMP(atomic read seq_cst)
+		is_set_i = is_set[i];
+		if (is_set_i)
+			continue;
+
+		// The operator constructors are not thread-safe (e.g. the Operator_Info is modified while operators are set).
+		PRAGMA_OMP(critical (lazy_operators))
+		{
+			if (!is_set[i]) {
+				ptrdiff_t ind_range[2] = { i, i+1, };
+				lazy->construct(ind_range,src,i,lazy->data);
+				assert(ind_range[0] <= i && i < ind_range[1]);
+				for (ptrdiff_t j = ind_range[0]; j < ind_range[1]; ++j) {
+					PRAGMA_OMP(atomic write seq_cst)
+					is_set[j] = true;
+				}
+			}
+		}
+	}
+}
+
 static void print_counter_MaO (const int order, const ptrdiff_t*const counter)
 {
 	printf("{");
@@ -23,6 +23,46 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stddef.h>
 
 struct const_Vector_i;
+struct Multiarray_Operator;
+
+/** \brief Function pointer to a function constructing the operator(s) of a lazily constructed
+ *         \ref Multiarray_Operator\* which include the operator at the input index.
+ *
+ *  \param ind_range Set to the range [begin,end) of the indices of the operators which were constructed.
+ *  \param op        The multiarray of operators.
+ *  \param ind       The index of the operator which is required.
+ *  \param data      \ref Lazy_Operators::data.
+ */
+typedef void (*construct_operators_lazy_fptr)
+	(ptrdiff_t ind_range[2],
+	 const struct Multiarray_Operator*const op,
+	 const ptrdiff_t ind,
+	 void*const data
+	);
+
+/** \brief Function pointer to the destructor for \ref Lazy_Operators::data.
+ *
+ *  \param data \ref Lazy_Operators::data.
+ */
+typedef void (*destructor_lazy_data_fptr)
+	(void*const data
+	);
+
+/** \brief Container for the information required for the construction of the operators of a \ref Multiarray_Operator
+ *         only when they are first accessed.
+ *
+ *  The operators are constructed in \ref get_Multiarray_Operator, \ref set_MO_from_MO and \ref alloc_MO_from_MO
+ *  such that operators which are never used (e.g. for polynomial degrees or h-refinement indices which are not present
+ *  in the mesh) are never constructed. The construction is serialized when called from within threaded regions.
+ */
+struct Lazy_Operators {
+	void* data; ///< The data required for the construction of the operators.
+
+	construct_operators_lazy_fptr construct; ///< \ref construct_operators_lazy_fptr.
+	destructor_lazy_data_fptr destructor;    ///< \ref destructor_lazy_data_fptr.
+
+	bool* is_set; ///< Flags indicating which of the operators have already been constructed.
+};
 
 /// Container holding the multiarray of operators in various formats.
 struct Multiarray_Operator {
@@ -31,6 +71,9 @@ struct Multiarray_Operator {
 
 	const bool owns_data;                   ///< Defined in \ref Multiarray_T.
 	const struct Operator*const*const data; ///< The array of pointers to \ref Operator containers.
+
+	/// \ref Lazy_Operators. `NULL` if all operators were constructed with the container (and for sub-range views).
+	struct Lazy_Operators*const lazy;
 };
 
 // Constructor functions ******************************************************************************************** //
@@ -55,6 +98,18 @@ const struct Multiarray_Operator* constructor_empty_Multiarray_Operator_V
 	(const struct const_Vector_i*const extents_i_V ///< The input extents in vector format.
 	);
 
+/** \brief Set the \ref Multiarray_Operator::lazy member such that the operators are constructed on first access.
+ *
+ *  The input \ref Multiarray_Operator\* must have been constructed using \ref constructor_empty_Multiarray_Operator
+ *  with none of the operators having been set.
+ */
+void set_lazy_Multiarray_Operator
+	(const struct Multiarray_Operator*const op,     ///< The multiarray of operators.
+	 void*const data,                               ///< \ref Lazy_Operators::data.
+	 const construct_operators_lazy_fptr construct, ///< \ref Lazy_Operators::construct.
+	 const destructor_lazy_data_fptr destructor     ///< \ref Lazy_Operators::destructor.
+	);
+
 // Destructors ****************************************************************************************************** //
 
 /// \brief Destructs a \ref Multiarray_Operator\*.
@@ -108,6 +163,13 @@ const struct Operator* get_Multiarray_Operator
 	 const ptrdiff_t*const sub_indices      ///< The sub-indices specifying which part of the source to extract.
 	);
 
+/** \brief Version of \ref get_Multiarray_Operator taking the index of the operator as input.
+ *  \return See brief. */
+const struct Operator* get_Multiarray_Operator_ind
+	(const struct Multiarray_Operator* src, ///< The source.
+	 const ptrdiff_t ind                    ///< The index of the operator.
+	);
+
 // Printing functions *********************************************************************************************** //
 
 /// \brief Print a \ref Multiarray_Operator\* to the terminal displaying entries below the default tolerance as 0.0.
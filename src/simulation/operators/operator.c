@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "operator.h"
 #include <assert.h>
+#include <math.h>
 
 #include "macros.h"
 #include "definitions_core.h"
@@ -25,6 +26,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "multiarray.h"
 #include "matrix.h"
 
+#include "mapped_file.h"
+#include "profiling.h"
+
 // Templated functions ********************************************************************************************** //
 
 #include "def_templates_type_d.h"
@@ -37,6 +41,12 @@ You should have received a copy of the GNU General Public License along with DPG
 
 // Static function declarations ************************************************************************************* //
 
+/// \brief Print a \ref const_Matrix_CSR_T\* to the terminal as a list of (row, column, value) entries.
+static void print_const_Matrix_CSR_d_tol
+	(const struct const_Matrix_CSR_d*const a, ///< Standard.
+	 const double tol                         ///< The tolerance below which values are printed as 0.
+	);
+
 // Interface functions ********************************************************************************************** //
 // Destructors ****************************************************************************************************** //
 
@@ -54,11 +64,31 @@ void destructor_mutable_Operator (struct mutable_Operator* op)
 		destructor_Multiarray_Matrix_d(op->ops_tp);
 	}
 	if (op->op_csr)
-		EXIT_ADD_SUPPORT;
-//		destructor_Matrix_CSR_d(op->op_csr);
+		destructor_Matrix_CSR_d(op->op_csr);
+	if (op->op_csr_mkl)
+		destructor_sparse_matrix_mkl(op->op_csr_mkl);
+	if (op->op_std_map)
+		destructor_Mapped_File(op->op_std_map);
 	free(op);
 }
 
+struct sparse_matrix* constructor_sparse_matrix_mkl (const struct const_Matrix_CSR_d*const a)
+{
+	sparse_matrix_t a_mkl = NULL;
+	const sparse_status_t status =
+		mkl_sparse_d_create_csr(&a_mkl,SPARSE_INDEX_BASE_ZERO,(MKL_INT)a->ext_0,(MKL_INT)a->ext_1,
+		                        (MKL_INT*)a->row_index,(MKL_INT*)&a->row_index[1],(MKL_INT*)a->columns,
+		                        (double*)a->data); // returned
+	if (status != SPARSE_STATUS_SUCCESS)
+		EXIT_ERROR("Failed to create the mkl sparse matrix (status: %d).",status);
+	return a_mkl;
+}
+
+void destructor_sparse_matrix_mkl (struct sparse_matrix*const a_mkl)
+{
+	mkl_sparse_destroy(a_mkl);
+}
+
 // Printing functions *********************************************************************************************** //
 
 void print_Operator (const struct Operator*const a)
@@ -89,7 +119,7 @@ void print_Operator_tol (const struct Operator*const a, const double tol)
 	printf("%-35s","\tsparse (CSR) operator:");
 	if (a->op_csr) {
 		printf("\n\n");
-		EXIT_ADD_SUPPORT;
+		print_const_Matrix_CSR_d_tol(a->op_csr,tol);
 	} else {
 		printf("*** NULL ***\n");
 	}
@@ -98,3 +128,15 @@ void print_Operator_tol (const struct Operator*const a, const double tol)
 
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
+
+static void print_const_Matrix_CSR_d_tol (const struct const_Matrix_CSR_d*const a, const double tol)
+{
+	printf("(ext_0, ext_1, n_nz): (%td, %td, %d)\n\n",a->ext_0,a->ext_1,a->row_index[a->ext_0]);
+	for (ptrdiff_t i = 0; i < a->ext_0; ++i) {
+		for (int ind = a->row_index[i]; ind < a->row_index[i+1]; ++ind) {
+			const double val = a->data[ind];
+			printf("\t(%td, %d): % .4e\n",i,a->columns[ind],(fabs(val) > tol ? val : 0.0));
+		}
+	}
+	printf("\n");
+}
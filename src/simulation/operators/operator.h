@@ -35,12 +35,20 @@ struct Operator;
 struct const_Multiarray_d;
 struct Multiarray_d;
 struct const_Multiarray_Matrix_c;
+struct Mapped_File;
+struct sparse_matrix;
 
 /// Container holding the operator matrices in various formats.
 struct Operator {
 	const struct const_Matrix_d*const op_std;             ///< The standard dense matrix operator.
 	const struct const_Multiarray_Matrix_d*const  ops_tp; ///< The multiarray of tensor-product sub-operators.
 	const struct const_Matrix_CSR_d*const op_csr;         ///< The sparse matrix operator in CSR format.
+
+	/// The mkl handle (`sparse_matrix_t`) for \ref Operator::op_csr (constructed along with the sparse operator).
+	struct sparse_matrix*const op_csr_mkl;
+
+	/// The memory mapped file holding the data of \ref Operator::op_std if it was read from the operator cache.
+	const struct Mapped_File*const op_std_map;
 };
 
 /// `mutable` version of \ref Operator
@@ -48,6 +56,9 @@ struct mutable_Operator {
 	struct Matrix_d* op_std;            ///< The standard dense matrix operator.
 	struct Multiarray_Matrix_d* ops_tp; ///< The multiarray of tensor-product sub-operators.
 	struct Matrix_CSR_d* op_csr;        ///< The sparse matrix operator in CSR format.
+	struct sparse_matrix* op_csr_mkl;   ///< Defined in \ref Operator.
+
+	const struct Mapped_File* op_std_map; ///< Defined in \ref Operator.
 };
 
 // Templated functions ********************************************************************************************** //
@@ -65,6 +76,17 @@ void destructor_mutable_Operator
 	(struct mutable_Operator* op ///< Standard.
 	);
 
+/** \brief Constructor for the mkl sparse matrix handle (see \ref Operator::op_csr_mkl) of the input sparse matrix.
+ *  \return Standard. */
+struct sparse_matrix* constructor_sparse_matrix_mkl
+	(const struct const_Matrix_CSR_d*const a ///< The sparse matrix.
+	);
+
+/// \brief Destructor for a mkl sparse matrix handle.
+void destructor_sparse_matrix_mkl
+	(struct sparse_matrix*const a_mkl ///< Standard.
+	);
+
 // Printing functions *********************************************************************************************** //
 
 /// \brief Print a \ref Operator\* to the terminal displaying entries below the default tolerance as 0.0.
@@ -17,6 +17,8 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "operator.h"
 #include <assert.h>
+#include "definitions_mkl.h"
+#include "mkl.h"
 
 #include "macros.h"
 #include "definitions_core.h"
@@ -27,6 +29,35 @@ You should have received a copy of the GNU General Public License along with DPG
 
 // Static function declarations ************************************************************************************* //
 
+/** \brief Version of \ref mm_NNC_Operator_Multiarray_T applying the tensor-product sub-operators successively in each
+ *         of the coordinate directions (i.e. using sum factorization).
+ *
+ *  For an operator of order p in d dimensions, this reduces the cost of the operator application from O(p^{2d}) to
+ *  O(d p^{d+1}) operations. The inputs are the same as those of \ref mm_NNC_Multiarray_T with the standard operator
+ *  replaced by the multiarray of sub-operators (\ref Operator::ops_tp).
+ */
+static void mm_tp_NNC_Multiarray_T
+	(const Real alpha,                                  ///< Defined for \ref mm_T.
+	 const Real beta,                                   ///< Defined for \ref mm_T.
+	 const struct const_Multiarray_Matrix_d*const a_tp, ///< The tensor-product sub-operators.
+	 const struct const_Multiarray_T*const b,           ///< Input `b`.
+	 struct Multiarray_T*const c                        ///< Output `c`.
+	);
+
+/** \brief Version of \ref mm_NNC_Operator_Multiarray_T using the sparse (CSR) operator.
+ *
+ *  The intel mkl sparse-times-dense kernel is used for real data; the complex data (for which the operator and input
+ *  types differ) is treated using a direct loop over the non-zero entries.
+ */
+static void mm_csr_NNC_Multiarray_T
+	(const Real alpha,                        ///< Defined for \ref mm_T.
+	 const Real beta,                         ///< Defined for \ref mm_T.
+	 const struct const_Matrix_CSR_d*const a, ///< The sparse operator.
+	 struct sparse_matrix*const a_mkl,        ///< The mkl handle for the sparse operator (\ref Operator::op_csr_mkl).
+	 const struct const_Multiarray_T*const b, ///< Input `b`.
+	 struct Multiarray_T*const c              ///< Output `c`.
+	);
+
 // Interface functions ********************************************************************************************** //
 // Constructors ***************************************************************************************************** //
 
@@ -137,12 +168,32 @@ void mm_NNC_Operator_Multiarray_T
 			c->layout,order_sub_ma,extents_c,false,&c->data[ind_sub_c]); // destructed
 	}
 
+	const ptrdiff_t n_col = compute_size(b_op->order,b_op->extents)/extents_b[0];
+	const int n_real = (int)(sizeof(Type)/sizeof(Real));
+
 	switch (op_format) {
 	case 'd': // fallthrough
-	case 's': mm_NNC_Multiarray_T(alpha,beta,op->op_std,b_op,c_op);    break;
-//	case 't': mm_tp_NNC_Multiarray_T(alpha,beta,op->ops_tp,b_op,c_op); break;
+	case 's':
+		mm_NNC_Multiarray_T(alpha,beta,op->op_std,b_op,c_op);
+		add_profile_mm(op->op_std->ext_0,op->op_std->ext_1,n_col,n_real);
+		break;
+	case 't':
+		// Tensor-product sub-operators are not available for all operators (e.g. those of simplex elements).
+		if (op->ops_tp) {
+			mm_tp_NNC_Multiarray_T(alpha,beta,op->ops_tp,b_op,c_op);
+		} else {
+			mm_NNC_Multiarray_T(alpha,beta,op->op_std,b_op,c_op);
+			add_profile_mm(op->op_std->ext_0,op->op_std->ext_1,n_col,n_real);
+		}
+		break;
 	case 'c':
-		EXIT_ADD_SUPPORT;
+		// Sparse operators are only stored when their density is below the threshold (see \ref OP_CSR_DENSITY_MAX).
+		if (op->op_csr) {
+			mm_csr_NNC_Multiarray_T(alpha,beta,op->op_csr,op->op_csr_mkl,b_op,c_op);
+		} else {
+			mm_NNC_Multiarray_T(alpha,beta,op->op_std,b_op,c_op);
+			add_profile_mm(op->op_std->ext_0,op->op_std->ext_1,n_col,n_real);
+		}
 		break;
 	default:
 		EXIT_ERROR("Unsupported: %c\n",op_format);
@@ -185,5 +236,157 @@ void mm_NN1_Operator_Multiarray_T
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
+/** \brief Apply the real sub-operator in one of the coordinate directions to the input data.
+ *
+ *  The input data is interpreted as a column-major array with extents (n_p,a->ext_1,n_q) and the output has extents
+ *  (n_p,a->ext_0,n_q). */
+static void mm_sub_operator_T
+	(const Real alpha,                    ///< Defined for \ref mm_T.
+	 const Real beta,                     ///< Defined for \ref mm_T.
+	 const struct const_Matrix_d*const a, ///< The sub-operator.
+	 const ptrdiff_t n_p,                 ///< The product of the extents preceding the operator direction.
+	 const ptrdiff_t n_q,                 ///< The product of the extents following the operator direction.
+	 const Real*const b,                  ///< The input data.
+	 Real*const c                         ///< The output data.
+	);
+
+static void mm_tp_NNC_Multiarray_T
+	(const Real alpha, const Real beta, const struct const_Multiarray_Matrix_d*const a_tp,
+	 const struct const_Multiarray_T*const b, struct Multiarray_T*const c)
+{
+	assert(a_tp->order == 1);
+	assert(b->layout == 'C');
+	assert(c->layout == 'C');
+
+	int n_rows_sub[DMAX] = { 0, 0, 0, },
+	    n_cols_sub[DMAX] = { 0, 0, 0, };
+	set_ops_tp_n_rows_cols_R(n_rows_sub,n_cols_sub,a_tp);
+
+	const ptrdiff_t ext_0_b = b->extents[0],
+	                ext_1   = compute_size(b->order,b->extents)/ext_0_b;
+	assert(ext_0_b == n_cols_sub[0]*n_cols_sub[1]*n_cols_sub[2]);
+	assert(c->extents[0] == n_rows_sub[0]*n_rows_sub[1]*n_rows_sub[2]);
+
+	const int d_op = (int)compute_size(a_tp->order,a_tp->extents);
+	int d_last = -1;
+	for (int d = 0; d < d_op; ++d) {
+		if (a_tp->data[d])
+			d_last = d;
+	}
+	assert(d_last >= 0);
+
+	/* The complex entries are stored contiguously such that the real sub-operators can be applied to the data
+	 * interpreted as being real with an additional leading extent of 2. */
+	const ptrdiff_t n_real = (ptrdiff_t)(sizeof(Type)/sizeof(Real));
+
+	// If only the first direction has a sub-operator, it is equal to the standard operator and is applied directly.
+	if (d_last == 0) {
+		mm_sub_operator_T(alpha,beta,a_tp->data[0],n_real,ext_1,(const Real*)b->data,(Real*)c->data);
+		return;
+	}
+
+	// The (r,s,t) indices of the input/output vary fastest in the r-direction.
+	ptrdiff_t ext_curr[DMAX] = { n_cols_sub[0], n_cols_sub[1], n_cols_sub[2], };
+
+	Real* data_tmp[DMAX] = { NULL, NULL, NULL, };
+	const Real* data_i = (const Real*) b->data;
+	for (int d = 0; d <= d_last; ++d) {
+		const struct const_Matrix_d*const a = a_tp->data[d];
+		if (!a)
+			continue;
+
+		ptrdiff_t n_p = n_real,
+		          n_q = ext_1;
+		for (int i = 0; i < d; ++i)
+			n_p *= ext_curr[i];
+		for (int i = d+1; i < DMAX; ++i)
+			n_q *= ext_curr[i];
+		ext_curr[d] = n_rows_sub[d];
+
+		Real* data_o = NULL;
+		if (d == d_last) {
+			data_o = (Real*) c->data;
+			mm_sub_operator_T(alpha,beta,a,n_p,n_q,data_i,data_o);
+		} else {
+			data_tmp[d] = malloc((size_t)(n_p*ext_curr[d]*n_q) * sizeof *data_tmp[d]); // free
+			data_o = data_tmp[d];
+			mm_sub_operator_T(1.0,0.0,a,n_p,n_q,data_i,data_o);
+		}
+		data_i = data_o;
+	}
+
+	for (int d = 0; d < DMAX; ++d)
+		free(data_tmp[d]);
+}
+
+static void mm_csr_NNC_Multiarray_T
+	(const Real alpha, const Real beta, const struct const_Matrix_CSR_d*const a, struct sparse_matrix*const a_mkl,
+	 const struct const_Multiarray_T*const b, struct Multiarray_T*const c)
+{
+	assert(b->layout == 'C');
+	assert(c->layout == 'C');
+
+	const ptrdiff_t ext_0_b = b->extents[0],
+	                ext_0_c = c->extents[0],
+	                ext_1   = compute_size(b->order,b->extents)/ext_0_b;
+	assert(ext_0_b == a->ext_1);
+	assert(ext_0_c == a->ext_0);
+	assert(ext_1 == compute_size(c->order,c->extents)/ext_0_c);
+
+	const double n_nz = a->row_index[a->ext_0],
+	             n_real = (double)(sizeof(Type)/sizeof(Real));
+	add_profile_kernel(2.0*n_nz*(double)ext_1*n_real,
+	                   n_nz*(sizeof(Real)+sizeof(int)) + (double)((ext_0_b+ext_0_c)*ext_1)*sizeof(Type));
+
+#if TYPE_RC == TYPE_REAL
+	assert(a_mkl != NULL);
+	const struct matrix_descr descr = { .type = SPARSE_MATRIX_TYPE_GENERAL, };
+	const sparse_status_t status =
+		mkl_sparse_d_mm(SPARSE_OPERATION_NON_TRANSPOSE,alpha,a_mkl,descr,SPARSE_LAYOUT_COLUMN_MAJOR,
+		                b->data,(MKL_INT)ext_1,(MKL_INT)ext_0_b,beta,c->data,(MKL_INT)ext_0_c);
+	if (status != SPARSE_STATUS_SUCCESS)
+		EXIT_ERROR("Failed to apply the mkl sparse matrix (status: %d).",status);
+#else
+	UNUSED(a_mkl);
+	for (ptrdiff_t j = 0; j < ext_1; ++j) {
+		const Type*const b_j = &b->data[j*ext_0_b];
+		Type*const c_j       = &c->data[j*ext_0_c];
+		for (ptrdiff_t i = 0; i < ext_0_c; ++i) {
+			Type sum = 0.0;
+			for (int ind = a->row_index[i]; ind < a->row_index[i+1]; ++ind)
+				sum += a->data[ind]*b_j[a->columns[ind]];
+			c_j[i] = ( beta == 0.0 ? alpha*sum : alpha*sum + beta*c_j[i] );
+		}
+	}
+#endif
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static void mm_sub_operator_T
+	(const Real alpha, const Real beta, const struct const_Matrix_d*const a, const ptrdiff_t n_p, const ptrdiff_t n_q,
+	 const Real*const b, Real*const c)
+{
+	const MKL_INT n_r = (MKL_INT) a->ext_0,
+	              n_c = (MKL_INT) a->ext_1;
+	add_profile_mm(a->ext_0,a->ext_1,n_p*n_q,1);
+
+	// Row-major storage of `a` corresponds to column-major storage of its transpose.
+	const bool row_major = ( a->layout == 'R' );
+	const MKL_INT lda    = ( row_major ? n_c : n_r );
+
+	if (n_p == 1) {
+		// c(n_r,n_q) = a*b(n_c,n_q)
+		const CBLAS_TRANSPOSE transa = ( row_major ? CBT : CBNT );
+		cblas_dgemm(CBCM,transa,CBNT,n_r,(MKL_INT)n_q,n_c,alpha,a->data,lda,b,n_c,beta,c,n_r);
+	} else {
+		// c_q(n_p,n_r) = b_q(n_p,n_c)*a^T for each of the n_q sub-blocks.
+		const CBLAS_TRANSPOSE transb = ( row_major ? CBNT : CBT );
+		const MKL_INT m = (MKL_INT) n_p;
+		for (ptrdiff_t q = 0; q < n_q; ++q)
+			cblas_dgemm(CBCM,CBNT,transb,m,n_r,n_c,alpha,&b[q*n_p*n_c],m,a->data,lda,beta,&c[q*n_p*n_r],m);
+	}
+}
+
 #include "undef_templates_operators.h"
 #include "undef_templates_multiarray.h"
@@ -22,8 +22,10 @@ You should have received a copy of the GNU General Public License along with DPG
  *  When used for matrix multiplication, the supported operator formats are denoted by the following `char`s:
  *  - 'd'efault -> standard.
  *  - 's'tandard;
- *  - 't'ensor-product;
- *  - 'c'sr.
+ *  - 't'ensor-product (sum factorization; falls back to the standard operator if the sub-operators are not available);
+ *  - 'c'sr (sparse; falls back to the standard operator if its density exceeds \ref OP_CSR_DENSITY_MAX).
+ *
+ *  The format is selected using the `op_format` parameter of the control file (see \ref get_set_op_format).
  */
 
 #include <stddef.h>
@@ -27,8 +27,14 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef mm_NN1C_Operator_Multiarray_T
 #undef mm_NN1_Operator_Multiarray_T
 
+#undef mm_tp_NNC_Multiarray_T
+#undef mm_csr_NNC_Multiarray_T
+#undef mm_sub_operator_T
+
 
 #undef constructor_mm_NN1_Operator_Multiarray_R
 #undef constructor_mm_NN1_Operator_const_Multiarray_R
 
+#undef set_ops_tp_n_rows_cols_R
+
 #undef mm_NN1C_Operator_Multiarray_R
@@ -36,12 +36,18 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "volume.h"
 #include "face.h"
 
+#include "compute_all_rlhs_dpg.h"
 #include "const_cast.h"
 #include "file_processing.h"
 #include "geometry.h"
 #include "intrusive.h"
 #include "mesh.h"
+#include "partition.h"
+#include "profiling.h"
+#include "reordering.h"
 #include "restart.h"
+#include "scratch_arena.h"
+#include "solve_dg.h"
 #include "test_case.h"
 
 // Static function declarations ************************************************************************************* //
@@ -110,6 +116,7 @@ struct Simulation* constructor_Simulation__no_mesh (const char*const ctrl_name)
 	set_simulation_invalid(sim);
 	set_simulation_mpi(sim);
 	set_simulation_core(sim,ctrl_name);
+	open_profile_run();
 	set_up_fopen_input(sim->ctrl_name_full,get_input_path(sim));
 	set_simulation_additional(sim);
 
@@ -137,6 +144,9 @@ struct Simulation* constructor_Simulation (const char*const ctrl_name)
 
 	sim->volumes = constructor_Volumes(sim,mesh); // destructed
 	sim->faces   = constructor_Faces(sim,mesh);   // destructed
+	partition_volumes(sim,mesh);
+	reorder_computational_elements(sim);
+	update_Face_Colouring(sim);
 
 	destructor_Mesh(mesh);
 
@@ -157,6 +167,9 @@ struct Simulation* constructor_Simulation_restart (const struct Simulation*const
 	sim->volumes = constructor_Volumes(sim,mesh); // destructed
 	sim->faces   = constructor_Faces(sim,mesh);   // destructed
 
+	// The computational elements are not reordered: the restart mesh is output in the (possibly reordered) order of
+	// the volumes of the main simulation and the solution coefficients are read by position in the volume list.
+
 	destructor_Mesh(mesh);
 
 	return sim;
@@ -164,6 +177,9 @@ struct Simulation* constructor_Simulation_restart (const struct Simulation*const
 
 void destructor_Simulation (struct Simulation* sim)
 {
+	destructor_Simulations_c_dpg(sim);
+	destructor_Simulation_c_jfnk_dg(sim);
+
 	if (sim->elements) {
 		assert(sim->elements->name == IL_ELEMENT);
 		destructor_const_Elements(sim->elements);
@@ -179,8 +195,15 @@ void destructor_Simulation (struct Simulation* sim)
 		destructor_Faces(sim->faces);
 	}
 
+	if (sim->face_colouring)
+		destructor_Face_Colouring(sim->face_colouring);
+
 	destructor_Test_Case_rc_real(sim->test_case_rc);
 
+	// The scratch arenas are kept across the rlhs calls of the solver.
+	destructor_scratch_arenas();
+
+	close_profile_run(sim->mpi_rank);
 	free(sim);
 }
 
@@ -240,32 +263,51 @@ void set_ml_p_curr (const int ml, const int p, struct Simulation* sim)
 char get_set_op_format (const char new_format)
 {
 	static char op_format = 'd';
-	if (new_format)
+	if (new_format) {
+		EXIT_IF_IN_PARALLEL;
 		op_format = new_format;
+	}
 	return op_format;
 }
 
+const char* get_set_op_cache_dir (const char*const new_dir)
+{
+	static char op_cache_dir[STRLEN_MAX] = "";
+	if (new_dir) {
+		EXIT_IF_IN_PARALLEL;
+		assert(strlen(new_dir) < STRLEN_MAX);
+		strcpy(op_cache_dir,new_dir);
+	}
+	return op_cache_dir;
+}
+
 bool get_set_collocated (const bool*const new_val)
 {
 	static bool collocated = false;
-	if (new_val)
+	if (new_val) {
+		EXIT_IF_IN_PARALLEL;
 		collocated = *new_val;
+	}
 	return collocated;
 }
 
 int get_set_method (const int*const new_val)
 {
 	static int method = -1;
-	if (new_val)
+	if (new_val) {
+		EXIT_IF_IN_PARALLEL;
 		method = *new_val;
+	}
 	return method;
 }
 
 int get_set_domain_type (const int*const new_val)
 {
 	static int domain_type = -1;
-	if (new_val)
+	if (new_val) {
+		EXIT_IF_IN_PARALLEL;
 		domain_type = *new_val;
+	}
 	return domain_type;
 }
 
@@ -278,6 +320,7 @@ const int* get_set_degree_poly (const int*const new_vals, const char*const key)
 		case 'p': {
 			static int p_t_p[2];
 			if (new_vals) {
+				EXIT_IF_IN_PARALLEL;
 				for (int i = 0; i < 2; ++i)
 					p_t_p[i] = new_vals[i];
 			}
@@ -353,6 +396,7 @@ static void set_simulation_invalid (struct Simulation*const sim)
 	set_ml_p_curr(-1,-1,sim);
 
 	const_cast_i(&sim->method,-1);
+	const_cast_i(&sim->reorder_type,-1);
 
 	const_cast_b(&sim->collocated,false);
 }
@@ -375,6 +419,9 @@ static void set_simulation_core (struct Simulation*const sim, const char*const c
 	FILE *ctrl_file = fopen_checked(sim->ctrl_name_full);
 
 	int d = -1;
+	char op_format[STRLEN_MIN] = "d";
+	char op_cache_dir[STRLEN_MAX] = "";
+	char profile_name[STRLEN_MAX] = "";
 
 	// Read information
 	char line[STRLEN_MAX];
@@ -388,6 +435,7 @@ static void set_simulation_core (struct Simulation*const sim, const char*const c
 		if (strstr(line,"dimension"))        read_skip_const_i_1(line,1,&d,1);
 		if (strstr(line,"mesh_level"))       read_skip_const_i_1(line,1,sim->ml,2);
 		if (strstr(line,"mesh_unrealistic")) read_skip_const_b(line,&sim->mesh_unrealistic);
+		read_skip_convert_const_i(line,"reorder_type",&sim->reorder_type,&dummy);
 
 		read_skip_name_const_c_1("test_case_extension",line,sim->test_case_extension);
 		read_skip_name_const_c_1("solution_extension", line,sim->solution_extension);
@@ -417,7 +465,10 @@ static void set_simulation_core (struct Simulation*const sim, const char*const c
 		if (strstr(line,"fe_method")) read_skip_const_i_1(line,1,&sim->method,1);
 		read_skip_convert_const_i(line,"method_name",&sim->method,&dummy);
 
-		if (strstr(line,"collocated")) read_skip_const_b(line,&sim->collocated);
+		if (strstr(line,"collocated"))   read_skip_const_b(line,&sim->collocated);
+		if (strstr(line,"op_format"))    read_skip_c_1(line,op_format);
+		if (strstr(line,"op_cache_dir")) read_skip_c_1(line,op_cache_dir);
+		if (strstr(line,"profile_name")) read_skip_c_1(line,profile_name);
 	}
 	fclose(ctrl_file);
 
@@ -427,6 +478,9 @@ static void set_simulation_core (struct Simulation*const sim, const char*const c
 	set_mesh_parameters(sim);
 	set_orders(sim);
 	get_set_collocated(&sim->collocated);
+	get_set_op_format(op_format[0]);
+	get_set_op_cache_dir(op_cache_dir);
+	get_set_profile_name(profile_name);
 	get_set_method(&sim->method);
 }
 
@@ -507,6 +561,9 @@ static void set_simulation_default (struct Simulation*const sim)
 			assert(sim->p_t_p[i] >= 0);
 	}
 
+	if (sim->reorder_type == -1)
+		const_cast_i(&sim->reorder_type,REORDER_NONE);
+
 	const_cast_i(&sim->n_hp,3);
 	const_cast_i(&sim->adapt_type,compute_adapt_type(sim->p_ref,sim->ml));
 }
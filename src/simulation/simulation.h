@@ -73,6 +73,13 @@ struct Simulation {
 	 *  to within a very small tolerance. See \ref mesh_vertices.h additional discussion of this issue. */
 	const bool mesh_unrealistic;
 
+	/** The type of reordering of the computational elements (see \ref reorder_computational_elements). Options:
+	 *  - none (default);
+	 *  - hilbert, morton: space-filling curve through the volume centroids;
+	 *  - rcm: reverse Cuthill-McKee ordering of the volume dual graph.
+	 */
+	const int reorder_type;
+
 	ptrdiff_t n_v, ///< The number of \ref Volume finite elements.
 	          n_f; ///< The number of \ref Face   finite elements.
 
@@ -201,6 +208,17 @@ struct Simulation {
 	const struct const_Intrusive_List* elements; ///< Pointer to the head of the Element list.
 	struct Intrusive_List* volumes;              ///< Pointer to the head of the Volume  list.
 	struct Intrusive_List* faces;                ///< Pointer to the head of the Face    list.
+
+	/// The colouring of \ref Simulation::faces used for threaded face loops (`NULL` if only a single thread is used).
+	struct Face_Colouring* face_colouring;
+
+	/** The complex simulations used for the complex step linearization of the DPG boundary Hessian terms (`NULL` if
+	 *  not yet constructed; see \ref get_Simulations_c_dpg). */
+	struct Simulations_c_DPG* sims_c_dpg;
+
+	/** The complex simulation used for the complex step jfnk matrix-vector products (`NULL` if not yet constructed;
+	 *  see \ref constructor_petsc_mat_jfnk_dg). */
+	struct Simulation* sim_c_jfnk;
 };
 
 /** \brief Constructor for \ref Simulation omitting the construction of members dependent upon an input mesh.
@@ -275,6 +293,16 @@ char get_set_op_format
 	(const char new_format ///< New format. Options: 'd'efault, 's'tandard, 't'ensor-product, 'c'ompressed sparse row.
 	);
 
+/** \brief Return the statically allocated name of the directory of the on-disk operator cache (see
+ *         \ref operator_cache.h).
+ *  \return See brief. An empty string indicates that the operator cache is not used.
+ *
+ *  Passing a non-NULL input for `new_dir` sets the statically allocated name to that of the input.
+ */
+const char* get_set_op_cache_dir
+	(const char*const new_dir ///< The new directory name if non-NULL.
+	);
+
 /** \brief Return a statically allocated `bool` flag indicating whether collocated interpolation and cubature nodes are
  *         being used.
  *  \return See brief.
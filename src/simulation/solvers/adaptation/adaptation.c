@@ -18,6 +18,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "adaptation.h"
 
 #include <assert.h>
+#include <float.h>
+#include <math.h>
 #include <stdlib.h>
 #include "gsl/gsl_math.h"
 
@@ -32,22 +34,31 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "definitions_test_case.h"
 #include "definitions_tol.h"
 
+#include "face_solver.h"
 #include "face_solver_adaptive.h"
 #include "element_adaptation.h"
 #include "element_solver.h"
+#include "volume_solver.h"
 #include "volume_solver_adaptive.h"
 
 #include "matrix.h"
 #include "multiarray.h"
 #include "vector.h"
 
+#include "boundary.h"
 #include "computational_elements.h"
+#include "compute_all_rlhs_dpg.h"
+#include "compute_face_rlhs.h"
+#include "compute_rlhs.h"
+#include "compute_volume_rlhs.h"
 #include "const_cast.h"
 #include "geometry.h"
 #include "intrusive.h"
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "profiling.h"
+#include "reordering.h"
 #include "simulation.h"
 #include "solve.h"
 #include "test_case.h"
@@ -107,6 +118,42 @@ static const struct const_Vector_i* get_operator__nc_fg
 	 const bool use_pg_face                 ///< Defined for \ref constructor_geom_fg.
 	);
 
+/** \brief Set \ref Solver_Volume_T::error_ind to the residual-based indicator combining the strong residual in each
+ *         volume with the jump in the solution over its internal faces.
+ *
+ *  The indicator is given by \f$ \eta_K^2 = h_K^2 \|R\|_K^2 + \|[u]\|_{\partial K}^2 \f$, where \f$ R \f$ is the strong
+ *  residual (see \ref compute_norm_2_residual_strong) and \f$ [u] \f$ is the jump in the solution over the internal
+ *  faces. The jump term is not weighted by the mesh size as is appropriate for the first order (hyperbolic) terms. No
+ *  constants are included such that the indicator is only suitable for ranking the volumes for marking.
+ */
+static void set_error_ind_residual
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Comparison function for std::qsort ordering pointers to \ref Solver_Volume_T\*s by decreasing
+ *         \ref Solver_Volume_T::error_ind.
+ *  \return See brief. */
+static int cmp_error_ind_desc
+	(const void*const a, ///< Variable 1.
+	 const void*const b  ///< Variable 2.
+	);
+
+/** \brief Return the type of refinement to be used for the input volume if marked based on its error indicator.
+ *  \return One of \ref ADAPT_P_REFINE, \ref ADAPT_H_REFINE or \ref ADAPT_NONE (if the limits on the order and mesh
+ *          level have both been reached). */
+static int compute_adapt_type_indicator
+	(const struct Adaptive_Solver_Volume*const a_s_vol, ///< The \ref Adaptive_Solver_Volume.
+	 const struct Simulation*const sim                  ///< \ref Simulation.
+	);
+
+/** \brief Return the increase in the number of volume degrees of freedom if the input volume is adapted using the
+ *         input adaptation type.
+ *  \return See brief. */
+static ptrdiff_t compute_n_dof_increment
+	(const struct Adaptive_Solver_Volume*const a_s_vol, ///< The \ref Adaptive_Solver_Volume.
+	 const int adapt_type                               ///< \ref Adaptive_Solver_Volume::adapt_type.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 void adapt_hp (struct Simulation* sim, const int adapt_strategy, const struct Adaptation_Data*const adapt_data)
@@ -115,6 +162,11 @@ void adapt_hp (struct Simulation* sim, const int adapt_strategy, const struct Ad
 	assert(sim->faces->name   == IL_FACE_SOLVER);
 	assert(list_is_derived_from("solver",'e',sim));
 
+	start_profile(PROF_ADAPTATION);
+
+	// The complex simulations are reconstructed for the adapted mesh when next required.
+	destructor_Simulations_c_dpg(sim);
+
 	constructor_derived_computational_elements(sim,IL_SOLVER_ADAPTIVE); // destructed
 
 	const int n_adapt = compute_max_n_adapt(adapt_strategy,adapt_data);
@@ -129,7 +181,64 @@ void adapt_hp (struct Simulation* sim, const int adapt_strategy, const struct Ad
 
 	destructor_derived_computational_elements(sim,IL_SOLVER);
 
+	reorder_computational_elements(sim);
+	update_Face_Colouring(sim);
 	update_ind_dof_d(sim);
+	stop_profile(PROF_ADAPTATION);
+}
+
+bool mark_volumes_indicator (const struct Simulation*const sim)
+{
+	assert(sim->volumes->name == IL_VOLUME_SOLVER_ADAPTIVE);
+
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	if (sim->method == METHOD_DG)
+		set_error_ind_residual(sim);
+
+	ptrdiff_t n_v = 0;
+	struct Intrusive_Link**const vols = constructor_array_Link(sim->volumes,&n_v); // free
+
+	double error_2_sum = 0.0;
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		const double error_ind = ((struct Solver_Volume*)vols[v])->error_ind;
+		error_2_sum += error_ind*error_ind;
+	}
+	qsort(vols,(size_t)n_v,sizeof(vols[0]),cmp_error_ind_desc);
+
+	const int adapt_marking = test_case->adapt_marking;
+	const double theta      = test_case->adapt_theta;
+	const ptrdiff_t n_dof_max  = test_case->adapt_dof_max,
+	                n_mark_max = ( adapt_marking == ADAPT_MARK_FIXED_FRACTION ? (ptrdiff_t)ceil(theta*(double)n_v)
+	                                                                          : n_v );
+
+	bool adapting = false;
+	ptrdiff_t n_dof  = compute_dof_schur('v',sim),
+	          n_mark = 0;
+	double error_2_marked = 0.0;
+	for (ptrdiff_t v = 0; v < n_v && n_mark < n_mark_max; ++v) {
+		if (adapt_marking == ADAPT_MARK_DORFLER && error_2_marked >= theta*error_2_sum)
+			break;
+
+		struct Adaptive_Solver_Volume*const a_s_vol = (struct Adaptive_Solver_Volume*) vols[v];
+		const double error_ind = ((struct Solver_Volume*)a_s_vol)->error_ind;
+		error_2_marked += error_ind*error_ind;
+		++n_mark;
+
+		const int adapt_type = compute_adapt_type_indicator(a_s_vol,sim);
+		if (adapt_type == ADAPT_NONE)
+			continue;
+
+		const ptrdiff_t n_dof_increment = compute_n_dof_increment(a_s_vol,adapt_type);
+		if (n_dof_max > 0 && n_dof+n_dof_increment > n_dof_max)
+			break;
+		n_dof += n_dof_increment;
+
+		a_s_vol->adapt_type = adapt_type;
+		adapting = true;
+	}
+	free(vols);
+
+	return adapting;
 }
 
 const struct const_Multiarray_d* constructor_geom_fg
@@ -217,16 +326,6 @@ static void destruct_fully_Adaptive_Solver_Faces
 	 struct Intrusive_Link** child_0 ///< Pointer to the first child of the parent or NULL if not h-refined.
 	);
 
-/// \brief Update \ref Volume::index members.
-static void update_index_volumes
-	(struct Simulation*const sim ///< \ref Simulation.
-	);
-
-/// \brief Update \ref Face::index members.
-static void update_index_faces
-	(struct Simulation*const sim ///< \ref Simulation.
-	);
-
 /** \brief Return whether the vertex in the specified row of the input multiarray is in \ref Volume::xyz_ve.
  *  \return See brief. */
 static bool volume_has_specified_xyz_ve
@@ -262,7 +361,8 @@ static int compute_max_n_adapt (const int adapt_strategy, const struct Adaptatio
 	case ADAPT_S_P_REFINE: // fallthrough
 	case ADAPT_S_P_COARSE: // fallthrough
 	case ADAPT_S_H_REFINE: // fallthrough
-	case ADAPT_S_H_COARSE:
+	case ADAPT_S_H_COARSE: // fallthrough
+	case ADAPT_S_INDICATOR:
 		return 1;
 	case ADAPT_S_XYZ_VE: {
 		const struct const_Vector_i*const xyz_ve_ml = adapt_data->xyz_ve_ml,
@@ -355,6 +455,10 @@ static bool mark_volumes_to_adapt
 			a_s_vol->adapt_type = ADAPT_H_COARSE;
 		}
 		break;
+	case ADAPT_S_INDICATOR:
+		adapting = mark_volumes_indicator(sim);
+		ensure_1_irregular(sim);
+		break;
 	default:
 		EXIT_ERROR("Unsupported: %d\n",adapt_strategy);
 		break;
@@ -869,26 +973,6 @@ static void destruct_fully_Adaptive_Solver_Faces
 	}
 }
 
-static void update_index_volumes (struct Simulation*const sim)
-{
-	int index = 0;
-	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-		struct Volume* vol = (struct Volume*) curr;
-		const_cast_i(&vol->index,index);
-		++index;
-	}
-}
-
-static void update_index_faces (struct Simulation*const sim)
-{
-	int index = 0;
-	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
-		struct Face* face = (struct Face*) curr;
-		const_cast_i(&face->index,index);
-		++index;
-	}
-}
-
 static bool volume_has_specified_xyz_ve
 	(const struct Volume*const vol, const struct const_Multiarray_d*const xyz_ve, const int row)
 {
@@ -974,6 +1058,35 @@ static int get_n_children
 	(const struct const_Element*const element ///< The \ref Element.
 	);
 
+/** \brief Return the rate of decay of the modal content of the solution in the input volume.
+ *  \return The decay rate, \f$ \log(e_{p-1}/e_{p}) \f$, where \f$ e_k \f$ is the norm of the content of the solution of
+ *          degree \f$ k \f$; `DBL_MAX` if the solution is resolved or if the lower degree projections are not
+ *          available.
+ *
+ *  The content of degree \f$ k \f$ is computed as the difference between the projections of the solution to degrees k
+ *  and k-1 (computed recursively from degree p) measured in the mass matrix norm of the volume. The solution is
+ *  considered to be smooth (favouring p-refinement) if the rate exceeds \ref Test_Case_T::adapt_smoothness.
+ */
+static double compute_modal_decay
+	(const struct Solver_Volume*const s_vol, ///< \ref Solver_Volume_T.
+	 const struct Simulation*const sim       ///< \ref Simulation.
+	);
+
+/** \brief Return the square of the L2 norm of the strong residual, \f$ R = s - \nabla \cdot f(u) \f$, in the input
+ *         volume.
+ *  \return See brief.
+ *
+ *  The divergence of the flux is computed at the volume cubature nodes by differentiating the L2 projection of the
+ *  reference fluxes to the solution basis and dividing by the Jacobian determinant. As only the weak form of the source
+ *  term is available (see \ref Test_Case_T::compute_source_rhs), its L2 projection is used.
+ */
+static double compute_norm_2_residual_strong
+	(const struct Solver_Volume*const s_vol,             ///< \ref Solver_Volume_T.
+	 const struct S_Params_Volume_Structor*const spvs, ///< \ref S_Params_Volume_Structor_T.
+	 struct Flux_Input*const flux_i,                     ///< \ref Flux_Input_T.
+	 const struct Simulation*const sim                   ///< \ref Simulation.
+	);
+
 /** \brief Return the "ind"ex of the 's'ub face of an h-"ref"ined face.
  *  \return See brief. */
 static int compute_ind_sref
@@ -1552,8 +1665,117 @@ static void correct_non_conforming_geometry (const struct Simulation*const sim)
 	}
 }
 
+static void set_error_ind_residual (const struct Simulation*const sim)
+{
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next)
+		((struct Solver_Volume*)curr)->error_ind = 0.0;
+
+	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+		const struct Face*const face          = (struct Face*) curr;
+		const struct Solver_Face*const s_face = (struct Solver_Face*) curr;
+		if (face->boundary)
+			continue;
+
+		const struct const_Multiarray_d*const s_l_fc = constructor_s_fc_interp_d(0,s_face); // destructed
+		struct Multiarray_d*const s_r_fc = (struct Multiarray_d*) constructor_s_fc_interp_d(1,s_face); // destructed
+		permute_Multiarray_d_fc(s_r_fc,'R',1,s_face);
+
+		const struct const_Vector_d*const w_fc = get_operator__w_fc__s_e(s_face);
+		const double*const jac_det_fc = s_face->jacobian_det_fc->data;
+
+		assert(s_l_fc->layout == 'C');
+		const ptrdiff_t n_fc = s_l_fc->extents[0],
+		                n_vr = s_l_fc->extents[1];
+		double jump_2 = 0.0;
+		for (int vr = 0; vr < n_vr; ++vr) {
+		for (int i = 0; i < n_fc; ++i) {
+			const ptrdiff_t ind = i+n_fc*vr;
+			const double jump = s_l_fc->data[ind]-s_r_fc->data[ind];
+			jump_2 += w_fc->data[i]*jac_det_fc[i]*jump*jump;
+		}}
+		destructor_const_Multiarray_d(s_l_fc);
+		destructor_Multiarray_d(s_r_fc);
+
+		for (int n = 0; n < 2; ++n)
+			((struct Solver_Volume*)face->neigh_info[n].volume)->error_ind += jump_2;
+	}
+
+	struct S_Params_Volume_Structor spvs;
+	set_S_Params_Volume_Structor(&spvs,sim);
+
+	// Only the fluxes are required such that the explicit flux input is used (only the test case is modified).
+	struct Flux_Input*const flux_i = constructor_Flux_Input_e((struct Simulation*)sim); // destructed
+
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Volume*const vol    = (struct Volume*) curr;
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+
+		const double res_2 = compute_norm_2_residual_strong(s_vol,&spvs,flux_i,sim);
+		s_vol->error_ind = sqrt(vol->h*vol->h*res_2 + s_vol->error_ind);
+	}
+	destructor_Flux_Input(flux_i);
+}
+
+static int cmp_error_ind_desc (const void*const a, const void*const b)
+{
+	const struct Solver_Volume*const*const ia = (const struct Solver_Volume*const*) a,
+	                          *const*const ib = (const struct Solver_Volume*const*) b;
+
+	const double e_a = (*ia)->error_ind,
+	             e_b = (*ib)->error_ind;
+	return (e_a < e_b) - (e_a > e_b);
+}
+
+static int compute_adapt_type_indicator
+	(const struct Adaptive_Solver_Volume*const a_s_vol, const struct Simulation*const sim)
+{
+	const struct Solver_Volume*const s_vol = (struct Solver_Volume*) a_s_vol;
+
+	const bool can_p_ref = (s_vol->p_ref < sim->p_ref[1]),
+	           can_h_ref = (s_vol->ml < ML_MAX);
+	if (!can_h_ref)
+		return ( can_p_ref ? ADAPT_P_REFINE : ADAPT_NONE );
+	if (!can_p_ref)
+		return ADAPT_H_REFINE;
+
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	return ( compute_modal_decay(s_vol,sim) >= test_case->adapt_smoothness ? ADAPT_P_REFINE : ADAPT_H_REFINE );
+}
+
+static ptrdiff_t compute_n_dof_increment (const struct Adaptive_Solver_Volume*const a_s_vol, const int adapt_type)
+{
+	const struct Volume*const vol          = (struct Volume*) a_s_vol;
+	const struct Solver_Volume*const s_vol = (struct Solver_Volume*) a_s_vol;
+
+	const struct Multiarray_d*const s_coef = s_vol->sol_coef;
+	const ptrdiff_t n_b  = s_coef->extents[0],
+	                n_vr = s_coef->extents[1];
+
+	switch (adapt_type) {
+	case ADAPT_P_REFINE: {
+		const int p = s_vol->p_ref;
+		const struct Adaptation_Element*const a_e = &((struct Solver_Element*)vol->element)->a_e;
+		const struct Operator*const cc0_vs_vs = get_Multiarray_Operator(a_e->cc0_vs_vs,(ptrdiff_t[]){0,0,p+1,p});
+		return (cc0_vs_vs->op_std->ext_0-n_b)*n_vr;
+	} case ADAPT_H_REFINE:
+		return (get_n_children(vol->element)-1)*n_b*n_vr;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",adapt_type);
+		break;
+	}
+}
+
 // Level 3 ********************************************************************************************************** //
 
+/** \brief Return the norm of the difference between the input solution coefficients, \f$ \sqrt{\sum_{vr} d_{vr}^T M
+ *         d_{vr}} \f$, where \f$ M \f$ is the mass matrix.
+ *  \return See brief. */
+static double compute_norm_mass_diff
+	(const struct const_Matrix_d*const mass,      ///< The mass matrix.
+	 const struct const_Multiarray_d*const coef_a, ///< The first set of coefficients.
+	 const struct const_Multiarray_d*const coef_b  ///< The second set of coefficients.
+	);
+
 /** \brief Constructor for an h-refined \ref Adaptive_Solver_Volume.
  *  \return See brief.
  *
@@ -1977,6 +2199,110 @@ static void correct_additional_non_conforming_face_geometry (const struct Simula
 	}
 }
 
+static double compute_modal_decay (const struct Solver_Volume*const s_vol, const struct Simulation*const sim)
+{
+	const int p = s_vol->p_ref;
+	if (p-2 < sim->p_ref[0])
+		return DBL_MAX;
+
+	const struct Volume*const vol = (struct Volume*) s_vol;
+	const struct Adaptation_Element*const a_e = &((struct Solver_Element*)vol->element)->a_e;
+	const struct Operator*const cc0_vs_vs_pm1_p   = get_Multiarray_Operator(a_e->cc0_vs_vs,(ptrdiff_t[]){0,0,p-1,p}),
+	                     *const cc0_vs_vs_p_pm1   = get_Multiarray_Operator(a_e->cc0_vs_vs,(ptrdiff_t[]){0,0,p,p-1}),
+	                     *const cc0_vs_vs_pm2_pm1 = get_Multiarray_Operator(a_e->cc0_vs_vs,(ptrdiff_t[]){0,0,p-2,p-1}),
+	                     *const cc0_vs_vs_pm1_pm2 = get_Multiarray_Operator(a_e->cc0_vs_vs,(ptrdiff_t[]){0,0,p-1,p-2});
+
+	const char op_format = 'd';
+	const struct const_Multiarray_d*const s_coef = (struct const_Multiarray_d*) s_vol->sol_coef;
+	const int order = s_coef->order;
+
+	const struct const_Multiarray_d*const s_pm1 =
+		constructor_mm_NN1_Operator_const_Multiarray_d(cc0_vs_vs_pm1_p,s_coef,'C',op_format,order,NULL); // destructed
+	const struct const_Multiarray_d*const s_pm1_p =
+		constructor_mm_NN1_Operator_const_Multiarray_d(cc0_vs_vs_p_pm1,s_pm1,'C',op_format,order,NULL); // destructed
+	const struct const_Multiarray_d*const s_pm2 =
+		constructor_mm_NN1_Operator_const_Multiarray_d(cc0_vs_vs_pm2_pm1,s_pm1,'C',op_format,order,NULL); // destructed
+	const struct const_Multiarray_d*const s_pm2_pm1 =
+		constructor_mm_NN1_Operator_const_Multiarray_d(cc0_vs_vs_pm1_pm2,s_pm2,'C',op_format,order,NULL); // destructed
+	const struct const_Multiarray_d*const s_pm2_p =
+		constructor_mm_NN1_Operator_const_Multiarray_d(cc0_vs_vs_p_pm1,s_pm2_pm1,'C',op_format,order,NULL); // dest.
+	destructor_const_Multiarray_d(s_pm1);
+	destructor_const_Multiarray_d(s_pm2);
+	destructor_const_Multiarray_d(s_pm2_pm1);
+
+	const struct const_Matrix_d*const mass = constructor_mass(s_vol); // destructed
+	const double e_p   = compute_norm_mass_diff(mass,s_coef,s_pm1_p),
+	             e_pm1 = compute_norm_mass_diff(mass,s_pm1_p,s_pm2_p);
+	destructor_const_Matrix_d(mass);
+	destructor_const_Multiarray_d(s_pm1_p);
+	destructor_const_Multiarray_d(s_pm2_p);
+
+	if (e_p <= EPS)
+		return DBL_MAX;
+	return log(GSL_MAX(e_pm1,EPS)/e_p);
+}
+
+static double compute_norm_2_residual_strong
+	(const struct Solver_Volume*const s_vol, const struct S_Params_Volume_Structor*const spvs,
+	 struct Flux_Input*const flux_i, const struct Simulation*const sim)
+{
+	const struct const_Matrix_d*const mass   = constructor_mass(s_vol);                    // destructed
+	const struct const_Matrix_d*const proj_s = constructor_l2_proj_operator_s(s_vol,mass); // destructed
+	const struct const_Matrix_d*const m_inv  = constructor_inverse_const_Matrix_d(mass);   // destructed
+	destructor_const_Matrix_d(mass);
+
+	// Flux divergence (scaled by the Jacobian determinant).
+	struct Flux_Ref*const flux_r = constructor_Flux_Ref_vol(spvs,flux_i,s_vol); // destructed
+	const struct const_Multiarray_d*const fr = flux_r->fr;
+	assert(fr->layout == 'C');
+
+	const ptrdiff_t n_vc = fr->extents[0],
+	                n_eq = fr->extents[1];
+	const struct Multiarray_Operator cv1_vt_vc = get_operator__cv1_vt_vc(s_vol);
+	struct Matrix_d*const div_vc = constructor_zero_Matrix_d('C',n_vc,n_eq); // destructed
+	for (int dim = 0; dim < DIM; ++dim) {
+		const struct const_Matrix_d fr_d = { .layout = 'C', .ext_0 = n_vc, .ext_1 = n_eq, .owns_data = false,
+		                                     .data = get_col_const_Multiarray_d(dim*n_eq,fr), };
+		const struct const_Matrix_d*const fr_coef =
+			constructor_mm_const_Matrix_d('N','N',1.0,proj_s,&fr_d,'C'); // destructed
+		assert(cv1_vt_vc.data[dim]->op_std->ext_1 == fr_coef->ext_0);
+		mm_d('N','N',1.0,1.0,cv1_vt_vc.data[dim]->op_std,fr_coef,div_vc);
+		destructor_const_Matrix_d(fr_coef);
+	}
+	destructor_Flux_Ref(flux_r);
+	destructor_const_Matrix_d(proj_s);
+
+	// Source term.
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	struct Multiarray_d*const source = constructor_zero_Multiarray_d('C',2,(ptrdiff_t[]){m_inv->ext_0,n_eq}); // d.
+	test_case->compute_source_rhs(sim,s_vol,source);
+
+	const struct const_Matrix_d source_M = interpret_const_Multiarray_as_Matrix_d((struct const_Multiarray_d*)source);
+	const struct const_Matrix_d*const source_coef =
+		constructor_mm_const_Matrix_d('N','N',1.0,m_inv,&source_M,'C'); // destructed
+	const struct const_Matrix_d*const source_vc =
+		constructor_mm_const_Matrix_d('N','N',1.0,get_operator__cv0_vs_vc(s_vol)->op_std,source_coef,'C'); // dest.
+	destructor_Multiarray_d(source);
+	destructor_const_Matrix_d(source_coef);
+	destructor_const_Matrix_d(m_inv);
+
+	const struct const_Vector_d*const w_vc = get_operator__w_vc__s_e(s_vol);
+	const double*const jac_det_vc = s_vol->jacobian_det_vc->data;
+	assert(source_vc->ext_0 == n_vc);
+
+	double res_2 = 0.0;
+	for (int eq = 0; eq < n_eq; ++eq) {
+	for (int i = 0; i < n_vc; ++i) {
+		const ptrdiff_t ind = i+n_vc*eq;
+		const double res = source_vc->data[ind]-div_vc->data[ind]/jac_det_vc[i];
+		res_2 += w_vc->data[i]*jac_det_vc[i]*res*res;
+	}}
+	destructor_Matrix_d(div_vc);
+	destructor_const_Matrix_d(source_vc);
+
+	return res_2;
+}
+
 // Level 4 ********************************************************************************************************** //
 
 /** \brief Constructor for the \ref Volume base of the h-refined \ref Adaptive_Solver_Volume.
@@ -2172,6 +2498,29 @@ static const struct const_Vector_i* constructor_cc0_vgc_fgc_indices
 	return constructor_const_Vector_i_inds_eq_1_const_Matrix_d(cc0_vgc_fgc_op->op_std);
 }
 
+static double compute_norm_mass_diff
+	(const struct const_Matrix_d*const mass, const struct const_Multiarray_d*const coef_a,
+	 const struct const_Multiarray_d*const coef_b)
+{
+	assert(coef_a->layout == 'C');
+	assert(coef_b->layout == 'C');
+	assert(coef_a->extents[0] == mass->ext_0);
+	assert(coef_b->extents[0] == mass->ext_0);
+
+	const ptrdiff_t n_b  = mass->ext_0,
+	                n_vr = coef_a->extents[1];
+	double norm_2 = 0.0;
+	for (int vr = 0; vr < n_vr; ++vr) {
+		const double*const d_a = &coef_a->data[n_b*vr],
+		            *const d_b = &coef_b->data[n_b*vr];
+		for (int i = 0; i < n_b; ++i) {
+		for (int j = 0; j < n_b; ++j) {
+			norm_2 += (d_a[i]-d_b[i])*get_val_const_Matrix_d(i,j,mass)*(d_a[j]-d_b[j]);
+		}}
+	}
+	return sqrt(norm_2);
+}
+
 // Level 5 ********************************************************************************************************** //
 
 /// \brief Container for data used to set \ref Face::Neigh_Info for new internal faces.
@@ -2289,6 +2638,7 @@ static void constructor_Volume_h_ref
 	const_cast_i(&vol->index,-1);
 
 	const struct Volume*const vol_p            = (struct Volume*) a_s_vol_p;
+	const_cast_i(&vol->rank,vol_p->rank);
 	const struct Solver_Volume*const s_vol_p   = (struct Solver_Volume*) a_s_vol_p;
 	const struct const_Element*const element_p = vol_p->element;
 	const_cast_const_Element(&vol->element,
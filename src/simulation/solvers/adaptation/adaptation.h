@@ -43,6 +43,23 @@ void adapt_hp
 	 const struct Adaptation_Data*const adapt_data ///< \ref Adaptation_Data.
 	);
 
+/** \brief Mark the volumes to be adapted based on the \ref Solver_Volume_T::error_ind values according to the
+ *         \ref Test_Case_T::adapt_marking strategy (see \ref ADAPT_S_INDICATOR).
+ *  \return `true` if any volumes were marked.
+ *
+ *  Volumes are sorted in order of decreasing error indicator and marked until either the marking criterion is satisfied
+ *  or the \ref Test_Case_T::adapt_dof_max budget would be exceeded. Marked volumes are p-refined if the decay rate of
+ *  the modal content of their solution exceeds \ref Test_Case_T::adapt_smoothness and h-refined otherwise.
+ *
+ *  The \ref Adaptive_Solver_Volume::adapt_type members are set such that the volumes must be derived
+ *  \ref Adaptive_Solver_Volume\*s. The error indicators of the DG method are computed here.
+ *
+ *  \note Only refinement is currently supported.
+ */
+bool mark_volumes_indicator
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
 /** \brief Constructor for the geometry values at the face geometry nodes interpolated from the volume of specified
  *         side_index including reordering if the destination side_index differs.
  *  \return See brief. */
@@ -54,6 +54,14 @@ You should have received a copy of the GNU General Public License along with DPG
 #define ADAPT_S_H_COARSE 1014 ///< Uniform h coarsening for the entire domain.
 
 #define ADAPT_S_XYZ_VE 1021 ///< Adapt around the specified vertices until the required mesh level is reached.
+
+#define ADAPT_S_INDICATOR 1031 ///< Adapt the volumes marked based on their error indicators.
+///\}
+
+///\{ \name Supported marking strategies for \ref ADAPT_S_INDICATOR (see \ref Test_Case_T::adapt_marking).
+#define ADAPT_MARK_NONE           0 ///< No automatic adaptation.
+#define ADAPT_MARK_DORFLER        1 ///< Mark the fewest volumes holding a fraction of the total squared error.
+#define ADAPT_MARK_FIXED_FRACTION 2 ///< Mark a fixed fraction of the volumes having the largest errors.
 ///\}
 
 ///\{ \name Support h-refinement types for tetrahedral elements.
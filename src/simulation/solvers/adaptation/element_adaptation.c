@@ -93,7 +93,8 @@ static void constructor_derived_Adaptation_Element_std (struct Element* element_
 	struct const_Element* e        = (struct const_Element*) element_ptr;
 	struct Adaptation_Element* a_e = (struct Adaptation_Element*) element_ptr;
 
-	a_e->cc0_vs_vs = constructor_operators("cc0","vsA","vsA","H_ALL_P_PM1",e,sim); // destructed
+	// The lower orders are used for the coarse levels of the p-multigrid preconditioner (see \ref p_multigrid.h).
+	a_e->cc0_vs_vs = constructor_operators("cc0","vsA","vsA","H_ALL_P_LPM1",e,sim); // destructed
 	a_e->cc0_vr_vr = constructor_operators("cc0","vrA","vrA","H_ALL_P_PM1",e,sim); // destructed
 	a_e->vv0_vv_vv = constructor_operators("vv0","vvA","vvA","H_CF_P_12",  e,sim); // destructed
 }
@@ -109,7 +110,7 @@ static void constructor_derived_Adaptation_Element_tp (struct Element* element_p
 	struct Operators_TP ops_tp;
 
 	set_operators_tp(&ops_tp,a_se[0]->cc0_vs_vs,NULL,a_se[1]->cc0_vs_vs,NULL);
-	a_e->cc0_vs_vs = constructor_operators_tp("cc0","vsA","vsA","H_ALL_P_PM1",e,sim,&ops_tp); // destructed
+	a_e->cc0_vs_vs = constructor_operators_tp("cc0","vsA","vsA","H_ALL_P_LPM1",e,sim,&ops_tp); // destructed
 
 	set_operators_tp(&ops_tp,a_se[0]->cc0_vr_vr,NULL,a_se[1]->cc0_vr_vr,NULL);
 	a_e->cc0_vr_vr = constructor_operators_tp("cc0","vrA","vrA","H_ALL_P_PM1",e,sim,&ops_tp); // destructed
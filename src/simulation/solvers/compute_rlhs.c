@@ -20,6 +20,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <assert.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include "mpi.h"
 
 #include "matrix.h"
 #include "multiarray.h"
@@ -29,6 +30,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "computational_elements.h"
 #include "intrusive.h"
 #include "math_functions.h"
+#include "partition.h"
 #include "test_case.h"
 #include "simulation.h"
 
@@ -61,12 +63,17 @@ double compute_max_rhs_dg_like (const struct Simulation*const sim)
 	double max_rhs = 0.0;
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
 		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		if (!is_volume_owned((struct Volume*)s_vol,sim))
+			continue;
 
 		struct Multiarray_d* rhs = s_vol->rhs;
 		double max_rhs_curr = norm_d(compute_size(rhs->order,rhs->extents),rhs->data,"Inf");
 		if (max_rhs_curr > max_rhs)
 			max_rhs = max_rhs_curr;
 	}
+
+	if (check_distributed(sim))
+		MPI_Allreduce(MPI_IN_PLACE,&max_rhs,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
 	return max_rhs;
 }
 
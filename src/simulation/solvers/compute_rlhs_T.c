@@ -20,6 +20,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdio.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 
 
 #include "def_templates_compute_rlhs.h"
@@ -43,7 +44,8 @@ struct Flux_Ref_T* constructor_Flux_Ref_T (const struct const_Multiarray_T*const
 	assert(flux->f != NULL);
 	assert(m->extents[0] == flux->f->extents[0]);
 
-	struct Flux_Ref_T*const flux_r = calloc(1,sizeof *flux_r); // returned
+	struct Flux_Ref_T*const flux_r = calloc_scratch(1,sizeof *flux_r); // returned
+	flux_r->in_scratch = in_scratch_scope();
 
 	flux_r->fr       = ( flux->f       ? constructor_flux_ref_piece_T(m,flux->f)       : NULL );
 	flux_r->dfr_ds   = ( flux->df_ds   ? constructor_flux_ref_piece_T(m,flux->df_ds)   : NULL );
@@ -62,7 +64,7 @@ void destructor_Flux_Ref_T (struct Flux_Ref_T*const flux_ref)
 	destructor_conditional_const_Multiarray_T(flux_ref->dfr_ds);
 	destructor_conditional_const_Multiarray_T(flux_ref->dfr_dg);
 	destructor_conditional_const_Multiarray_T(flux_ref->d2fr_ds2);
-	free(flux_ref);
+	free_scratch(flux_ref,flux_ref->in_scratch);
 }
 
 // Static functions ************************************************************************************************* //
@@ -84,7 +86,7 @@ static const struct const_Multiarray_T* constructor_flux_ref_piece_T
 			extents[i-1] = f->extents[i];
 	}
 
-	struct Multiarray_T* fr = constructor_zero_Multiarray_T('C',order,extents); // returned
+	struct Multiarray_T* fr = constructor_zero_Multiarray_T_scratch('C',order,extents); // returned
 
 	const int n_n   = (int)extents[0];
 	const int n_col = (int)compute_size(order,extents)/(n_n*DIM);
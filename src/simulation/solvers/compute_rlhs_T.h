@@ -29,6 +29,8 @@ struct Flux_Ref_T {
 	const struct const_Multiarray_T* dfr_ds;   ///< The reference flux Jacobians with respect to the solution.
 	const struct const_Multiarray_T* dfr_dg;   ///< The reference flux Jacobians with respect to the solution gradients.
 	const struct const_Multiarray_T* d2fr_ds2; ///< The reference flux Hessians  with respect to the solution.
+
+	bool in_scratch; ///< Flag for whether the container was allocated from the scratch arena.
 };
 
 /** \brief Constructor for a \ref Flux_Ref_T container.
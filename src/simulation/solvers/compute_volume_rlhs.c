@@ -30,6 +30,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "test_case.h"
 
@@ -18,8 +18,10 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_intrusive.h"
 #include "definitions_test_case.h"
 
@@ -93,6 +95,29 @@ static void destructor_sol_vc_col
 	(const struct const_Multiarray_T* sol_vc ///< To be destructed.
 	);
 
+/** \brief Constructor for the \ref Matrix_T\* holding the solution or gradient coefficients interpolated to the volume
+ *         cubature nodes for all volumes of the batch if interpolation is used.
+ *  \return See brief; `NULL` if the values are not interpolated.
+ *
+ *  The coefficients of the volumes are stacked column-wise such that the interpolation is performed using a single
+ *  matrix-matrix multiplication.
+ */
+static struct Matrix_T* constructor_vc_batch_T
+	(const char coef_type,                               ///< The type of coefficient. Options: 's'olution, 'g'radient.
+	 const struct S_Params_Volume_Structor_T*const spvs, ///< Defined for \ref compute_rhs_v_dg_like_batch_T.
+	 const ptrdiff_t n_b,                                ///< Defined for \ref compute_rhs_v_dg_like_batch_T.
+	 struct Solver_Volume_T*const*const s_vols,          ///< Defined for \ref compute_rhs_v_dg_like_batch_T.
+	 struct Multiarray_T*const vc_v                      ///< Set to the view of the values of a single volume.
+	);
+
+/** \brief Get the view of the values of the input volume from the batched values.
+ *  \return See brief. */
+static const struct const_Multiarray_T* get_vc_batch_T
+	(const struct Matrix_T*const vc_b, ///< The batched values.
+	 const ptrdiff_t b,                ///< The index of the volume in the batch.
+	 struct Multiarray_T*const vc_v    ///< The view to be set.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 void set_S_Params_Volume_Structor_T (struct S_Params_Volume_Structor_T* spvs, const struct Simulation* sim)
@@ -176,6 +201,81 @@ void compute_rhs_v_dg_like_T
 		mm_NNC_Operator_Multiarray_T(1.0,1.0,tw1_vt_vc.data[dim],flux_r->fr,s_vol->rhs,op_format,2,&dim,NULL);
 }
 
+void compute_rhs_v_dg_like_batch_T
+	(const struct S_Params_Volume_Structor_T*const spvs, struct Flux_Input_T*const flux_i, const ptrdiff_t n_b,
+	 struct Solver_Volume_T*const*const s_vols)
+{
+	assert(n_b > 0);
+
+	// Interpolate the coefficients of all volumes in the batch to the volume cubature nodes.
+	ptrdiff_t ext_s[3], ext_g[3];
+	struct Multiarray_T s_vc_v = { .layout = 'C', .order = 0, .extents = ext_s, .owns_data = false, .data = NULL, },
+	                    g_vc_v = { .layout = 'C', .order = 0, .extents = ext_g, .owns_data = false, .data = NULL, };
+	struct Matrix_T*const s_vc_b = constructor_vc_batch_T('s',spvs,n_b,s_vols,&s_vc_v); // destructed
+	struct Matrix_T*const g_vc_b = constructor_vc_batch_T('g',spvs,n_b,s_vols,&g_vc_v); // destructed
+
+	const struct Multiarray_Operator tw1_vt_vc = get_operator__tw1_vt_vc_T(s_vols[0]);
+	const ptrdiff_t n_vt = tw1_vt_vc.data[0]->op_std->ext_0,
+	                n_vc = tw1_vt_vc.data[0]->op_std->ext_1;
+	const int n_eq = get_set_n_var_eq(NULL)[1];
+
+	// Compute the reference fluxes, stacking those of each dimension for all volumes in the batch.
+	struct Matrix_T* fr_b[DIM];
+	for (int dim = 0; dim < DIM; ++dim)
+		fr_b[dim] = constructor_empty_Matrix_T_scratch('C',n_vc,n_eq*n_b); // destructed
+
+	const size_t size_fr = (size_t)(n_vc*n_eq);
+	for (ptrdiff_t b = 0; b < n_b; ++b) {
+		const struct Solver_Volume_T*const s_vol = s_vols[b];
+		assert(get_operator__tw1_vt_vc_T(s_vol).data[0] == tw1_vt_vc.data[0]);
+
+		flux_i->s   = ( s_vc_b ? get_vc_batch_T(s_vc_b,b,&s_vc_v) : spvs->constructor_sol_vc(s_vol) );
+		flux_i->g   = ( g_vc_b ? get_vc_batch_T(g_vc_b,b,&g_vc_v) : spvs->constructor_grad_vc(s_vol) );
+		flux_i->xyz = constructor_xyz_vc(s_vol);
+
+		struct Flux_T* flux = constructor_Flux_T(flux_i); // destructed
+		if (!s_vc_b)
+			spvs->destructor_sol_vc(flux_i->s);
+		if (!g_vc_b)
+			spvs->destructor_grad_vc(flux_i->g);
+		destructor_conditional_const_Multiarray_T(flux_i->xyz);
+
+		struct Flux_Ref_T* flux_r = constructor_Flux_Ref_T(s_vol->metrics_vc,flux); // destructed
+		destructor_Flux_T(flux);
+
+		const struct const_Multiarray_T*const fr = flux_r->fr;
+		assert(compute_size(fr->order,fr->extents) == (ptrdiff_t)size_fr*DIM);
+		for (int dim = 0; dim < DIM; ++dim)
+			memcpy(&fr_b[dim]->data[(size_t)b*size_fr],&fr->data[(size_t)dim*size_fr],size_fr*sizeof(Type));
+		destructor_Flux_Ref_T(flux_r);
+	}
+	if (s_vc_b)
+		destructor_Matrix_T(s_vc_b);
+	if (g_vc_b)
+		destructor_Matrix_T(g_vc_b);
+
+	// Compute the rhs terms for all volumes in the batch.
+	struct Matrix_T*const rhs_b = constructor_empty_Matrix_T_scratch('C',n_vt,n_eq*n_b); // destructed
+	for (int dim = 0; dim < DIM; ++dim) {
+		const Type beta = ( dim == 0 ? 0.0 : 1.0 );
+		mm_RTT('N','N',1.0,beta,tw1_vt_vc.data[dim]->op_std,(struct const_Matrix_T*)fr_b[dim],rhs_b);
+		add_profile_mm(n_vt,n_vc,n_eq*n_b,(int)(sizeof(Type)/sizeof(Real)));
+		destructor_Matrix_T(fr_b[dim]);
+	}
+
+	const ptrdiff_t size_rhs = n_vt*n_eq;
+	for (ptrdiff_t b = 0; b < n_b; ++b) {
+		struct Multiarray_T*const rhs = s_vols[b]->rhs;
+		assert(rhs->layout == 'C');
+		assert(compute_size(rhs->order,rhs->extents) == size_rhs);
+
+		const Type*const rhs_b_data = &rhs_b->data[b*size_rhs];
+		for (ptrdiff_t i = 0; i < size_rhs; ++i)
+			rhs->data[i] += rhs_b_data[i];
+	}
+	destructor_Matrix_T(rhs_b);
+}
+
 struct Matrix_T* constructor_lhs_v_1_T (const struct Flux_Ref_T*const flux_r, const struct Solver_Volume_T*const s_vol)
 {
 	const struct Multiarray_Operator tw1_vt_vc = get_operator__tw1_vt_vc_T(s_vol);
@@ -192,9 +292,10 @@ print_const_Matrix_d(cv0_vs_vc->op_std);
 	const int n_vr = n_var_eq[0],
 	          n_eq = n_var_eq[1];
 
-	struct Matrix_T* tw1_r = constructor_empty_Matrix_T('R',ext_0,ext_1);                         // destructed
-	struct Matrix_T* lhs_l = constructor_empty_Matrix_T('R',ext_0,cv0_vs_vc->op_std->ext_1);      // destructed
-	struct Matrix_T* lhs   = constructor_empty_Matrix_T('R',n_eq*lhs_l->ext_0,n_vr*lhs_l->ext_1); // returned
+	struct Matrix_T* tw1_r = constructor_empty_Matrix_T_scratch('R',ext_0,ext_1);                    // destructed
+	struct Matrix_T* lhs_l = constructor_empty_Matrix_T_scratch('R',ext_0,cv0_vs_vc->op_std->ext_1); // destructed
+	struct Matrix_T* lhs   =
+		constructor_empty_Matrix_T_scratch('R',n_eq*lhs_l->ext_0,n_vr*lhs_l->ext_1); // returned
 
 	const struct const_Multiarray_T* dfr_ds_Ma = flux_r->dfr_ds;
 	struct Vector_T dfr_ds = { .ext_0 = dfr_ds_Ma->extents[0], .owns_data = false, .data = NULL, };
@@ -344,6 +445,59 @@ static void destructor_sol_vc_col (const struct const_Multiarray_T* sol_vc)
 	UNUSED(sol_vc);
 }
 
+/** \brief Get the solution or gradient coefficients of the input volume.
+ *  \return See brief. */
+static const struct Multiarray_T* get_coef_T
+	(const char coef_type,                    ///< Defined for \ref constructor_vc_batch_T.
+	 const struct Solver_Volume_T*const s_vol ///< The current volume.
+	);
+
+static struct Matrix_T* constructor_vc_batch_T
+	(const char coef_type, const struct S_Params_Volume_Structor_T*const spvs, const ptrdiff_t n_b,
+	 struct Solver_Volume_T*const*const s_vols, struct Multiarray_T*const vc_v)
+{
+	const bool interp = ( coef_type == 's' ? spvs->constructor_sol_vc  == constructor_sol_vc_interp
+	                                       : spvs->constructor_grad_vc == constructor_grad_vc_interp );
+	if (!interp)
+		return NULL;
+
+	const struct Operator*const cv0_vc = ( coef_type == 's' ? get_operator__cv0_vs_vc_T(s_vols[0])
+	                                                        : get_operator__cv0_vr_vc_T(s_vols[0]) );
+
+	const struct Multiarray_T*const coef_0 = get_coef_T(coef_type,s_vols[0]);
+	const ptrdiff_t size  = compute_size(coef_0->order,coef_0->extents),
+	                ext_0 = coef_0->extents[0],
+	                n_col = ( ext_0 ? size/ext_0 : 0 );
+
+	struct Matrix_T*const coef_b = constructor_empty_Matrix_T_scratch('C',ext_0,n_col*n_b); // destructed
+	for (ptrdiff_t b = 0; b < n_b; ++b) {
+		const struct Multiarray_T*const coef = get_coef_T(coef_type,s_vols[b]);
+		assert(coef->layout == 'C');
+		assert(compute_size(coef->order,coef->extents) == size);
+		memcpy(&coef_b->data[b*size],coef->data,(size_t)size*sizeof(Type));
+	}
+
+	struct Matrix_T*const vc_b = constructor_empty_Matrix_T_scratch('C',cv0_vc->op_std->ext_0,n_col*n_b); // returned
+	mm_RTT('N','N',1.0,0.0,cv0_vc->op_std,(struct const_Matrix_T*)coef_b,vc_b);
+	add_profile_mm(cv0_vc->op_std->ext_0,ext_0,n_col*n_b,(int)(sizeof(Type)/sizeof(Real)));
+	destructor_Matrix_T(coef_b);
+
+	assert(coef_0->order <= 3);
+	vc_v->order = coef_0->order;
+	for (int i = 0; i < vc_v->order; ++i)
+		vc_v->extents[i] = coef_0->extents[i];
+	vc_v->extents[0] = vc_b->ext_0;
+
+	return vc_b;
+}
+
+static const struct const_Multiarray_T* get_vc_batch_T
+	(const struct Matrix_T*const vc_b, const ptrdiff_t b, struct Multiarray_T*const vc_v)
+{
+	vc_v->data = &vc_b->data[b*compute_size(vc_v->order,vc_v->extents)];
+	return (const struct const_Multiarray_T*) vc_v;
+}
+
 // Level 1 ********************************************************************************************************** //
 
 static const struct Operator* get_operator__cv0_vg_vc_T (const struct Solver_Volume_T* s_vol)
@@ -357,6 +511,21 @@ static const struct Operator* get_operator__cv0_vg_vc_T (const struct Solver_Vol
 	return get_Multiarray_Operator(e->cv0_vg_vc[curved],(ptrdiff_t[]){0,0,p,p_i});
 }
 
+static const struct Multiarray_T* get_coef_T (const char coef_type, const struct Solver_Volume_T*const s_vol)
+{
+	switch (coef_type) {
+	case 's':
+		return s_vol->sol_coef;
+		break;
+	case 'g':
+		return s_vol->grad_coef;
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %c\n",coef_type);
+		break;
+	}
+}
+
 #include "undef_templates_compute_volume_rlhs.h"
 #include "undef_templates_compute_rlhs.h"
 
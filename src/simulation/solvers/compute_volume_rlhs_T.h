@@ -17,6 +17,8 @@ You should have received a copy of the GNU General Public License along with DPG
  *         (rlhs) terms of supported schemes.
  */
 
+#include <stddef.h>
+
 #include "def_templates_compute_volume_rlhs.h"
 #include "def_templates_compute_rlhs.h"
 #include "def_templates_volume_solver.h"
@@ -96,6 +98,20 @@ void compute_rhs_v_dg_like_T
 	 struct Solver_Storage_Implicit*const ssi ///< See brief.
 	);
 
+/** \brief Version of \ref compute_rhs_v_dg_like_T computing the rhs terms for a batch of volumes sharing the same
+ *         operators (i.e. having the same element, reference order and curved flag).
+ *
+ *  The coefficients of all volumes in the batch are interpolated to the volume cubature nodes and the reference fluxes
+ *  are projected onto the test basis using a single matrix-matrix multiplication for the batch (for each of the
+ *  operators). The batched temporaries are allocated using \ref malloc_scratch.
+ */
+void compute_rhs_v_dg_like_batch_T
+	(const struct S_Params_Volume_Structor_T*const spvs, ///< Standard.
+	 struct Flux_Input_T*const flux_i,                   ///< Standard.
+	 const ptrdiff_t n_b,                                ///< The number of volumes in the batch.
+	 struct Solver_Volume_T*const*const s_vols           ///< The volumes of the batch.
+	);
+
 /** \brief Constructor for the lhs volume term of 1st order equations only (i.e. flux having dependence only on \ref
  *         Solver_Volume_T::sol_coef.
  *  \return See brief. */
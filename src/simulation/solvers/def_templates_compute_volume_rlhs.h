@@ -34,6 +34,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_Flux_Ref_vol_T     constructor_Flux_Ref_vol
 #define destructor_Flux_Ref_T          destructor_Flux_Ref
 #define compute_rhs_v_dg_like_T        compute_rhs_v_dg_like
+#define compute_rhs_v_dg_like_batch_T  compute_rhs_v_dg_like_batch
 #define constructor_lhs_v_1_T          constructor_lhs_v_1
 #define constructor_lhs_p_v_2_T        constructor_lhs_p_v_2
 ///\}
@@ -50,6 +51,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #define destructor_sol_vc_col destructor_sol_vc_col
 #define constructor_flux_ref_T constructor_flux_ref_T
 #define get_operator__cv0_vg_vc_T get_operator__cv0_vg_vc_T
+#define constructor_vc_batch_T constructor_vc_batch_T
+#define get_vc_batch_T get_vc_batch_T
+#define get_coef_T get_coef_T
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
@@ -70,6 +74,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_Flux_Ref_vol_T     constructor_Flux_Ref_vol_c
 #define destructor_Flux_Ref_T          destructor_Flux_Ref_c
 #define compute_rhs_v_dg_like_T        compute_rhs_v_dg_like_c
+#define compute_rhs_v_dg_like_batch_T  compute_rhs_v_dg_like_batch_c
 #define constructor_lhs_v_1_T          constructor_lhs_v_1_c
 #define constructor_lhs_p_v_2_T        constructor_lhs_p_v_2_c
 ///\}
@@ -86,6 +91,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #define destructor_sol_vc_col destructor_sol_vc_col_c
 #define constructor_flux_ref_T constructor_flux_ref_T_c
 #define get_operator__cv0_vg_vc_T get_operator__cv0_vg_vc_T_c
+#define constructor_vc_batch_T constructor_vc_batch_T_c
+#define get_vc_batch_T get_vc_batch_T_c
+#define get_coef_T get_coef_T_c
 ///\}
 
 #endif
@@ -25,11 +25,15 @@ You should have received a copy of the GNU General Public License along with DPG
 #define get_operator__tw0_vt_vc_T             get_operator__tw0_vt_vc
 #define initialize_zero_memory_volumes_T      initialize_zero_memory_volumes
 #define update_ind_dof_T update_ind_dof_d
+#define compute_block_size_T compute_block_size
 ///\}
 
 ///\{ \name Static names
 #define update_ind_dof_test_T update_ind_dof_test_d
 #define constructor_nnz constructor_nnz
+#define constructor_petsc_mat_vec_mpi constructor_petsc_mat_vec_mpi
+#define constructor_petsc_mat_seq constructor_petsc_mat_seq
+#define constructor_nnz_block constructor_nnz_block
 #define compute_dof_volumes compute_dof_volumes
 #define compute_dof_faces compute_dof_faces
 #define compute_dof_volumes_l_mult compute_dof_volumes_l_mult
@@ -46,11 +50,15 @@ You should have received a copy of the GNU General Public License along with DPG
 #define get_operator__tw0_vt_vc_T             get_operator__tw0_vt_vc_c
 #define initialize_zero_memory_volumes_T      initialize_zero_memory_volumes_c
 #define update_ind_dof_T update_ind_dof_c
+#define compute_block_size_T compute_block_size_c
 ///\}
 
 ///\{ \name Static names
 #define update_ind_dof_test_T update_ind_dof_test_c
 #define constructor_nnz constructor_nnz_c
+#define constructor_petsc_mat_vec_mpi constructor_petsc_mat_vec_mpi_c
+#define constructor_petsc_mat_seq constructor_petsc_mat_seq_c
+#define constructor_nnz_block constructor_nnz_block_c
 #define compute_dof_volumes compute_dof_volumes_c
 #define compute_dof_faces compute_dof_faces_c
 #define compute_dof_volumes_l_mult compute_dof_volumes_l_mult_c
@@ -25,6 +25,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "face_solver_dg.h"
 #include "element_solver.h"
+#include "face.h"
 #include "volume.h"
 #include "volume_solver_dg.h"
 
@@ -34,6 +35,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "multiarray_operator.h"
 #include "numerical_flux.h"
 #include "operator.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solve.h"
 #include "solve_dg.h"
@@ -20,6 +20,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdio.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_intrusive.h"
 #include "definitions_numerical_flux.h"
 
@@ -83,6 +84,17 @@ static void constructor_Boundary_Value_g_face_fcl
 	 const struct DG_Solver_Face_T*const dg_s_face ///< \ref DG_Solver_Face_T.
 	);
 
+/// \brief Compute the rhs and, if applicable, the lhs terms of the input face.
+static void compute_face_rlhs_face_T
+	(struct DG_Solver_Face_T*const dg_s_face,        ///< The current face.
+	 struct Numerical_Flux_Input_T*const num_flux_i, ///< \ref Numerical_Flux_Input_T.
+	 const struct S_Params_T*const s_params,         ///< \ref S_Params_T.
+	 const struct Solver_Storage_Implicit*const ssi, ///< The shared \ref Solver_Storage_Implicit (`NULL` if explicit).
+	 struct Solver_Storage_Implicit*const ssi_p,     ///< The \ref Solver_Storage_Implicit of the current thread.
+	 const struct Simulation*const sim,              ///< \ref Simulation.
+	 const bool has_2nd_order                        ///< Flag for whether the pde has 2nd order terms.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 void compute_face_rlhs_dg_T
@@ -95,22 +107,41 @@ void compute_face_rlhs_dg_T
 	const bool has_2nd_order = get_set_has_1st_2nd_order(NULL)[1];
 
 	struct S_Params_T s_params = set_s_params_T(sim);
-	struct Numerical_Flux_Input_T* num_flux_i = constructor_Numerical_Flux_Input_T(sim); // destructed
-
-	for (struct Intrusive_Link* curr = faces->first; curr; curr = curr->next) {
-		struct Solver_Face_T*const s_face       = (struct Solver_Face_T*) curr;
-		struct DG_Solver_Face_T*const dg_s_face = (struct DG_Solver_Face_T*) curr;
-
-		constructor_Numerical_Flux_Input_data_dg_T(num_flux_i,dg_s_face,sim,has_2nd_order); // destructed
 
-		struct Numerical_Flux_T* num_flux = constructor_Numerical_Flux_T(num_flux_i); // destructed
-		destructor_Numerical_Flux_Input_data_T(num_flux_i);
+	/* The face terms are added to the rhs of both neighbouring volumes; faces of a given colour do not share any
+	 * neighbours and can thus be processed concurrently. */
+	const struct Face_Colouring*const f_col = sim->face_colouring;
+	if (!f_col) {
+		struct Numerical_Flux_Input_T* num_flux_i = constructor_Numerical_Flux_Input_T(sim); // destructed
+		for (struct Intrusive_Link* curr = faces->first; curr; curr = curr->next)
+			compute_face_rlhs_face_T((struct DG_Solver_Face_T*)curr,num_flux_i,&s_params,ssi,ssi,sim,has_2nd_order);
+		destructor_Numerical_Flux_Input_T(num_flux_i);
+		return;
+	}
 
-		s_params.scale_by_Jacobian(num_flux,s_face);
-		s_params.compute_rlhs(num_flux,s_face,ssi);
-		destructor_Numerical_Flux_T(num_flux);
+	ptrdiff_t n_f = 0;
+	struct Intrusive_Link**const links = constructor_array_Link(faces,&n_f); // free
+	assert(n_f == f_col->n_f);
+
+	PRAGMA_OMP(parallel)
+	{
+		struct Numerical_Flux_Input_T* num_flux_i = constructor_Numerical_Flux_Input_T(sim); // destructed
+
+		struct Solver_Storage_Implicit ssi_l;
+		struct Solver_Storage_Implicit*const ssi_p = ( ssi ? &ssi_l : NULL );
+		if (ssi)
+			ssi_l = *ssi;
+
+		for (int c = 0; c < f_col->n_colours; ++c) {
+			PRAGMA_OMP(for schedule(dynamic,CHUNK_OMP))
+			for (ptrdiff_t f = f_col->ind_colour[c]; f < f_col->ind_colour[c+1]; ++f) {
+				struct DG_Solver_Face_T*const dg_s_face = (struct DG_Solver_Face_T*) links[f_col->ind_f[f]];
+				compute_face_rlhs_face_T(dg_s_face,num_flux_i,&s_params,ssi,ssi_p,sim,has_2nd_order);
+			}
+		}
+		destructor_Numerical_Flux_Input_T(num_flux_i);
 	}
-	destructor_Numerical_Flux_Input_T(num_flux_i);
+	free(links);
 }
 
 void compute_flux_imbalances_faces_dg_T (const struct Simulation*const sim)
@@ -159,6 +190,53 @@ void constructor_Numerical_Flux_Input_data_dg_T
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
+/** \brief Return the index of the side of the input face whose volume is of the coarser level of the local time
+ *         stepping if the face is on an interface between two levels; -1 otherwise.
+ *  \return See brief. */
+static int get_side_index_rhs_lts
+	(const struct Face*const face ///< \ref Face.
+	);
+
+/// \brief Add the face term of the input side to \ref DG_Solver_Volume_T::rhs_lts.
+static void add_to_rhs_lts
+	(const int side_index,                         ///< The index of the side of the face under consideration.
+	 const struct Numerical_Flux_T*const num_flux, ///< \ref Numerical_Flux_T (as seen from the input side).
+	 const struct Solver_Face_T*const s_face       ///< \ref Solver_Face_T.
+	);
+
+static void compute_face_rlhs_face_T
+	(struct DG_Solver_Face_T*const dg_s_face, struct Numerical_Flux_Input_T*const num_flux_i,
+	 const struct S_Params_T*const s_params, const struct Solver_Storage_Implicit*const ssi,
+	 struct Solver_Storage_Implicit*const ssi_p, const struct Simulation*const sim, const bool has_2nd_order)
+{
+	struct Solver_Face_T*const s_face = (struct Solver_Face_T*) dg_s_face;
+	if ((ssi && !is_face_local((struct Face*)s_face,sim)) || !is_face_lts_active_T((struct Face*)s_face))
+		return;
+	set_profile_element_type(((struct Face*)s_face)->element->type);
+
+	// The flux temporaries of the numerical flux are obtained from the scratch arena of the thread.
+	const struct Scratch_Scope scope = open_scratch_scope();
+	constructor_Numerical_Flux_Input_data_dg_T(num_flux_i,dg_s_face,sim,has_2nd_order); // destructed
+
+	struct Numerical_Flux_T* num_flux = constructor_Numerical_Flux_T(num_flux_i); // destructed
+	destructor_Numerical_Flux_Input_data_T(num_flux_i);
+
+	s_params->scale_by_Jacobian(num_flux,s_face);
+
+	/* The face term of the coarser volume on an interface between levels of the local time stepping is also stored for
+	 * its flux register. As the numerical flux is converted to that seen from side 1 when computing the rhs terms, the
+	 * term of side 0 must be added before and that of side 1 after. */
+	const int side_index_lts = ( ssi ? -1 : get_side_index_rhs_lts((struct Face*)s_face) );
+	if (side_index_lts == 0)
+		add_to_rhs_lts(0,num_flux,s_face);
+	s_params->compute_rlhs(num_flux,s_face,ssi_p);
+	if (side_index_lts == 1)
+		add_to_rhs_lts(1,num_flux,s_face);
+
+	destructor_Numerical_Flux_T(num_flux);
+	close_scratch_scope(scope);
+}
+
 /** \brief Constructor for the partially corrected weak gradient interpolated to the face cubature nodes as seen from
  *         the volume of input "side_index".
  *  \return See brief. */
@@ -236,6 +314,34 @@ static void constructor_Boundary_Value_g_face_fcl
 
 // Level 1 ********************************************************************************************************** //
 
+static int get_side_index_rhs_lts (const struct Face*const face)
+{
+	if (face->boundary)
+		return -1;
+
+	const struct DG_Solver_Volume_T*const dg_s_vol[2] =
+		{ (struct DG_Solver_Volume_T*) face->neigh_info[0].volume,
+		  (struct DG_Solver_Volume_T*) face->neigh_info[1].volume, };
+	if (dg_s_vol[0]->lts_level == dg_s_vol[1]->lts_level)
+		return -1;
+
+	const int side_index = ( dg_s_vol[0]->lts_level > dg_s_vol[1]->lts_level ? 0 : 1 );
+	assert(dg_s_vol[side_index]->rhs_lts != NULL);
+	return side_index;
+}
+
+static void add_to_rhs_lts
+	(const int side_index, const struct Numerical_Flux_T*const num_flux, const struct Solver_Face_T*const s_face)
+{
+	const struct Face*const face = (struct Face*) s_face;
+	struct DG_Solver_Volume_T*const dg_s_vol = (struct DG_Solver_Volume_T*) face->neigh_info[side_index].volume;
+
+	const struct Operator*const tw0_vt_fc = get_operator__tw0_vt_fc_T(side_index,s_face);
+	const char op_format = get_set_op_format(0);
+
+	mm_NNC_Operator_Multiarray_T(-1.0,1.0,tw0_vt_fc,num_flux->nnf,dg_s_vol->rhs_lts,op_format,2,NULL,NULL);
+}
+
 /** \brief Return the scaling for the face contribution to the weak gradient used to compute the numerical flux.
  *  \return See brief. */
 static Real compute_scaling_weak_gradient
@@ -32,6 +32,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solve.h"
 #include "solve_dg.h"
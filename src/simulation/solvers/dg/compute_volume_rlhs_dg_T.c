@@ -16,14 +16,17 @@ You should have received a copy of the GNU General Public License along with DPG
  */
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_intrusive.h"
 
 
 #include "def_templates_compute_volume_rlhs_dg.h"
+#include "def_templates_solve_dg.h"
 
 #include "def_templates_volume_solver.h"
 #include "def_templates_volume_solver_dg.h"
@@ -35,6 +38,9 @@ You should have received a copy of the GNU General Public License along with DPG
 
 // Static function declarations ************************************************************************************* //
 
+/// The maximum number of volumes in each of the batches used by \ref compute_rhs_v_batched_T.
+#define N_BATCH_MAX_V 64
+
 /// \brief Container for solver-related parameters.
 struct S_Params_T {
 	struct S_Params_Volume_Structor_T spvs; ///< \ref S_Params_Volume_Structor_T.
@@ -48,6 +54,35 @@ static struct S_Params_T set_s_params_T
 	(const struct Simulation* sim ///< \ref Simulation.
 	);
 
+/** \brief Check whether the volume rhs terms should be computed for batches of volumes (see
+ *         \ref compute_rhs_v_batched_T).
+ *  \return `true` if yes; `false` otherwise.
+ *
+ *  Batching is only used when:
+ *  - \ref Test_Case_T::use_volume_batching is enabled;
+ *  - only the rhs is being computed (the lhs blocks are inserted into the global system for each volume individually);
+ *  - the operators are applied in the standard (dense) format as the batched multiplications use the dense operators
+ *    (the tensor-product and sparse formats already reduce the cost of the per-volume multiplications).
+ */
+static bool check_volume_batching_T
+	(const struct Simulation*const sim,         ///< Standard.
+	 const struct Solver_Storage_Implicit* ssi, ///< Standard.
+	 const struct S_Params_T*const s_params     ///< \ref S_Params_T.
+	);
+
+/** \brief Compute the rhs volume terms using \ref compute_rhs_v_dg_like_batch_T for batches of volumes sharing the
+ *         same operators.
+ *
+ *  This is used for the rhs-only evaluations (explicit solver, jfnk matrix-free products) for which the cost of the
+ *  small matrix-matrix multiplications performed for each of the volumes individually is dominated by the call
+ *  overhead.
+ */
+static void compute_rhs_v_batched_T
+	(const struct Simulation*const sim,                  ///< Standard.
+	 const struct S_Params_Volume_Structor_T*const spvs, ///< Standard.
+	 struct Intrusive_List*const volumes                 ///< The list of volumes.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 void compute_volume_rlhs_dg_T
@@ -57,18 +92,44 @@ void compute_volume_rlhs_dg_T
 	assert(sim->elements->name == IL_ELEMENT_SOLVER_DG);
 
 	struct S_Params_T s_params = set_s_params_T(sim);
-	struct Flux_Input_T* flux_i = constructor_Flux_Input_T(sim); // destructed
+	if (check_volume_batching_T(sim,ssi,&s_params)) {
+		compute_rhs_v_batched_T(sim,&s_params.spvs,volumes);
+		return;
+	}
+
+	ptrdiff_t n_v = 0;
+	struct Intrusive_Link**const vols = constructor_array_Link(volumes,&n_v); // freed
+
+	/* Each volume only updates its own rhs such that the volumes can be processed concurrently. The flux input and the
+	 * solver storage (whose row/col indices are modified before insertion) must be thread-private. */
+	PRAGMA_OMP(parallel)
+	{
+		struct Flux_Input_T* flux_i = constructor_Flux_Input_T(sim); // destructed
+
+		struct Solver_Storage_Implicit ssi_l;
+		struct Solver_Storage_Implicit*const ssi_p = ( ssi ? &ssi_l : NULL );
+		if (ssi)
+			ssi_l = *ssi;
 
-	for (struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next) {
-		struct Solver_Volume_T*const s_vol = (struct Solver_Volume_T*) curr;
+		PRAGMA_OMP(for schedule(dynamic,CHUNK_OMP))
+		for (ptrdiff_t v = 0; v < n_v; ++v) {
+			struct Solver_Volume_T*const s_vol = (struct Solver_Volume_T*) vols[v];
+			if ((ssi && !is_volume_owned((struct Volume*)s_vol,sim)) || !is_volume_lts_active_T((struct Volume*)s_vol))
+				continue;
+			set_profile_element_type(((struct Volume*)s_vol)->element->type);
 
-		struct Flux_Ref_T* flux_r = constructor_Flux_Ref_vol_T(&s_params.spvs,flux_i,s_vol); // destructed
+			// The flux temporaries are obtained from the scratch arena of the thread, released for each volume.
+			const struct Scratch_Scope scope = open_scratch_scope();
+			struct Flux_Ref_T* flux_r = constructor_Flux_Ref_vol_T(&s_params.spvs,flux_i,s_vol); // destructed
 
-		// Compute the rhs (and optionally the lhs) terms.
-		s_params.compute_rlhs(flux_r,s_vol,ssi);
-		destructor_Flux_Ref_T(flux_r);
+			// Compute the rhs (and optionally the lhs) terms.
+			s_params.compute_rlhs(flux_r,s_vol,ssi_p);
+			destructor_Flux_Ref_T(flux_r);
+			close_scratch_scope(scope);
+		}
+		destructor_Flux_Input_T(flux_i);
 	}
-	destructor_Flux_Input_T(flux_i);
+	free(vols);
 }
 
 // Static functions ************************************************************************************************* //
@@ -105,7 +166,123 @@ static struct S_Params_T set_s_params_T (const struct Simulation* sim)
 	return s_params;
 }
 
+/** \brief Constructor for the array of offsets of the batches of volumes sharing the same operators, sorting the input
+ *         volumes such that the volumes of each batch are contiguous.
+ *  \return See brief. */
+static ptrdiff_t* constructor_batch_offsets_T
+	(const ptrdiff_t n_v,               ///< The number of volumes.
+	 struct Intrusive_Link**const vols, ///< The array of volumes.
+	 ptrdiff_t*const n_batch            ///< Set to the number of batches.
+	);
+
+static bool check_volume_batching_T
+	(const struct Simulation*const sim, const struct Solver_Storage_Implicit* ssi,
+	 const struct S_Params_T*const s_params)
+{
+	const struct Test_Case_T*const test_case = (struct Test_Case_T*) sim->test_case_rc->tc;
+	return test_case->use_volume_batching && !ssi && s_params->compute_rlhs == compute_rhs_v_dg_like_T &&
+	       get_set_op_format(0) == 'd';
+}
+
+static void compute_rhs_v_batched_T
+	(const struct Simulation*const sim, const struct S_Params_Volume_Structor_T*const spvs,
+	 struct Intrusive_List*const volumes)
+{
+	ptrdiff_t n_v_all = 0;
+	struct Intrusive_Link**const vols = constructor_array_Link(volumes,&n_v_all); // freed
+
+	// Only the volumes which are active for the local time stepping are included in the batches.
+	ptrdiff_t n_v = 0;
+	for (ptrdiff_t v = 0; v < n_v_all; ++v) {
+		if (is_volume_lts_active_T((struct Volume*)vols[v]))
+			vols[n_v++] = vols[v];
+	}
+
+	ptrdiff_t n_batch = 0;
+	const ptrdiff_t*const offsets = constructor_batch_offsets_T(n_v,vols,&n_batch); // freed
+	if (n_batch > get_solver_stats()->n_volume_batches)
+		get_solver_stats()->n_volume_batches = (int)n_batch;
+
+	PRAGMA_OMP(parallel)
+	{
+		struct Flux_Input_T* flux_i = constructor_Flux_Input_T(sim); // destructed
+
+		PRAGMA_OMP(for schedule(dynamic,1))
+		for (ptrdiff_t i = 0; i < n_batch; ++i) {
+			set_profile_element_type(((struct Volume*)vols[offsets[i]])->element->type);
+			const struct Scratch_Scope scope = open_scratch_scope();
+			compute_rhs_v_dg_like_batch_T(spvs,flux_i,offsets[i+1]-offsets[i],
+			                              (struct Solver_Volume_T*const*)&vols[offsets[i]]);
+			close_scratch_scope(scope);
+		}
+		destructor_Flux_Input_T(flux_i);
+	}
+	free((void*)offsets);
+	free(vols);
+}
+
+// Level 1 ********************************************************************************************************** //
+
+/** \brief Comparison function for qsort ordering volumes by the key of their operators (element, reference order
+ *         and curved flag) and then by index.
+ *  \return The comparison result. */
+static int cmp_operator_key_T
+	(const void* a, ///< Pointer to the first volume.
+	 const void* b  ///< Pointer to the second volume.
+	);
+
+/** \brief Check whether the input volumes have the same operator key.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_same_operator_key_T
+	(const struct Intrusive_Link*const a, ///< The first volume.
+	 const struct Intrusive_Link*const b  ///< The second volume.
+	);
+
+static ptrdiff_t* constructor_batch_offsets_T
+	(const ptrdiff_t n_v, struct Intrusive_Link**const vols, ptrdiff_t*const n_batch)
+{
+	qsort(vols,(size_t)n_v,sizeof *vols,cmp_operator_key_T);
+
+	ptrdiff_t*const offsets = malloc((size_t)(n_v+1) * sizeof *offsets); // returned
+	ptrdiff_t n_b = 0;
+	offsets[0] = 0;
+	for (ptrdiff_t v = 1; v <= n_v; ++v) {
+		if (v == n_v || v-offsets[n_b] == N_BATCH_MAX_V || !check_same_operator_key_T(vols[v-1],vols[v]))
+			offsets[++n_b] = v;
+	}
+	*n_batch = n_b;
+	return offsets;
+}
+
+// Level 2 ********************************************************************************************************** //
+
+static int cmp_operator_key_T (const void* a, const void* b)
+{
+	const struct Volume*const vol_a = *(const struct Volume*const*) a,
+	                   *const vol_b = *(const struct Volume*const*) b;
+	const int p_a = ((const struct Solver_Volume_T*) vol_a)->p_ref,
+	          p_b = ((const struct Solver_Volume_T*) vol_b)->p_ref;
+
+	if (vol_a->element != vol_b->element)
+		return ( (uintptr_t)vol_a->element < (uintptr_t)vol_b->element ? -1 : 1 );
+	if (p_a != p_b)
+		return ( p_a < p_b ? -1 : 1 );
+	if (vol_a->curved != vol_b->curved)
+		return ( vol_a->curved ? 1 : -1 );
+	return ( vol_a->index < vol_b->index ? -1 : (vol_a->index > vol_b->index) );
+}
+
+static bool check_same_operator_key_T (const struct Intrusive_Link*const a, const struct Intrusive_Link*const b)
+{
+	const struct Volume*const vol_a = (const struct Volume*) a,
+	                   *const vol_b = (const struct Volume*) b;
+	return vol_a->element == vol_b->element &&
+	       ((const struct Solver_Volume_T*) vol_a)->p_ref == ((const struct Solver_Volume_T*) vol_b)->p_ref &&
+	       vol_a->curved == vol_b->curved;
+}
+
 #include "undef_templates_compute_volume_rlhs_dg.h"
+#include "undef_templates_solve_dg.h"
 
 #include "undef_templates_volume_solver.h"
 #include "undef_templates_volume_solver_dg.h"
@@ -36,6 +36,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_Boundary_Value_g_face_fcl constructor_Boundary_Value_g_face_fcl
 #define constructor_partial_grad_fc_interp constructor_partial_grad_fc_interp
 #define compute_scaling_weak_gradient compute_scaling_weak_gradient
+#define compute_face_rlhs_face_T compute_face_rlhs_face
+#define get_side_index_rhs_lts get_side_index_rhs_lts
+#define add_to_rhs_lts add_to_rhs_lts
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
@@ -55,6 +58,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_Boundary_Value_g_face_fcl constructor_Boundary_Value_g_face_fcl_c
 #define constructor_partial_grad_fc_interp constructor_partial_grad_fc_interp_c
 #define compute_scaling_weak_gradient compute_scaling_weak_gradient_c
+#define compute_face_rlhs_face_T compute_face_rlhs_face_c
+#define get_side_index_rhs_lts get_side_index_rhs_lts_c
+#define add_to_rhs_lts add_to_rhs_lts_c
 ///\}
 
 #endif
@@ -26,6 +26,11 @@ You should have received a copy of the GNU General Public License along with DPG
 ///\{ \name Static names
 #define S_Params_T S_Params_T
 #define set_s_params_T set_s_params_T
+#define check_volume_batching_T check_volume_batching_T
+#define compute_rhs_v_batched_T compute_rhs_v_batched_T
+#define constructor_batch_offsets_T constructor_batch_offsets_T
+#define cmp_operator_key_T cmp_operator_key_T
+#define check_same_operator_key_T check_same_operator_key_T
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
@@ -37,6 +42,11 @@ You should have received a copy of the GNU General Public License along with DPG
 ///\{ \name Static names
 #define S_Params_T S_Params_T_c
 #define set_s_params_T set_s_params_T_c
+#define check_volume_batching_T check_volume_batching_T_c
+#define compute_rhs_v_batched_T compute_rhs_v_batched_T_c
+#define constructor_batch_offsets_T constructor_batch_offsets_T_c
+#define cmp_operator_key_T cmp_operator_key_T_c
+#define check_same_operator_key_T check_same_operator_key_T_c
 ///\}
 
 #endif
@@ -20,12 +20,18 @@ You should have received a copy of the GNU General Public License along with DPG
 
 ///\{ \name Function names
 #define constructor_nnz_dg_T    constructor_nnz_dg
+#define constructor_nnz_o_dg_T  constructor_nnz_o_dg
+#define is_volume_lts_active_T  is_volume_lts_active
+#define is_face_lts_active_T    is_face_lts_active
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
 
 ///\{ \name Function names
 #define constructor_nnz_dg_T    constructor_nnz_dg_c
+#define constructor_nnz_o_dg_T  constructor_nnz_o_dg_c
+#define is_volume_lts_active_T  is_volume_lts_active_c
+#define is_face_lts_active_T    is_face_lts_active_c
 ///\}
 
 #endif
@@ -18,13 +18,19 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "solve_dg.h"
 
 #include <assert.h>
+#include <complex.h>
 #include <float.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "gsl/gsl_math.h"
+#include "mpi.h"
 #include "petscvec.h"
 
 #include "macros.h"
+#include "scratch_arena.h"
+#include "definitions_intrusive.h"
 #include "definitions_test_case.h"
 #include "definitions_tol.h"
 
@@ -39,6 +45,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "multiarray.h"
 #include "vector.h"
 
+#include "computational_elements.h"
 #include "compute_face_rlhs.h"
 #include "compute_grad_coef_dg.h"
 #include "compute_volume_rlhs_dg.h"
@@ -46,10 +53,13 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "compute_rlhs.h"
 #include "compute_source_rlhs_dg.h"
 #include "const_cast.h"
+#include "geometry.h"
 #include "intrusive.h"
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solution_euler.h"
 #include "solution_navier_stokes.h"
@@ -59,15 +69,47 @@ You should have received a copy of the GNU General Public License along with DPG
 
 // Static function declarations ************************************************************************************* //
 
+/** \brief Return the minimum measure of the length of the input volume.
+ *  \return See brief. */
+static double compute_min_length_measure
+	(const struct Solver_Volume*const s_vol, ///< \ref Solver_Volume_T.
+	 const struct Simulation*const sim       ///< \ref Simulation.
+	);
+
 /// \brief Call the common functions when computing the rlhs values for explicit and implicit dg schemes.
 static void compute_rlhs_common_dg
 	(const struct Simulation*const sim,       ///< \ref Simulation.
 	 struct Solver_Storage_Implicit*const ssi ///< \ref Solver_Storage_Implicit.
 	);
 
-/// \brief Scale the rhs terms by the the inverse mass matrices (for explicit schemes).
-static void scale_rhs_by_m_inv
-	(const struct Simulation*const sim ///< \ref Simulation.
+/** \brief Scale the rhs terms by the the inverse mass matrices (for explicit schemes), optionally applying the stage
+ *         update to the solution of each of the volumes in the same pass.
+ *  \return The maximum absolute value of the scaled rhs terms of the owned volumes. */
+static double scale_rhs_by_m_inv
+	(const struct Simulation*const sim,    ///< \ref Simulation.
+	 const update_stage_fptr update_stage, ///< Defined for \ref compute_rhs_update_dg.
+	 const void*const stage_data           ///< Defined for \ref compute_rhs_update_dg.
+	);
+
+/** \brief Version of \ref scale_rhs_by_m_inv used for non-collocated runs for a single volume.
+ *
+ *  The product is computed in memory from the scratch arena and copied back to the rhs such that no allocation is
+ *  required. */
+static void scale_rhs_by_m_inv_std
+	(struct Multiarray_d*const rhs,         ///< The rhs terms of the volume.
+	 const struct Solver_Volume*const s_vol ///< \ref Solver_Volume_T.
+	);
+
+/// \brief Version of \ref scale_rhs_by_m_inv used for collocated runs for a single volume.
+static void scale_rhs_by_m_inv_col
+	(struct Multiarray_d*const rhs,         ///< The rhs terms of the volume.
+	 const struct Solver_Volume*const s_vol ///< \ref Solver_Volume_T.
+	);
+
+/** \brief Check whether the input volume has a neighbour of the next finer level of the local time stepping.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_finer_neighbour_lts
+	(const struct Volume*const vol ///< \ref Volume.
 	);
 
 /** \brief Fill \ref Solver_Storage_Implicit::b with the negated rhs values.
@@ -117,6 +159,51 @@ static void compute_CFL_ramping
 	 const struct Simulation*const sim         ///< \ref Simulation.
 	);
 
+/// \brief Container for the data required to compute the action of the lhs matrix for the jfnk method.
+struct JFNK_Context_DG {
+	const struct Simulation* sim; ///< \ref Simulation.
+
+	/// The solution coefficients about which the rhs is linearized (indexed by \ref Solver_Volume_T::ind_dof).
+	double* sol_coef_0;
+	/// The rhs terms for \ref JFNK_Context_DG::sol_coef_0 (`NULL` if \ref JFNK_Context_DG::sim_c is used).
+	double* rhs_0;
+	double* dt;             ///< The CFL constrained time step of each volume (`NULL` if CFL ramping is not used).
+	double norm_sol_coef_0; ///< The L2 norm of \ref JFNK_Context_DG::sol_coef_0.
+
+	VecScatter scatter; ///< The scatter of the (distributed) input vector to all processes.
+	Vec v_all;          ///< The copy of the full input vector on each process.
+
+	/// \ref Simulation::sim_c_jfnk if \ref JFNK_CMPLX_STEP is used; `NULL` otherwise.
+	struct Simulation* sim_c;
+};
+
+/** \brief Constructor for a \ref JFNK_Context_DG container.
+ *  \return See brief. */
+static struct JFNK_Context_DG* constructor_JFNK_Context_DG
+	(const struct Solver_Storage_Implicit*const ssi, ///< Defined for \ref constructor_petsc_mat_jfnk_dg.
+	 const struct Simulation*const sim               ///< Defined for \ref constructor_petsc_mat_jfnk_dg.
+	);
+
+/// \brief Destructor for a \ref JFNK_Context_DG container.
+static void destructor_JFNK_Context_DG
+	(struct JFNK_Context_DG*const ctx ///< Standard.
+	);
+
+/** \brief Compute the product of the lhs matrix with the input vector for the jfnk method (`MATOP_MULT` of the Petsc
+ *         `MATSHELL`).
+ *  \return The Petsc error code. */
+static PetscErrorCode mult_jfnk_dg
+	(Mat A, ///< The Petsc `MATSHELL`.
+	 Vec v, ///< The input vector.
+	 Vec y  ///< The output vector.
+	);
+
+/** \brief Destructor for the context of the Petsc `MATSHELL` for the jfnk method (`MATOP_DESTROY`).
+ *  \return The Petsc error code. */
+static PetscErrorCode destroy_jfnk_dg
+	(Mat A ///< The Petsc `MATSHELL`.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 #include "def_templates_type_d.h"
@@ -129,10 +216,15 @@ static void compute_CFL_ramping
 
 double compute_rhs_dg (const struct Simulation* sim)
 {
-	compute_rlhs_common_dg(sim,NULL);
-	scale_rhs_by_m_inv(sim);
+	return compute_rhs_update_dg(sim,NULL,NULL);
+}
 
-	return compute_max_rhs_dg_like(sim);
+double compute_rhs_update_dg
+	(const struct Simulation*const sim, const update_stage_fptr update_stage, const void*const stage_data)
+{
+	zero_memory_volumes(sim->volumes);
+	compute_rlhs_common_dg(sim,NULL);
+	return scale_rhs_by_m_inv(sim,update_stage,stage_data);
 }
 
 double compute_rlhs_dg (const struct Simulation* sim, struct Solver_Storage_Implicit* ssi)
@@ -148,6 +240,10 @@ void set_petsc_Mat_row_col_dg
 	(struct Solver_Storage_Implicit*const ssi, const struct Solver_Volume* v_l, const int eq,
 	 const struct Solver_Volume* v_r, const int vr)
 {
+	if (ssi->element_local_only && v_l != v_r) {
+		ssi->row = -1; // Rows outside of the range owned by the current process are ignored by add_to_petsc_Mat.
+		return;
+	}
 	ssi->row = (int)(v_l->ind_dof+v_l->sol_coef->extents[0]*eq);
 	ssi->col = (int)(v_r->ind_dof+v_r->sol_coef->extents[0]*vr);
 }
@@ -158,18 +254,155 @@ void compute_flux_imbalances_dg (const struct Simulation*const sim)
 	compute_flux_imbalances_source_dg(sim);
 }
 
-// Static functions ************************************************************************************************* //
-// Level 0 ********************************************************************************************************** //
+Mat constructor_petsc_mat_jfnk_dg (const struct Solver_Storage_Implicit*const ssi, const struct Simulation*const sim)
+{
+	PetscInt n_local = 0,
+	         n       = 0;
+	VecGetLocalSize(ssi->b,&n_local);
+	VecGetSize(ssi->b,&n);
+
+	Mat A = NULL;
+	MatCreateShell(MPI_COMM_WORLD,n_local,n_local,n,n,constructor_JFNK_Context_DG(ssi,sim),&A); // destructed
+	MatShellSetOperation(A,MATOP_MULT,(void(*)(void))mult_jfnk_dg);
+	MatShellSetOperation(A,MATOP_DESTROY,(void(*)(void))destroy_jfnk_dg);
+	return A;
+}
 
-/// \brief Version of \ref scale_rhs_by_m_inv used for non-collocated runs.
-static void scale_rhs_by_m_inv_std
-	(const struct Simulation*const sim ///< \ref Simulation.
-	);
+void destructor_petsc_mat_jfnk_dg (Mat A)
+{
+	// The context is destructed when the last reference to the matrix (possibly held by a `KSP`) is destroyed.
+	MatDestroy(&A);
+}
 
-/// \brief Version of \ref scale_rhs_by_m_inv used for collocated runs.
-static void scale_rhs_by_m_inv_col
-	(const struct Simulation*const sim ///< \ref Simulation.
-	);
+void destructor_Simulation_c_jfnk_dg (struct Simulation*const sim)
+{
+	struct Simulation*const sim_c = sim->sim_c_jfnk;
+	if (!sim_c)
+		return;
+
+	destructor_derived_Elements(sim_c,IL_ELEMENT_SOLVER);
+	destructor_derived_computational_elements_c(sim_c,IL_SOLVER);
+	convert_to_Test_Case_rc(sim_c,'r');
+	destructor_derived_computational_elements_c(sim_c,IL_BASE);
+	destructor_derived_Elements(sim_c,IL_ELEMENT);
+	destructor_Simulation(sim_c);
+
+	sim->sim_c_jfnk = NULL;
+}
+
+double compute_dt_cfl_dg
+	(const double cfl, const bool scale_by_p, const struct Solver_Volume*const s_vol, const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+
+	struct Multiarray_d* s_coef_b = constructor_s_coef_bezier(s_vol,sim); // destructed
+
+	const ptrdiff_t ext_0 = s_coef_b->extents[0];
+
+	// Max wave speed.
+	struct Multiarray_d* V_p_c = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){ext_0,1}); // destructed
+	compute_max_wavespeed(V_p_c,(struct const_Multiarray_d*)s_coef_b,'c');
+
+	const double max_wave_speed = maximum_dd(V_p_c->data,ext_0);
+	destructor_Multiarray_d(V_p_c);
+
+	// Max viscosity.
+	double max_viscosity = EPS;
+	if (test_case->has_2nd_order) {
+		struct Multiarray_d* mu = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){ext_0,1}); // destructed
+		compute_viscosity(mu,(struct const_Multiarray_d*)s_coef_b,'c');
+
+		max_viscosity = maximum_dd(mu->data,ext_0);
+		destructor_Multiarray_d(mu);
+	}
+	destructor_Multiarray_d(s_coef_b);
+
+	// Min length measure.
+	double dx = compute_min_length_measure(s_vol,sim);
+	if (scale_by_p)
+		dx /= 2*s_vol->p_ref+1;
+
+	return cfl*GSL_MIN(dx/max_wave_speed,( !test_case->has_2nd_order ? DBL_MAX : dx*dx/max_viscosity ));
+}
+
+int get_set_lts_level_max (const int*const new_val)
+{
+	static int lts_level_max = INT_MAX;
+	if (new_val) {
+		EXIT_IF_IN_PARALLEL;
+		lts_level_max = *new_val;
+	}
+	return lts_level_max;
+}
+
+void set_up_flux_registers_dg (const struct Simulation*const sim)
+{
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct DG_Solver_Volume*const dg_s_vol = (struct DG_Solver_Volume*) curr;
+
+		const bool has_finer_neighbour = check_finer_neighbour_lts((struct Volume*)curr);
+		if (has_finer_neighbour && !dg_s_vol->flux_reg) {
+			const struct Multiarray_d*const s_coef = ((struct Solver_Volume*)curr)->sol_coef;
+			dg_s_vol->rhs_lts  = constructor_zero_Multiarray_d('C',s_coef->order,s_coef->extents); // destructed
+			dg_s_vol->flux_reg = constructor_zero_Multiarray_d('C',s_coef->order,s_coef->extents); // destructed
+		} else if (!has_finer_neighbour && dg_s_vol->flux_reg) {
+			destructor_Multiarray_d(dg_s_vol->rhs_lts);
+			destructor_Multiarray_d(dg_s_vol->flux_reg);
+			dg_s_vol->rhs_lts  = NULL;
+			dg_s_vol->flux_reg = NULL;
+		}
+	}
+}
+
+void update_flux_registers_dg (const double dt_b, const struct Simulation*const sim)
+{
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct DG_Solver_Volume*const dg_s_vol = (struct DG_Solver_Volume*) curr;
+		if (!dg_s_vol->flux_reg)
+			continue;
+		assert(dg_s_vol->lts_level > 0);
+
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Multiarray_d*const rhs_lts = dg_s_vol->rhs_lts;
+		if (!sim->collocated)
+			scale_rhs_by_m_inv_std(rhs_lts,s_vol);
+		else
+			scale_rhs_by_m_inv_col(rhs_lts,s_vol);
+
+		const double sign  = ( is_volume_lts_active((struct Volume*)curr) ? -1.0 : 1.0 ),
+		             scale = sign*dt_b*(double)(1 << (dg_s_vol->lts_level-1));
+
+		double*const data_fr  = dg_s_vol->flux_reg->data,
+		      *const data_rhs = rhs_lts->data;
+
+		const ptrdiff_t i_max = compute_size(rhs_lts->order,rhs_lts->extents);
+		for (ptrdiff_t i = 0; i < i_max; ++i) {
+			data_fr[i] += scale*data_rhs[i];
+			data_rhs[i] = 0.0;
+		}
+	}
+}
+
+void apply_flux_registers_dg (const struct Simulation*const sim)
+{
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct DG_Solver_Volume*const dg_s_vol = (struct DG_Solver_Volume*) curr;
+		if (!dg_s_vol->flux_reg || !is_volume_lts_active((struct Volume*)curr))
+			continue;
+
+		double*const data_s  = ((struct Solver_Volume*)curr)->sol_coef->data,
+		      *const data_fr = dg_s_vol->flux_reg->data;
+
+		const ptrdiff_t i_max = compute_size(dg_s_vol->flux_reg->order,dg_s_vol->flux_reg->extents);
+		for (ptrdiff_t i = 0; i < i_max; ++i) {
+			data_s[i]  += data_fr[i];
+			data_fr[i]  = 0.0;
+		}
+	}
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
 
 /** \brief Return the time step relating to the CFL ramping.
  *  \return See brief. */
@@ -179,30 +412,123 @@ static double compute_dt_cfl_constrained
 	 const struct Simulation*const sim       ///< \ref Simulation.
 	);
 
+/** \brief Compute the (unscaled) rhs terms for the current solution using the explicit code path, as required for the
+ *         jfnk method. */
+static void compute_rhs_jfnk_dg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/// \brief Set the solution coefficients to `sol_coef_0 + alpha*v` for the jfnk method.
+static void set_sol_coef_jfnk_dg
+	(const double alpha,                    ///< The scaling of the increment.
+	 const PetscScalar*const v,             ///< The increment for all of the global dof (unused if `alpha == 0`).
+	 const struct JFNK_Context_DG*const ctx ///< \ref JFNK_Context_DG.
+	);
+
+/// \brief Copy \ref JFNK_Context_DG::rhs_0 back to the rhs terms of the volumes for the jfnk method.
+static void restore_rhs_jfnk_dg
+	(const struct JFNK_Context_DG*const ctx ///< \ref JFNK_Context_DG.
+	);
+
+/** \brief Get \ref Simulation::sim_c_jfnk, constructing it if it has not yet been constructed.
+ *  \return See brief. */
+static struct Simulation* get_Simulation_c_jfnk_dg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/// \brief Set the complex solution coefficients to `sol_coef_0 + i*h*v` for the complex step jfnk method.
+static void set_sol_coef_cmplx_step_jfnk_dg
+	(const double h,                        ///< The magnitude of the complex step.
+	 const PetscScalar*const v,             ///< The increment for all of the global dof.
+	 const struct JFNK_Context_DG*const ctx ///< \ref JFNK_Context_DG.
+	);
+
+/// \brief Version of \ref compute_rhs_jfnk_dg for the complex \ref Simulation of the complex step jfnk method.
+static void compute_rhs_cmplx_step_jfnk_dg
+	(const struct Simulation*const sim_c ///< The complex \ref Simulation.
+	);
+
+/// \brief Add the mass matrix terms of \ref LHS_CFL_RAMPING multiplied by the input vector for the jfnk method.
+static void add_CFL_ramping_jfnk_dg
+	(double*const y,                              ///< The output vector for the volume.
+	 const double*const v,                        ///< The input vector for the volume.
+	 const double dt,                             ///< The CFL constrained time step of the volume.
+	 const struct DG_Solver_Volume*const dg_s_vol ///< \ref DG_Solver_Volume_T.
+	);
+
 static void compute_rlhs_common_dg (const struct Simulation*const sim, struct Solver_Storage_Implicit*const ssi)
 {
 	initialize_zero_memory_volumes(sim->volumes);
+	start_profile(PROF_VOLUME_RLHS);
 	compute_grad_coef_dg(sim,sim->volumes,sim->faces);
 	compute_volume_rlhs_dg(sim,ssi,sim->volumes);
+	stop_profile(PROF_VOLUME_RLHS);
+
+	start_profile(PROF_FACE_RLHS);
 	compute_face_rlhs_dg(sim,ssi,sim->faces);
+	stop_profile(PROF_FACE_RLHS);
 	compute_source_rhs_dg_like(sim);
 }
 
-static void scale_rhs_by_m_inv (const struct Simulation*const sim)
+static double scale_rhs_by_m_inv
+	(const struct Simulation*const sim, const update_stage_fptr update_stage, const void*const stage_data)
 {
 	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
 	assert((test_case->solver_proc == SOLVER_E) ||
 	       (test_case->solver_proc == SOLVER_EI));
 
-	if (!sim->collocated)
-		scale_rhs_by_m_inv_std(sim);
-	else
-		scale_rhs_by_m_inv_col(sim);
+	/* The rhs of each volume is complete once the face terms have been added such that the scaling, the computation of
+	 * the maximum and the stage update can be performed while the volume data is in cache. */
+	double max_rhs = 0.0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		if (!is_volume_lts_active((struct Volume*)curr))
+			continue;
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+
+		if (!sim->collocated)
+			scale_rhs_by_m_inv_std(s_vol->rhs,s_vol);
+		else
+			scale_rhs_by_m_inv_col(s_vol->rhs,s_vol);
+
+		if (is_volume_owned((struct Volume*)s_vol,sim)) {
+			const struct Multiarray_d*const rhs = s_vol->rhs;
+			const double max_rhs_curr = norm_d(compute_size(rhs->order,rhs->extents),rhs->data,"Inf");
+			if (max_rhs_curr > max_rhs)
+				max_rhs = max_rhs_curr;
+		}
+
+		if (update_stage)
+			update_stage(s_vol,stage_data,sim);
+	}
+
+	if (check_distributed(sim))
+		MPI_Allreduce(MPI_IN_PLACE,&max_rhs,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+	return max_rhs;
+}
+
+static bool check_finer_neighbour_lts (const struct Volume*const vol)
+{
+	const int lts_level = ((struct DG_Solver_Volume*)vol)->lts_level;
+	for (int i = 0; i < NFMAX;    ++i) {
+	for (int j = 0; j < NSUBFMAX; ++j) {
+		const struct Face*const face = vol->faces[i][j];
+		if (!face || face->boundary)
+			continue;
+
+		const int lts_level_n = ((struct DG_Solver_Volume*)get_volume_neighbour(vol,face))->lts_level;
+		assert(abs(lts_level-lts_level_n) <= 1);
+		if (lts_level_n < lts_level)
+			return true;
+	}}
+	return false;
 }
 
 static void fill_petsc_Vec_b_dg (const struct Simulation*const sim, struct Solver_Storage_Implicit*const ssi)
 {
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+
 		const int ind_dof        = (int)((struct Solver_Volume*)curr)->ind_dof;
 		struct Multiarray_d* rhs = ((struct Solver_Volume*)curr)->rhs;
 
@@ -232,6 +558,9 @@ static void compute_CFL_ramping (struct Solver_Storage_Implicit*const ssi, const
 
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
 		struct Solver_Volume* s_vol = (struct Solver_Volume*) curr;
+		if (!is_volume_owned((struct Volume*)s_vol,sim))
+			continue;
+
 		const double dt = compute_dt_cfl_constrained(max_rhs,s_vol,sim);
 
 		struct DG_Solver_Volume* dg_s_vol = (struct DG_Solver_Volume*) curr;
@@ -247,14 +576,158 @@ static void compute_CFL_ramping (struct Solver_Storage_Implicit*const ssi, const
 	}
 }
 
-// Level 1 ********************************************************************************************************** //
+static struct JFNK_Context_DG* constructor_JFNK_Context_DG
+	(const struct Solver_Storage_Implicit*const ssi, const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	assert(sim->method == METHOD_DG);
 
-/** \brief Return the minimum measure of the length of the input volume.
- *  \return See brief. */
-static double compute_min_length_measure
-	(const struct Solver_Volume*const s_vol, ///< \ref Solver_Volume_T.
-	 const struct Simulation*const sim       ///< \ref Simulation.
-	);
+	PetscInt n = 0;
+	VecGetSize(ssi->b,&n);
+
+	struct JFNK_Context_DG*const ctx = calloc(1,sizeof *ctx); // free
+	ctx->sim        = sim;
+	ctx->sol_coef_0 = malloc((size_t)n * sizeof *ctx->sol_coef_0); // free
+
+	/* The rhs at the current solution is only required for the finite difference and is recomputed using the code
+	 * path of the perturbed solutions. Otherwise, the rhs computed by the implicit solver is used as is. */
+	if (test_case->jfnk_method == JFNK_CMPLX_STEP) {
+		ctx->sim_c = get_Simulation_c_jfnk_dg(sim);
+	} else {
+		ctx->rhs_0 = malloc((size_t)n * sizeof *ctx->rhs_0); // free
+		compute_rhs_jfnk_dg(sim);
+	}
+
+	// The solution coefficients are replicated on all processes (see \ref partition.h).
+	ptrdiff_t n_v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++n_v) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		const struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+		const ptrdiff_t ind_dof = s_vol->ind_dof,
+		                size    = compute_size(sol_coef->order,sol_coef->extents);
+		assert(ind_dof+size <= n);
+
+		for (ptrdiff_t i = 0; i < size; ++i)
+			ctx->sol_coef_0[ind_dof+i] = sol_coef->data[i];
+		if (ctx->rhs_0) {
+			for (ptrdiff_t i = 0; i < size; ++i)
+				ctx->rhs_0[ind_dof+i] = s_vol->rhs->data[i];
+		}
+	}
+	ctx->norm_sol_coef_0 = norm_d(n,ctx->sol_coef_0,"L2");
+
+	if (test_case->lhs_terms == LHS_CFL_RAMPING) {
+		const double max_rhs = compute_max_rhs_dg_like(sim);
+
+		ctx->dt = calloc((size_t)n_v,sizeof *ctx->dt); // free
+		ptrdiff_t ind_v = 0;
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++ind_v) {
+			const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+			if (is_volume_owned((struct Volume*)s_vol,sim))
+				ctx->dt[ind_v] = compute_dt_cfl_constrained(max_rhs,s_vol,sim);
+		}
+	}
+
+	VecScatterCreateToAll(ssi->b,&ctx->scatter,&ctx->v_all); // destroyed
+	return ctx;
+}
+
+static void destructor_JFNK_Context_DG (struct JFNK_Context_DG*const ctx)
+{
+	VecScatterDestroy(&ctx->scatter);
+	VecDestroy(&ctx->v_all);
+
+	free(ctx->sol_coef_0);
+	free(ctx->rhs_0);
+	free(ctx->dt);
+	free(ctx);
+}
+
+static PetscErrorCode destroy_jfnk_dg (Mat A)
+{
+	struct JFNK_Context_DG* ctx = NULL;
+	CHKERRQ(MatShellGetContext(A,&ctx));
+	destructor_JFNK_Context_DG(ctx);
+	return 0;
+}
+
+static PetscErrorCode mult_jfnk_dg (Mat A, Vec v, Vec y)
+{
+	struct JFNK_Context_DG* ctx = NULL;
+	CHKERRQ(MatShellGetContext(A,&ctx));
+	const struct Simulation*const sim = ctx->sim;
+
+	PetscReal norm_v = 0.0;
+	CHKERRQ(VecNorm(v,NORM_2,&norm_v));
+	if (norm_v == 0.0) {
+		CHKERRQ(VecZeroEntries(y));
+		return 0;
+	}
+	struct Simulation*const sim_c = ctx->sim_c;
+	const double eps = ( sim_c ? CX_STEP : SQRT_EPS*(1.0+ctx->norm_sol_coef_0)/norm_v );
+
+	CHKERRQ(VecScatterBegin(ctx->scatter,v,ctx->v_all,INSERT_VALUES,SCATTER_FORWARD));
+	CHKERRQ(VecScatterEnd(ctx->scatter,v,ctx->v_all,INSERT_VALUES,SCATTER_FORWARD));
+
+	const PetscScalar* v_all = NULL;
+	CHKERRQ(VecGetArrayRead(ctx->v_all,&v_all));
+
+	if (sim_c) {
+		set_sol_coef_cmplx_step_jfnk_dg(eps,v_all,ctx);
+		compute_rhs_cmplx_step_jfnk_dg(sim_c);
+		++get_solver_stats()->n_mult_cmplx_step;
+	} else {
+		set_sol_coef_jfnk_dg(eps,v_all,ctx);
+		compute_rhs_jfnk_dg(sim);
+	}
+
+	// The volumes of the complex simulation are in the same order as those of the real simulation.
+	struct Intrusive_Link* curr_c = ( sim_c ? sim_c->volumes->first : NULL );
+	ptrdiff_t ind_v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++ind_v) {
+		const struct Solver_Volume_c*const s_vol_c = (struct Solver_Volume_c*) curr_c;
+		if (curr_c)
+			curr_c = curr_c->next;
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		const struct Multiarray_d*const rhs = s_vol->rhs;
+
+		const int ind_dof = (int)s_vol->ind_dof,
+		          ni      = (int)compute_size(rhs->order,rhs->extents);
+
+		PetscInt    ix[ni];
+		PetscScalar y_v[ni];
+		if (s_vol_c) {
+			const double complex*const rhs_c = s_vol_c->rhs->data;
+			for (int i = 0; i < ni; ++i) {
+				ix[i]  = ind_dof+i;
+				y_v[i] = cimag(rhs_c[i])/eps;
+			}
+		} else {
+			for (int i = 0; i < ni; ++i) {
+				ix[i]  = ind_dof+i;
+				y_v[i] = (rhs->data[i]-ctx->rhs_0[ind_dof+i])/eps;
+			}
+		}
+		if (ctx->dt)
+			add_CFL_ramping_jfnk_dg(y_v,&v_all[ind_dof],ctx->dt[ind_v],(struct DG_Solver_Volume*)curr);
+
+		CHKERRQ(VecSetValues(y,ni,ix,y_v,INSERT_VALUES));
+	}
+	if (!sim_c) {
+		set_sol_coef_jfnk_dg(0.0,NULL,ctx);
+		restore_rhs_jfnk_dg(ctx);
+	}
+	CHKERRQ(VecRestoreArrayRead(ctx->v_all,&v_all));
+
+	CHKERRQ(VecAssemblyBegin(y));
+	CHKERRQ(VecAssemblyEnd(y));
+	return 0;
+}
+
+// Level 1 ********************************************************************************************************** //
 
 /** \brief Return the ratio of the initial max_rhs divided by the current max_rhs.
  *  \return See brief. */
@@ -262,23 +735,33 @@ static double compute_max_rhs_ratio
 	(const double max_rhs ///< The current maximum rhs value.
 	);
 
-static void scale_rhs_by_m_inv_std (const struct Simulation*const sim)
+/** \brief Constructor for the complex \ref Simulation used for the complex step jfnk method, checking that its volumes
+ *         match those of the real \ref Simulation.
+ *  \return See brief. */
+static struct Simulation* constructor_Simulation_c_jfnk_dg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+static void scale_rhs_by_m_inv_std (struct Multiarray_d*const rhs, const struct Solver_Volume*const s_vol)
 {
-	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-		struct Solver_Volume*const s_vol       = (struct Solver_Volume*) curr;
-		struct DG_Solver_Volume*const dg_s_vol = (struct DG_Solver_Volume*) curr;
-		mm_NN1C_overwrite_Multiarray_d(dg_s_vol->m_inv,&s_vol->rhs);
-	}
+	const struct DG_Solver_Volume*const dg_s_vol = (struct DG_Solver_Volume*) s_vol;
+	assert(rhs->layout == 'C');
+
+	const size_t size = (size_t)compute_size(rhs->order,rhs->extents);
+
+	const struct Scratch_Scope scope = open_scratch_scope();
+	struct Multiarray_d rhs_s = { .layout = 'C', .order = rhs->order, .extents = rhs->extents, .owns_data = false,
+	                              .data = malloc_scratch(size * sizeof *rhs->data), };
+	mm_NN1C_Multiarray_d(dg_s_vol->m_inv,(struct const_Multiarray_d*)rhs,&rhs_s);
+	memcpy(rhs->data,rhs_s.data,size * sizeof *rhs->data);
+	free_scratch(rhs_s.data,true);
+	close_scratch_scope(scope);
 }
 
-static void scale_rhs_by_m_inv_col (const struct Simulation*const sim)
+static void scale_rhs_by_m_inv_col (struct Multiarray_d*const rhs, const struct Solver_Volume*const s_vol)
 {
-	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
-
-		const struct const_Vector_d jac_det_vc = interpret_const_Multiarray_as_Vector_d(s_vol->jacobian_det_vc);
-		scale_Multiarray_by_Vector_d('L',1.0,s_vol->rhs,&jac_det_vc,true);
-	}
+	const struct const_Vector_d jac_det_vc = interpret_const_Multiarray_as_Vector_d(s_vol->jacobian_det_vc);
+	scale_Multiarray_by_Vector_d('L',1.0,rhs,&jac_det_vc,true);
 }
 
 static double compute_dt_cfl_constrained
@@ -286,40 +769,148 @@ static double compute_dt_cfl_constrained
 {
 	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
 
-	struct Multiarray_d* s_coef_b = constructor_s_coef_bezier(s_vol,sim); // destructed
+	const double max_rhs_ratio = compute_max_rhs_ratio(max_rhs);
+	const double cfl = test_case->cfl_initial * ( max_rhs_ratio < 1.0 ? 1.0 : max_rhs_ratio );
 
-	const ptrdiff_t ext_0 = s_coef_b->extents[0];
+	return compute_dt_cfl_dg(cfl,false,s_vol,sim);
+}
 
-	// Max wave speed.
-	struct Multiarray_d* V_p_c = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){ext_0,1}); // destructed
-	compute_max_wavespeed(V_p_c,(struct const_Multiarray_d*)s_coef_b,'c');
+static void compute_rhs_jfnk_dg (const struct Simulation*const sim)
+{
+	struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	const char smc = test_case->solver_method_curr;
+	test_case->solver_method_curr = 'e'; // The linearization terms are not required.
+	compute_rlhs_common_dg(sim,NULL);
+	test_case->solver_method_curr = smc;
+}
 
-	const double max_wave_speed = maximum_dd(V_p_c->data,ext_0);
-	destructor_Multiarray_d(V_p_c);
+static void set_sol_coef_jfnk_dg (const double alpha, const PetscScalar*const v, const struct JFNK_Context_DG*const ctx)
+{
+	for (struct Intrusive_Link* curr = ctx->sim->volumes->first; curr; curr = curr->next) {
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+
+		const ptrdiff_t ind_dof = s_vol->ind_dof,
+		                size    = compute_size(sol_coef->order,sol_coef->extents);
+		const double*const sol_coef_0 = &ctx->sol_coef_0[ind_dof];
+		if (alpha == 0.0) {
+			for (ptrdiff_t i = 0; i < size; ++i)
+				sol_coef->data[i] = sol_coef_0[i];
+		} else {
+			for (ptrdiff_t i = 0; i < size; ++i)
+				sol_coef->data[i] = sol_coef_0[i] + alpha*v[ind_dof+i];
+		}
+	}
+}
 
-	// Max viscosity.
-	double max_viscosity = EPS;
-	if (test_case->has_2nd_order) {
-		struct Multiarray_d* mu = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){ext_0,1}); // destructed
-		compute_viscosity(mu,(struct const_Multiarray_d*)s_coef_b,'c');
+static void add_CFL_ramping_jfnk_dg
+	(double*const y, const double*const v, const double dt, const struct DG_Solver_Volume*const dg_s_vol)
+{
+	const struct const_Matrix_d*const m = dg_s_vol->m;
+	const ptrdiff_t n_vs = m->ext_0;
+	const int n_eq = (int)((struct Solver_Volume*)dg_s_vol)->sol_coef->extents[1];
+
+	/// \note See the comments for \ref compute_CFL_ramping for the justification of the scaling.
+	for (int eq = 0; eq < n_eq; ++eq) {
+		const struct const_Vector_d v_eq = { .ext_0 = n_vs, .owns_data = false, .data = &v[n_vs*eq], };
+		struct Vector_d y_eq             = { .ext_0 = n_vs, .owns_data = false, .data = &y[n_vs*eq], };
+		mv_d('N',-1.0/dt,1.0,m,&v_eq,&y_eq);
+	}
+}
 
-		max_viscosity = maximum_dd(mu->data,ext_0);
-		destructor_Multiarray_d(mu);
+static void restore_rhs_jfnk_dg (const struct JFNK_Context_DG*const ctx)
+{
+	for (struct Intrusive_Link* curr = ctx->sim->volumes->first; curr; curr = curr->next) {
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Multiarray_d*const rhs = s_vol->rhs;
+
+		const ptrdiff_t size = compute_size(rhs->order,rhs->extents);
+		memcpy(rhs->data,&ctx->rhs_0[s_vol->ind_dof],(size_t)size * sizeof *rhs->data);
 	}
-	destructor_Multiarray_d(s_coef_b);
+}
 
-	// Min length measure.
-	double dx = compute_min_length_measure(s_vol,sim);
+static struct Simulation* get_Simulation_c_jfnk_dg (const struct Simulation*const sim)
+{
+	EXIT_IF_IN_PARALLEL;
 
-	const double max_rhs_ratio = compute_max_rhs_ratio(max_rhs);
-	const double cfl = test_case->cfl_initial * ( max_rhs_ratio < 1.0 ? 1.0 : max_rhs_ratio );
-//printf("cfl: %f %f %f\n",cfl,dx,max_wave_speed);
+	// The cache is not part of the logical state of the simulation and is thus set through a non-const pointer.
+	struct Simulation*const sim_m = (struct Simulation*) sim;
+	if (!sim_m->sim_c_jfnk)
+		sim_m->sim_c_jfnk = constructor_Simulation_c_jfnk_dg(sim); // destructed
+	return sim_m->sim_c_jfnk;
+}
 
-	return cfl*GSL_MIN(dx/max_wave_speed,( !test_case->has_2nd_order ? DBL_MAX : dx*dx/max_viscosity ));
+static void set_sol_coef_cmplx_step_jfnk_dg
+	(const double h, const PetscScalar*const v, const struct JFNK_Context_DG*const ctx)
+{
+	struct Intrusive_Link* curr_c = ctx->sim_c->volumes->first;
+	for (struct Intrusive_Link* curr = ctx->sim->volumes->first; curr; curr = curr->next, curr_c = curr_c->next) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Multiarray_c*const sol_coef_c = ((struct Solver_Volume_c*) curr_c)->sol_coef;
+
+		const ptrdiff_t ind_dof = s_vol->ind_dof,
+		                size    = compute_size(sol_coef_c->order,sol_coef_c->extents);
+		const double*const sol_coef_0 = &ctx->sol_coef_0[ind_dof];
+		for (ptrdiff_t i = 0; i < size; ++i)
+			sol_coef_c->data[i] = sol_coef_0[i] + h*v[ind_dof+i]*I;
+	}
+}
+
+static void compute_rhs_cmplx_step_jfnk_dg (const struct Simulation*const sim_c)
+{
+	struct Test_Case_c*const test_case = (struct Test_Case_c*) sim_c->test_case_rc->tc;
+	assert(test_case->solver_method_curr == 'e'); // The linearization terms are not required.
+
+	initialize_zero_memory_volumes_c(sim_c->volumes);
+	start_profile(PROF_VOLUME_RLHS);
+	compute_grad_coef_dg_c(sim_c,sim_c->volumes,sim_c->faces);
+	compute_volume_rlhs_dg_c(sim_c,NULL,sim_c->volumes);
+	stop_profile(PROF_VOLUME_RLHS);
+
+	start_profile(PROF_FACE_RLHS);
+	compute_face_rlhs_dg_c(sim_c,NULL,sim_c->faces);
+	stop_profile(PROF_FACE_RLHS);
+	for (struct Intrusive_Link* curr = sim_c->volumes->first; curr; curr = curr->next) {
+		const struct Solver_Volume_c*const s_vol = (struct Solver_Volume_c*) curr;
+		test_case->compute_source_rhs(sim_c,s_vol,s_vol->rhs);
+	}
 }
 
 // Level 2 ********************************************************************************************************** //
 
+static struct Simulation* constructor_Simulation_c_jfnk_dg (const struct Simulation*const sim)
+{
+	struct Simulation*const sim_c = constructor_Simulation(sim->ctrl_name); // returned
+	constructor_derived_Elements(sim_c,IL_ELEMENT_SOLVER);                // destructed
+	constructor_derived_computational_elements_c(sim_c,IL_SOLVER);        // destructed
+	convert_to_Test_Case_rc(sim_c,'c');                                    // converted back
+	set_up_solver_geometry_c(sim_c);
+
+	constructor_derived_Elements(sim_c,IL_ELEMENT_SOLVER_DG);             // destructed
+	constructor_derived_computational_elements_c(sim_c,IL_SOLVER_DG);     // destructed
+
+	struct Test_Case_c*const test_case = (struct Test_Case_c*) sim_c->test_case_rc->tc;
+	test_case->solver_method_curr = 'e';
+
+	/* The complex simulation is constructed from the mesh of the control file such that the volumes can only be
+	 * matched to those of the real simulation if they have not been adapted. */
+	struct Intrusive_Link* curr_c = sim_c->volumes->first;
+	for (const struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, curr_c = curr_c->next) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Solver_Volume_c*const s_vol_c   = (struct Solver_Volume_c*) curr_c;
+		if (!curr_c || ((struct Volume*)curr)->index != ((struct Volume*)curr_c)->index ||
+		    s_vol->p_ref != s_vol_c->p_ref)
+			EXIT_ERROR("Unsupported: The complex step jfnk method requires the mesh of the control file.\n");
+
+		const struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+		resize_Multiarray_c(s_vol_c->sol_coef,sol_coef->order,sol_coef->extents);
+	}
+	if (curr_c)
+		EXIT_ERROR("Unsupported: The complex step jfnk method requires the mesh of the control file.\n");
+
+	return sim_c;
+}
+
 static double compute_min_length_measure (const struct Solver_Volume*const s_vol, const struct Simulation*const sim)
 {
 	/** In the 1D case, the length of the volume is being returned. In higher dimensional cases, the minimum of the
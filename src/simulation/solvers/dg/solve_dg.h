@@ -20,6 +20,9 @@ You should have received a copy of the GNU General Public License along with DPG
  *         method.
  */
 
+#include <stdbool.h>
+#include "petscmat.h"
+
 #include "def_templates_type_d.h"
 #include "solve_dg_T.h"
 #include "undef_templates_type.h"
@@ -39,6 +42,33 @@ double compute_rhs_dg
 	(const struct Simulation* sim ///< \ref Simulation.
 	);
 
+/** \brief Function pointer to a function applying the update of a stage of an explicit time-stepping method to the
+ *         solution of a single volume.
+ *  \param s_vol      \ref Solver_Volume_T.
+ *  \param stage_data The data relating to the stage.
+ *  \param sim        \ref Simulation.
+ */
+typedef void (*update_stage_fptr)
+	(struct Solver_Volume*const s_vol,
+	 const void*const stage_data,
+	 const struct Simulation*const sim
+	);
+
+/** \brief Version of \ref compute_rhs_dg additionally applying the update of an explicit time-stepping stage to the
+ *         solution of each of the volumes.
+ *  \return See brief.
+ *
+ *  The scaling of the rhs by the inverse mass matrix, the computation of the maximum rhs and the stage update
+ *  (including any limiting) are fused in a single pass over the volumes following the computation of the face terms.
+ *  The volume memory is set to zero (see \ref zero_memory_volumes) before computing the rhs terms such that this
+ *  function may be called directly by the explicit solver.
+ */
+double compute_rhs_update_dg
+	(const struct Simulation*const sim,    ///< \ref Simulation.
+	 const update_stage_fptr update_stage, ///< The stage update function (may be `NULL`).
+	 const void*const stage_data           ///< The data passed to `update_stage`.
+	);
+
 /** \brief Version of \ref compute_rlhs for the dg method.
  *  \return See brief. */
 double compute_rlhs_dg
@@ -47,7 +77,10 @@ double compute_rlhs_dg
 	);
 
 /** \brief Set the values of \ref Solver_Storage_Implicit::row and Solver_Storage_Implicit::col based on the current
- *         volume and eq, var indices. */
+ *         volume and eq, var indices.
+ *
+ *  If \ref Solver_Storage_Implicit::element_local_only is enabled, the row index is set such that the terms coupling
+ *  different volumes are not added to the matrix. */
 void set_petsc_Mat_row_col_dg
 	(struct Solver_Storage_Implicit*const ssi, ///< \ref Solver_Storage_Implicit.
 	 const struct Solver_Volume* v_l,          ///< The left \ref Solver_Volume_T.
@@ -56,6 +89,104 @@ void set_petsc_Mat_row_col_dg
 	 const int vr                              ///< The index of the variable.
 	);
 
+/** \brief Constructor for a Petsc `MATSHELL` whose action approximates that of the lhs matrix of the dg scheme,
+ *         linearized about the current solution, using a perturbation of the rhs.
+ *  \return See brief.
+ *
+ *  This is used for the 'J'acobian-'f'ree 'N'ewton-'K'rylov method (see \ref Test_Case_T::use_jfnk). For
+ *  \ref JFNK_FINITE_DIFF, the matrix vector products are computed as
+ *  \f[
+ *  	\text{lhs}(s_{coef}) v \approx \frac{\text{rhs}(s_{coef}+\epsilon v)-\text{rhs}(s_{coef})}{\epsilon},\ \ \ \
+ *  	\epsilon = \sqrt{\epsilon_{mach}} \frac{1+||s_{coef}||}{||v||},
+ *  \f]
+ *  where the rhs at the current solution is recomputed here using the same (explicit) code path as that used for the
+ *  perturbed solutions. For \ref JFNK_CMPLX_STEP, they are computed as
+ *  \f[
+ *  	\text{lhs}(s_{coef}) v \approx \frac{\Im(\text{rhs}(s_{coef}+ihv))}{h},\ \ \ \ h = \text{CX_STEP},
+ *  \f]
+ *  using the complex \ref Simulation stored in \ref Simulation::sim_c_jfnk, which is free of subtractive
+ *  cancellation. The mass matrix terms are added to either if \ref LHS_CFL_RAMPING is used.
+ *
+ *  The rhs terms of the volumes are left holding the rhs at the current solution after the construction and after each
+ *  matrix-vector product.
+ */
+Mat constructor_petsc_mat_jfnk_dg
+	(const struct Solver_Storage_Implicit*const ssi, ///< \ref Solver_Storage_Implicit.
+	 const struct Simulation*const sim               ///< \ref Simulation.
+	);
+
+/// \brief Destructor for a Petsc `MATSHELL` constructed by \ref constructor_petsc_mat_jfnk_dg.
+void destructor_petsc_mat_jfnk_dg
+	(Mat A ///< Standard.
+	);
+
+/// \brief Destructor for \ref Simulation::sim_c_jfnk (if it was constructed).
+void destructor_Simulation_c_jfnk_dg
+	(struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Return the time step of the input volume for which the local CFL number is equal to the input value.
+ *  \return See brief.
+ *
+ *  The time step is computed from the maximum wave speed and the maximum viscosity (if applicable) at the Bezier
+ *  coefficients of the solution and a measure of the minimum length of the volume. If `scale_by_p` is enabled, the
+ *  length measure is divided by (2p+1) such that the time step accounts for the decrease in the stable time step with
+ *  the increase in the order of the explicit dg scheme.
+ */
+double compute_dt_cfl_dg
+	(const double cfl,                       ///< The CFL number.
+	 const bool scale_by_p,                  ///< Flag for whether the length measure should be scaled by 1/(2p+1).
+	 const struct Solver_Volume*const s_vol, ///< \ref Solver_Volume_T.
+	 const struct Simulation*const sim       ///< \ref Simulation.
+	);
+
+/** \brief Return a statically allocated `int` holding the maximum \ref DG_Solver_Volume_T::lts_level of the volumes
+ *         which are active for the explicit local time stepping.
+ *  \return See brief.
+ *
+ *  Passing a non-NULL input for `new_val` sets the statically allocated int to the value. Only the active volumes and
+ *  faces (see \ref is_volume_lts_active_T and \ref is_face_lts_active_T) are included in the computation of the
+ *  explicit rhs terms. By default, all volumes are active.
+ */
+int get_set_lts_level_max
+	(const int*const new_val ///< The new value (if not NULL).
+	);
+
+/** \brief Construct the zero-initialized \ref DG_Solver_Volume_T::rhs_lts and \ref DG_Solver_Volume_T::flux_reg
+ *         members of the volumes having a neighbour of the next finer level of the local time stepping and destruct
+ *         them for all other volumes.
+ *
+ *  The levels of neighbouring volumes must not differ by more than one.
+ */
+void set_up_flux_registers_dg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Add the contributions of the current Runge-Kutta stage to the flux registers
+ *         (\ref DG_Solver_Volume_T::flux_reg) and zero \ref DG_Solver_Volume_T::rhs_lts.
+ *
+ *  The flux register of a volume of level `l` accumulates the difference between the face terms integrated by its
+ *  neighbours of level `l-1` and those integrated by the volume itself. As the volume and its finer neighbours are both
+ *  active during the first half of the time step of the volume and only the finer neighbours are active during the
+ *  second half, the face terms are scaled by `-dt_b*2^(l-1)` when the volume is active and by `+dt_b*2^(l-1)`
+ *  otherwise.
+ */
+void update_flux_registers_dg
+	(const double dt_b,                ///< The time step of the finest level multiplied by the weight of the stage.
+	 const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Add the flux registers (\ref DG_Solver_Volume_T::flux_reg) to the solution coefficients of the volumes which
+ *         are active for the next sub-step of the local time stepping (i.e. whose time step has just been completed)
+ *         and zero the registers.
+ *
+ *  After the correction, the face fluxes integrated over the time step of the coarser volume are equal and opposite to
+ *  those integrated by its finer neighbours such that the scheme is conservative.
+ */
+void apply_flux_registers_dg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
 /// \brief Version of \ref compute_flux_imbalances for the DG scheme.
 void compute_flux_imbalances_dg
 	(const struct Simulation*const sim ///< See brief.
@@ -73,6 +73,47 @@ struct Vector_i* constructor_nnz_dg_T (const bool diag_only, const struct Simula
 	return nnz;
 }
 
+struct Vector_i* constructor_nnz_o_dg_T (const struct Simulation* sim)
+{
+	const ptrdiff_t dof = compute_dof(sim);
+	struct Vector_i* nnz_o = constructor_zero_Vector_i(dof); // returned
+
+	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+		struct Face* face = (struct Face*) curr;
+		if (face->boundary)
+			continue;
+
+		struct Volume* vol[2] = { face->neigh_info[0].volume, face->neigh_info[1].volume, };
+		if (vol[0]->rank == vol[1]->rank)
+			continue;
+
+		struct Solver_Volume_T* s_vol[2] = { (struct Solver_Volume_T*) vol[0], (struct Solver_Volume_T*) vol[1], };
+
+		struct Multiarray_T* sol_coef[2] = { s_vol[0]->sol_coef, s_vol[1]->sol_coef, };
+		const ptrdiff_t size[2] = { compute_size(sol_coef[0]->order,sol_coef[0]->extents),
+		                            compute_size(sol_coef[1]->order,sol_coef[1]->extents), };
+
+		increment_nnz(nnz_o,s_vol[0]->ind_dof,size[0],size[1]);
+		increment_nnz(nnz_o,s_vol[1]->ind_dof,size[1],size[0]);
+	}
+	return nnz_o;
+}
+
+bool is_volume_lts_active_T (const struct Volume*const vol)
+{
+	return ((const struct DG_Solver_Volume_T*) vol)->lts_level <= get_set_lts_level_max(NULL);
+}
+
+bool is_face_lts_active_T (const struct Face*const face)
+{
+	for (int i = 0; i < 2; ++i) {
+		const struct Volume*const vol = face->neigh_info[i].volume;
+		if (vol && is_volume_lts_active_T(vol))
+			return true;
+	}
+	return false;
+}
+
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
@@ -26,6 +26,8 @@ You should have received a copy of the GNU General Public License along with DPG
 struct Multiarray_T;
 struct Solver_Face_T;
 struct Simulation;
+struct Volume;
+struct Face;
 
 /** \brief Version of \ref constructor_nnz for the dg method.
  *  \return See brief. */
@@ -35,6 +37,31 @@ struct Vector_i* constructor_nnz_dg_T
 	 const struct Simulation* sim ///< \ref Simulation.
 	);
 
+/** \brief Constructor for a \ref Vector_T\* holding the number of non-zero entries in each row of the global system
+ *         matrix which are in columns owned by other processes (the 'o'ff-process block).
+ *  \return See brief. */
+struct Vector_i* constructor_nnz_o_dg_T
+	(const struct Simulation* sim ///< \ref Simulation.
+	);
+
+/** \brief Check whether the input volume is active for the current stage of the explicit local time stepping.
+ *  \return `true` if \ref DG_Solver_Volume_T::lts_level is not greater than \ref get_set_lts_level_max; `false`
+ *          otherwise. */
+bool is_volume_lts_active_T
+	(const struct Volume*const vol ///< The \ref DG_Solver_Volume_T.
+	);
+
+/** \brief Check whether the input face is active for the current stage of the explicit local time stepping.
+ *  \return `true` if either of the neighbouring volumes is active (see \ref is_volume_lts_active_T); `false` otherwise.
+ *
+ *  The face terms of active faces are also added to the rhs of inactive neighbouring volumes; these terms are unused as
+ *  the solution of inactive volumes is not updated, except for their contribution to the flux registers (see
+ *  \ref update_flux_registers_dg).
+ */
+bool is_face_lts_active_T
+	(const struct Face*const face ///< The \ref DG_Solver_Face_T.
+	);
+
 #include "undef_templates_solve_dg.h"
 #include "undef_templates_face_solver.h"
 #include "undef_templates_multiarray.h"
@@ -30,3 +30,6 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef constructor_Boundary_Value_g_face_fcl
 #undef constructor_partial_grad_fc_interp
 #undef compute_scaling_weak_gradient
+#undef compute_face_rlhs_face_T
+#undef get_side_index_rhs_lts
+#undef add_to_rhs_lts
@@ -22,3 +22,8 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #undef S_Params_T
 #undef set_s_params_T
+#undef check_volume_batching_T
+#undef compute_rhs_v_batched_T
+#undef constructor_batch_offsets_T
+#undef cmp_operator_key_T
+#undef check_same_operator_key_T
@@ -17,3 +17,6 @@ You should have received a copy of the GNU General Public License along with DPG
  */
 
 #undef constructor_nnz_dg_T
+#undef constructor_nnz_o_dg_T
+#undef is_volume_lts_active_T
+#undef is_face_lts_active_T
@@ -58,6 +58,9 @@ void constructor_derived_DG_Solver_Volume_T (struct Volume* volume_ptr, const st
 
 	dg_s_vol->sol_coef_p =
 		( needed_members.sol_coef_p ? constructor_zero_Multiarray_T('C',order,extents) : NULL ); // destructed
+	dg_s_vol->lts_level = 0;
+	dg_s_vol->rhs_lts   = NULL;
+	dg_s_vol->flux_reg  = NULL;
 
 	dg_s_vol->m     = ( needed_members.m     ? constructor_mass_T(s_vol) : NULL );                     // destructed
 	dg_s_vol->m_inv = ( needed_members.m_inv ? constructor_inverse_mass_T(s_vol,dg_s_vol->m) : NULL ); // destructed
@@ -82,6 +85,8 @@ void destructor_derived_DG_Solver_Volume_T (struct Volume* volume_ptr)
 	struct DG_Solver_Volume_T* dg_s_vol = (struct DG_Solver_Volume_T*) volume_ptr;
 
 	destructor_conditional_Multiarray_T(dg_s_vol->sol_coef_p);
+	destructor_conditional_Multiarray_T(dg_s_vol->rhs_lts);
+	destructor_conditional_Multiarray_T(dg_s_vol->flux_reg);
 	destructor_conditional_const_Matrix_T(dg_s_vol->m_inv);
 	destructor_conditional_const_Matrix_T(dg_s_vol->m);
 	destructor_conditional_Multiarray_T(dg_s_vol->grad_coef_v);
@@ -32,6 +32,19 @@ struct DG_Solver_Volume_T {
 
 	struct Multiarray_T* sol_coef_p; ///< The coefficients of the solution at a previous Runge-Kutta stage.
 
+	/** The level of the volume for the explicit local time stepping. The time step of the volume is that of the finest
+	 *  level multiplied by 2^lts_level (see \ref get_set_lts_level_max). */
+	int lts_level;
+
+	/** The contributions of the faces shared with volumes of the next finer level to the rhs of the volume at the
+	 *  current stage of the local time stepping (`NULL` if the volume has no finer neighbours). */
+	struct Multiarray_T* rhs_lts;
+
+	/** The correction to the solution coefficients accumulated over the time step of the volume such that its face
+	 *  fluxes match those integrated by its finer neighbours (`NULL` if the volume has no finer neighbours). See
+	 *  \ref update_flux_registers_dg. */
+	struct Multiarray_T* flux_reg;
+
 	const struct const_Matrix_T* m_inv; ///< The inverse mass matrix.
 	const struct const_Matrix_T* m;     ///< The mass matrix.
 
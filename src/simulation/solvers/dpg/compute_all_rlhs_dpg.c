@@ -17,7 +17,12 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "compute_all_rlhs_dpg.h"
 
+#include <math.h>
+#include <string.h>
+
 #include "macros.h"
+#include "definitions_alloc.h"
+#include "definitions_test_case.h"
 #include "definitions_tol.h"
 
 #include "face_solver_dpg.h"
@@ -37,6 +42,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "multiarray_operator.h"
 #include "numerical_flux.h"
 #include "operator.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solve.h"
 #include "test_case.h"
@@ -47,6 +54,19 @@ You should have received a copy of the GNU General Public License along with DPG
 
 struct Norm_DPG;
 
+/// \brief Container for the complex \ref Simulation\*s cached by \ref get_Simulations_c_dpg.
+struct Simulations_c_DPG {
+	int n_sims;                 ///< The number of complex simulations (the maximum number of threads).
+	struct Simulation** sims_c; ///< The complex simulations.
+};
+
+/** \brief Constructor for a complex \ref Simulation to be used for the complex step linearization of the boundary
+ *         terms.
+ *  \return See brief. */
+static struct Simulation* constructor_Simulation_c_dpg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
 /** \brief Add the contribution of the linearization of the optimal test functions wrt to the solution coefficients to
  *         the lhs term for the DPG scheme.
  *
@@ -74,9 +94,24 @@ static void add_to_lhs_opt__l_mult
 	 struct Simulation*const sim_c                   ///< The complex \ref Simulation.
 	);
 
+/** \brief Set \ref Solver_Volume_T::error_ind to the norm of the DPG error representation function if required (see
+ *         \ref Test_Case_T::compute_error_ind).
+ *
+ *  The error representation function, \f$ \psi \f$, is the Riesz representation of the residual in the test space
+ *  with respect to the test norm (i.e. \f$ N \psi = r \f$) such that the indicator is given by
+ *  \f$ \sqrt{r^T N^{-1} r} \f$.
+ */
+static void set_error_ind_dpg
+	(const struct Solver_Volume*const s_vol,    ///< The current volume.
+	 const struct Norm_DPG*const norm,          ///< \ref Norm_DPG.
+	 const struct const_Vector_d*const rhs_std, ///< The standard (DG-like) contribution to the rhs (the residual).
+	 const struct Simulation*const sim          ///< \ref Simulation.
+	);
+
 /** \brief Add entries from the current volume to Solver_Storage_Implicit::A and Solver_Storage_Implicit::b.
- *  \attention **When using the schur complement method to solve the global system, the block diagonal contributions are
- *             inverted before being added to global system matrix.**
+ *  \attention **When using the schur complement method to solve the global system, the volume dof are statically
+ *             condensed out of the local system before it is added to the global system (see \ref
+ *             add_to_petsc_Mat_Vec_dpg_condensed).**
  */
 static void add_to_petsc_Mat_Vec_dpg
 	(const struct Solver_Volume* s_vol,    ///< The current volume.
@@ -129,9 +164,124 @@ static void add_to_petsc_Mat_dpg_c
 #include "compute_all_rlhs_dpg_T.c"
 #include "undef_templates_type.h"
 
+struct Simulation** get_Simulations_c_dpg (const struct Simulation*const sim)
+{
+	EXIT_IF_IN_PARALLEL;
+
+	// The cache is not part of the logical state of the simulation and is thus set through a non-const pointer.
+	struct Simulation*const sim_m = (struct Simulation*) sim;
+
+	const int n_threads = MAX_THREADS_OMP;
+	if (sim_m->sims_c_dpg && sim_m->sims_c_dpg->n_sims != n_threads)
+		destructor_Simulations_c_dpg(sim_m);
+
+	if (!sim_m->sims_c_dpg) {
+		struct Simulations_c_DPG*const sims_c_dpg = malloc(sizeof *sims_c_dpg); // destructed
+		sims_c_dpg->n_sims = n_threads;
+		sims_c_dpg->sims_c = malloc((size_t)n_threads * sizeof *sims_c_dpg->sims_c); // free
+		for (int i = 0; i < n_threads; ++i)
+			sims_c_dpg->sims_c[i] = constructor_Simulation_c_dpg(sim); // destructed
+		sim_m->sims_c_dpg = sims_c_dpg;
+	}
+
+	/* To avoid recomputing the derived \ref DPG_Solver_Element operators for each volume, the existing
+	 * \ref Simulation::elements list is used for the complex \ref Simulation as well. As the list may have been
+	 * reconstructed since the previous call, it is reset here. */
+	struct Simulation**const sims_c = sim_m->sims_c_dpg->sims_c;
+	for (int i = 0; i < n_threads; ++i)
+		sims_c[i]->elements = sim->elements;
+
+	return sims_c;
+}
+
+void destructor_Simulations_c_dpg (struct Simulation*const sim)
+{
+	EXIT_IF_IN_PARALLEL;
+
+	struct Simulations_c_DPG*const sims_c_dpg = sim->sims_c_dpg;
+	if (!sims_c_dpg)
+		return;
+
+	for (int i = 0; i < sims_c_dpg->n_sims; ++i) {
+		struct Simulation*const sim_c = sims_c_dpg->sims_c[i];
+		convert_to_Test_Case_rc(sim_c,'r');
+		sim_c->elements = NULL;
+		destructor_Simulation(sim_c);
+	}
+	free(sims_c_dpg->sims_c);
+	free(sims_c_dpg);
+
+	sim->sims_c_dpg = NULL;
+}
+
+PetscErrorCode back_substitute_x_dpg (Vec*const x, const struct Simulation*const sim)
+{
+	assert(sizeof(double) == sizeof(PetscScalar));
+	assert(!check_distributed(sim)); // Add support.
+
+	const ptrdiff_t dof_k = compute_dof_schur('k',sim);
+
+	Vec x_full;
+	CHKERRQ(VecCreateSeq(MPI_COMM_WORLD,(PetscInt)compute_dof(sim),&x_full)); // moved
+
+	const PetscScalar* x_k = NULL;
+	PetscScalar* x_f       = NULL;
+	CHKERRQ(VecGetArrayRead(*x,&x_k));
+	CHKERRQ(VecGetArray(x_full,&x_f));
+	if (dof_k > 0)
+		memcpy(x_f,x_k,(size_t)dof_k * sizeof *x_f);
+
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct DPG_Solver_Volume*const dpg_s_vol = (struct DPG_Solver_Volume*) curr;
+		const struct Matrix_d*const inv_vv_vk = dpg_s_vol->inv_vv_vk;
+		assert(inv_vv_vk != NULL);
+
+		// x_v = A_vv^{-1} b_v - A_vv^{-1} A_vk x_k
+		const ptrdiff_t dof_v   = inv_vv_vk->ext_0,
+		                dof_k_l = inv_vv_vk->ext_1-1;
+		const struct const_Vector_i*const idxm =
+			constructor_petsc_idxm_dpg(dof_v+dof_k_l,(struct Solver_Volume*)dpg_s_vol,sim); // destructed
+		for (ptrdiff_t i = 0; i < dof_v; ++i) {
+			const double*const row = get_row_Matrix_d(i,inv_vv_vk);
+			double x_v = row[dof_k_l];
+			for (ptrdiff_t j = 0; j < dof_k_l; ++j)
+				x_v -= row[j]*x_k[idxm->data[dof_v+j]];
+			x_f[idxm->data[i]] = x_v;
+		}
+		destructor_const_Vector_i(idxm);
+	}
+	CHKERRQ(VecRestoreArray(x_full,&x_f));
+	CHKERRQ(VecRestoreArrayRead(*x,&x_k));
+
+	CHKERRQ(VecDestroy(x));
+	*x = x_full;
+	return 0;
+}
+
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
+static struct Simulation* constructor_Simulation_c_dpg (const struct Simulation*const sim)
+{
+	struct Simulation*const sim_c = constructor_Simulation__no_mesh(sim->ctrl_name); // returned
+	convert_to_Test_Case_rc(sim_c,'c');
+
+	struct Test_Case_c* test_case = (struct Test_Case_c*) sim_c->test_case_rc->tc;
+	/** Currently, the function pointer to the boundary condition/numerical flux computing functions are set based
+	 *  on the value of solver_method_curr and functions do not necessarily allow for the computation of all
+	 *  required terms. For example, setting solver_method_curr = 'e' here, \ref Test_Case_T::flux_comp_mem_e will
+	 *  indicate that the Jacobian should be computed, but the function pointer will point to a function which does
+	 *  not support the Jacobian computation and the values will all simply be 0.
+	 *
+	 * \todo Combine the separate (and redundant) numerical flux/boundary condition functions, similarly to what
+	 *       was done for the standard flux functions. Once complete, change solver_method_curr to 'e' for the
+	 *       Test_Case_c.
+	 */
+	test_case->solver_method_curr = 'i';
+
+	return sim_c;
+}
+
 /** \brief Get the pointer to the appropriate \ref DPG_Solver_Element::cvcv0_vs_vc operator.
  *  \return See brief. */
 static const struct Operator* get_operator__cvcv0_vs_vc
@@ -160,13 +310,13 @@ static struct Matrix_d* constructor_dlhs_ds_v_1
 	);
 
 /** \brief Adds the linearization of the face boundary terms to the Hessian of the residual (rhs) wrt the solution
- *         coefficients. */
+ *         coefficients using the method specified by \ref Test_Case_T::bc_hessian. */
 static void add_to_dlhs_ds__face_boundary
 	(struct Matrix_d*const dlhs_ds,             ///< Defined for \ref add_to_dlhs_ds__norm.
 	 const struct DPG_Solver_Volume* dpg_s_vol, ///< Defined for \ref add_to_rlhs__face_boundary_T.
 	 const struct Simulation*const sim,         ///< Defined for \ref add_to_rlhs__face_boundary_T.
-	 struct Simulation*const sim_c,             ///< Defined for \ref add_to_rlhs__face_boundary_T.
-	 const char lin_method                      ///< Linearization method. Options: 'a'nalytical, 'c'omplex step.
+	 struct Simulation*const sim_c              /**< The complex \ref Simulation (only used for
+	                                             *   \ref BC_HESSIAN_CMPLX_STEP). */
 	);
 
 /** \brief Adds the linearization of \ref Norm_DPG::N to the Hessian of the residual (rhs) wrt the solution coefficients
@@ -211,7 +361,7 @@ static void add_to_lhs_opt__d_opt_t_ds
 		return;
 
 	struct Matrix_d* dlhs_ds = constructor_dlhs_ds_v_1(flux_r,dpg_s_vol,sim); // destructed
-	add_to_dlhs_ds__face_boundary(dlhs_ds,dpg_s_vol,sim,sim_c,'c');
+	add_to_dlhs_ds__face_boundary(dlhs_ds,dpg_s_vol,sim,sim_c);
 	add_to_dlhs_ds__norm(&dlhs_ds,norm,opt_t);
 
 	const struct const_Matrix_d* dopt_t_ds =
@@ -276,6 +426,25 @@ static void add_to_lhs_opt__l_mult
 	add_nonlinear_l_mult_contribution(*lhs_opt_ptr,lhs_std,dpg_s_vol,sim,sim_c);
 }
 
+/** \brief Add the entries of the current volume to \ref Solver_Storage_Implicit::A and \ref Solver_Storage_Implicit::b
+ *         after statically condensing out the volume dof.
+ *
+ *  Denoting the volume dof by 'v' and the face and Lagrange multiplier dof by 'k', the local system is reduced to
+ *  \f$ (A_{kk} - A_{kv} A_{vv}^{-1} A_{vk}) x_k = b_k - A_{kv} A_{vv}^{-1} b_v \f$. As the volume dof are only coupled
+ *  to the dof of the same volume, the sum of these contributions is the Schur complement of the global system.
+ *
+ *  \f$ A_{vv}^{-1} [A_{vk}, b_v] \f$ is stored in \ref DPG_Solver_Volume_T::inv_vv_vk for the local recovery of the
+ *  volume dof (see \ref back_substitute_x_dpg) and the uncondensed rhs is added to \ref
+ *  Solver_Storage_Implicit::b_full.
+ */
+static void add_to_petsc_Mat_Vec_dpg_condensed
+	(struct DPG_Solver_Volume*const dpg_s_vol,  ///< The current volume.
+	 const struct const_Vector_d*const rhs_neg, ///< Defined for \ref add_to_petsc_Mat_Vec_dpg.
+	 const struct const_Matrix_d*const lhs,     ///< Defined for \ref add_to_petsc_Mat_Vec_dpg.
+	 const struct const_Vector_i*const idxm,    ///< The global indices of the local dof.
+	 struct Solver_Storage_Implicit*const ssi   ///< Defined for \ref add_to_petsc_Mat_Vec_dpg.
+	);
+
 static void add_to_petsc_Mat_Vec_dpg
 	(const struct Solver_Volume* s_vol, const struct const_Vector_d* rhs_neg, const struct const_Matrix_d* lhs,
 	 struct Solver_Storage_Implicit* ssi, const struct Simulation* sim)
@@ -289,18 +458,40 @@ static void add_to_petsc_Mat_Vec_dpg
 
 	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
 	if (test_case->use_schur_complement) {
-		const ptrdiff_t dof_s = compute_size(s_vol->sol_coef->order,s_vol->sol_coef->extents),
-		                dof_g = compute_size(s_vol->grad_coef->order,s_vol->grad_coef->extents);
-		invert_sub_block_Matrix_d((struct Matrix_d*)lhs,0,0,dof_s);
-		assert(dof_g == 0); // Add support.
+		add_to_petsc_Mat_Vec_dpg_condensed((struct DPG_Solver_Volume*)s_vol,rhs_neg,lhs,idxm,ssi);
+		destructor_const_Vector_i(idxm);
+		return;
 	}
 
-	MatSetValues(ssi->A,(PetscInt)ext_0,idxm->data,(PetscInt)ext_0,idxm->data,lhs->data,ADD_VALUES);
-	VecSetValues(ssi->b,(PetscInt)ext_0,idxm->data,rhs_neg->data,ADD_VALUES);
+	PRAGMA_OMP(critical (petsc_assembly))
+	{
+		add_values_to_petsc_Mat(ssi,(PetscInt)ext_0,idxm->data,(PetscInt)ext_0,idxm->data,lhs->data);
+		VecSetValues(ssi->b,(PetscInt)ext_0,idxm->data,rhs_neg->data,ADD_VALUES);
+	}
 
 	destructor_const_Vector_i(idxm);
 }
 
+static void set_error_ind_dpg
+	(const struct Solver_Volume*const s_vol, const struct Norm_DPG*const norm,
+	 const struct const_Vector_d*const rhs_std, const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*)sim->test_case_rc->tc;
+	if (!test_case->compute_error_ind)
+		return;
+
+	const struct const_Matrix_d rhs_M =
+		{ .layout = 'C', .ext_0 = rhs_std->ext_0, .ext_1 = 1, .owns_data = false, .data = rhs_std->data, };
+	const struct const_Matrix_d*const psi = constructor_sysv_const_Matrix_d(norm->N,&rhs_M); // destructed
+
+	double error_ind_2 = 0.0;
+	for (ptrdiff_t i = 0; i < rhs_std->ext_0; ++i)
+		error_ind_2 += rhs_std->data[i]*psi->data[i];
+	destructor_const_Matrix_d(psi);
+
+	((struct Solver_Volume*)s_vol)->error_ind = sqrt(fabs(error_ind_2));
+}
+
 static const struct const_Matrix_d* constructor_norm_DPG_dN_ds__h1_upwind
 	(const struct DPG_Solver_Volume* dpg_s_vol, const struct Flux_Ref* flux_r, const struct const_Matrix_d* n1_lt,
 	 const struct Simulation* sim)
@@ -411,6 +602,7 @@ static void add_to_petsc_Mat_dpg_c
 	for (int i = 0; i < ext_0; ++i)
 		rhs_c_data[i] = cimag((-rhs_neg->data[i])/CX_STEP);
 
+	PRAGMA_OMP(critical (petsc_assembly))
 	MatSetValues(ssi->A,(PetscInt)ext_0,idxm->data,1,&ssi->col,rhs_c_data,ADD_VALUES);
 
 	destructor_const_Vector_i(idxm);
@@ -426,6 +618,31 @@ static void add_to_dlhs_ds__face_boundary_cmplx_step
 	 struct Simulation*const sim_c              ///< See brief.
 	);
 
+/** \brief Check whether the entry of the Hessian of the reference flux for the input equation and variables is zero
+ *         for all dimensions and nodes.
+ *  \return `true` if all entries are zero; `false` otherwise. */
+static bool hessian_entry_is_zero
+	(const struct const_Multiarray_d*const d2fr_ds2, ///< \ref Flux_Ref_T::d2fr_ds2.
+	 const int eq,                                   ///< The index of the equation.
+	 const int vr,                                   ///< The index of the first variable.
+	 const int vr2                                   ///< The index of the second variable.
+	);
+
+/// \brief Version of \ref add_to_dlhs_ds__face_boundary using finite differences of the analytical Jacobians.
+static void add_to_dlhs_ds__face_boundary_jacobian_fd
+	(struct Matrix_d*const dlhs_ds,             ///< See brief.
+	 const struct DPG_Solver_Volume* dpg_s_vol, ///< See brief.
+	 const struct Simulation*const sim          ///< See brief.
+	);
+
+/// \brief Version of \ref add_nonlinear_l_mult_contribution using finite differences of the analytical Jacobians.
+static void add_nonlinear_l_mult_contribution_jacobian_fd
+	(struct Matrix_d*const lhs_opt,                  ///< See brief.
+	 const struct const_Matrix_d*const lhs_std,      ///< See brief.
+	 const struct DPG_Solver_Volume*const dpg_s_vol, ///< See brief.
+	 const struct Simulation*const sim               ///< See brief.
+	);
+
 /// \brief Constructor for the complex \ref Simulation volumes and faces DPG computational element lists.
 static void constructor_Simulation_c_comp_elems
 	(struct Simulation*const sim_c,            ///< The complex \ref Simulation.
@@ -448,6 +665,22 @@ static const struct Operator* get_operator__cvcv0_vs_vc (const struct DPG_Solver
 	return get_Multiarray_Operator(e->cvcv0_vs_vc[curved],(ptrdiff_t[]){0,0,p,p});
 }
 
+static bool hessian_entry_is_zero
+	(const struct const_Multiarray_d*const d2fr_ds2, const int eq, const int vr, const int vr2)
+{
+	const ptrdiff_t n_n = d2fr_ds2->extents[0];
+	for (int dim = 0; dim < DIM; ++dim) {
+		const ptrdiff_t ind =
+			compute_index_sub_container(d2fr_ds2->order,1,d2fr_ds2->extents,(ptrdiff_t[]){eq,vr,vr2,dim});
+		const double*const data = &d2fr_ds2->data[ind];
+		for (ptrdiff_t n = 0; n < n_n; ++n) {
+			if (data[n] != 0.0)
+				return false;
+		}
+	}
+	return true;
+}
+
 static struct Matrix_d* constructor_dlhs_ds_v_1
 	(const struct Flux_Ref* flux_r, const struct DPG_Solver_Volume* dpg_s_vol, const struct Simulation* sim)
 {
@@ -467,17 +700,18 @@ static struct Matrix_d* constructor_dlhs_ds_v_1
 	const ptrdiff_t ext_1 = tw1_vt_vc.data[0]->op_std->ext_1;
 	struct Matrix_d* tw1_r  = constructor_empty_Matrix_d('R',n_dof_t,ext_1);               // destructed
 	struct Matrix_d* lhs_l  = constructor_empty_Matrix_d('C',n_dof_t,n_dof_s2);            // destructed
-	struct Matrix_d* lhs    = constructor_empty_Matrix_d('C',n_eq*n_dof_t,n_vr2*n_dof_s2); // returned
+	struct Matrix_d* lhs    = constructor_zero_Matrix_d('C',n_eq*n_dof_t,n_vr2*n_dof_s2);  // returned
 
 	const struct const_Multiarray_d* d2fr_ds2_Ma = flux_r->d2fr_ds2;
 	struct Vector_d d2fr_ds2 = { .ext_0 = d2fr_ds2_Ma->extents[0], .owns_data = false, .data = NULL, };
 
-	/** \note: Many entries in the Hessian are 0 and need not be included in the loop below.
-	 *  \todo Include a list of non-zero entries in the Hessian term (as part of \ref Flux_Ref_T) and skip
-	 *        unnecessary terms below. Change to constructor_zero_\*. Also do this for the Jacobian terms. */
+	// Many entries in the Hessian are 0 at all of the nodes; the associated (zero) blocks of `lhs` are skipped.
 	for (int vr2 = 0; vr2 < n_vr; ++vr2) {
 	for (int vr = 0; vr < n_vr; ++vr) {
 	for (int eq = 0; eq < n_eq; ++eq) {
+		if (hessian_entry_is_zero(d2fr_ds2_Ma,eq,vr,vr2))
+			continue;
+
 		set_to_value_Matrix_d(tw1_r,0.0);
 		for (int dim = 0; dim < DIM; ++dim) {
 			const ptrdiff_t ind = compute_index_sub_container(
@@ -546,15 +780,20 @@ static void add_to_dlhs_ds__norm
 
 static void add_to_dlhs_ds__face_boundary
 	(struct Matrix_d*const dlhs_ds, const struct DPG_Solver_Volume* dpg_s_vol, const struct Simulation*const sim,
-	 struct Simulation*const sim_c, const char lin_method)
+	 struct Simulation*const sim_c)
 {
-UNUSED(sim);
-	if (lin_method == 'a')
-		EXIT_ADD_SUPPORT; // Will require linearization of boundary condition/numerical flux Jacobians.
-	else if (lin_method == 'c')
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	switch (test_case->bc_hessian) {
+	case BC_HESSIAN_CMPLX_STEP:
 		add_to_dlhs_ds__face_boundary_cmplx_step(dlhs_ds,dpg_s_vol,sim_c);
-	else
-		EXIT_ERROR("Unsupported: %c\n",lin_method);
+		break;
+	case BC_HESSIAN_JACOBIAN_FD:
+		add_to_dlhs_ds__face_boundary_jacobian_fd(dlhs_ds,dpg_s_vol,sim);
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",test_case->bc_hessian);
+		break;
+	}
 }
 
 static void add_nonlinear_l_mult_contribution
@@ -566,13 +805,19 @@ static void add_nonlinear_l_mult_contribution
 	if (!vol->boundary)
 		return;
 
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	if (test_case->bc_hessian == BC_HESSIAN_JACOBIAN_FD) {
+		add_nonlinear_l_mult_contribution_jacobian_fd(lhs_opt,lhs_std,dpg_s_vol,sim);
+		return;
+	}
+	assert(test_case->bc_hessian == BC_HESSIAN_CMPLX_STEP);
+
 	constructor_Simulation_c_comp_elems(sim_c,dpg_s_vol); // destructed
 
 	const struct Solver_Volume_c*const s_vol_c         = (struct Solver_Volume_c*) sim_c->volumes->first;
 	const struct DPG_Solver_Volume_c*const dpg_s_vol_c = (struct DPG_Solver_Volume_c*) sim_c->volumes->first;
 	struct Multiarray_c*const s_coef_c = s_vol_c->sol_coef;
 
-	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
 	const int n_eq = test_case->n_eq;
 	const ptrdiff_t size_s = compute_size(s_coef_c->order,s_coef_c->extents);
 
@@ -620,8 +865,76 @@ static struct Multiarray_Operator get_operator__cvcv1_vt_vc__rlhs (const struct
 	return set_MO_from_MO(dpg_s_e->cvcv1_vt_vc[curved],1,(ptrdiff_t[]){0,0,p,p});
 }
 
+static void add_to_petsc_Mat_Vec_dpg_condensed
+	(struct DPG_Solver_Volume*const dpg_s_vol, const struct const_Vector_d*const rhs_neg,
+	 const struct const_Matrix_d*const lhs, const struct const_Vector_i*const idxm,
+	 struct Solver_Storage_Implicit*const ssi)
+{
+	const struct Solver_Volume*const s_vol = (struct Solver_Volume*) dpg_s_vol;
+	assert(lhs->layout == 'R');
+	assert(compute_size(s_vol->grad_coef->order,s_vol->grad_coef->extents) == 0); // Add support.
+
+	const ptrdiff_t n_dof = rhs_neg->ext_0,
+	                dof_v = compute_size(s_vol->sol_coef->order,s_vol->sol_coef->extents),
+	                dof_k = n_dof-dof_v;
+
+	// [A_vk, b_v] and [A_kk, b_k]
+	struct Matrix_d*const lhs_rhs_v = constructor_empty_Matrix_d('R',dof_v,dof_k+1), // destructed
+	               *const lhs_rhs_k = constructor_empty_Matrix_d('R',dof_k,dof_k+1); // destructed
+	set_block_Matrix_d(lhs_rhs_v,0,0,lhs,0,    dof_v,dof_v,dof_k,'i');
+	set_block_Matrix_d(lhs_rhs_k,0,0,lhs,dof_v,dof_v,dof_k,dof_k,'i');
+	for (ptrdiff_t i = 0; i < dof_v; ++i)
+		lhs_rhs_v->data[i*(dof_k+1)+dof_k] = rhs_neg->data[i];
+	for (ptrdiff_t i = 0; i < dof_k; ++i)
+		lhs_rhs_k->data[i*(dof_k+1)+dof_k] = rhs_neg->data[dof_v+i];
+
+	const struct Matrix_d*const lhs_m = (struct Matrix_d*) lhs;
+	struct Matrix_d*const lhs_vv = constructor_sub_block_Matrix_d(0,    0,dof_v,dof_v,lhs_m), // destructed
+	               *const lhs_kv = constructor_sub_block_Matrix_d(dof_v,0,dof_k,dof_v,lhs_m); // destructed
+
+	destructor_conditional_Matrix_d(dpg_s_vol->inv_vv_vk);
+	dpg_s_vol->inv_vv_vk = constructor_sgesv_Matrix_d(lhs_vv,lhs_rhs_v); // destructed
+	mm_d('N','N',-1.0,1.0,(struct const_Matrix_d*)lhs_kv,(struct const_Matrix_d*)dpg_s_vol->inv_vv_vk,lhs_rhs_k);
+
+	destructor_Matrix_d(lhs_vv);
+	destructor_Matrix_d(lhs_kv);
+	destructor_Matrix_d(lhs_rhs_v);
+
+	struct Matrix_d*const lhs_c = constructor_sub_block_Matrix_d(0,0,dof_k,dof_k,lhs_rhs_k); // destructed
+	struct Vector_d*const rhs_c = constructor_empty_Vector_d(dof_k);                        // destructed
+	for (ptrdiff_t i = 0; i < dof_k; ++i)
+		rhs_c->data[i] = lhs_rhs_k->data[i*(dof_k+1)+dof_k];
+	destructor_Matrix_d(lhs_rhs_k);
+
+	const PetscInt*const idxm_k = &idxm->data[dof_v];
+	PRAGMA_OMP(critical (petsc_assembly))
+	{
+		add_values_to_petsc_Mat(ssi,(PetscInt)dof_k,idxm_k,(PetscInt)dof_k,idxm_k,lhs_c->data);
+		VecSetValues(ssi->b,(PetscInt)dof_k,idxm_k,rhs_c->data,ADD_VALUES);
+		VecSetValues(ssi->b_full,(PetscInt)n_dof,idxm->data,rhs_neg->data,ADD_VALUES);
+	}
+
+	destructor_Matrix_d(lhs_c);
+	destructor_Vector_d(rhs_c);
+}
+
 // Level 2 ********************************************************************************************************** //
 
+/** \brief Constructor for the derivative of the boundary face lhs contributions of the current volume wrt a single
+ *         solution coefficient computed using central finite differences of the analytical Jacobians.
+ *  \return See brief.
+ *
+ *  The solution coefficient is perturbed in place. This is safe in the threaded volume loop as the coefficients of a
+ *  volume are only read by the thread processing it for the DPG scheme and only the boundary faces of the volume are
+ *  evaluated here. */
+static struct Matrix_d* constructor_dlhs_b_ds_fd
+	(const struct DPG_Solver_Volume*const dpg_s_vol, ///< The current \ref DPG_Solver_Volume_T.
+	 const int col_l,                                ///< The index of the solution coefficient.
+	 const ptrdiff_t ext_0,                          ///< The number of rows of the lhs contribution.
+	 const ptrdiff_t ext_1,                          ///< The number of columns of the lhs contribution.
+	 const struct Simulation*const sim               ///< \ref Simulation.
+	);
+
 /** \brief Constructor for a list of volumes including only a copy of the current volume.
  *  \return See brief. */
 static struct Intrusive_List* constructor_Volumes_dpg_local
@@ -672,6 +985,57 @@ static void add_to_dlhs_ds__face_boundary_cmplx_step
 	destructor_Simulation_c_comp_elems(sim_c);
 }
 
+static void add_to_dlhs_ds__face_boundary_jacobian_fd
+	(struct Matrix_d*const dlhs_ds, const struct DPG_Solver_Volume* dpg_s_vol, const struct Simulation*const sim)
+{
+	const struct Solver_Volume*const s_vol = (struct Solver_Volume*) dpg_s_vol;
+	const ptrdiff_t size_s = compute_size(s_vol->sol_coef->order,s_vol->sol_coef->extents);
+
+	for (int col_l = 0; col_l < size_s; ++col_l) {
+		struct Matrix_d*const dlhs_b_ds = constructor_dlhs_b_ds_fd(dpg_s_vol,col_l,dlhs_ds->ext_0,size_s,sim); // d.
+
+		transpose_Matrix_d(dlhs_b_ds,true);
+		set_block_Matrix_d(dlhs_ds,0,col_l*size_s,(struct const_Matrix_d*)dlhs_b_ds,0,0,
+		                   dlhs_b_ds->ext_0,dlhs_b_ds->ext_1,'a');
+		destructor_Matrix_d(dlhs_b_ds);
+	}
+}
+
+static void add_nonlinear_l_mult_contribution_jacobian_fd
+	(struct Matrix_d*const lhs_opt, const struct const_Matrix_d*const lhs_std,
+	 const struct DPG_Solver_Volume*const dpg_s_vol, const struct Simulation*const sim)
+{
+	const struct Solver_Volume*const s_vol = (struct Solver_Volume*) dpg_s_vol;
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	const int n_eq = test_case->n_eq;
+	const ptrdiff_t size_s = compute_size(s_vol->sol_coef->order,s_vol->sol_coef->extents);
+
+	const struct Multiarray_d*const l_mult = s_vol->l_mult;
+	const struct const_Vector_d*const ones_coef = get_operator__ones_coef_vt(dpg_s_vol);
+	struct Vector_d*const ones_coef_l_mult = constructor_empty_Vector_d(n_eq*ones_coef->ext_0); // destructed
+	for (int ind = 0, eq = 0; eq < n_eq; ++eq) {
+	for (int n = 0; n < ones_coef->ext_0; ++n) {
+		ones_coef_l_mult->data[ind] = ones_coef->data[n]*l_mult->data[eq];
+		++ind;
+	}}
+
+	for (int col_l = 0; col_l < size_s; ++col_l) {
+		struct Matrix_d*const dlhs_b_ds =
+			constructor_dlhs_b_ds_fd(dpg_s_vol,col_l,lhs_std->ext_0,lhs_std->ext_1,sim); // destructed
+
+		const struct const_Vector_d*const lhs_l_mult_V = constructor_mv_const_Vector_d(
+			'T',1.0,(struct const_Matrix_d*)dlhs_b_ds,(struct const_Vector_d*)ones_coef_l_mult); // destructed
+		destructor_Matrix_d(dlhs_b_ds);
+
+		const struct const_Matrix_d lhs_l_mult =
+			{ .layout = 'R', .ext_0 = lhs_l_mult_V->ext_0, .ext_1 = 1, .owns_data = false,
+			  .data = lhs_l_mult_V->data, };
+		set_block_Matrix_d(lhs_opt,0,col_l,&lhs_l_mult,0,0,lhs_l_mult.ext_0,lhs_l_mult.ext_1,'a');
+		destructor_const_Vector_d(lhs_l_mult_V);
+	}
+	destructor_Vector_d(ones_coef_l_mult);
+}
+
 static void constructor_Simulation_c_comp_elems
 	(struct Simulation*const sim_c, const struct DPG_Solver_Volume* dpg_s_vol)
 {
@@ -707,6 +1071,36 @@ struct DPG_Solver_Face* get_dpg_face_ptr
 	 const int index_f                               ///< The index of the face.
 	);
 
+static struct Matrix_d* constructor_dlhs_b_ds_fd
+	(const struct DPG_Solver_Volume*const dpg_s_vol, const int col_l, const ptrdiff_t ext_0, const ptrdiff_t ext_1,
+	 const struct Simulation*const sim)
+{
+	const struct Solver_Volume*const s_vol = (struct Solver_Volume*) dpg_s_vol;
+	double*const s_l = &s_vol->sol_coef->data[col_l];
+
+	// The step is chosen to balance the truncation and round-off errors of the central difference.
+	const double s_0 = *s_l,
+	             h   = cbrt(EPS)*(1.0+fabs(s_0)),
+	             s_p = s_0+h,
+	             s_m = s_0-h;
+
+	struct Matrix_d*const lhs_p = constructor_zero_Matrix_d('R',ext_0,ext_1); // returned
+	struct Matrix_d*const lhs_m = constructor_zero_Matrix_d('R',ext_0,ext_1); // destructed
+
+	*s_l = s_p;
+	add_to_rlhs__face_boundary(dpg_s_vol,lhs_p,NULL,sim);
+	*s_l = s_m;
+	add_to_rlhs__face_boundary(dpg_s_vol,lhs_m,NULL,sim);
+	*s_l = s_0;
+
+	const ptrdiff_t size = ext_0*ext_1;
+	for (ptrdiff_t i = 0; i < size; ++i)
+		lhs_p->data[i] = (lhs_p->data[i]-lhs_m->data[i])/(s_p-s_m);
+	destructor_Matrix_d(lhs_m);
+
+	return lhs_p;
+}
+
 static struct Intrusive_List* constructor_Volumes_dpg_local
 	(const struct DPG_Solver_Volume*const dpg_s_vol, struct Simulation*const sim)
 {
@@ -20,6 +20,8 @@ You should have received a copy of the GNU General Public License along with DPG
  *         scheme.
  */
 
+#include "petscvec.h"
+
 #include "def_templates_type_d.h"
 #include "compute_all_rlhs_dpg_T.h"
 #include "undef_templates_type.h"
@@ -28,4 +30,37 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "compute_all_rlhs_dpg_T.h"
 #include "undef_templates_type.h"
 
+struct Simulation;
+
+/** \brief Get the complex \ref Simulation\*s (one for each thread) used to compute the Hessian terms relating to the
+ *         boundary conditions using the complex step method, constructing them if required.
+ *  \return See brief.
+ *
+ *  The complex simulations are stored in \ref Simulation::sims_c_dpg such that they are constructed once for the life
+ *  of the simulation instead of at each call to \ref compute_all_rlhs_dpg_T. They are destructed with the simulation,
+ *  invalidated when the mesh is adapted (see \ref adapt_hp) and reconstructed if the maximum number of threads
+ *  changes.
+ *
+ *  As the \ref Simulation constructor sets statically allocated values, this function must be called from a serial
+ *  region. */
+struct Simulation** get_Simulations_c_dpg
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/// \brief Destructor for the complex \ref Simulation\*s cached by \ref get_Simulations_c_dpg (if present).
+void destructor_Simulations_c_dpg
+	(struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Replace the input vector of solved face and Lagrange multiplier values with the vector of all solved values,
+ *         recovering the volume values by local back-substitution.
+ *  \return The Petsc error code or 0 if no error.
+ *
+ *  Used when the volume dof were statically condensed out of the global system during assembly (see \ref
+ *  Test_Case_T::use_schur_complement), such that \ref DPG_Solver_Volume_T::inv_vv_vk is available. */
+PetscErrorCode back_substitute_x_dpg
+	(Vec*const x,                      ///< The solution vector.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
 #endif // DPG__compute_all_rlhs_dpg_h__INCLUDED
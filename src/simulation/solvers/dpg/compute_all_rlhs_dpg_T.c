@@ -20,9 +20,11 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "petscmat.h"
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_dpg.h"
 #include "definitions_elements.h"
 #include "definitions_intrusive.h"
+#include "definitions_test_case.h"
 
 
 #include "def_templates_compute_all_rlhs_dpg.h"
@@ -176,51 +178,49 @@ void compute_all_rlhs_dpg_T
 	assert(((struct Test_Case_T*)sim->test_case_rc->tc)->solver_method_curr == 'i');
 
 	struct S_Params_DPG s_params = set_s_params_dpg(sim);
-	struct Flux_Input_T* flux_i = constructor_Flux_Input_T(sim); // destructed
 
-	/** A complex \ref Simulation is initialized here as it is used to compute Hessian terms relating to the
-	 *  boundary conditions using the complex step method. While this is certainly less efficient than computing these
-	 *  terms through the analytical Hessian, efficiency may not be significantly impacted as this procedure is only
-	 *  used for faces on the boundary. \todo Profile and refer to test.
+	/** By default, a complex \ref Simulation is used to compute Hessian terms relating to the boundary conditions using
+	 *  the complex step method. As the boundary conditions are imposed weakly through a numerical flux after computing
+	 *  the appropriate boundary ghost state (exactly as is done in the DG solver), the analytical Hessian of both
+	 *  boundary condition and numerical flux functions would be required to remove the complex step linearization.
+	 *  Alternatively, these terms may be computed from finite differences of the analytical boundary face Jacobians,
+	 *  which does not require the complex simulations (see \ref Test_Case_T::bc_hessian).
 	 *
-	 *  As the boundary conditions are currently imposed weakly through a numerical flux after computing the
-	 *  appropriate boundary ghost state (exactly as is done in the DG solver), the analytical Hessian of both
-	 *  boundary condition and numerical flux functions would be required if it is desired to remove the complex step
-	 *  linearization. */
-	struct Simulation* sim_c = NULL;
+	 *  As the computational elements of the complex \ref Simulation are modified for each volume, one instance is
+	 *  required for each thread. These are cached across calls (see \ref get_Simulations_c_dpg). */
 #if TYPE_RC == TYPE_REAL
-	sim_c = constructor_Simulation__no_mesh(sim->ctrl_name); // destructed
-	convert_to_Test_Case_rc(sim_c,'c');
-
-	struct Test_Case_c* test_case = (struct Test_Case_c*) sim_c->test_case_rc->tc;
-	/** Currently, the function pointer to the boundary condition/numerical flux computing functions are set based on
-	 *  the value of solver_method_curr and functions do not necessarily allow for the computation of all required
-	 *  terms. For example, setting solver_method_curr = 'e' here, \ref Test_Case_T::flux_comp_mem_e will indicate
-	 *  that the Jacobian should be computed, but the function pointer will point to a function which does not support
-	 *  the Jacobian computation and the values will all simply be 0.
-	 *
-	 * \todo Combine the separate (and redundant) numerical flux/boundary condition functions, similarly to what was
-	 *       done for the standard flux functions. Once complete, change solver_method_curr to 'e' for the
-	 *       Test_Case_c.
-	 */
-	test_case->solver_method_curr = 'i';
-
-	/* To avoid recomputing the derived \ref DPG_Solver_Element operators for each volume, the existing
-	 * \ref Simulation::elements list is used for the complex \ref Simulation as well. */
-	sim_c->elements = sim->elements;
+	const struct Test_Case_T*const test_case = (struct Test_Case_T*) sim->test_case_rc->tc;
+	const bool use_sims_c = !test_case->is_linear && test_case->bc_hessian == BC_HESSIAN_CMPLX_STEP;
+	struct Simulation**const sims_c = ( use_sims_c ? get_Simulations_c_dpg(sim) : NULL );
+#elif TYPE_RC == TYPE_COMPLEX
+	struct Simulation**const sims_c = NULL;
 #endif
 
-	for (struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next) {
-		struct DPG_Solver_Volume_T* dpg_s_vol = (struct DPG_Solver_Volume_T*) curr;
-		s_params.compute_rlhs(&s_params,flux_i,dpg_s_vol,ssi,sim,sim_c);
-	}
-	destructor_Flux_Input_T(flux_i);
+	ptrdiff_t n_v = 0;
+	struct Intrusive_Link**const vols = constructor_array_Link(volumes,&n_v); // freed
 
-#if TYPE_RC == TYPE_REAL
-	convert_to_Test_Case_rc(sim_c,'r');
-	sim_c->elements = NULL;
-	destructor_Simulation(sim_c);
-#endif
+	PRAGMA_OMP(parallel)
+	{
+		struct Flux_Input_T* flux_i = constructor_Flux_Input_T(sim); // destructed
+		struct Simulation*const sim_c = ( sims_c ? sims_c[THREAD_NUM_OMP] : NULL );
+
+		struct Solver_Storage_Implicit ssi_l;
+		struct Solver_Storage_Implicit*const ssi_p = ( ssi ? &ssi_l : NULL );
+		if (ssi)
+			ssi_l = *ssi;
+
+		PRAGMA_OMP(for schedule(dynamic,CHUNK_OMP))
+		for (ptrdiff_t v = 0; v < n_v; ++v) {
+			struct DPG_Solver_Volume_T* dpg_s_vol = (struct DPG_Solver_Volume_T*) vols[v];
+			set_profile_element_type(((struct Volume*)vols[v])->element->type);
+
+			const struct Scratch_Scope scope = open_scratch_scope();
+			s_params.compute_rlhs(&s_params,flux_i,dpg_s_vol,ssi_p,sim,sim_c);
+			close_scratch_scope(scope);
+		}
+		destructor_Flux_Input_T(flux_i);
+	}
+	free(vols);
 }
 
 void compute_flux_imbalances_faces_dpg_T (struct Simulation*const sim)
@@ -777,8 +777,8 @@ static const struct Norm_DPG* constructor_norm_DPG__adjoint
 	if (get_set_pde_index(NULL) != PDE_ADVECTION)
 		EXIT_ADD_SUPPORT;
 
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
@@ -878,6 +878,8 @@ static void compute_rlhs_1
 		                        opt_t_coef,dpg_s_vol,sim); // destructed
 
 #if TYPE_RC == TYPE_REAL
+	set_error_ind_dpg(s_vol,norm,(struct const_Vector_T*)rhs_std,sim);
+
 	struct Matrix_T* lhs_opt =
 		constructor_mm_Matrix_T('T','N',1.0,opt_t_coef,(struct const_Matrix_T*)lhs_std,'R'); // destructed
 
@@ -1099,6 +1101,7 @@ static void add_to_petsc_Mat_dpg_c
 	for (int i = 0; i < ext_0; ++i)
 		rhs_c_data[i] = cimag((-rhs_neg->data[i])/CX_STEP);
 
+	PRAGMA_OMP(critical (petsc_assembly))
 	MatSetValues(ssi->A,(PetscInt)ext_0,idxm->data,1,&ssi->col,rhs_c_data,ADD_VALUES);
 
 	destructor_const_Vector_i(idxm);
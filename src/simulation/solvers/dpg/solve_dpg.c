@@ -31,6 +31,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "compute_source_rlhs_dg.h"
 #include "const_cast.h"
 #include "intrusive.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solve.h"
 #include "solve_implicit.h"
@@ -50,7 +51,10 @@ You should have received a copy of the GNU General Public License along with DPG
 
 double compute_rlhs_dpg (const struct Simulation* sim, struct Solver_Storage_Implicit* ssi)
 {
+	// The face terms are computed as part of the volume loop.
+	start_profile(PROF_VOLUME_RLHS);
 	compute_all_rlhs_dpg(sim,ssi,sim->volumes);
+	stop_profile(PROF_VOLUME_RLHS);
 	return compute_max_rhs_from_ssi(ssi);
 }
 
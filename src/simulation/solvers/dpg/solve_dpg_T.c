@@ -35,33 +35,44 @@ You should have received a copy of the GNU General Public License along with DPG
 
 /// \brief Increment the appropriate rows of nnz based on the off-diagonal terms.
 static void increment_nnz_off_diag
-	(struct Vector_i* nnz,              ///< Vector of 'n'umber of 'n'on-'z'ero entries per row.
-	 const struct Solver_Face_T* s_face ///< The current face.
+	(struct Vector_i* nnz,               ///< Vector of 'n'umber of 'n'on-'z'ero entries per row.
+	 const struct Solver_Face_T* s_face, ///< The current face.
+	 const bool condense_v               ///< Defined for \ref constructor_nnz_dpg_T.
 	);
 
 /// \brief Increment the appropriate rows of nnz based on the off-diagonal constraint terms.
 static void increment_nnz_off_diag_constraint
-	(struct Vector_i*const nnz,               ///< Vector of 'n'umber of 'n'on-'z'ero entries per row.
-	 const struct Solver_Volume_T*const s_vol ///< The current volume.
+	(struct Vector_i*const nnz,                ///< Vector of 'n'umber of 'n'on-'z'ero entries per row.
+	 const struct Solver_Volume_T*const s_vol, ///< The current volume.
+	 const bool condense_v                     ///< Defined for \ref constructor_nnz_dpg_T.
 	);
 
 // Interface functions ********************************************************************************************** //
 
-struct Vector_i* constructor_nnz_dpg_T (const bool diag_only, const struct Simulation* sim)
+struct Vector_i* constructor_nnz_dpg_T (const bool diag_only, const bool condense_v, const struct Simulation* sim)
 {
 	struct Test_Case_T* test_case = (struct Test_Case_T*) sim->test_case_rc->tc;
 	assert(test_case->has_2nd_order == false); // Add support.
 
-	const ptrdiff_t dof = compute_dof(sim);
+	// The volume dof are numbered after the face and Lagrange multiplier dof (see \ref update_ind_dof_T).
+	ptrdiff_t dof = compute_dof(sim);
+	if (condense_v) {
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+			struct Multiarray_T* sol_coef = ((struct Solver_Volume_T*) curr)->sol_coef;
+			dof -= compute_size(sol_coef->order,sol_coef->extents);
+		}
+	}
 	struct Vector_i* nnz = constructor_zero_Vector_i(dof); // returned
 
 	// Volume contribution (Diagonal)
-	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-		struct Solver_Volume_T* s_vol = (struct Solver_Volume_T*) curr;
+	if (!condense_v) {
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+			struct Solver_Volume_T* s_vol = (struct Solver_Volume_T*) curr;
 
-		struct Multiarray_T* sol_coef = s_vol->sol_coef;
-		const ptrdiff_t size = compute_size(sol_coef->order,sol_coef->extents);
-		increment_nnz(nnz,s_vol->ind_dof,size,size);
+			struct Multiarray_T* sol_coef = s_vol->sol_coef;
+			const ptrdiff_t size = compute_size(sol_coef->order,sol_coef->extents);
+			increment_nnz(nnz,s_vol->ind_dof,size,size);
+		}
 	}
 
 	// Face contributions (Diagonal and Off-diagonal)
@@ -79,7 +90,7 @@ struct Vector_i* constructor_nnz_dpg_T (const bool diag_only, const struct Simul
 
 		// Off-diagonal
 		if (!diag_only)
-			increment_nnz_off_diag(nnz,s_face);
+			increment_nnz_off_diag(nnz,s_face,condense_v);
 	}
 
 	// Constraint - if applicable (Diagonal and Off-diagonal)
@@ -89,7 +100,7 @@ struct Vector_i* constructor_nnz_dpg_T (const bool diag_only, const struct Simul
 			struct Solver_Volume_T* s_vol = (struct Solver_Volume_T*) curr;
 
 			increment_nnz(nnz,s_vol->ind_dof_constraint,n_eq,n_eq);
-			increment_nnz_off_diag_constraint(nnz,s_vol);
+			increment_nnz_off_diag_constraint(nnz,s_vol,condense_v);
 		}
 	}
 	return nnz;
@@ -114,7 +125,7 @@ static void increment_nnz_off_diag_f
 	 const struct Solver_Face_T* s_face ///< The current face.
 	);
 
-static void increment_nnz_off_diag (struct Vector_i* nnz, const struct Solver_Face_T* s_face)
+static void increment_nnz_off_diag (struct Vector_i* nnz, const struct Solver_Face_T* s_face, const bool condense_v)
 {
 	const struct Face* face = (struct Face*) s_face;
 	struct Multiarray_T* nf_coef = s_face->nf_coef;
@@ -124,12 +135,14 @@ static void increment_nnz_off_diag (struct Vector_i* nnz, const struct Solver_Fa
 		if (n == 1 && face->boundary)
 			continue;
 
-		increment_nnz_off_diag_v(nnz,n,size_nf,s_face);
+		if (!condense_v)
+			increment_nnz_off_diag_v(nnz,n,size_nf,s_face);
 		increment_nnz_off_diag_f(nnz,n,size_nf,s_face);
 	}
 }
 
-static void increment_nnz_off_diag_constraint (struct Vector_i*const nnz, const struct Solver_Volume_T*const s_vol)
+static void increment_nnz_off_diag_constraint
+	(struct Vector_i*const nnz, const struct Solver_Volume_T*const s_vol, const bool condense_v)
 {
 	const ptrdiff_t size_l_mult = compute_size(s_vol->l_mult->order,s_vol->l_mult->extents);
 
@@ -148,6 +161,9 @@ static void increment_nnz_off_diag_constraint (struct Vector_i*const nnz, const
 			increment_nnz(nnz,s_face->ind_dof,size_nf,size_l_mult);
 		}
 	}}
+	if (condense_v)
+		return;
+
 	struct Multiarray_T* sol_coef = s_vol->sol_coef;
 	const ptrdiff_t size_sol = compute_size(sol_coef->order,sol_coef->extents);
 	increment_nnz(nnz,s_vol->ind_dof_constraint,size_l_mult,size_sol);
@@ -29,6 +29,8 @@ struct Solver_Storage_Implicit;
 struct Vector_i* constructor_nnz_dpg_T
 	(const bool diag_only,        /**< Flag for whether space should only be allocated for block diagonal
 	                               *   contributions. */
+	 const bool condense_v,       /**< Flag for whether the volume dof are statically condensed out of the global
+	                               *   system, in which case the volume rows and columns are not included. */
 	 const struct Simulation* sim ///< \ref Simulation.
 	);
 
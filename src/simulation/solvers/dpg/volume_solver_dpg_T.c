@@ -49,6 +49,7 @@ void constructor_derived_DPG_Solver_Volume_T (struct Volume* volume_ptr, const s
 
 	dpg_s_vol->norm_op_H0 = constructor_norm_op_H0(dpg_s_vol); // destructed
 	dpg_s_vol->norm_op_H1 = constructor_norm_op_H1(dpg_s_vol); // destructed
+	dpg_s_vol->inv_vv_vk  = NULL;
 }
 
 void destructor_derived_DPG_Solver_Volume_T (struct Volume* volume_ptr)
@@ -57,6 +58,7 @@ void destructor_derived_DPG_Solver_Volume_T (struct Volume* volume_ptr)
 
 	destructor_const_Matrix_T(dpg_s_vol->norm_op_H0);
 	destructor_const_Matrix_T(dpg_s_vol->norm_op_H1);
+	destructor_conditional_Matrix_T(dpg_s_vol->inv_vv_vk);
 }
 
 // Static functions ************************************************************************************************* //
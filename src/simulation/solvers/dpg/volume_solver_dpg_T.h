@@ -30,6 +30,11 @@ struct DPG_Solver_Volume_T {
 
 	const struct const_Matrix_T* norm_op_H0; ///< The H0 (L2) norm operator.
 	const struct const_Matrix_T* norm_op_H1; ///< The H1      norm operator.
+
+	/** The solution of the volume block of the local system for the face and Lagrange multiplier columns of the lhs
+	 *  and the rhs: \f$ A_{vv}^{-1} [A_{vk}, b_v] \f$. Only used when the volume dof are statically condensed out of
+	 *  the global system (see \ref Test_Case_T::use_schur_complement); `NULL` otherwise. */
+	struct Matrix_T* inv_vv_vk;
 };
 
 /// \brief Constructor for a derived \ref DPG_Solver_Volume_T.
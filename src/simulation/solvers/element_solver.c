@@ -124,6 +124,8 @@ void destructor_derived_Solver_Element (struct Element* element_ptr)
 	destructor_Multiarray_Operator(s_e->ccSB0_vs_vs);
 	destructor_Multiarray_Operator(s_e->ccBS0_vs_vs);
 
+	destructor_Multiarray_Operator(s_e->ccGB0_vgc_vgc);
+
 	destructor_Multiarray2_Operator(s_e->cv0_vg_ev);
 	destructor_Multiarray2_Operator_conditional(s_e->cv0_vg_vv);
 }
@@ -136,44 +138,49 @@ static void constructor_derived_Solver_Element_std (struct Element* element_ptr,
 	struct const_Element* e    = (struct const_Element*) element_ptr;
 	struct Solver_Element* s_e = (struct Solver_Element*) element_ptr;
 
-	// H_CF, P_PM1 are needed for cv0_vs_vc* and tw0_vt_vc* operators as they are used to assemble tensor-product
-	// operators.
-	s_e->cv0_vs_vc[0] = constructor_operators("cv0","vsA","vcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vs_vc[1] = constructor_operators("cv0","vsA","vcc","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vr_vc[0] = constructor_operators("cv0","vrA","vcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vr_vc[1] = constructor_operators("cv0","vrA","vcc","H_CF_P_PM1",e,sim); // destructed
-	s_e->tw1_vt_vc[0] = constructor_operators("tw1","vtA","vcs","H_1_P_PM0", e,sim); // destructed
-	s_e->tw1_vt_vc[1] = constructor_operators("tw1","vtA","vcc","H_1_P_PM0", e,sim); // destructed
-	s_e->cv0_vt_vc[0] = constructor_operators("cv0","vtA","vcs","H_CF_P_PM1", e,sim); // destructed
-	s_e->cv0_vt_vc[1] = constructor_operators("cv0","vtA","vcc","H_CF_P_PM1", e,sim); // destructed
-	s_e->cv1_vt_vc[0] = constructor_operators("cv1","vtA","vcs","H_1_P_PM0", e,sim); // destructed
-	s_e->cv1_vt_vc[1] = constructor_operators("cv1","vtA","vcc","H_1_P_PM0", e,sim); // destructed
-	s_e->cv0_vs_vs    = constructor_operators("cv0","vsA","vsA","H_1_P_PM0",e,sim); // destructed
-	s_e->cv0_vr_vs    = constructor_operators("cv0","vrA","vsA","H_1_P_PM0",e,sim); // destructed
-	s_e->cv0_vg_vs[0] = constructor_operators("cv0","vgs","vsA","H_1_P_1P",  e,sim); // destructed
-	s_e->cv0_vg_vs[1] = constructor_operators("cv0","vgc","vsA","H_1_P_PM0", e,sim); // destructed
-
-	s_e->cv0_vs_fc[0] = constructor_operators("cv0","vsA","fcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vs_fc[1] = constructor_operators("cv0","vsA","fcc","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vr_fc[0] = constructor_operators("cv0","vrA","fcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vr_fc[1] = constructor_operators("cv0","vrA","fcc","H_CF_P_PM1",e,sim); // destructed
-	s_e->tw0_vt_fc[0] = constructor_operators("tw0","vtA","fcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->tw0_vt_fc[1] = constructor_operators("tw0","vtA","fcc","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vt_fc[0] = constructor_operators("cv0","vtA","fcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->cv0_vt_fc[1] = constructor_operators("cv0","vtA","fcc","H_CF_P_PM1",e,sim); // destructed
-
-	s_e->cv0_vg_vc[0] = constructor_operators("cv0","vgs","vcs","H_1_P_1P",  e,sim); // destructed
-	s_e->cv0_vg_vc[1] = constructor_operators("cv0","vgc","vcc","H_1_P_PM0", e,sim); // destructed
-	s_e->tw0_vt_vc[0] = constructor_operators("tw0","vtA","vcs","H_CF_P_PM1",e,sim); // destructed
-	s_e->tw0_vt_vc[1] = constructor_operators("tw0","vtA","vcc","H_CF_P_PM1",e,sim); // destructed
+	/* The operators are only constructed when first accessed such that those for the polynomial degrees and
+	 * h-refinement indices which are not present in the simulation are never computed.
+	 *
+	 * H_CF, P_PM1 are needed for cv0_vs_vc* and tw0_vt_vc* operators as they are used to assemble tensor-product
+	 * operators. */
+	s_e->cv0_vs_vc[0] = constructor_operators_lazy("cv0","vsA","vcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vs_vc[1] = constructor_operators_lazy("cv0","vsA","vcc","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vr_vc[0] = constructor_operators_lazy("cv0","vrA","vcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vr_vc[1] = constructor_operators_lazy("cv0","vrA","vcc","H_CF_P_PM1",e,sim); // destructed
+	s_e->tw1_vt_vc[0] = constructor_operators_lazy("tw1","vtA","vcs","H_1_P_PM0", e,sim); // destructed
+	s_e->tw1_vt_vc[1] = constructor_operators_lazy("tw1","vtA","vcc","H_1_P_PM0", e,sim); // destructed
+	s_e->cv0_vt_vc[0] = constructor_operators_lazy("cv0","vtA","vcs","H_CF_P_PM1", e,sim); // destructed
+	s_e->cv0_vt_vc[1] = constructor_operators_lazy("cv0","vtA","vcc","H_CF_P_PM1", e,sim); // destructed
+	s_e->cv1_vt_vc[0] = constructor_operators_lazy("cv1","vtA","vcs","H_1_P_PM0", e,sim); // destructed
+	s_e->cv1_vt_vc[1] = constructor_operators_lazy("cv1","vtA","vcc","H_1_P_PM0", e,sim); // destructed
+	s_e->cv0_vs_vs    = constructor_operators_lazy("cv0","vsA","vsA","H_1_P_PM0",e,sim); // destructed
+	s_e->cv0_vr_vs    = constructor_operators_lazy("cv0","vrA","vsA","H_1_P_PM0",e,sim); // destructed
+	s_e->cv0_vg_vs[0] = constructor_operators_lazy("cv0","vgs","vsA","H_1_P_1P",  e,sim); // destructed
+	s_e->cv0_vg_vs[1] = constructor_operators_lazy("cv0","vgc","vsA","H_1_P_PM0", e,sim); // destructed
+
+	s_e->cv0_vs_fc[0] = constructor_operators_lazy("cv0","vsA","fcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vs_fc[1] = constructor_operators_lazy("cv0","vsA","fcc","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vr_fc[0] = constructor_operators_lazy("cv0","vrA","fcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vr_fc[1] = constructor_operators_lazy("cv0","vrA","fcc","H_CF_P_PM1",e,sim); // destructed
+	s_e->tw0_vt_fc[0] = constructor_operators_lazy("tw0","vtA","fcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->tw0_vt_fc[1] = constructor_operators_lazy("tw0","vtA","fcc","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vt_fc[0] = constructor_operators_lazy("cv0","vtA","fcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->cv0_vt_fc[1] = constructor_operators_lazy("cv0","vtA","fcc","H_CF_P_PM1",e,sim); // destructed
+
+	s_e->cv0_vg_vc[0] = constructor_operators_lazy("cv0","vgs","vcs","H_1_P_1P",  e,sim); // destructed
+	s_e->cv0_vg_vc[1] = constructor_operators_lazy("cv0","vgc","vcc","H_1_P_PM0", e,sim); // destructed
+	s_e->tw0_vt_vc[0] = constructor_operators_lazy("tw0","vtA","vcs","H_CF_P_PM1",e,sim); // destructed
+	s_e->tw0_vt_vc[1] = constructor_operators_lazy("tw0","vtA","vcc","H_CF_P_PM1",e,sim); // destructed
 
 	s_e->ccSB0_vs_vs = constructor_operators_bt("ccSB0","vsA","vsA","H_1_P_PM0",e,sim); // destructed
 	s_e->ccBS0_vs_vs = constructor_operators_bt("ccBS0","vsA","vsA","H_1_P_PM0",e,sim); // destructed
 
-	s_e->cv0_vg_vv[0] = constructor_operators("cv0","vgs","vvs","H_1_P_11",e,sim); // destructed
-	s_e->cv0_vg_vv[1] = constructor_operators("cv0","vgc","vvs","H_1_P_P1",e,sim); // destructed
-	s_e->cv0_vg_ev[0] = constructor_operators("cv0","vgs","evs","H_1_P_11",e,sim); // destructed
-	s_e->cv0_vg_ev[1] = constructor_operators("cv0","vgc","evs","H_1_P_P1",e,sim); // destructed
+	s_e->ccGB0_vgc_vgc = constructor_operators_bt("ccGB0","vgc","vgc","H_1_P_PM0",e,sim); // destructed
+
+	s_e->cv0_vg_vv[0] = constructor_operators_lazy("cv0","vgs","vvs","H_1_P_11",e,sim); // destructed
+	s_e->cv0_vg_vv[1] = constructor_operators_lazy("cv0","vgc","vvs","H_1_P_P1",e,sim); // destructed
+	s_e->cv0_vg_ev[0] = constructor_operators_lazy("cv0","vgs","evs","H_1_P_11",e,sim); // destructed
+	s_e->cv0_vg_ev[1] = constructor_operators_lazy("cv0","vgc","evs","H_1_P_P1",e,sim); // destructed
 }
 
 static void constructor_derived_Solver_Element_tp (struct Element* element_ptr, const struct Simulation* sim)
@@ -274,6 +281,9 @@ static void constructor_derived_Solver_Element_tp (struct Element* element_ptr,
 	set_operators_tp(&ops_tp,s_se[0]->ccBS0_vs_vs,NULL,s_se[1]->ccBS0_vs_vs,NULL);
 	s_e->ccBS0_vs_vs = constructor_operators_tp("ccBS0","vsA","vsA","H_1_P_PM0",e,sim,&ops_tp); // destructed
 
+	set_operators_tp(&ops_tp,s_se[0]->ccGB0_vgc_vgc,NULL,s_se[1]->ccGB0_vgc_vgc,NULL);
+	s_e->ccGB0_vgc_vgc = constructor_operators_tp("ccGB0","vgc","vgc","H_1_P_PM0",e,sim,&ops_tp); // destructed
+
 	set_operators_tp(&ops_tp,s_se[0]->cv0_vg_vv[0],s_se[0]->cv0_vg_ev[0],s_se[1]->cv0_vg_vv[0],s_se[1]->cv0_vg_ev[0]);
 	s_e->cv0_vg_ev[0] = constructor_operators_tp("cv0","vgs","evs","H_1_P_11",e,sim,&ops_tp); // destructed
 
@@ -286,8 +296,8 @@ static void constructor_derived_Solver_Element_common (struct Element* element_p
 	const struct const_Element* e = (struct const_Element*) element_ptr;
 	struct Solver_Element* s_e    = (struct Solver_Element*) element_ptr;
 
-	s_e->cv0_ff_fc[0] = constructor_operators("cv0","ffA","fcs","H_1_P_PM0",e,sim); // destructed
-	s_e->cv0_ff_fc[1] = constructor_operators("cv0","ffA","fcc","H_1_P_PM0",e,sim); // destructed
+	s_e->cv0_ff_fc[0] = constructor_operators_lazy("cv0","ffA","fcs","H_1_P_PM0",e,sim); // destructed
+	s_e->cv0_ff_fc[1] = constructor_operators_lazy("cv0","ffA","fcc","H_1_P_PM0",e,sim); // destructed
 
 	s_e->w_vc[0] = constructor_operators_w("vcs","vcs","H_1_P_PM0",sim->p_s_v,e,sim); // destructed
 	s_e->w_vc[1] = constructor_operators_w("vcc","vcc","H_1_P_PM0",sim->p_s_v,e,sim); // destructed
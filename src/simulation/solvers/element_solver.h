@@ -68,6 +68,9 @@ struct Solver_Element {
 	const struct Multiarray_Operator* ccSB0_vs_vs; ///< See notation in \ref element_operators.h.
 	const struct Multiarray_Operator* ccBS0_vs_vs; ///< See notation in \ref element_operators.h.
 
+	// Point location
+	const struct Multiarray_Operator* ccGB0_vgc_vgc; ///< See notation in \ref element_operators.h.
+
 	// CFL ramping
 	const struct Multiarray_Operator* cv0_vg_vv[2]; ///< See notation in \ref element_operators.h.
 	const struct Multiarray_Operator* cv0_vg_ev[2]; ///< See notation in \ref element_operators.h.
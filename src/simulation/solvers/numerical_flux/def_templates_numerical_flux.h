@@ -78,6 +78,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #define compute_Numerical_Flux_T_central_jacobian compute_Numerical_Flux_T_central_jacobian
 #define set_Numerical_Flux_Energy_member set_Numerical_Flux_Energy_member
 #define compute_dmaxV_ds compute_dmaxV_ds_d
+#define compute_max_wave_speed compute_max_wave_speed_d
+#define min_abs_real_inline min_abs_real_inline_d
+#define max_abs_real_inline max_abs_real_inline_d
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
@@ -142,6 +145,9 @@ You should have received a copy of the GNU General Public License along with DPG
 #define compute_Numerical_Flux_T_central_jacobian compute_Numerical_Flux_T_central_jacobian_c
 #define set_Numerical_Flux_Energy_member set_Numerical_Flux_Energy_member_c
 #define compute_dmaxV_ds compute_dmaxV_ds_c
+#define compute_max_wave_speed compute_max_wave_speed_c
+#define min_abs_real_inline min_abs_real_inline_c
+#define max_abs_real_inline max_abs_real_inline_c
 ///\}
 
 #endif
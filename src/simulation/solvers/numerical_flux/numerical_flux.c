@@ -19,6 +19,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include <assert.h>
 
+#include "macros.h"
 #include "definitions_numerical_flux.h"
 
 #include "multiarray.h"
@@ -55,6 +56,7 @@ const int* get_set_ind_num_flux (const int*const new_vals)
 {
 	static int ind_num_flux[2] = { -1, -1, };
 	if (new_vals) {
+		EXIT_IF_IN_PARALLEL;
 		assert((new_vals[0] == NUM_FLUX_INVALID)    ||
 		       (new_vals[0] == NUM_FLUX_UPWIND)     ||
 		       (new_vals[0] == NUM_FLUX_ROE_PIKE)   ||
@@ -39,8 +39,8 @@ You should have received a copy of the GNU General Public License along with DPG
 void compute_Numerical_Flux_T_advection_upwind
 	(const struct Numerical_Flux_Input_T* num_flux_i, struct mutable_Numerical_Flux_T* num_flux)
 {
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
@@ -78,8 +78,8 @@ void compute_Numerical_Flux_T_advection_upwind_jacobian
 	(const struct Numerical_Flux_Input_T* num_flux_i, struct mutable_Numerical_Flux_T* num_flux
 	)
 {
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
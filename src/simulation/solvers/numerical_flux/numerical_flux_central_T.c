@@ -176,7 +176,7 @@ static void set_Numerical_Flux_Energy_member
 
 static struct Fluxes_LR constructor_Fluxes_LR (const struct Numerical_Flux_Input_T*const num_flux_i)
 {
-	static struct Fluxes_LR fluxes_lr;
+	static _Thread_local struct Fluxes_LR fluxes_lr;
 
 	// Note that only the 2nd order flux contributions should be included in the viscous numerical flux.
 	struct Flux_Input_T*const flux_i = num_flux_i->flux_i;
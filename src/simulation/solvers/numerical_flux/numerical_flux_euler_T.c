@@ -55,275 +55,79 @@ static const Type* compute_dmaxV_ds
 	 const Type*const uvw ///< Velocity components.
 		);
 
+/** \brief Compute the maximum wave speed (|V|+c) of the left and right states used in the Lax-Friedrichs scheme.
+ *  \return See brief. */
+static Type compute_max_wave_speed
+	(const ptrdiff_t n,          ///< The index of the node.
+	 const Type*const sL_p[NVR], ///< Pointers to the left  solution variables.
+	 const Type*const sR_p[NVR]  ///< Pointers to the right solution variables.
+	);
+
+/** \brief Version of \ref min_abs_real_T which is defined in this file such that it can be inlined in the vectorized
+ *         node loops.
+ *  \return See brief. */
+static FORCE_INLINE Type min_abs_real_inline
+	(const Type a, ///< First value in the comparison.
+	 const Type b  ///< Second value in the comparison.
+	);
+
+/** \brief Version of \ref max_abs_real_T which is defined in this file such that it can be inlined in the vectorized
+ *         node loops.
+ *  \return See brief. */
+static FORCE_INLINE Type max_abs_real_inline
+	(const Type a, ///< First value in the comparison.
+	 const Type b  ///< Second value in the comparison.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 void compute_Numerical_Flux_T_euler_lax_friedrichs
 	(const struct Numerical_Flux_Input_T* num_flux_i, struct mutable_Numerical_Flux_T* num_flux)
 {
-	const ptrdiff_t NnTotal = num_flux_i->bv_l.s->extents[0];
-
-	Type const *const nL = num_flux_i->bv_l.normals->data;
-
-	Type const *const WL = num_flux_i->bv_l.s->data,
-	           *const WR = num_flux_i->bv_r.s->data;
-
-	Type       *const nFluxNum = num_flux->nnf->data;
-
-	Type const *rhoL_ptr  = &WL[NnTotal*0],
-	           *rhouL_ptr = &WL[NnTotal*1],
-	           *EL_ptr    = &WL[NnTotal*(DIM+1)],
-
-	           *rhoR_ptr  = &WR[NnTotal*0],
-	           *rhouR_ptr = &WR[NnTotal*1],
-	           *ER_ptr    = &WR[NnTotal*(DIM+1)];
-
-	Type const *n_ptr = nL;
+	const struct const_Multiarray_T*const sL = num_flux_i->bv_l.s,
+	                               *const sR = num_flux_i->bv_r.s;
+	const ptrdiff_t n_n = sL->extents[0];
 
-	struct Flux_Input_T* flux_i = malloc(sizeof *flux_i); // free
-	flux_i->compute_member = num_flux_i->flux_i->compute_member;
-	flux_i->s = constructor_move_const_Multiarray_T_T('C',2,(ptrdiff_t[]){1,NVR},false,NULL); // destructed
+	assert(num_flux_i->flux_i->compute_member[0]);
+	const bool c_m[4] = { true, false, false, false, };
 
-	struct mutable_Flux_T flux;
-	flux.f = constructor_move_Multiarray_T_T('C',3,(ptrdiff_t[]){1,DIM,NEQ},false,NULL); // destructed
+	const Type* sL_p[NVR] = { NULL },
+	          * sR_p[NVR] = { NULL };
+	for (int vr = 0; vr < NVR; ++vr) {
+		sL_p[vr] = get_col_const_Multiarray_T(vr,sL);
+		sR_p[vr] = get_col_const_Multiarray_T(vr,sR);
+	}
 
-	Type *nF_ptr[NEQ];
+	Type* nnf[NEQ] = { NULL };
 	for (int eq = 0; eq < NEQ; eq++)
-		nF_ptr[eq] = &nFluxNum[eq*NnTotal];
-
-	if (DIM == 3) {
-		Type const *rhovL_ptr = &WL[NnTotal*2],
-		           *rhowL_ptr = &WL[NnTotal*3],
-
-		           *rhovR_ptr = &WR[NnTotal*2],
-		           *rhowR_ptr = &WR[NnTotal*3];
-
-		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           rhovL = *rhovL_ptr++,
-			           rhowL = *rhowL_ptr++,
-			           EL    = *EL_ptr++,
-
-			           rhoL_inv = 1.0/rhoL,
-			           uL = rhouL*rhoL_inv,
-			           vL = rhovL*rhoL_inv,
-			           wL = rhowL*rhoL_inv,
-
-			           V2L = uL*uL+vL*vL+wL*wL,
-			           VL  = sqrt_T(V2L),
-
-			           pL  = GM1*(EL-0.5*rhoL*V2L),
-			           cL  = sqrt_T(GAMMA*pL/rhoL);
-
-			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           rhovR = *rhovR_ptr++,
-			           rhowR = *rhowR_ptr++,
-			           ER    = *ER_ptr++,
-
-			           rhoR_inv = 1.0/rhoR,
-			           uR = rhouR*rhoR_inv,
-			           vR = rhovR*rhoR_inv,
-			           wR = rhowR*rhoR_inv,
-
-			           V2R = uR*uR+vR*vR+wR*wR,
-			           VR  = sqrt_T(V2R),
-
-			           pR  = GM1*(ER-0.5*rhoR*V2R),
-			           cR  = sqrt_T(GAMMA*pR/rhoR);
-
-			Type const maxlL = VL+cL,
-			           maxlR = VR+cR;
-
-			Type maxV;
-			if (real_T(maxlL) > real_T(maxlR))
-				maxV = maxlL;
-			else
-				maxV = maxlR;
-
-			Type const n1 = *n_ptr++,
-			           n2 = *n_ptr++,
-			           n3 = *n_ptr++;
-
-			Type WLn[] = {rhoL, rhouL, rhovL, rhowL, EL};
-			Type FLn[NEQ*DIM] = { 0.0 };
-			const_cast_T1(&flux_i->s->data,WLn);
-			flux.f->data   = FLn;
-			compute_Flux_T_euler(flux_i,&flux);
-
-			Type const *FL1_ptr = FLn,
-			           *FL2_ptr = FL1_ptr+1,
-			           *FL3_ptr = FL2_ptr+1;
-
-			Type WRn[] = {rhoR, rhouR, rhovR, rhowR, ER};
-			Type FRn[NEQ*DIM] = { 0.0 };
-			const_cast_T1(&flux_i->s->data,WRn);
-			flux.f->data   = FRn;
-			compute_Flux_T_euler(flux_i,&flux);
-
-			Type const *FR1_ptr = FRn,
-			           *FR2_ptr = FR1_ptr+1,
-			           *FR3_ptr = FR2_ptr+1;
-
-			for (int eq = 0; eq < NEQ; eq++) {
-				*nF_ptr[eq]++ = 0.5*( n1*((*FL1_ptr)+(*FR1_ptr))+n2*((*FL2_ptr)+(*FR2_ptr))+n3*((*FL3_ptr)+(*FR3_ptr))
-				                     + maxV*(WLn[eq]-WRn[eq]));
-
-				FL1_ptr += DIM;
-				FL2_ptr += DIM;
-				FL3_ptr += DIM;
-				FR1_ptr += DIM;
-				FR2_ptr += DIM;
-				FR3_ptr += DIM;
-			}
-		}
-	} else if (DIM == 2) {
-		Type const *rhovL_ptr = &WL[NnTotal*2],
-
-		           *rhovR_ptr = &WR[NnTotal*2];
-
-		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           rhovL = *rhovL_ptr++,
-			           EL    = *EL_ptr++,
-
-			           rhoL_inv = 1.0/rhoL,
-			           uL = rhouL*rhoL_inv,
-			           vL = rhovL*rhoL_inv,
-
-			           V2L = uL*uL+vL*vL,
-			           VL  = sqrt_T(V2L),
-
-			           pL  = GM1*(EL-0.5*rhoL*V2L),
-			           cL  = sqrt_T(GAMMA*pL/rhoL);
-
-			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           rhovR = *rhovR_ptr++,
-			           ER    = *ER_ptr++,
-
-			           rhoR_inv = 1.0/rhoR,
-			           uR = rhouR*rhoR_inv,
-			           vR = rhovR*rhoR_inv,
-
-			           V2R = uR*uR+vR*vR,
-			           VR  = sqrt_T(V2R),
-
-			           pR  = GM1*(ER-0.5*rhoR*V2R),
-			           cR  = sqrt_T(GAMMA*pR/rhoR);
-
-			Type const maxlL = VL+cL,
-			           maxlR = VR+cR;
-
-			Type maxV;
-			if (real_T(maxlL) > real_T(maxlR))
-				maxV = maxlL;
-			else
-				maxV = maxlR;
-
-			Type const n1 = *n_ptr++,
-			           n2 = *n_ptr++;
-
-			Type WLn[] = {rhoL, rhouL, rhovL, EL};
-			Type FLn[NEQ*DIM] = { 0.0 };
-			const_cast_T1(&flux_i->s->data,WLn);
-			flux.f->data   = FLn;
-			compute_Flux_T_euler(flux_i,&flux);
-
-			Type const *FL1_ptr = FLn,
-			           *FL2_ptr = FL1_ptr+1;
-
-			Type WRn[] = {rhoR, rhouR, rhovR, ER};
-			Type FRn[NEQ*DIM] = { 0.0 };
-			const_cast_T1(&flux_i->s->data,WRn);
-			flux.f->data   = FRn;
-			compute_Flux_T_euler(flux_i,&flux);
-
-			Type const *FR1_ptr = FRn,
-			           *FR2_ptr = FR1_ptr+1;
-
-			for (int eq = 0; eq < NEQ; eq++) {
-				*nF_ptr[eq]++ = 0.5*( n1*((*FL1_ptr)+(*FR1_ptr))+n2*((*FL2_ptr)+(*FR2_ptr)) + maxV*(WLn[eq]-WRn[eq]));
-
-				FL1_ptr += DIM;
-				FL2_ptr += DIM;
-				FR1_ptr += DIM;
-				FR2_ptr += DIM;
-			}
-		}
-	} else if (DIM == 1) {
-		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           EL    = *EL_ptr++,
-
-			           rhoL_inv = 1.0/rhoL,
-			           uL = rhouL*rhoL_inv,
-
-			           V2L = uL*uL,
-			           VL  = sqrt_T(V2L),
-
-			           pL  = GM1*(EL-0.5*rhoL*V2L),
-			           cL  = sqrt_T(GAMMA*pL/rhoL);
-
-			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           ER    = *ER_ptr++,
-
-			           rhoR_inv = 1.0/rhoR,
-			           uR = rhouR*rhoR_inv,
-
-			           V2R = uR*uR,
-			           VR  = sqrt_T(V2R),
-
-			           pR  = GM1*(ER-0.5*rhoR*V2R),
-			           cR  = sqrt_T(GAMMA*pR/rhoR);
-
-			Type const maxlL = VL+cL,
-			           maxlR = VR+cR;
-
-			Type maxV;
-			if (real_T(maxlL) > real_T(maxlR))
-				maxV = maxlL;
-			else
-				maxV = maxlR;
-
-			Type const n1 = *n_ptr++;
-
-			Type WLn[] = {rhoL, rhouL, EL};
-			Type FLn[NEQ*DIM] = { 0.0 };
-			const_cast_T1(&flux_i->s->data,WLn);
-			flux.f->data   = FLn;
-			compute_Flux_T_euler(flux_i,&flux);
-
-			Type const *FL1_ptr = FLn;
-
-			Type WRn[] = {rhoR, rhouR, ER};
-			Type FRn[NEQ*DIM] = { 0.0 };
-			const_cast_T1(&flux_i->s->data,WRn);
-			flux.f->data   = FRn;
-			compute_Flux_T_euler(flux_i,&flux);
+		nnf[eq] = get_col_Multiarray_T(eq,num_flux->nnf);
 
-			Type const *FR1_ptr = FRn;
+	// The physical fluxes are computed for all face nodes at once such that the batched kernels can be used.
+	struct Flux_Input_T flux_i =
+		{ .compute_member = c_m, .n_eq = NEQ, .n_var = NVR, .s = sL, .compute_Flux = compute_Flux_T_euler, };
+	struct Flux_T*const fluxL = constructor_Flux_T(&flux_i); // destructed
+	flux_i.s = sR;
+	struct Flux_T*const fluxR = constructor_Flux_T(&flux_i); // destructed
 
-			for (int eq = 0; eq < NEQ; eq++) {
-				*nF_ptr[eq]++ = 0.5*(n1*((*FL1_ptr)+(*FR1_ptr)) + maxV*(WLn[eq]-WRn[eq]));
+	const struct const_Multiarray_T*const normals = num_flux_i->bv_l.normals;
+	const Type*const fL = fluxL->f->data,
+	          *const fR = fluxR->f->data;
+	for (ptrdiff_t n = 0; n < n_n; ++n) {
+		const Type maxV = compute_max_wave_speed(n,sL_p,sR_p);
 
-				FL1_ptr += DIM;
-				FR1_ptr += DIM;
+		const Type*const n_l = get_row_const_Multiarray_T(n,normals);
+		for (int eq = 0; eq < NEQ; ++eq) {
+			Type nf = 0.0;
+			for (int d = 0; d < DIM; ++d) {
+				const ptrdiff_t ind_f = n+n_n*(d+DIM*eq);
+				nf += n_l[d]*(fL[ind_f]+fR[ind_f]);
 			}
+			nnf[eq][n] = 0.5*(nf + maxV*(sL_p[eq][n]-sR_p[eq][n]));
 		}
 	}
-	destructor_const_Multiarray_T(flux_i->s);
-	destructor_Multiarray_T(flux.f);
-	free(flux_i);
+
+	destructor_Flux_T(fluxL);
+	destructor_Flux_T(fluxR);
 }
 
 void compute_Numerical_Flux_T_euler_lax_friedrichs_jacobian
@@ -362,12 +166,17 @@ void compute_Numerical_Flux_T_euler_lax_friedrichs_jacobian
 
 	assert(!c_m[3]); // Add support for Hessian terms if desired.
 
-	struct Flux_Input_T flux_i = { .compute_member = c_m, };
-	flux_i.s = constructor_move_const_Multiarray_T_T('C',2,(ptrdiff_t[]){1,NVR},false,NULL); // destructed
+	// The physical fluxes are computed for all face nodes at once such that the batched kernels can be used.
+	struct Flux_Input_T flux_i =
+		{ .compute_member = c_m, .n_eq = NEQ, .n_var = NVR, .s = sL, .compute_Flux = compute_Flux_T_euler, };
+	struct Flux_T*const fluxL = constructor_Flux_T(&flux_i); // destructed
+	flux_i.s = sR;
+	struct Flux_T*const fluxR = constructor_Flux_T(&flux_i); // destructed
 
-	struct mutable_Flux_T flux;
-	flux.f     = constructor_move_Multiarray_T_T('C',3,(ptrdiff_t[]){1,DIM,NEQ},false,NULL);      // destructed
-	flux.df_ds = constructor_move_Multiarray_T_T('C',4,(ptrdiff_t[]){1,DIM,NEQ,NVAR},false,NULL); // destructed
+	const Type*const fL      = fluxL->f->data,
+	          *const fR      = fluxR->f->data,
+	          *const dfL_dsL = fluxL->df_ds->data,
+	          *const dfR_dsR = fluxR->df_ds->data;
 
 	const struct const_Multiarray_T*const nL_p = num_flux_i->bv_l.normals;
 
@@ -393,24 +202,8 @@ void compute_Numerical_Flux_T_euler_lax_friedrichs_jacobian
 		           pR        = GM1*(ER-0.5*rhoR*V2R),
 		           cR        = sqrt_T(GAMMA*pR/rhoR);
 
-		const Type sL_n[] = ARRAY_VAR(rhoL, rhouvwL[0], rhouvwL[1], rhouvwL[2], EL);
-		const_cast_T1(&flux_i.s->data,sL_n);
-
-		Type fL_n[DIM*NEQ]          = {0.0};
-		Type dfL_dsL_n[DIM*NEQ*NVR] = {0.0};
-		flux.f->data     = fL_n;
-		flux.df_ds->data = dfL_dsL_n;
-		compute_Flux_T_euler(&flux_i,&flux);
-
-		const Type sR_n[] = ARRAY_VAR(rhoR, rhouvwR[0], rhouvwR[1], rhouvwR[2], ER);
-		const_cast_T1(&flux_i.s->data,sR_n);
-
-		Type fR_n[DIM*NEQ]          = {0.0};
-		Type dfR_dsR_n[DIM*NEQ*NVR] = {0.0};
-		flux.f->data     = fR_n;
-		flux.df_ds->data = dfR_dsR_n;
-		compute_Flux_T_euler(&flux_i,&flux);
-
+		const Type sL_n[] = ARRAY_VAR(rhoL, rhouvwL[0], rhouvwL[1], rhouvwL[2], EL),
+		           sR_n[] = ARRAY_VAR(rhoR, rhouvwR[0], rhouvwR[1], rhouvwR[2], ER);
 
 		Type const maxlL = VL+cL,
 		           maxlR = VR+cR;
@@ -428,8 +221,8 @@ void compute_Numerical_Flux_T_euler_lax_friedrichs_jacobian
 
 		for (int eq = 0; eq < NEQ; ++eq) {
 			for (int d = 0; d < DIM; ++d) {
-				const int ind_f = d+DIM*eq;
-				nnf[eq][n] += nL[d]*(fL_n[ind_f]+fR_n[ind_f]);
+				const ptrdiff_t ind_f = n+n_n*(d+DIM*eq);
+				nnf[eq][n] += nL[d]*(fL[ind_f]+fR[ind_f]);
 			}
 			nnf[eq][n] += maxV*(sL_n[eq]-sR_n[eq]);
 			nnf[eq][n] *= 0.5;
@@ -443,9 +236,9 @@ void compute_Numerical_Flux_T_euler_lax_friedrichs_jacobian
 		for (int eq = 0; eq < NEQ; ++eq) {
 			const int ind_dnnf = eq+NEQ*(vr);
 			for (int d = 0; d < DIM; ++d) {
-				const int ind_f = d+DIM*ind_dnnf;
-				dnnf_dsL[ind_dnnf][n] += nL[d]*(dfL_dsL_n[ind_f]);
-				dnnf_dsR[ind_dnnf][n] += nL[d]*(dfR_dsR_n[ind_f]);
+				const ptrdiff_t ind_f = n+n_n*(d+DIM*ind_dnnf);
+				dnnf_dsL[ind_dnnf][n] += nL[d]*(dfL_dsL[ind_f]);
+				dnnf_dsR[ind_dnnf][n] += nL[d]*(dfR_dsR[ind_f]);
 			}
 
 			if (use_left)
@@ -462,9 +255,8 @@ void compute_Numerical_Flux_T_euler_lax_friedrichs_jacobian
 		}}
 	}
 
-	destructor_const_Multiarray_T(flux_i.s);
-	destructor_Multiarray_T(flux.f);
-	destructor_Multiarray_T(flux.df_ds);
+	destructor_Flux_T(fluxL);
+	destructor_Flux_T(fluxR);
 }
 
 void compute_Numerical_Flux_T_euler_roe_pike
@@ -481,38 +273,39 @@ void compute_Numerical_Flux_T_euler_roe_pike
 
 	Type       *const nFluxNum = num_flux->nnf->data;
 
-	Type const *rhoL_ptr  = &WL[NnTotal*0],
-	           *rhouL_ptr = &WL[NnTotal*1],
-	           *EL_ptr    = &WL[NnTotal*(DIM+1)],
+	Type const *const rhoL_ptr  = &WL[NnTotal*0],
+	           *const rhouL_ptr = &WL[NnTotal*1],
+	           *const EL_ptr    = &WL[NnTotal*(DIM+1)],
 
-	           *rhoR_ptr  = &WR[NnTotal*0],
-	           *rhouR_ptr = &WR[NnTotal*1],
-	           *ER_ptr    = &WR[NnTotal*(DIM+1)];
+	           *const rhoR_ptr  = &WR[NnTotal*0],
+	           *const rhouR_ptr = &WR[NnTotal*1],
+	           *const ER_ptr    = &WR[NnTotal*(DIM+1)];
 
-	Type const *n_ptr = nL;
+	Type const *const n_ptr = nL;
 
 	Type *nF_ptr[NEQ];
 	for (int eq = 0; eq < NEQ; eq++)
 		nF_ptr[eq] = &nFluxNum[eq*NnTotal];
 
 	if (DIM == 3) {
-		Type const *rhovL_ptr = &WL[NnTotal*2],
-		           *rhowL_ptr = &WL[NnTotal*3],
+		Type const *const rhovL_ptr = &WL[NnTotal*2],
+		           *const rhowL_ptr = &WL[NnTotal*3],
 
-		           *rhovR_ptr = &WR[NnTotal*2],
-		           *rhowR_ptr = &WR[NnTotal*3];
+		           *const rhovR_ptr = &WR[NnTotal*2],
+		           *const rhowR_ptr = &WR[NnTotal*3];
 
+		PRAGMA_OMP(simd)
 		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			Type const n1 = *n_ptr++,
-			           n2 = *n_ptr++,
-			           n3 = *n_ptr++;
+			Type const n1 = n_ptr[n*DIM+0],
+			           n2 = n_ptr[n*DIM+1],
+			           n3 = n_ptr[n*DIM+2];
 
 			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           rhovL = *rhovL_ptr++,
-			           rhowL = *rhowL_ptr++,
-			           EL    = *EL_ptr++,
+			Type const rhoL  = rhoL_ptr[n],
+			           rhouL = rhouL_ptr[n],
+			           rhovL = rhovL_ptr[n],
+			           rhowL = rhowL_ptr[n],
+			           EL    = EL_ptr[n],
 
 			           rhoL_inv  = 1.0/rhoL,
 			           uL = rhouL*rhoL_inv,
@@ -526,11 +319,11 @@ void compute_Numerical_Flux_T_euler_roe_pike
 			           HL  = (EL+pL)*rhoL_inv;
 
 			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           rhovR = *rhovR_ptr++,
-			           rhowR = *rhowR_ptr++,
-			           ER    = *ER_ptr++,
+			Type const rhoR  = rhoR_ptr[n],
+			           rhouR = rhouR_ptr[n],
+			           rhovR = rhovR_ptr[n],
+			           rhowR = rhowR_ptr[n],
+			           ER    = ER_ptr[n],
 
 			           rhoR_inv  = 1.0/rhoR,
 			           uR = rhouR*rhoR_inv,
@@ -558,8 +351,8 @@ void compute_Numerical_Flux_T_euler_roe_pike
 			           c   = sqrt_T(c2);
 
 			// Compute eigenvalues (with entropy fix)
-			const Type l1   = min_abs_real_T(VnL-c,Vn-c),
-			           l5   = max_abs_real_T(VnR+c,Vn+c),
+			const Type l1   = min_abs_real_inline(VnL-c,Vn-c),
+			           l5   = max_abs_real_inline(VnR+c,Vn+c),
 			           l234 = ( real_T(Vn) > 0.0 ? Vn : -Vn );
 
 			Type const drho  = rhoR-rhoL,
@@ -595,26 +388,27 @@ void compute_Numerical_Flux_T_euler_roe_pike
 
 			// Assemble components
 			int IndnF = 0;
-			*nF_ptr[IndnF++]++ = 0.5*(nF1 - dis1);
-			*nF_ptr[IndnF++]++ = 0.5*(nF2 - dis2);
-			*nF_ptr[IndnF++]++ = 0.5*(nF3 - dis3);
-			*nF_ptr[IndnF++]++ = 0.5*(nF4 - dis4);
-			*nF_ptr[IndnF++]++ = 0.5*(nF5 - dis5);
+			nF_ptr[IndnF++][n] = 0.5*(nF1 - dis1);
+			nF_ptr[IndnF++][n] = 0.5*(nF2 - dis2);
+			nF_ptr[IndnF++][n] = 0.5*(nF3 - dis3);
+			nF_ptr[IndnF++][n] = 0.5*(nF4 - dis4);
+			nF_ptr[IndnF++][n] = 0.5*(nF5 - dis5);
 		}
 	} else if (DIM == 2) {
-		Type const *rhovL_ptr = &WL[NnTotal*2],
+		Type const *const rhovL_ptr = &WL[NnTotal*2],
 
-		           *rhovR_ptr = &WR[NnTotal*2];
+		           *const rhovR_ptr = &WR[NnTotal*2];
 
+		PRAGMA_OMP(simd)
 		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			Type const n1 = *n_ptr++,
-			           n2 = *n_ptr++;
+			Type const n1 = n_ptr[n*DIM+0],
+			           n2 = n_ptr[n*DIM+1];
 
 			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           rhovL = *rhovL_ptr++,
-			           EL    = *EL_ptr++,
+			Type const rhoL  = rhoL_ptr[n],
+			           rhouL = rhouL_ptr[n],
+			           rhovL = rhovL_ptr[n],
+			           EL    = EL_ptr[n],
 
 			           rhoL_inv  = 1.0/rhoL,
 			           uL = rhouL*rhoL_inv,
@@ -627,10 +421,10 @@ void compute_Numerical_Flux_T_euler_roe_pike
 			           HL  = (EL+pL)*rhoL_inv;
 
 			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           rhovR = *rhovR_ptr++,
-			           ER    = *ER_ptr++,
+			Type const rhoR  = rhoR_ptr[n],
+			           rhouR = rhouR_ptr[n],
+			           rhovR = rhovR_ptr[n],
+			           ER    = ER_ptr[n],
 
 			           rhoR_inv  = 1.0/rhoR,
 			           uR = rhouR*rhoR_inv,
@@ -655,8 +449,8 @@ void compute_Numerical_Flux_T_euler_roe_pike
 			           c   = sqrt_T(c2);
 
 			// Compute eigenvalues (with entropy fix)
-			const Type l1   = min_abs_real_T(VnL-c,Vn-c),
-			           l5   = max_abs_real_T(VnR+c,Vn+c),
+			const Type l1   = min_abs_real_inline(VnL-c,Vn-c),
+			           l5   = max_abs_real_inline(VnR+c,Vn+c),
 			           l234 = ( real_T(Vn) > 0.0 ? Vn : -Vn );
 
 			Type const drho  = rhoR-rhoL,
@@ -689,19 +483,20 @@ void compute_Numerical_Flux_T_euler_roe_pike
 
 			// Assemble components
 			int IndnF = 0;
-			*nF_ptr[IndnF++]++ = 0.5*(nF1 - dis1);
-			*nF_ptr[IndnF++]++ = 0.5*(nF2 - dis2);
-			*nF_ptr[IndnF++]++ = 0.5*(nF3 - dis3);
-			*nF_ptr[IndnF++]++ = 0.5*(nF5 - dis5);
+			nF_ptr[IndnF++][n] = 0.5*(nF1 - dis1);
+			nF_ptr[IndnF++][n] = 0.5*(nF2 - dis2);
+			nF_ptr[IndnF++][n] = 0.5*(nF3 - dis3);
+			nF_ptr[IndnF++][n] = 0.5*(nF5 - dis5);
 		}
 	} else if (DIM == 1) {
+		PRAGMA_OMP(simd)
 		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			Type const n1 = *n_ptr++;
+			Type const n1 = n_ptr[n*DIM+0];
 
 			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           EL    = *EL_ptr++,
+			Type const rhoL  = rhoL_ptr[n],
+			           rhouL = rhouL_ptr[n],
+			           EL    = EL_ptr[n],
 
 			           rhoL_inv  = 1.0/rhoL,
 			           uL = rhouL*rhoL_inv,
@@ -713,9 +508,9 @@ void compute_Numerical_Flux_T_euler_roe_pike
 			           HL  = (EL+pL)*rhoL_inv;
 
 			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           ER    = *ER_ptr++,
+			Type const rhoR  = rhoR_ptr[n],
+			           rhouR = rhouR_ptr[n],
+			           ER    = ER_ptr[n],
 
 			           rhoR_inv  = 1.0/rhoR,
 			           uR = rhouR*rhoR_inv,
@@ -739,8 +534,8 @@ void compute_Numerical_Flux_T_euler_roe_pike
 			           c   = sqrt_T(c2);
 
 			// Compute eigenvalues (with entropy fix)
-			const Type l1   = min_abs_real_T(VnL-c,Vn-c),
-			           l5   = max_abs_real_T(VnR+c,Vn+c),
+			const Type l1   = min_abs_real_inline(VnL-c,Vn-c),
+			           l5   = max_abs_real_inline(VnR+c,Vn+c),
 			           l234 = ( real_T(Vn) > 0.0 ? Vn : -Vn );
 
 			Type const drho  = rhoR-rhoL,
@@ -770,9 +565,9 @@ void compute_Numerical_Flux_T_euler_roe_pike
 
 			// Assemble components
 			int IndnF = 0;
-			*nF_ptr[IndnF++]++ = 0.5*(nF1 - dis1);
-			*nF_ptr[IndnF++]++ = 0.5*(nF2 - dis2);
-			*nF_ptr[IndnF++]++ = 0.5*(nF5 - dis5);
+			nF_ptr[IndnF++][n] = 0.5*(nF1 - dis1);
+			nF_ptr[IndnF++][n] = 0.5*(nF2 - dis2);
+			nF_ptr[IndnF++][n] = 0.5*(nF5 - dis5);
 		}
 	}
 }
@@ -793,15 +588,15 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 	     *const dnFdWL   = num_flux->neigh_info[0].dnnf_ds->data,
 	     *const dnFdWR   = num_flux->neigh_info[1].dnnf_ds->data;
 
-	Type const *rhoL_ptr  = &WL[NnTotal*0],
-	           *rhouL_ptr = &WL[NnTotal*1],
-	           *EL_ptr    = &WL[NnTotal*(DIM+1)],
+	Type const *const rhoL_ptr  = &WL[NnTotal*0],
+	           *const rhouL_ptr = &WL[NnTotal*1],
+	           *const EL_ptr    = &WL[NnTotal*(DIM+1)],
 
-	           *rhoR_ptr  = &WR[NnTotal*0],
-	           *rhouR_ptr = &WR[NnTotal*1],
-	           *ER_ptr    = &WR[NnTotal*(DIM+1)];
+	           *const rhoR_ptr  = &WR[NnTotal*0],
+	           *const rhouR_ptr = &WR[NnTotal*1],
+	           *const ER_ptr    = &WR[NnTotal*(DIM+1)];
 
-	Type const *n_ptr = nL;
+	Type const *const n_ptr = nL;
 
 	Type *nF_ptr[NEQ];
 	if (nFluxNum != NULL) {
@@ -825,23 +620,23 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 	}
 
 	if (DIM == 3) {
-		Type const *rhovL_ptr = &WL[NnTotal*2],
-		           *rhowL_ptr = &WL[NnTotal*3],
+		Type const *const rhovL_ptr = &WL[NnTotal*2],
+		           *const rhowL_ptr = &WL[NnTotal*3],
 
-		           *rhovR_ptr = &WR[NnTotal*2],
-		           *rhowR_ptr = &WR[NnTotal*3];
+		           *const rhovR_ptr = &WR[NnTotal*2],
+		           *const rhowR_ptr = &WR[NnTotal*3];
 
 		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			Type const n1 = *n_ptr++,
-			           n2 = *n_ptr++,
-			           n3 = *n_ptr++;
+			Type const n1 = n_ptr[n*DIM+0],
+			           n2 = n_ptr[n*DIM+1],
+			           n3 = n_ptr[n*DIM+2];
 
 			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           rhovL = *rhovL_ptr++,
-			           rhowL = *rhowL_ptr++,
-			           EL    = *EL_ptr++,
+			Type const rhoL  = rhoL_ptr[n],
+			           rhouL = rhouL_ptr[n],
+			           rhovL = rhovL_ptr[n],
+			           rhowL = rhowL_ptr[n],
+			           EL    = EL_ptr[n],
 
 			           rhoL_inv  = 1.0/rhoL,
 			           rhoLr_inv = sqrt_T(rhoL_inv),
@@ -856,11 +651,11 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 			           HL  = (EL+pL)*rhoL_inv;
 
 			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           rhovR = *rhovR_ptr++,
-			           rhowR = *rhowR_ptr++,
-			           ER    = *ER_ptr++,
+			Type const rhoR  = rhoR_ptr[n],
+			           rhouR = rhouR_ptr[n],
+			           rhovR = rhovR_ptr[n],
+			           rhowR = rhowR_ptr[n],
+			           ER    = ER_ptr[n],
 
 			           rhoR_inv  = 1.0/rhoR,
 			           rhoRr_inv = sqrt_T(rhoR_inv),
@@ -962,11 +757,11 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 
 				// Assemble components
 				int IndnF = 0;
-				*nF_ptr[IndnF++]++ = 0.5*(nF1 - dis1);
-				*nF_ptr[IndnF++]++ = 0.5*(nF2 - dis2);
-				*nF_ptr[IndnF++]++ = 0.5*(nF3 - dis3);
-				*nF_ptr[IndnF++]++ = 0.5*(nF4 - dis4);
-				*nF_ptr[IndnF++]++ = 0.5*(nF5 - dis5);
+				nF_ptr[IndnF++][n] = 0.5*(nF1 - dis1);
+				nF_ptr[IndnF++][n] = 0.5*(nF2 - dis2);
+				nF_ptr[IndnF++][n] = 0.5*(nF3 - dis3);
+				nF_ptr[IndnF++][n] = 0.5*(nF4 - dis4);
+				nF_ptr[IndnF++][n] = 0.5*(nF5 - dis5);
 			}
 
 			Type dnF1dW[NEQ],  dnF2dW[NEQ],  dnF3dW[NEQ],  dnF4dW[NEQ],  dnF5dW[NEQ],
@@ -1040,11 +835,11 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 			}
 
 			int InddnFdW = 0;
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF1dW[var]-ddis1dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF2dW[var]-ddis2dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF3dW[var]-ddis3dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF4dW[var]-ddis4dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF5dW[var]-ddis5dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF1dW[var]-ddis1dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF2dW[var]-ddis2dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF3dW[var]-ddis3dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF4dW[var]-ddis4dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF5dW[var]-ddis5dW[var]);
 
 			if (dnFdWR != NULL) {
 				// Flux term
@@ -1115,27 +910,27 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 				}
 
 				int InddnFdW = 0;
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF1dW[var]-ddis1dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF2dW[var]-ddis2dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF3dW[var]-ddis3dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF4dW[var]-ddis4dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF5dW[var]-ddis5dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF1dW[var]-ddis1dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF2dW[var]-ddis2dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF3dW[var]-ddis3dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF4dW[var]-ddis4dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF5dW[var]-ddis5dW[var]);
 			}
 		}
 	} else if (DIM == 2) {
-		Type const *rhovL_ptr = &WL[NnTotal*2],
+		Type const *const rhovL_ptr = &WL[NnTotal*2],
 
-		             *rhovR_ptr = &WR[NnTotal*2];
+		             *const rhovR_ptr = &WR[NnTotal*2];
 
 		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			Type const n1 = *n_ptr++,
-			           n2 = *n_ptr++;
+			Type const n1 = n_ptr[n*DIM+0],
+			           n2 = n_ptr[n*DIM+1];
 
 			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           rhovL = *rhovL_ptr++,
-			           EL    = *EL_ptr++,
+			Type const rhoL  = rhoL_ptr[n],
+			           rhouL = rhouL_ptr[n],
+			           rhovL = rhovL_ptr[n],
+			           EL    = EL_ptr[n],
 
 			           rhoL_inv  = 1.0/rhoL,
 			           rhoLr_inv = sqrt_T(rhoL_inv),
@@ -1149,10 +944,10 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 			           HL  = (EL+pL)*rhoL_inv;
 
 			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           rhovR = *rhovR_ptr++,
-			           ER    = *ER_ptr++,
+			Type const rhoR  = rhoR_ptr[n],
+			           rhouR = rhouR_ptr[n],
+			           rhovR = rhovR_ptr[n],
+			           ER    = ER_ptr[n],
 
 			           rhoR_inv  = 1.0/rhoR,
 			           rhoRr_inv = sqrt_T(rhoR_inv),
@@ -1249,10 +1044,10 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 
 				// Assemble components
 				int IndnF = 0;
-				*nF_ptr[IndnF++]++ = 0.5*(nF1 - dis1);
-				*nF_ptr[IndnF++]++ = 0.5*(nF2 - dis2);
-				*nF_ptr[IndnF++]++ = 0.5*(nF3 - dis3);
-				*nF_ptr[IndnF++]++ = 0.5*(nF5 - dis5);
+				nF_ptr[IndnF++][n] = 0.5*(nF1 - dis1);
+				nF_ptr[IndnF++][n] = 0.5*(nF2 - dis2);
+				nF_ptr[IndnF++][n] = 0.5*(nF3 - dis3);
+				nF_ptr[IndnF++][n] = 0.5*(nF5 - dis5);
 			}
 
 			Type dnF1dW[NEQ],  dnF2dW[NEQ],  dnF3dW[NEQ],  dnF5dW[NEQ],
@@ -1321,10 +1116,10 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 			}
 
 			int InddnFdW = 0;
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF1dW[var]-ddis1dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF2dW[var]-ddis2dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF3dW[var]-ddis3dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF5dW[var]-ddis5dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF1dW[var]-ddis1dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF2dW[var]-ddis2dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF3dW[var]-ddis3dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF5dW[var]-ddis5dW[var]);
 
 			if (dnFdWR != NULL) {
 				// Flux term
@@ -1390,20 +1185,20 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 				}
 
 				int InddnFdW = 0;
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF1dW[var]-ddis1dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF2dW[var]-ddis2dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF3dW[var]-ddis3dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF5dW[var]-ddis5dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF1dW[var]-ddis1dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF2dW[var]-ddis2dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF3dW[var]-ddis3dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF5dW[var]-ddis5dW[var]);
 			}
 		}
 	} else if (DIM == 1) {
 		for (ptrdiff_t n = 0; n < NnTotal; n++) {
-			Type const n1 = *n_ptr++;
+			Type const n1 = n_ptr[n*DIM+0];
 
 			// Left VOLUME
-			Type const rhoL  = *rhoL_ptr++,
-			           rhouL = *rhouL_ptr++,
-			           EL    = *EL_ptr++,
+			Type const rhoL  = rhoL_ptr[n],
+			           rhouL = rhouL_ptr[n],
+			           EL    = EL_ptr[n],
 
 			           rhoL_inv  = 1.0/rhoL,
 			           rhoLr_inv = sqrt_T(rhoL_inv),
@@ -1416,9 +1211,9 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 			           HL  = (EL+pL)*rhoL_inv;
 
 			// Right VOLUME
-			Type const rhoR  = *rhoR_ptr++,
-			           rhouR = *rhouR_ptr++,
-			           ER    = *ER_ptr++,
+			Type const rhoR  = rhoR_ptr[n],
+			           rhouR = rhouR_ptr[n],
+			           ER    = ER_ptr[n],
 
 			           rhoR_inv  = 1.0/rhoR,
 			           rhoRr_inv = sqrt_T(rhoR_inv),
@@ -1510,9 +1305,9 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 
 				// Assemble components
 				int IndnF = 0;
-				*nF_ptr[IndnF++]++ = 0.5*(nF1 - dis1);
-				*nF_ptr[IndnF++]++ = 0.5*(nF2 - dis2);
-				*nF_ptr[IndnF++]++ = 0.5*(nF5 - dis5);
+				nF_ptr[IndnF++][n] = 0.5*(nF1 - dis1);
+				nF_ptr[IndnF++][n] = 0.5*(nF2 - dis2);
+				nF_ptr[IndnF++][n] = 0.5*(nF5 - dis5);
 			}
 
 			Type dnF1dW[NEQ],  dnF2dW[NEQ],  dnF5dW[NEQ],
@@ -1576,9 +1371,9 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 			}
 
 			int InddnFdW = 0;
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF1dW[var]-ddis1dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF2dW[var]-ddis2dW[var]);
-			for (int var = 0; var < NVAR; var++) *dnFdWL_ptr[InddnFdW++]++ = 0.5*(dnF5dW[var]-ddis5dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF1dW[var]-ddis1dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF2dW[var]-ddis2dW[var]);
+			for (int var = 0; var < NVAR; var++) dnFdWL_ptr[InddnFdW++][n] = 0.5*(dnF5dW[var]-ddis5dW[var]);
 
 			if (dnFdWR != NULL) {
 				// Flux term
@@ -1639,9 +1434,9 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 				}
 
 				int InddnFdW = 0;
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF1dW[var]-ddis1dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF2dW[var]-ddis2dW[var]);
-				for (int var = 0; var < NVAR; var++) *dnFdWR_ptr[InddnFdW++]++ = 0.5*(dnF5dW[var]-ddis5dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF1dW[var]-ddis1dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF2dW[var]-ddis2dW[var]);
+				for (int var = 0; var < NVAR; var++) dnFdWR_ptr[InddnFdW++][n] = 0.5*(dnF5dW[var]-ddis5dW[var]);
 			}
 		}
 	}
@@ -1650,10 +1445,43 @@ void compute_Numerical_Flux_T_euler_roe_pike_jacobian
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
+static FORCE_INLINE Type min_abs_real_inline (const Type a, const Type b)
+{
+	const Type c = ( abs_T(a) < abs_T(b) ? a : b );
+	return ( real_T(c) < 0.0 ? -c : c );
+}
+
+static FORCE_INLINE Type max_abs_real_inline (const Type a, const Type b)
+{
+	const Type c = ( abs_T(a) > abs_T(b) ? a : b );
+	return ( real_T(c) < 0.0 ? -c : c );
+}
+
+static Type compute_max_wave_speed (const ptrdiff_t n, const Type*const sL_p[NVR], const Type*const sR_p[NVR])
+{
+	const Type*const*const s_p[2] = { sL_p, sR_p, };
+
+	Type max_l[2] = { 0.0, 0.0, };
+	for (int i = 0; i < 2; ++i) {
+		const Type rho     = s_p[i][0][n],
+		           rho_inv = 1.0/rho,
+		           E       = s_p[i][NVR-1][n];
+
+		Type V2 = 0.0;
+		for (int d = 0; d < DIM; ++d)
+			V2 += s_p[i][d+1][n]*s_p[i][d+1][n];
+		V2 *= rho_inv*rho_inv;
+
+		const Type p = GM1*(E-0.5*rho*V2);
+		max_l[i] = sqrt_T(V2)+sqrt_T(GAMMA*p/rho);
+	}
+	return ( real_T(max_l[0]) > real_T(max_l[1]) ? max_l[0] : max_l[1] );
+}
+
 static const Type* compute_dmaxV_ds
 	(const Type rho_inv, const Type p, const Type V2, const Type V, const Type c, const Type*const uvw)
 {
-	static Type dmaxV_ds[NVR];
+	static _Thread_local Type dmaxV_ds[NVR];
 
 	const Type drho_inv_ds[NVR] = ARRAY_VAR(-rho_inv*rho_inv, 0.0, 0.0, 0.0, 0.0 );
 	Type dp_ds[NVR]             = ARRAY_VAR(0.5*V2, -uvw[0], -uvw[1], -uvw[2], 1.0 );
@@ -75,3 +75,6 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef compute_Numerical_Flux_T_central_jacobian
 #undef set_Numerical_Flux_Energy_member
 #undef compute_dmaxV_ds
+#undef compute_max_wave_speed
+#undef min_abs_real_inline
+#undef max_abs_real_inline
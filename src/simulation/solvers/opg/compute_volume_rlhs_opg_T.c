@@ -20,6 +20,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdio.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_intrusive.h"
 
 
@@ -107,11 +108,13 @@ void compute_volume_rlhs_opg_T
 	for (struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next) {
 		struct Solver_Volume_T*const s_vol = (struct Solver_Volume_T*) curr;
 
+		const struct Scratch_Scope scope = open_scratch_scope();
 		struct Flux_Ref_T* flux_r = constructor_Flux_Ref_vol_opg_T(flux_i,s_vol); // destructed
 
 		// Compute the rhs and the lhs terms.
 		s_params.compute_rlhs(flux_r,s_vol,ssi);
 		destructor_Flux_Ref_T(flux_r);
+		close_scratch_scope(scope);
 	}
 	destructor_Flux_Input_T(flux_i);
 }
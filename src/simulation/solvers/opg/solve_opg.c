@@ -36,6 +36,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solve.h"
 #include "solve_implicit.h"
@@ -79,7 +80,11 @@ static PetscErrorCode convert_petsc_to_c0_opg
 double compute_rlhs_opg (const struct Simulation*const sim, struct Solver_Storage_Implicit*const ssi)
 {
 	initialize_zero_memory_volumes(sim->volumes);
+	start_profile(PROF_VOLUME_RLHS);
 	compute_volume_rlhs_opg(sim,ssi,sim->volumes);
+	stop_profile(PROF_VOLUME_RLHS);
+
+	start_profile(PROF_FACE_RLHS);
 	switch (get_set_method(NULL)) {
 	case METHOD_OPG:
 		compute_face_rlhs_opg(sim,ssi,sim->faces);
@@ -91,6 +96,7 @@ double compute_rlhs_opg (const struct Simulation*const sim, struct Solver_Storag
 		EXIT_ERROR("Unsupported: %d\n",get_set_method(NULL));
 		break;
 	}
+	stop_profile(PROF_FACE_RLHS);
 
 	compute_source_rhs_dg_like(sim);
 	fill_petsc_Vec_b_opg(sim,ssi);
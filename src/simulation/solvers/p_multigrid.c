@@ -0,0 +1,405 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "p_multigrid.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include "petscksp.h"
+#include "petscmat.h"
+#include "gsl/gsl_math.h"
+
+#include "macros.h"
+#include "definitions_test_case.h"
+
+#include "element_solver.h"
+#include "volume_solver.h"
+
+#include "matrix.h"
+#include "multiarray.h"
+
+#include "intrusive.h"
+#include "multiarray_operator.h"
+#include "operator.h"
+#include "partition.h"
+#include "simulation.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define N_SMOOTH_PMG 2 ///< The number of pre- and post-smoothing iterations on each of the finer levels.
+
+/** \brief Return the number of levels of the p-multigrid hierarchy.
+ *  \return See brief. */
+static int compute_n_levels
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Return the reference order of the coarsest level of the p-multigrid hierarchy.
+ *  \return See brief.
+ *
+ *  This is the lowest order for which the \ref Adaptation_Element::cc0_vs_vs operators are stored (see
+ *  \ref OP_R_P_LPM1).
+ */
+static int compute_p_min_level
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Constructor for the Petsc `Mat` holding the prolongation operator from the input level to the next finer
+ *         level.
+ *  \return See brief. */
+static Mat constructor_petsc_mat_prolong
+	(const int level_c,                ///< The index of the coarse level (0 for the coarsest level).
+	 const int n_levels,               ///< The number of levels.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Set up the smoother for the input level.
+ *  \return Petsc error code. */
+static PetscErrorCode set_up_smoother
+	(KSP smoother,                     ///< The Petsc `KSP` context of the smoother.
+	 const int level,                  ///< The index of the level.
+	 const int n_levels,               ///< The number of levels.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+PetscErrorCode set_up_pc_p_multigrid (PC pc, const struct Simulation*const sim)
+{
+	assert(sim->method == METHOD_DG);
+	const int n_levels = compute_n_levels(sim);
+
+	CHKERRQ(PCSetType(pc,PCMG));
+	CHKERRQ(PCMGSetLevels(pc,n_levels,NULL));
+	CHKERRQ(PCMGSetType(pc,PC_MG_MULTIPLICATIVE));
+	CHKERRQ(PCMGSetGalerkin(pc,PC_MG_GALERKIN_BOTH));
+
+	for (int level = 1; level < n_levels; ++level) {
+		Mat prolong = constructor_petsc_mat_prolong(level-1,n_levels,sim); // destructed
+		CHKERRQ(PCMGSetInterpolation(pc,level,prolong));
+		CHKERRQ(MatDestroy(&prolong)); // A reference is kept by the PC.
+
+		KSP smoother;
+		CHKERRQ(PCMGGetSmoother(pc,level,&smoother));
+		CHKERRQ(set_up_smoother(smoother,level,n_levels,sim));
+	}
+	CHKERRQ(PCMGSetNumberSmooth(pc,N_SMOOTH_PMG));
+
+	KSP ksp_c;
+	PC pc_c;
+	CHKERRQ(PCMGGetCoarseSolve(pc,&ksp_c));
+	CHKERRQ(KSPSetType(ksp_c,KSPPREONLY));
+	CHKERRQ(KSPGetPC(ksp_c,&pc_c));
+	CHKERRQ(PCSetType(pc_c,PCLU));
+	if (check_distributed(sim))
+		CHKERRQ(PCFactorSetMatSolverType(pc_c,MATSOLVERMUMPS));
+
+	CHKERRQ(PCSetFromOptions(pc));
+	return 0;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/** \brief Return the reference order of the input volume on the input level.
+ *  \return See brief. */
+static int compute_p_level
+	(const struct Solver_Volume*const s_vol, ///< \ref Solver_Volume_T.
+	 const int level,                        ///< The index of the level.
+	 const int n_levels,                     ///< The number of levels.
+	 const struct Simulation*const sim       ///< Standard.
+	);
+
+/** \brief Get the pointer to the \ref Adaptation_Element::cc0_vs_vs operator of the input volume for the input orders.
+ *  \return See brief. */
+static const struct Operator* get_operator__cc0_vs_vs
+	(const int p_o,                         ///< The output order.
+	 const int p_i,                         ///< The input order.
+	 const struct Solver_Volume*const s_vol ///< \ref Solver_Volume_T.
+	);
+
+/** \brief Return the number of dof of the input volume on the input level.
+ *  \return See brief. */
+static ptrdiff_t compute_n_dof_level
+	(const struct Solver_Volume*const s_vol, ///< \ref Solver_Volume_T.
+	 const int level,                        ///< The index of the level.
+	 const int n_levels,                     ///< The number of levels.
+	 const struct Simulation*const sim       ///< Standard.
+	);
+
+/** \brief Constructor for the array of the global indices of the first dof of each of the volumes (in the order of
+ *         \ref Simulation::volumes) on the input level.
+ *  \return See brief.
+ *
+ *  The volume dof are numbered contiguously for each of the mpi processes as in \ref update_ind_dof_T.
+ */
+static ptrdiff_t* constructor_ind_dof_level
+	(const int level,                  ///< The index of the level.
+	 const int n_levels,               ///< The number of levels.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Container for the context of the volume block Jacobi smoother.
+ *
+ *  The operators of the coarser levels are only computed (as Galerkin products) when the multigrid preconditioner is
+ *  set up. The variable block sizes required by `PCVPBJACOBI` are thus set on the level operator in the set up of a
+ *  `PCSHELL` preconditioner wrapping the `PCVPBJACOBI` preconditioner.
+ */
+struct Smoother_VPBJacobi {
+	PC pc_vpb; ///< The Petsc `PC` context of type `PCVPBJACOBI`.
+
+	PetscInt n_blocks; ///< The number of blocks (the number of volumes owned by the process).
+	PetscInt* bsizes;  ///< The sizes of the blocks (the number of dof of each of the volumes on the level).
+};
+
+/** \brief Set up the \ref Smoother_VPBJacobi of the input `PCSHELL` context.
+ *  \return Petsc error code. */
+static PetscErrorCode set_up_smoother_vpbjacobi
+	(PC pc ///< The Petsc `PC` context of the smoother.
+	);
+
+/** \brief Apply the \ref Smoother_VPBJacobi of the input `PCSHELL` context.
+ *  \return Petsc error code. */
+static PetscErrorCode apply_smoother_vpbjacobi
+	(PC pc, ///< The Petsc `PC` context of the smoother.
+	 Vec x, ///< The input vector.
+	 Vec y  ///< The output vector.
+	);
+
+/** \brief Destructor for the \ref Smoother_VPBJacobi of the input `PCSHELL` context.
+ *  \return Petsc error code. */
+static PetscErrorCode destructor_smoother_vpbjacobi
+	(PC pc ///< The Petsc `PC` context of the smoother.
+	);
+
+static int compute_n_levels (const struct Simulation*const sim)
+{
+	int p_max = sim->p_ref[0];
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next)
+		p_max = GSL_MAX(p_max,((struct Solver_Volume*)curr)->p_ref);
+	return p_max-compute_p_min_level(sim)+1;
+}
+
+static int compute_p_min_level (const struct Simulation*const sim)
+{
+	return GSL_MIN(1,sim->p_ref[0]);
+}
+
+static Mat constructor_petsc_mat_prolong (const int level_c, const int n_levels, const struct Simulation*const sim)
+{
+	const int level_f = level_c+1;
+	ptrdiff_t*const ind_dof_f = constructor_ind_dof_level(level_f,n_levels,sim), // free
+	         *const ind_dof_c = constructor_ind_dof_level(level_c,n_levels,sim); // free
+
+	if (level_f == n_levels-1) {
+		int v = 0;
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+			if (ind_dof_f[v] != ((struct Solver_Volume*)curr)->ind_dof)
+				EXIT_ADD_SUPPORT; // Only the volume dof are currently supported.
+		}
+	}
+
+	PetscInt n_dof_f = 0,
+	         n_dof_c = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		n_dof_f += (PetscInt)compute_n_dof_level(s_vol,level_f,n_levels,sim);
+		n_dof_c += (PetscInt)compute_n_dof_level(s_vol,level_c,n_levels,sim);
+	}
+
+	// Each row of the prolongation operator couples only to the coarse dof of the same volume and variable.
+	PetscInt*const d_nnz = malloc((size_t)GSL_MAX(n_dof_f,1) * sizeof *d_nnz); // free
+	PetscInt row = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		const ptrdiff_t n_vr  = s_vol->sol_coef->extents[1],
+		                n_f   = compute_n_dof_level(s_vol,level_f,n_levels,sim),
+		                n_b_c = compute_n_dof_level(s_vol,level_c,n_levels,sim)/n_vr;
+		for (ptrdiff_t i = 0; i < n_f; ++i)
+			d_nnz[row++] = (PetscInt)n_b_c;
+	}
+
+	Mat prolong = NULL;
+	MatCreateAIJ(MPI_COMM_WORLD,n_dof_f,n_dof_c,PETSC_DETERMINE,PETSC_DETERMINE,0,d_nnz,0,NULL,&prolong); // returned
+	free(d_nnz);
+
+	int v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		const int p_f = compute_p_level(s_vol,level_f,n_levels,sim),
+		          p_c = compute_p_level(s_vol,level_c,n_levels,sim);
+
+		const struct const_Matrix_d*const cc0_vs_vs = get_operator__cc0_vs_vs(p_f,p_c,s_vol)->op_std;
+		assert(cc0_vs_vs->layout == 'R');
+
+		const ptrdiff_t n_b_f = cc0_vs_vs->ext_0,
+		                n_b_c = cc0_vs_vs->ext_1,
+		                n_vr  = s_vol->sol_coef->extents[1];
+		PetscInt idxm[n_b_f],
+		         idxn[n_b_c];
+		for (int vr = 0; vr < n_vr; ++vr) {
+			for (int i = 0; i < n_b_f; ++i)
+				idxm[i] = (PetscInt)(ind_dof_f[v]+i+n_b_f*vr);
+			for (int j = 0; j < n_b_c; ++j)
+				idxn[j] = (PetscInt)(ind_dof_c[v]+j+n_b_c*vr);
+			MatSetValues(prolong,(PetscInt)n_b_f,idxm,(PetscInt)n_b_c,idxn,cc0_vs_vs->data,INSERT_VALUES);
+		}
+	}
+	free(ind_dof_f);
+	free(ind_dof_c);
+
+	MatAssemblyBegin(prolong,MAT_FINAL_ASSEMBLY);
+	MatAssemblyEnd(prolong,MAT_FINAL_ASSEMBLY);
+
+	return prolong;
+}
+
+static PetscErrorCode set_up_smoother
+	(KSP smoother, const int level, const int n_levels, const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+
+	PC pc;
+	CHKERRQ(KSPSetType(smoother,KSPRICHARDSON));
+	CHKERRQ(KSPGetPC(smoother,&pc));
+
+	switch (test_case->pmg_smoother) {
+	case PMG_SMOOTHER_BLOCK_JACOBI: {
+		// Each block holds the dense coupling of the dof of a single volume such that its inverse is computed exactly.
+		struct Smoother_VPBJacobi*const smoother_vpb = calloc(1,sizeof *smoother_vpb); // destructed
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next)
+			smoother_vpb->n_blocks += is_volume_owned((struct Volume*)curr,sim);
+
+		smoother_vpb->bsizes = malloc((size_t)GSL_MAX(smoother_vpb->n_blocks,1) * sizeof *smoother_vpb->bsizes); // free
+		PetscInt ind = 0;
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+			if (is_volume_owned((struct Volume*)curr,sim)) {
+				smoother_vpb->bsizes[ind++] =
+					(PetscInt)compute_n_dof_level((struct Solver_Volume*)curr,level,n_levels,sim);
+			}
+		}
+		CHKERRQ(PCSetType(pc,PCSHELL));
+		CHKERRQ(PCShellSetName(pc,"vpbjacobi_volume"));
+		CHKERRQ(PCShellSetContext(pc,smoother_vpb));
+		CHKERRQ(PCShellSetSetUp(pc,set_up_smoother_vpbjacobi));
+		CHKERRQ(PCShellSetApply(pc,apply_smoother_vpbjacobi));
+		CHKERRQ(PCShellSetDestroy(pc,destructor_smoother_vpbjacobi));
+		break;
+	} case PMG_SMOOTHER_ILU:
+		// The Petsc ILU is sequential; ILU is applied to the process-local blocks for distributed meshes.
+		CHKERRQ(PCSetType(pc,( check_distributed(sim) ? PCBJACOBI : PCILU )));
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",test_case->pmg_smoother);
+		break;
+	}
+	return 0;
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static int compute_p_level
+	(const struct Solver_Volume*const s_vol, const int level, const int n_levels, const struct Simulation*const sim)
+{
+	return GSL_MAX(compute_p_min_level(sim),s_vol->p_ref-(n_levels-1-level));
+}
+
+static const struct Operator* get_operator__cc0_vs_vs
+	(const int p_o, const int p_i, const struct Solver_Volume*const s_vol)
+{
+	const struct Volume*const vol = (struct Volume*) s_vol;
+	const struct Adaptation_Element*const a_e = &((struct Solver_Element*)vol->element)->a_e;
+
+	assert(abs(p_o-p_i) <= 1);
+	return get_Multiarray_Operator(a_e->cc0_vs_vs,(ptrdiff_t[]){0,0,p_o,p_i});
+}
+
+static ptrdiff_t compute_n_dof_level
+	(const struct Solver_Volume*const s_vol, const int level, const int n_levels, const struct Simulation*const sim)
+{
+	const int p = compute_p_level(s_vol,level,n_levels,sim);
+	const ptrdiff_t n_b = get_operator__cc0_vs_vs(p,p,s_vol)->op_std->ext_0;
+	return n_b*s_vol->sol_coef->extents[1];
+}
+
+static ptrdiff_t* constructor_ind_dof_level (const int level, const int n_levels, const struct Simulation*const sim)
+{
+	const int n_ranks = sim->mpi_size;
+	ptrdiff_t dof_rank[n_ranks+1];
+	for (int r = 0; r <= n_ranks; ++r)
+		dof_rank[r] = 0;
+
+	ptrdiff_t n_v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++n_v) {
+		const struct Volume*const vol = (struct Volume*) curr;
+		dof_rank[vol->rank+1] += compute_n_dof_level((struct Solver_Volume*)curr,level,n_levels,sim);
+	}
+	for (int r = 0; r < n_ranks; ++r)
+		dof_rank[r+1] += dof_rank[r];
+
+	ptrdiff_t*const ind_dof = malloc((size_t)GSL_MAX(n_v,1) * sizeof *ind_dof); // returned
+	int v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+		const struct Volume*const vol = (struct Volume*) curr;
+		ind_dof[v] = dof_rank[vol->rank];
+		dof_rank[vol->rank] += compute_n_dof_level((struct Solver_Volume*)curr,level,n_levels,sim);
+	}
+	return ind_dof;
+}
+
+static PetscErrorCode set_up_smoother_vpbjacobi (PC pc)
+{
+	struct Smoother_VPBJacobi* smoother_vpb = NULL;
+	CHKERRQ(PCShellGetContext(pc,(void*)&smoother_vpb));
+
+	Mat A, P;
+	CHKERRQ(PCGetOperators(pc,&A,&P));
+	CHKERRQ(MatSetVariableBlockSizes(P,smoother_vpb->n_blocks,smoother_vpb->bsizes));
+
+	if (!smoother_vpb->pc_vpb) {
+		CHKERRQ(PCCreate(MPI_COMM_WORLD,&smoother_vpb->pc_vpb)); // destroyed
+		CHKERRQ(PCSetType(smoother_vpb->pc_vpb,PCVPBJACOBI));
+	}
+	CHKERRQ(PCSetOperators(smoother_vpb->pc_vpb,A,P));
+	CHKERRQ(PCSetUp(smoother_vpb->pc_vpb));
+	return 0;
+}
+
+static PetscErrorCode apply_smoother_vpbjacobi (PC pc, Vec x, Vec y)
+{
+	struct Smoother_VPBJacobi* smoother_vpb = NULL;
+	CHKERRQ(PCShellGetContext(pc,(void*)&smoother_vpb));
+	CHKERRQ(PCApply(smoother_vpb->pc_vpb,x,y));
+	return 0;
+}
+
+static PetscErrorCode destructor_smoother_vpbjacobi (PC pc)
+{
+	struct Smoother_VPBJacobi* smoother_vpb = NULL;
+	CHKERRQ(PCShellGetContext(pc,(void*)&smoother_vpb));
+	CHKERRQ(PCDestroy(&smoother_vpb->pc_vpb));
+	free(smoother_vpb->bsizes);
+	free(smoother_vpb);
+	return 0;
+}
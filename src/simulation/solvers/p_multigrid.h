@@ -0,0 +1,50 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__p_multigrid_h__INCLUDED
+#define DPG__p_multigrid_h__INCLUDED
+/** \file
+ *  \brief Provides the p-multigrid preconditioner for the implicit dg solver.
+ *
+ *  The levels of the multigrid hierarchy are obtained by successively decreasing the order of each of the volumes by
+ *  one until p = 1 (or p = 0 if this is the minimal reference order, \ref Simulation::p_ref[0]) is reached, such that
+ *  the number of levels is determined by the volume having the highest order and that multiple levels are also used
+ *  for simulations with a single reference order. The prolongation operators are assembled from the element-local
+ *  order projection operators used for adaptation (\ref Adaptation_Element::cc0_vs_vs) and the restriction operators
+ *  are their transposes (corresponding to the L2 projection for the orthonormal reference basis).
+ *
+ *  The coarse level operators are the Galerkin products of the assembled lhs matrix (i.e. no rediscretization is
+ *  performed at the lower orders) and the coarsest level is solved using a direct solver. The smoother on each of the
+ *  finer levels is specified by \ref Test_Case_T::pmg_smoother.
+ *
+ *  The default settings may be overridden using the standard Petsc PCMG options (e.g. `-pc_mg_cycle_type`,
+ *  `-mg_levels_ksp_max_it`).
+ */
+
+#include "petscpc.h"
+
+struct Simulation;
+
+/** \brief Set up the input Petsc `PC` as the p-multigrid preconditioner.
+ *  \return Petsc error code.
+ *
+ *  \ref Solver_Volume_T::ind_dof must already have been set (see \ref update_ind_dof_T).
+ */
+PetscErrorCode set_up_pc_p_multigrid
+	(PC pc,                            ///< The Petsc `PC` context.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+#endif // DPG__p_multigrid_h__INCLUDED
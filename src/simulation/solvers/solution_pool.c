@@ -0,0 +1,246 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include "solution_pool.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mkl.h"
+
+#include "macros.h"
+
+#include "multiarray.h"
+
+#include "volume_solver.h"
+#include "volume_solver_dg.h"
+
+#include "const_cast.h"
+#include "definitions_intrusive.h"
+#include "intrusive.h"
+#include "simulation.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define N_MEMBERS_V 3 ///< The number of pooled members which are not indexed by \ref Solver_Volume_T::ind_dof.
+
+/** \brief Set the pooled members of the input volume which are not indexed by \ref Solver_Volume_T::ind_dof.
+ *
+ *  The `const` geometry members are cast to non-`const` such that their data can be moved; the values are not
+ *  modified. */
+static void set_members_v
+	(struct Multiarray_d* members[N_MEMBERS_V], ///< To hold the members.
+	 const struct Solver_Volume*const s_vol     ///< The volume.
+	);
+
+/** \brief Compute the size of the data of the input multiarray.
+ *  \return See brief (0 if the multiarray is `NULL`). */
+static ptrdiff_t compute_size_member
+	(const struct Multiarray_d*const a ///< The multiarray.
+	);
+
+/** \brief Check whether the data of the input multiarray lies in the input range of the pool.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_in_range
+	(const struct Multiarray_d*const a, ///< The multiarray.
+	 const double*const data,           ///< The start of the range.
+	 const ptrdiff_t size               ///< The size of the range.
+	);
+
+/// \brief Move the data of the input multiarray to the input location in the pool.
+static void move_to_pool
+	(struct Multiarray_d*const a, ///< The multiarray.
+	 double*const data            ///< The location in the pool.
+	);
+
+/// \brief Move the data of the input multiarray from the pool to newly allocated memory.
+static void move_from_pool
+	(struct Multiarray_d*const a ///< The multiarray.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+struct Solution_Pool* constructor_Solution_Pool (const struct Simulation*const sim)
+{
+	ptrdiff_t ind_dof_min = -1,
+	          n_dof       = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		assert(s_vol->ind_dof >= 0);
+		if (ind_dof_min == -1 || s_vol->ind_dof < ind_dof_min)
+			ind_dof_min = s_vol->ind_dof;
+
+		const struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+		assert(sol_coef->owns_data);
+		n_dof += compute_size(sol_coef->order,sol_coef->extents);
+	}
+
+	// The rhs and the previous stage coefficients share the extents of the solution coefficients for the dg method.
+	const bool is_dg = (sim->volumes->name == IL_VOLUME_SOLVER_DG);
+	const bool has_sol_coef_p =
+		is_dg && sim->volumes->first && ((struct DG_Solver_Volume*)sim->volumes->first)->sol_coef_p;
+	const int n_members = 1 + ( is_dg ? 1 : 0 ) + ( has_sol_coef_p ? 1 : 0 );
+
+	struct Solution_Pool*const sol_pool = calloc(1,sizeof *sol_pool); // free
+	const_cast_ptrdiff(&sol_pool->ind_dof_min,ind_dof_min);
+	const_cast_ptrdiff(&sol_pool->n_dof,n_dof);
+	sol_pool->data       = malloc((size_t)(n_members*n_dof) * sizeof *sol_pool->data); // free
+	sol_pool->rhs        = ( is_dg          ? &sol_pool->data[n_dof]   : NULL );
+	sol_pool->sol_coef_p = ( has_sol_coef_p ? &sol_pool->data[2*n_dof] : NULL );
+
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+
+		const ptrdiff_t ind = s_vol->ind_dof-ind_dof_min;
+		assert(ind+compute_size(sol_coef->order,sol_coef->extents) <= n_dof); // Volume dof must be contiguous.
+
+		if (sol_pool->rhs) {
+			resize_Multiarray_d(s_vol->rhs,sol_coef->order,sol_coef->extents);
+			move_to_pool(s_vol->rhs,&sol_pool->rhs[ind]);
+		}
+		if (sol_pool->sol_coef_p)
+			move_to_pool(((struct DG_Solver_Volume*)s_vol)->sol_coef_p,&sol_pool->sol_coef_p[ind]);
+		move_to_pool(sol_coef,&sol_pool->data[ind]);
+	}
+
+	ptrdiff_t n_data_v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Multiarray_d* members[N_MEMBERS_V];
+		set_members_v(members,(struct Solver_Volume*)curr);
+		for (int i = 0; i < N_MEMBERS_V; ++i)
+			n_data_v += compute_size_member(members[i]);
+	}
+	const_cast_ptrdiff(&sol_pool->n_data_v,n_data_v);
+	sol_pool->data_v = malloc((size_t)n_data_v * sizeof *sol_pool->data_v); // free
+
+	ptrdiff_t ind_v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Multiarray_d* members[N_MEMBERS_V];
+		set_members_v(members,(struct Solver_Volume*)curr);
+		for (int i = 0; i < N_MEMBERS_V; ++i) {
+			const ptrdiff_t size = compute_size_member(members[i]);
+			if (size == 0)
+				continue;
+			move_to_pool(members[i],&sol_pool->data_v[ind_v]);
+			ind_v += size;
+		}
+	}
+	return sol_pool;
+}
+
+void destructor_Solution_Pool (struct Solution_Pool*const sol_pool, const struct Simulation*const sim)
+{
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+
+		move_from_pool(s_vol->sol_coef);
+		if (sol_pool->rhs)
+			move_from_pool(s_vol->rhs);
+		if (sol_pool->sol_coef_p)
+			move_from_pool(((struct DG_Solver_Volume*)s_vol)->sol_coef_p);
+
+		struct Multiarray_d* members[N_MEMBERS_V];
+		set_members_v(members,s_vol);
+		for (int i = 0; i < N_MEMBERS_V; ++i) {
+			if (compute_size_member(members[i]) != 0)
+				move_from_pool(members[i]);
+		}
+	}
+	free(sol_pool->data);
+	free(sol_pool->data_v);
+	free(sol_pool);
+}
+
+bool check_members_in_Solution_Pool (const struct Solution_Pool*const sol_pool, const struct Simulation*const sim)
+{
+	const ptrdiff_t n_dof = sol_pool->n_dof;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+
+		if (!check_in_range(s_vol->sol_coef,sol_pool->data,n_dof))
+			return false;
+		if (sol_pool->rhs && !check_in_range(s_vol->rhs,sol_pool->rhs,n_dof))
+			return false;
+		if (sol_pool->sol_coef_p &&
+		    !check_in_range(((struct DG_Solver_Volume*)s_vol)->sol_coef_p,sol_pool->sol_coef_p,n_dof))
+			return false;
+
+		struct Multiarray_d* members[N_MEMBERS_V];
+		set_members_v(members,s_vol);
+		for (int i = 0; i < N_MEMBERS_V; ++i) {
+			if (compute_size_member(members[i]) != 0 &&
+			    !check_in_range(members[i],sol_pool->data_v,sol_pool->n_data_v))
+				return false;
+		}
+	}
+	return true;
+}
+
+void add_to_Solution_Pool (struct Solution_Pool*const sol_pool, const double alpha, const double*const d_coef)
+{
+	if (sol_pool->n_dof == 0)
+		return;
+	cblas_daxpy((MKL_INT)sol_pool->n_dof,alpha,&d_coef[sol_pool->ind_dof_min],1,sol_pool->data,1);
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static void set_members_v (struct Multiarray_d* members[N_MEMBERS_V], const struct Solver_Volume*const s_vol)
+{
+	members[0] = s_vol->grad_coef;
+	members[1] = (struct Multiarray_d*) s_vol->metrics_vc;
+	members[2] = (struct Multiarray_d*) s_vol->jacobian_det_vc;
+}
+
+static ptrdiff_t compute_size_member (const struct Multiarray_d*const a)
+{
+	return ( a ? compute_size(a->order,a->extents) : 0 );
+}
+
+static bool check_in_range (const struct Multiarray_d*const a, const double*const data, const ptrdiff_t size)
+{
+	const ptrdiff_t size_a = compute_size(a->order,a->extents);
+	return !a->owns_data && a->data >= data && a->data+size_a <= data+size;
+}
+
+static void move_to_pool (struct Multiarray_d*const a, double*const data)
+{
+	assert(a->owns_data);
+
+	const ptrdiff_t size = compute_size(a->order,a->extents);
+	if (size > 0)
+		memcpy(data,a->data,(size_t)size * sizeof *data);
+	free(a->data);
+
+	a->owns_data = false;
+	a->data      = data;
+}
+
+static void move_from_pool (struct Multiarray_d*const a)
+{
+	assert(!a->owns_data);
+
+	const ptrdiff_t size = compute_size(a->order,a->extents);
+	double*const data = malloc((size_t)size * sizeof *data); // keep
+	if (size > 0)
+		memcpy(data,a->data,(size_t)size * sizeof *data);
+
+	a->owns_data = true;
+	a->data      = data;
+}
@@ -0,0 +1,89 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__solution_pool_h__INCLUDED
+#define DPG__solution_pool_h__INCLUDED
+/** \file
+ *  \brief Provides a contiguous storage pool for the per-volume solution data of the \ref Solver_Volume_T\*s.
+ *
+ *  When the pool is active, the data of each of the pooled members is a (non-owning) view into a single buffer ordered
+ *  by \ref Solver_Volume_T::ind_dof such that the volume loops traverse contiguous memory and the solution update of
+ *  the implicit solver reduces to a single vector AXPY. The pooled members are:
+ *  - \ref Solver_Volume_T::sol_coef (always);
+ *  - \ref Solver_Volume_T::rhs and \ref DG_Solver_Volume_T::sol_coef_p (when present) for the dg volumes;
+ *  - \ref Solver_Volume_T::grad_coef (when non-empty), \ref Solver_Volume_T::metrics_vc and
+ *    \ref Solver_Volume_T::jacobian_det_vc, which are stored in a second buffer in the order of the volume list as
+ *    their sizes do not correspond to the volume degrees of freedom.
+ *
+ *  The use of the pool is controlled by \ref Test_Case_T::use_solution_pool.
+ *
+ *  \warning The pooled members may not be resized while the pool is active (i.e. the pool must be destructed before
+ *           any adaptation or reinitialization of the solution). Resizing to the current size is permitted (see
+ *           \ref initialize_zero_memory_volumes_T).
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+
+struct Simulation;
+
+/// \brief Container for the contiguous per-volume solution data storage.
+struct Solution_Pool {
+	const ptrdiff_t ind_dof_min; ///< The minimum \ref Solver_Volume_T::ind_dof of the volumes in the pool.
+	const ptrdiff_t n_dof;       ///< The number of volume degrees of freedom in the pool.
+
+	double* data;       ///< The contiguous data of all of the \ref Solver_Volume_T::sol_coef members.
+	double* rhs;        ///< The contiguous data of all of the \ref Solver_Volume_T::rhs members (or `NULL`).
+	double* sol_coef_p; ///< The contiguous data of all of the \ref DG_Solver_Volume_T::sol_coef_p members (or `NULL`).
+
+	const ptrdiff_t n_data_v; ///< The size of \ref Solution_Pool::data_v.
+
+	/// The contiguous data of the pooled members which are not indexed by \ref Solver_Volume_T::ind_dof.
+	double* data_v;
+};
+
+/** \brief Constructor for a \ref Solution_Pool, moving the data of the pooled volume members to the pool.
+ *  \return See brief.
+ *
+ *  \ref Solver_Volume_T::ind_dof must already have been set (see \ref update_ind_dof_T).
+ */
+struct Solution_Pool* constructor_Solution_Pool
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/// \brief Destructor for a \ref Solution_Pool, moving the data of the pooled members back to the volumes.
+void destructor_Solution_Pool
+	(struct Solution_Pool*const sol_pool, ///< Standard.
+	 const struct Simulation*const sim    ///< Standard.
+	);
+
+/** \brief Check whether the data of all of the pooled members of all of the volumes lies in the pool.
+ *  \return `true` if yes; `false` otherwise. */
+bool check_members_in_Solution_Pool
+	(const struct Solution_Pool*const sol_pool, ///< Standard.
+	 const struct Simulation*const sim          ///< Standard.
+	);
+
+/** \brief Add the scaled increment corresponding to the volume degrees of freedom to the pooled solution coefficients.
+ *
+ *  The input increment is indexed by the global dof (i.e. \ref Solver_Volume_T::ind_dof).
+ */
+void add_to_Solution_Pool
+	(struct Solution_Pool*const sol_pool, ///< Standard.
+	 const double alpha,                  ///< The scaling of the increment.
+	 const double*const d_coef            ///< The increment for all of the global dof.
+	);
+
+#endif // DPG__solution_pool_h__INCLUDED
@@ -18,6 +18,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "solve.h"
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include "gsl/gsl_math.h"
@@ -42,6 +43,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "partition.h"
 #include "simulation.h"
 #include "solve_explicit.h"
 #include "solve_implicit.h"
@@ -64,11 +66,6 @@ You should have received a copy of the GNU General Public License along with DPG
 #define ALWAYS_SET_INITIAL false
 /// \todo REMOVE THIS WHEN FINISHED TESTING! (Replace with restart file where applicable)
 
-/// \brief Set the memory of the rhs and lhs (if applicable) terms to zero for the volumes.
-static void zero_memory_volumes
-	(struct Intrusive_List* volumes ///< The list of volumes for which to set the memory.
-	);
-
 /// \brief Set the memory of the rhs and lhs (if applicable) terms relating to flux imbalances to zero for the volumes.
 static void zero_memory_volumes_flux_imbalances
 	(struct Intrusive_List* volumes ///< The list of volumes for which to set the memory.
@@ -80,6 +77,14 @@ static void correct_coef
 	 const double p_ho               ///< The percentage of the 'h'igh-'o'rder contribution to retain.
 	);
 
+/** \brief Check whether the input indices are made up of complete, contiguous blocks aligned with the block size.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_block_aligned
+	(const PetscInt n,         ///< The number of indices.
+	 const PetscInt*const idx, ///< The indices.
+	 const PetscInt bs         ///< The block size.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 #include "def_templates_type_d.h"
@@ -90,6 +95,12 @@ static void correct_coef
 #include "solve_T.c"
 #include "undef_templates_type.h"
 
+struct Solver_Stats* get_solver_stats ( )
+{
+	static struct Solver_Stats solver_stats = { .n_steps_i = 0, };
+	return &solver_stats;
+}
+
 void solve_for_solution (struct Simulation* sim)
 {
 	assert(sim->volumes->name == IL_VOLUME_SOLVER);
@@ -112,6 +123,8 @@ for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
 #endif
 	}
 
+	*get_solver_stats() = (struct Solver_Stats) { .n_steps_i = 0, };
+
 	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
 	switch (test_case->solver_proc) {
 	case SOLVER_E:
@@ -135,7 +148,7 @@ double compute_rhs (const struct Simulation* sim)
 /// \todo Add assertions relevant to rhs.
 	double max_rhs = 0.0;
 
-	zero_memory_volumes(sim->volumes);
+	// The volume memory is set to zero in the method-specific functions (also used directly by the explicit solver).
 	switch (sim->method) {
 	case METHOD_DG:
 		max_rhs = compute_rhs_dg(sim);
@@ -148,6 +161,11 @@ double compute_rhs (const struct Simulation* sim)
 	return max_rhs;
 }
 
+void zero_memory_volumes (struct Intrusive_List* volumes)
+{
+	zero_memory_volumes_flux_imbalances(volumes);
+}
+
 double compute_rlhs (const struct Simulation* sim, struct Solver_Storage_Implicit* ssi)
 {
 	double max_rhs = 0.0;
@@ -237,10 +255,20 @@ void destructor_Solver_Storage_Implicit (struct Solver_Storage_Implicit* ssi)
 	if (!ssi->do_not_destruct_A)
 		MatDestroy(&ssi->A);
 	VecDestroy(&ssi->b);
+	VecDestroy(&ssi->b_full);
 	destructor_conditional_const_Vector_i(ssi->corr_l2_c0);
 	free(ssi);
 }
 
+void reset_Solver_Storage_Implicit (struct Solver_Storage_Implicit*const ssi)
+{
+	assert(ssi->n_c0 == 0); // The C0 Mat/Vec are constructed from the L2 Mat/Vec.
+	MatZeroEntries(ssi->A);
+	VecZeroEntries(ssi->b);
+	if (ssi->b_full)
+		VecZeroEntries(ssi->b_full);
+}
+
 void increment_nnz (struct Vector_i* nnz, const ptrdiff_t ind_dof, const ptrdiff_t n_row, const ptrdiff_t n_col)
 {
 	assert(ind_dof >= 0);
@@ -314,13 +342,16 @@ void compute_flux_imbalances (struct Simulation*const sim)
 double compute_max_rhs_from_ssi (const struct Solver_Storage_Implicit*const ssi)
 {
 	double max_rhs = 0.0;
-	VecNorm(ssi->b,NORM_INFINITY,&max_rhs);
+	VecNorm(( ssi->b_full ? ssi->b_full : ssi->b ),NORM_INFINITY,&max_rhs);
 	return max_rhs;
 }
 
 void add_to_petsc_Mat (const struct Solver_Storage_Implicit*const ssi, const struct const_Matrix_d*const lhs)
 {
 	assert(lhs->layout == 'R');
+	if (ssi->row < ssi->ind_dof_range[0] || ssi->row >= ssi->ind_dof_range[1])
+		return;
+
 	const ptrdiff_t ext_0 = lhs->ext_0,
 	                ext_1 = lhs->ext_1;
 
@@ -334,17 +365,35 @@ void add_to_petsc_Mat (const struct Solver_Storage_Implicit*const ssi, const str
 		idxn[i] = ssi->col+i;
 
 	const PetscScalar*const vv = lhs->data;
-	MatSetValues(ssi->A,(PetscInt)ext_0,idxm,(PetscInt)ext_1,idxn,vv,ADD_VALUES);
+	PRAGMA_OMP(critical (petsc_assembly))
+	add_values_to_petsc_Mat(ssi,(PetscInt)ext_0,idxm,(PetscInt)ext_1,idxn,vv);
 }
 
-// Static functions ************************************************************************************************* //
-// Level 0 ********************************************************************************************************** //
-
-static void zero_memory_volumes (struct Intrusive_List* volumes)
+void add_values_to_petsc_Mat
+	(const struct Solver_Storage_Implicit*const ssi, const PetscInt m, const PetscInt*const idxm, const PetscInt n,
+	 const PetscInt*const idxn, const PetscScalar*const vv)
 {
-	zero_memory_volumes_flux_imbalances(volumes);
+	const PetscInt bs = ssi->block_size;
+	if (bs <= 1 || !check_block_aligned(m,idxm,bs) || !check_block_aligned(n,idxn,bs)) {
+		MatSetValues(ssi->A,m,idxm,n,idxn,vv,ADD_VALUES);
+		return;
+	}
+
+	const PetscInt m_b = m/bs,
+	               n_b = n/bs;
+	PetscInt idxm_b[m_b],
+	         idxn_b[n_b];
+	for (PetscInt i = 0; i < m_b; ++i)
+		idxm_b[i] = idxm[i*bs]/bs;
+	for (PetscInt i = 0; i < n_b; ++i)
+		idxn_b[i] = idxn[i*bs]/bs;
+
+	MatSetValuesBlocked(ssi->A,m_b,idxm_b,n_b,idxn_b,vv,ADD_VALUES);
 }
 
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
 static void zero_memory_volumes_flux_imbalances (struct Intrusive_List* volumes)
 {
 	for (struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next) {
@@ -372,3 +421,19 @@ static void correct_coef (struct Multiarray_d*const coef, const double p_ho)
 			data[n] = p_ho*data[n] + (1-p_ho)*avg;
 	}
 }
+
+static bool check_block_aligned (const PetscInt n, const PetscInt*const idx, const PetscInt bs)
+{
+	if (n == 0 || n % bs != 0)
+		return false;
+
+	for (PetscInt i = 0; i < n; i += bs) {
+		if (idx[i] < 0 || idx[i] % bs != 0)
+			return false;
+		for (PetscInt j = 1; j < bs; ++j) {
+			if (idx[i+j] != idx[i]+j)
+				return false;
+		}
+	}
+	return true;
+}
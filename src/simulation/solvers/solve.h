@@ -33,6 +33,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "petscvec.h"
 
 struct Simulation;
+struct Intrusive_List;
 struct Vector_i;
 struct const_Matrix_d;
 struct Solver_Volume;
@@ -42,9 +43,18 @@ struct Solver_Storage_Implicit {
 	Mat A; ///< Petsc Mat holding the LHS entries.
 	Vec b; ///< Petsc Vec holding the negative of the RHS entries.
 
+	/** Petsc Vec holding the negative of the RHS entries of all of the dof when the volume dof are statically
+	 *  condensed out of the global system (`NULL` otherwise; see \ref Test_Case_T::use_schur_complement). This is
+	 *  only used to compute the residual as \ref Solver_Storage_Implicit::b then holds the condensed RHS entries. */
+	Vec b_full;
+
 	int row, ///< Index of the first row in which data is to be added.
 	    col; ///< Index of the first col in which data is to be added.
 
+	/** The range ([start,end)) of the rows of \ref Solver_Storage_Implicit::A owned by the current process. Entries
+	 *  added to rows outside of this range are ignored (see \ref add_to_petsc_Mat). */
+	PetscInt ind_dof_range[2];
+
 	ptrdiff_t n_c0; ///< The number of C0 dof. C0 assumed if this value is not zero.
 
 	/** Holding the correspondence betwene the L2 and C0 dof.
@@ -54,10 +64,44 @@ struct Solver_Storage_Implicit {
 	const struct const_Vector_i* corr_l2_c0;
 
 	bool do_not_destruct_A; ///< Flag for whether the \ref Solver_Storage_Implicit::A matrix should be destructed.
+
+	/// The block size of \ref Solver_Storage_Implicit::A (values <= 1 indicate scalar (AIJ) storage).
+	PetscInt block_size;
+
+	/** Flag for whether only the element-local (diagonal) blocks are stored in \ref Solver_Storage_Implicit::A. This
+	 *  is used when the matrix is only required for the preconditioner (see \ref Test_Case_T::use_jfnk). */
+	bool element_local_only;
+};
+
+/** \brief Container for statistics of the most recent call to \ref solve_for_solution.
+ *
+ *  These are used to verify that the solver options have taken effect (see \ref test_integration_solver_options.c).
+ */
+struct Solver_Stats {
+	int n_steps_i;         ///< The number of implicit steps.
+	int n_ksp_constructed; ///< The number of `KSP` contexts constructed by the implicit solver.
+	int n_pc_set_up;       ///< The number of implicit steps for which the preconditioner was recomputed.
+
+	PetscInt block_size; ///< The block size of the most recent lhs matrix (`MatGetBlockSize`).
+	bool op_is_shell;    ///< Flag for whether the most recent `KSP` operator was a `MATSHELL`.
+	PetscInt n_pc_mg;    ///< The number of `PCMG` levels of the most recent preconditioner (0 if not `PCMG`).
+
+	int n_mult_cmplx_step; ///< The number of jfnk matrix-vector products computed using the complex step.
+
+	/// Flag for whether the pooled members were found to lie in the \ref Solution_Pool (`false` if not used).
+	bool members_in_pool;
+
+	int n_lts_levels;     ///< The maximum number of local time stepping levels used by any explicit time step.
+	int n_volume_batches; ///< The maximum number of batches used for any batched volume rhs computation.
 };
 
 // Interface functions ********************************************************************************************** //
 
+/** \brief Get the \ref Solver_Stats of the most recent call to \ref solve_for_solution, which are updated by the
+ *         solver functions.
+ *  \return See brief. */
+struct Solver_Stats* get_solver_stats ( );
+
 /// \brief Solve for the solution.
 void solve_for_solution
 	(struct Simulation* sim ///< \ref Simulation.
@@ -74,6 +118,11 @@ double compute_rhs
 	(const struct Simulation* sim ///< \ref Simulation.
 	);
 
+/// \brief Set the memory of the rhs and lhs (if applicable) terms to zero for the volumes.
+void zero_memory_volumes
+	(struct Intrusive_List* volumes ///< The list of volumes for which to set the memory.
+	);
+
 /** \brief Compute the volume and face rhs and lhs terms for the the given method.
  *  \return The maximum absolute value of the rhs.
  *
@@ -106,6 +155,16 @@ void destructor_Solver_Storage_Implicit
 	(struct Solver_Storage_Implicit* ssi ///< Standard.
 	);
 
+/** \brief Zero the entries of \ref Solver_Storage_Implicit::A and \ref Solver_Storage_Implicit::b such that the
+ *         container can be reused for the next implicit step.
+ *
+ *  The nonzero pattern (and hence the preallocation) of the matrix is retained, allowing for the symbolic factorization
+ *  to be reused by the PETSc preconditioner. This is only valid as long as the \ref Solver_Volume_T::ind_dof (and
+ *  related) indices are unchanged. */
+void reset_Solver_Storage_Implicit
+	(struct Solver_Storage_Implicit*const ssi ///< Standard.
+	);
+
 /// \brief Increment the corresponding rows of `nnz` by the input number of columns.
 void increment_nnz
 	(struct Vector_i* nnz,    ///< Holds the number of non-zero entries for each row.
@@ -152,4 +211,20 @@ void add_to_petsc_Mat
 	 const struct const_Matrix_d*const lhs           ///< The matrix containing the lhs data.
 	);
 
+/** \brief Add the row-major values to the petsc Mat at the (global) row and column indices using blocked insertion when
+ *         possible.
+ *
+ *  Blocked insertion (`MatSetValuesBlocked`) is used when \ref Solver_Storage_Implicit::block_size > 1 and both index
+ *  arrays are made up of complete, contiguous blocks aligned with the block size; scalar insertion (`MatSetValues`) is
+ *  used otherwise. The call is not protected by a critical section.
+ */
+void add_values_to_petsc_Mat
+	(const struct Solver_Storage_Implicit*const ssi, ///< \ref Solver_Storage_Implicit.
+	 const PetscInt m,                               ///< The number of rows.
+	 const PetscInt*const idxm,                      ///< The global row indices.
+	 const PetscInt n,                               ///< The number of columns.
+	 const PetscInt*const idxn,                      ///< The global column indices.
+	 const PetscScalar*const vv                      ///< The row-major values.
+	);
+
 #endif // DPG__solve_h__INCLUDED
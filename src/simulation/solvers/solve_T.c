@@ -51,6 +51,23 @@ static struct Vector_i* constructor_nnz
 	(const struct Simulation*const sim ///< \ref Simulation.
 	);
 
+/// \brief Constructor for the sequential \ref Solver_Storage_Implicit::A member.
+static void constructor_petsc_mat_seq
+	(struct Solver_Storage_Implicit*const ssi, ///< \ref Solver_Storage_Implicit.
+	 const struct Vector_i*const nnz           ///< The number of non-zero entries in each row of the global matrix.
+	);
+
+/** \brief Constructor for the distributed \ref Solver_Storage_Implicit::A and \ref Solver_Storage_Implicit::b members,
+ *         also setting \ref Solver_Storage_Implicit::ind_dof_range.
+ *
+ *  The rows owned by each process are those corresponding to the dof of the volumes owned by the process, which are
+ *  numbered contiguously in \ref update_ind_dof_T. */
+static void constructor_petsc_mat_vec_mpi
+	(struct Solver_Storage_Implicit*const ssi, ///< \ref Solver_Storage_Implicit.
+	 const struct Vector_i*const nnz,          ///< The number of non-zero entries in each row of the global matrix.
+	 const struct Simulation*const sim         ///< \ref Simulation.
+	);
+
 /** \brief Compute the number of 'd'egrees 'o'f 'f'reedom in the volume computational elements.
  *  \return See brief. */
 static ptrdiff_t compute_dof_volumes
@@ -92,19 +109,35 @@ struct Solver_Storage_Implicit* constructor_Solver_Storage_Implicit_T (const str
 	const ptrdiff_t dof_solve = nnz->ext_0;
 
 	struct Solver_Storage_Implicit* ssi = calloc(1,sizeof *ssi); // free
+	const struct Test_Case_T*const test_case = (struct Test_Case_T*) sim->test_case_rc->tc;
+	ssi->block_size = (PetscInt) ( test_case->use_block_matrix ? compute_block_size_T(sim) : 1 );
+	ssi->element_local_only = test_case->use_jfnk;
+
 	switch (sim->method) {
 		case METHOD_DG:  // fallthrough
-		case METHOD_DPG: assert(dof_solve == compute_dof_T(sim));      break;
+		case METHOD_DPG:
+			assert(dof_solve == compute_dof_T(sim)-
+			                    (test_case->use_schur_complement ? compute_dof_volumes(sim) : 0));
+			break;
 		case METHOD_OPG: // fallthrough
 		case METHOD_OPGC0: assert(dof_solve == compute_dof_test_T(sim)); break;
 		default:         EXIT_ERROR("Unsupported: %d.\n",sim->method); break;
 	}
 
-	MatCreateSeqAIJ(MPI_COMM_WORLD,(PetscInt)dof_solve,(PetscInt)dof_solve,0,nnz->data,&ssi->A); // destructed
+	if (!check_distributed(sim)) {
+		ssi->ind_dof_range[0] = 0;
+		ssi->ind_dof_range[1] = (PetscInt)dof_solve;
+
+		constructor_petsc_mat_seq(ssi,nnz); // destructed
+		VecCreateSeq(MPI_COMM_WORLD,(PetscInt)dof_solve,&ssi->b); // destructed
+		if (sim->method == METHOD_DPG && test_case->use_schur_complement)
+			VecCreateSeq(MPI_COMM_WORLD,(PetscInt)compute_dof_T(sim),&ssi->b_full); // destructed
+	} else {
+		constructor_petsc_mat_vec_mpi(ssi,nnz,sim); // destructed
+	}
 	MatSetFromOptions(ssi->A);
 	MatSetUp(ssi->A);
 
-	VecCreateSeq(MPI_COMM_WORLD,(PetscInt)dof_solve,&ssi->b); // destructed
 	VecSetFromOptions(ssi->b);
 	VecSetUp(ssi->b);
 
@@ -181,6 +214,31 @@ void initialize_zero_memory_volumes_T (struct Intrusive_List* volumes)
 	}
 }
 
+ptrdiff_t compute_block_size_T (const struct Simulation*const sim)
+{
+	if (sim->method != METHOD_DG)
+		return 1;
+
+	ptrdiff_t dof_min = PTRDIFF_MAX,
+	          dof_max = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Multiarray_T*const sol_coef = ((struct Solver_Volume_T*) curr)->sol_coef;
+		const ptrdiff_t dof_v = compute_size(sol_coef->order,sol_coef->extents);
+		dof_min = GSL_MIN(dof_min,dof_v);
+		dof_max = GSL_MAX(dof_max,dof_v);
+	}
+
+	if (check_distributed(sim)) {
+		// The block size must be the same on all processes (those without any volumes do not constrain it).
+		long long int dof_l[2] = { -(long long int)dof_min, dof_max, },
+		              dof_g[2] = { 0, 0, };
+		MPI_Allreduce(dof_l,dof_g,2,MPI_LONG_LONG_INT,MPI_MAX,MPI_COMM_WORLD);
+		dof_min = (ptrdiff_t)(-dof_g[0]);
+		dof_max = (ptrdiff_t)dof_g[1];
+	}
+	return ( dof_min == dof_max ? dof_max : 1 );
+}
+
 void update_ind_dof_T (const struct Simulation*const sim)
 {
 	ptrdiff_t dof = 0;
@@ -209,13 +267,30 @@ void update_ind_dof_T (const struct Simulation*const sim)
 		}
 	}
 
+	// The volume dof are numbered contiguously for each of the mpi processes (see \ref partition_volumes).
+	const int n_ranks = sim->mpi_size;
+	ptrdiff_t dof_rank[n_ranks+1];
+	for (int r = 0; r <= n_ranks; ++r)
+		dof_rank[r] = 0;
+
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Volume* vol = (struct Volume*) curr;
+		struct Multiarray_T* sol_coef = ((struct Solver_Volume_T*) curr)->sol_coef;
+		dof_rank[vol->rank+1] += compute_size(sol_coef->order,sol_coef->extents);
+	}
+	dof_rank[0] = dof;
+	for (int r = 0; r < n_ranks; ++r)
+		dof_rank[r+1] += dof_rank[r];
+	dof = dof_rank[n_ranks];
+
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Volume* vol = (struct Volume*) curr;
 		struct Solver_Volume_T* s_vol = (struct Solver_Volume_T*) curr;
 
-		const_cast_ptrdiff(&s_vol->ind_dof,dof);
+		const_cast_ptrdiff(&s_vol->ind_dof,dof_rank[vol->rank]);
 
 		struct Multiarray_T* sol_coef = s_vol->sol_coef;
-		dof += compute_size(sol_coef->order,sol_coef->extents);
+		dof_rank[vol->rank] += compute_size(sol_coef->order,sol_coef->extents);
 	}
 	assert(dof == compute_dof(sim));
 
@@ -233,10 +308,12 @@ static ptrdiff_t compute_dof_test_volumes
 
 static struct Vector_i* constructor_nnz (const struct Simulation*const sim)
 {
+	const struct Test_Case_T*const test_case = (struct Test_Case_T*) sim->test_case_rc->tc;
+
 	struct Vector_i* nnz = NULL;
 	switch (sim->method) {
-	case METHOD_DG:  nnz = constructor_nnz_dg_T(false,sim);  break;
-	case METHOD_DPG: nnz = constructor_nnz_dpg_T(false,sim); break;
+	case METHOD_DG:  nnz = constructor_nnz_dg_T(test_case->use_jfnk,sim); break;
+	case METHOD_DPG: nnz = constructor_nnz_dpg_T(false,test_case->use_schur_complement,sim); break;
 	case METHOD_OPG: // fallthrough
 	case METHOD_OPGC0:
 		nnz = constructor_nnz_opg_T(sim);
@@ -248,6 +325,82 @@ static struct Vector_i* constructor_nnz (const struct Simulation*const sim)
 	return nnz;
 }
 
+/** \brief Constructor for the array of the number of non-zero blocks in each of the block rows of the global matrix.
+ *  \return See brief.
+ *
+ *  As the nonzero pattern of the matrix is composed of complete blocks (see \ref compute_block_size_T), the number of
+ *  non-zero blocks is obtained from the number of non-zero entries in the first row of each block.
+ */
+static PetscInt* constructor_nnz_block
+	(const PetscInt*const nnz, ///< The number of non-zero entries in each row.
+	 const PetscInt n_row,     ///< The number of rows.
+	 const PetscInt bs         ///< The block size.
+	);
+
+static void constructor_petsc_mat_seq (struct Solver_Storage_Implicit*const ssi, const struct Vector_i*const nnz)
+{
+	const PetscInt dof = (PetscInt)nnz->ext_0,
+	               bs  = ssi->block_size;
+	if (bs <= 1) {
+		MatCreateSeqAIJ(MPI_COMM_WORLD,dof,dof,0,nnz->data,&ssi->A); // destructed
+		return;
+	}
+
+	PetscInt*const nnz_b = constructor_nnz_block(nnz->data,dof,bs); // free
+	MatCreateSeqBAIJ(MPI_COMM_WORLD,bs,dof,dof,0,nnz_b,&ssi->A); // destructed
+	free(nnz_b);
+}
+
+static void constructor_petsc_mat_vec_mpi
+	(struct Solver_Storage_Implicit*const ssi, const struct Vector_i*const nnz, const struct Simulation*const sim)
+{
+	const struct Test_Case_T*const test_case = (struct Test_Case_T*) sim->test_case_rc->tc;
+	// Only the volume dof are partitioned (see \ref partition.h).
+	if (sim->method != METHOD_DG || test_case->use_schur_complement)
+		EXIT_ERROR("Only the DG method without Schur complement is supported on multiple processes.\n");
+
+	PetscInt ind_dof_min = (PetscInt)nnz->ext_0,
+	         dof_local   = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+
+		struct Solver_Volume_T* s_vol = (struct Solver_Volume_T*) curr;
+		if (s_vol->ind_dof < ind_dof_min)
+			ind_dof_min = (PetscInt)s_vol->ind_dof;
+		dof_local += (PetscInt)compute_size(s_vol->sol_coef->order,s_vol->sol_coef->extents);
+	}
+
+	// There is no coupling between volumes on different processes if only the element-local blocks are stored.
+	struct Vector_i* nnz_o = ( !test_case->use_jfnk ? constructor_nnz_o_dg_T(sim)                // destructed
+	                                                : constructor_zero_Vector_i(nnz->ext_0) ); // destructed
+	PetscInt*const d_nnz = malloc((size_t)dof_local * sizeof *d_nnz), // free
+	        *const o_nnz = malloc((size_t)dof_local * sizeof *o_nnz); // free
+	for (PetscInt i = 0; i < dof_local; ++i) {
+		o_nnz[i] = nnz_o->data[ind_dof_min+i];
+		d_nnz[i] = nnz->data[ind_dof_min+i]-o_nnz[i];
+	}
+	destructor_Vector_i(nnz_o);
+
+	const PetscInt bs = ssi->block_size;
+	if (bs <= 1) {
+		MatCreateAIJ(MPI_COMM_WORLD,dof_local,dof_local,PETSC_DETERMINE,PETSC_DETERMINE,0,d_nnz,0,o_nnz,&ssi->A); // d.
+	} else {
+		PetscInt*const d_nnz_b = constructor_nnz_block(d_nnz,dof_local,bs), // free
+		        *const o_nnz_b = constructor_nnz_block(o_nnz,dof_local,bs); // free
+		MatCreateBAIJ(MPI_COMM_WORLD,bs,dof_local,dof_local,PETSC_DETERMINE,PETSC_DETERMINE,0,d_nnz_b,0,o_nnz_b,
+		              &ssi->A); // destructed
+		free(d_nnz_b);
+		free(o_nnz_b);
+	}
+	VecCreateMPI(MPI_COMM_WORLD,dof_local,PETSC_DETERMINE,&ssi->b); // destructed
+	free(d_nnz);
+	free(o_nnz);
+
+	MatGetOwnershipRange(ssi->A,&ssi->ind_dof_range[0],&ssi->ind_dof_range[1]);
+	assert(dof_local == 0 || ssi->ind_dof_range[0] == ind_dof_min);
+}
+
 static ptrdiff_t compute_dof_volumes (const struct Simulation*const sim)
 {
 	ptrdiff_t dof = 0;
@@ -303,6 +456,19 @@ static void update_ind_dof_test_T (const struct Simulation*const sim)
 
 // Level 1 ********************************************************************************************************** //
 
+static PetscInt* constructor_nnz_block (const PetscInt*const nnz, const PetscInt n_row, const PetscInt bs)
+{
+	assert(n_row % bs == 0);
+
+	const PetscInt n_row_b = n_row/bs;
+	PetscInt*const nnz_b = malloc((size_t)(n_row_b > 0 ? n_row_b : 1) * sizeof *nnz_b); // returned
+	for (PetscInt i = 0; i < n_row_b; ++i) {
+		assert(nnz[i*bs] % bs == 0);
+		nnz_b[i] = nnz[i*bs]/bs;
+	}
+	return nnz_b;
+}
+
 static ptrdiff_t compute_dof_test_volumes (const struct Simulation*const sim)
 {
 	ptrdiff_t dof = 0;
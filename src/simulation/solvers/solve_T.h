@@ -58,6 +58,22 @@ void initialize_zero_memory_volumes_T
 	(struct Intrusive_List* volumes ///< The list of volumes for which to set the memory.
 	);
 
+/** \brief Compute the block size of the global system matrix when stored in block sparse (BAIJ) format.
+ *  \return See brief.
+ *
+ *  The dof are ordered variable-major within each element (see \ref update_ind_dof_T) such that the `n_var x n_var`
+ *  point blocks which are typically used are not contiguous. Block storage is thus only used when all volumes (over
+ *  all processes) have the same number of dof, i.e. for the dg method on meshes with a single element type and uniform
+ *  order. The block is then the full (dense) element block such that the block ILU and Jacobi preconditioners operate
+ *  on the element blocks.
+ *
+ *  A value of 1 (i.e. scalar storage) is returned otherwise as the common divisor of the element dof generally
+ *  collapses to a size which does not reflect the coupling structure.
+ */
+ptrdiff_t compute_block_size_T
+	(const struct Simulation*const sim ///< Standard.
+	);
+
 /** \brief Update the global 'd'egree 'o'f 'f'reedom indices in \ref Solver_Volume_T and \ref Solver_Face_T based on the
  *         size of the allocated variable containers. */
 void update_ind_dof_T
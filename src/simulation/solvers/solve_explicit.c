@@ -18,6 +18,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "solve_explicit.h"
 
 #include <assert.h>
+#include <float.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
@@ -29,6 +31,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "definitions_tol.h"
 
 #include "computational_elements.h"
+#include "face.h"
 #include "volume_solver.h"
 #include "volume_solver_dg.h"
 
@@ -36,11 +39,29 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "intrusive.h"
 #include "simulation.h"
+#include "solution_pool.h"
 #include "solve.h"
+#include "solve_dg.h"
 #include "test_case.h"
 
 // Static function declarations ************************************************************************************* //
 
+/// \brief Container for the data relating to a stage of an explicit time-stepping method.
+struct Stage_Data {
+	double dt; ///< The time step (of the finest level of the local time stepping).
+	int rk;    ///< The index of the Runge-Kutta stage.
+};
+
+/// The `A` coefficients of the low-storage Runge-Kutta 5-stage, 4rd order method (see \ref time_step_ls_rk_54).
+static const double rk4a[] =
+	{  0.0,                             -567301805773.0 /1357537059087.0, -2404267990393.0/2016746695238.0,
+	  -3550918686646.0/2091501179385.0, -1275806237668.0/842570457699.0, };
+
+/// The `B` coefficients of the low-storage Runge-Kutta 5-stage, 4rd order method (see \ref time_step_ls_rk_54).
+static const double rk4b[] =
+	{  1432997174477.0/9575080441755.0,  5161836677717.0/13612068292357.0, 17201463215490.0/20902069494980.0,
+	   3134564353537.0/4481467310338.0,  2277821191437.0/14882151754819.0, };
+
 /** \brief Function pointer to a time-stepping function.
  *  \return The absolute value of the maximum rhs at the current time.
  *  \param dt  The time step.
@@ -57,6 +78,40 @@ static time_step_fptr set_time_step
 	(const struct Simulation* sim ///< \ref Simulation
 	);
 
+/** \brief Return the time step to be used for the next step of the explicit solve, setting the levels of the volumes
+ *         for the local time stepping if applicable.
+ *  \return See brief.
+ *
+ *  If \ref Test_Case_T::cfl_e is not positive, the fixed time step (\ref Test_Case_T::dt) is returned. Otherwise, the
+ *  time step is the minimum of the CFL constrained time steps of the volumes (see \ref compute_dt_cfl_dg) multiplied
+ *  by 2^(\ref Test_Case_T::n_lts_levels-1). The levels of the volumes are then reduced such that the levels of
+ *  neighbouring volumes differ by at most one, as required by the flux registers (see \ref set_up_flux_registers_dg).
+ */
+static double compute_time_step
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Advance the solution by the input time step using the local time stepping.
+ *  \return The absolute value of the maximum rhs at the current time.
+ *
+ *  The input time step is divided into 2^(n_lts_levels-1) sub-steps of the finest level. At sub-step `k`, the volumes
+ *  of level `l` are active if `k` is divisible by 2^l and are advanced by their time step (2^l times that of the finest
+ *  level) using the input time-stepping function while the solution of the inactive volumes is frozen. Global time
+ *  stepping is recovered when a single level is used.
+ *
+ *  The scheme is made conservative using flux registers (Berger and Colella): the face terms integrated by each volume
+ *  on the faces shared with finer neighbours are replaced by those integrated by the neighbours at the end of the time
+ *  step of the volume (see \ref update_flux_registers_dg and \ref apply_flux_registers_dg).
+ *
+ *  \note The solution of the neighbouring volumes of a different level is taken at the time of their most recent
+ *        update such that the scheme is only first order accurate in time at the interfaces between the levels.
+ */
+static double time_step_lts
+	(const double dt,                  ///< The time step.
+	 const time_step_fptr time_step,   ///< The time-stepping function.
+	 const struct Simulation*const sim ///< \ref Simulation.
+	);
+
 /// \brief Display the solver progress.
 static void display_progress
 	(const struct Test_Case* test_case, ///< \ref Test_Case_T.
@@ -90,17 +145,22 @@ void solve_explicit (struct Simulation* sim)
 
 	time_step_fptr time_step = set_time_step(sim);
 
+	// The per-volume solution data is stored contiguously for the duration of the explicit solve.
+	update_ind_dof_d(sim);
+	struct Solution_Pool*const sol_pool =
+		( test_case->use_solution_pool ? constructor_Solution_Pool(sim) : NULL ); // destructed
+	get_solver_stats()->members_in_pool = ( sol_pool ? check_members_in_Solution_Pool(sol_pool,sim) : false );
+
 	const double time_final = test_case->time_final;
-	double dt = test_case->dt;
 	assert(time_final >= 0.0);
 
 	double max_rhs0 = 0.0;
 	for (int t_step = 0; ; ++t_step) {
+		double dt = compute_time_step(sim);
 		if (test_case->time + dt > time_final-1e3*EPS)
 			dt = time_final - test_case->time;
-		test_case->time += dt;
 
-		const double max_rhs = time_step(dt,sim);
+		const double max_rhs = time_step_lts(dt,time_step,sim);
 		if (t_step == 0) {
 			max_rhs0 = max_rhs;
 			if (test_case->copy_initial_rhs)
@@ -112,6 +172,8 @@ void solve_explicit (struct Simulation* sim)
 			break;
 	}
 
+	if (sol_pool)
+		destructor_Solution_Pool(sol_pool,sim);
 	destructor_derived_computational_elements(sim,IL_SOLVER);
 	destructor_derived_Elements(sim,IL_ELEMENT_SOLVER);
 	test_case->solver_method_curr = 0;
@@ -147,6 +209,12 @@ static double time_step_ls_rk_54
 	 const struct Simulation* sim ///< Defined for \ref time_step_fptr.
 	);
 
+/** \brief Reduce the \ref DG_Solver_Volume_T::lts_level of the volumes until the levels of all pairs of neighbouring
+ *         volumes differ by at most one. */
+static void limit_lts_level_jumps
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
 static time_step_fptr set_time_step (const struct Simulation* sim)
 {
 	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
@@ -168,6 +236,81 @@ static time_step_fptr set_time_step (const struct Simulation* sim)
 	}
 }
 
+static double compute_time_step (const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*)sim->test_case_rc->tc;
+	if (!(test_case->cfl_e > 0.0))
+		return test_case->dt;
+
+	/* The explicit solution update is performed for all of the volumes on each of the processes such that the time
+	 * step and the levels are identical on all processes without communication. */
+	ptrdiff_t n_v = 0;
+	struct Intrusive_Link**const vols = constructor_array_Link(sim->volumes,&n_v); // freed
+	double*const dt_v = malloc((size_t)n_v * sizeof *dt_v); // freed
+
+	double dt_min = DBL_MAX;
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		dt_v[v] = compute_dt_cfl_dg(test_case->cfl_e,true,(struct Solver_Volume*)vols[v],sim);
+		if (dt_v[v] < dt_min)
+			dt_min = dt_v[v];
+	}
+	assert(dt_min > 0.0 && dt_min < DBL_MAX);
+
+	const int n_levels = test_case->n_lts_levels;
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		int lts_level = (int)floor(log2(dt_v[v]/dt_min));
+		if (lts_level < 0)
+			lts_level = 0;
+		else if (lts_level > n_levels-1)
+			lts_level = n_levels-1;
+		((struct DG_Solver_Volume*)vols[v])->lts_level = lts_level;
+	}
+	free(dt_v);
+
+	if (n_levels > 1) {
+		limit_lts_level_jumps(sim);
+		set_up_flux_registers_dg(sim);
+	}
+
+	struct Solver_Stats*const stats = get_solver_stats();
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		const int lts_level = ((struct DG_Solver_Volume*)vols[v])->lts_level;
+		if (lts_level+1 > stats->n_lts_levels)
+			stats->n_lts_levels = lts_level+1;
+	}
+	free(vols);
+
+	return dt_min*(double)(1 << (n_levels-1));
+}
+
+static double time_step_lts (const double dt, const time_step_fptr time_step, const struct Simulation*const sim)
+{
+	struct Test_Case*const test_case = (struct Test_Case*)sim->test_case_rc->tc;
+
+	const int n_sub = 1 << (test_case->n_lts_levels-1);
+	const double dt_f   = dt/n_sub,
+	             time_0 = test_case->time;
+
+	// All volumes are active for the first sub-step.
+	get_set_lts_level_max((int[]){INT_MAX});
+
+	double max_rhs = 0.0;
+	for (int k = 0; k < n_sub; ++k) {
+		test_case->time = ( k == n_sub-1 ? time_0+dt : time_0+(k+1)*dt_f );
+		const double max_rhs_k = time_step(dt_f,sim);
+		if (k == 0)
+			max_rhs = max_rhs_k;
+
+		// The volumes active for the next sub-step have completed their time step and their flux registers are applied.
+		const int lts_level_max = ( k == n_sub-1 ? INT_MAX : __builtin_ctz((unsigned)(k+1)) );
+		get_set_lts_level_max(&lts_level_max);
+		if (n_sub > 1)
+			apply_flux_registers_dg(sim);
+	}
+
+	return max_rhs;
+}
+
 static void display_progress
 	(const struct Test_Case* test_case, const int t_step, const double max_rhs, const double max_rhs0)
 {
@@ -223,30 +366,44 @@ static bool check_exit (const struct Test_Case* test_case, const double max_rhs,
 
 // Level 1 ********************************************************************************************************** //
 
+/** \brief Call \ref compute_rhs_update_dg for the input stage, also updating the flux registers of the local time
+ *         stepping if applicable (see \ref update_flux_registers_dg).
+ *  \return See \ref compute_rhs_update_dg. */
+static double compute_rhs_update_lts
+	(const struct Simulation*const sim,        ///< \ref Simulation.
+	 const update_stage_fptr update_stage,     ///< Defined for \ref compute_rhs_update_dg.
+	 const struct Stage_Data*const stage_data, ///< \ref Stage_Data.
+	 const double b_rk                         ///< The weight of the rhs of the stage in the complete time step.
+	);
+
+/// \brief Version of \ref update_stage_fptr for \ref time_step_euler.
+static void update_stage_euler
+	(struct Solver_Volume*const s_vol, ///< Defined for \ref update_stage_fptr.
+	 const void*const stage_data,      ///< Defined for \ref update_stage_fptr.
+	 const struct Simulation*const sim ///< Defined for \ref update_stage_fptr.
+	);
+
+/// \brief Version of \ref update_stage_fptr for \ref time_step_ssp_rk_33.
+static void update_stage_ssp_rk_33
+	(struct Solver_Volume*const s_vol, ///< Defined for \ref update_stage_fptr.
+	 const void*const stage_data,      ///< Defined for \ref update_stage_fptr.
+	 const struct Simulation*const sim ///< Defined for \ref update_stage_fptr.
+	);
+
+/// \brief Version of \ref update_stage_fptr for \ref time_step_ls_rk_54.
+static void update_stage_ls_rk_54
+	(struct Solver_Volume*const s_vol, ///< Defined for \ref update_stage_fptr.
+	 const void*const stage_data,      ///< Defined for \ref update_stage_fptr.
+	 const struct Simulation*const sim ///< Defined for \ref update_stage_fptr.
+	);
+
 static double time_step_euler (const double dt, const struct Simulation* sim)
 {
 	assert(sim->method == METHOD_DG);
 	assert(sim->volumes->name == IL_VOLUME_SOLVER_DG);
 	assert(sim->faces->name   == IL_FACE_SOLVER_DG);
 
-	const double max_rhs = compute_rhs(sim);
-	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
-
-		struct Multiarray_d* sol_coef = s_vol->sol_coef,
-		                   * rhs      = s_vol->rhs;
-
-		double* data_s   = sol_coef->data,
-		      * data_rhs = rhs->data;
-
-		const ptrdiff_t i_max = compute_size(sol_coef->order,sol_coef->extents);
-		assert(i_max == compute_size(rhs->order,rhs->extents));
-
-		for (ptrdiff_t i = 0; i < i_max; ++i)
-			data_s[i] += dt*data_rhs[i];
-		enforce_positivity_highorder(s_vol,sim);
-	}
-	return max_rhs;
+	return compute_rhs_update_lts(sim,update_stage_euler,&(struct Stage_Data){ .dt = dt, .rk = 0, },1.0);
 }
 
 static double time_step_ssp_rk_33 (const double dt, const struct Simulation* sim)
@@ -255,46 +412,13 @@ static double time_step_ssp_rk_33 (const double dt, const struct Simulation* sim
 	assert(sim->volumes->name == IL_VOLUME_SOLVER_DG);
 	assert(sim->faces->name   == IL_FACE_SOLVER_DG);
 
+	// The weights of the stage rhs terms in the complete time step (from the Butcher tableau).
+	static const double b_rk[] = { 1.0/6.0, 1.0/6.0, 2.0/3.0, };
+
 	double max_rhs = 0.0;
 	for (int rk = 0; rk < 3; rk++) {
-		max_rhs = compute_rhs(sim);
-		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-			struct Solver_Volume*    s_vol    = (struct Solver_Volume*) curr;
-			struct DG_Solver_Volume* s_vol_dg = (struct DG_Solver_Volume*) curr;
-
-			struct Multiarray_d* sol_coef   = s_vol->sol_coef,
-			                   * sol_coef_p = s_vol_dg->sol_coef_p,
-			                   * rhs        = s_vol->rhs;
-
-			double* data_s   = sol_coef->data,
-			      * data_sp  = sol_coef_p->data,
-			      * data_rhs = rhs->data;
-
-			const ptrdiff_t i_max = compute_size(sol_coef->order,sol_coef->extents);
-			assert(i_max == compute_size(sol_coef_p->order,sol_coef_p->extents));
-			assert(i_max == compute_size(rhs->order,rhs->extents));
-
-			switch (rk) {
-			case 0:
-				for (ptrdiff_t i = 0; i < i_max; ++i) {
-					data_sp[i]  = data_s[i];
-					data_s[i]  += dt*data_rhs[i];
-				}
-				break;
-			case 1:
-				for (ptrdiff_t i = 0; i < i_max; ++i)
-					data_s[i] = (1.0/4.0)*(3.0*data_sp[i] + data_s[i] + dt*data_rhs[i]);
-				break;
-			case 2:
-				for (ptrdiff_t i = 0; i < i_max; ++i)
-					data_s[i] = (1.0/3.0)*(data_sp[i] + 2.0*data_s[i] + 2.0*dt*data_rhs[i]);
-				break;
-			default:
-				EXIT_ERROR("Unsupported: %d\n",rk);
-				break;
-			}
-			enforce_positivity_highorder(s_vol,sim);
-		}
+		const struct Stage_Data s_data = { .dt = dt, .rk = rk, };
+		max_rhs = compute_rhs_update_lts(sim,update_stage_ssp_rk_33,&s_data,b_rk[rk]);
 	}
 
 	return max_rhs;
@@ -306,45 +430,162 @@ static double time_step_ls_rk_54 (const double dt, const struct Simulation* sim)
 	assert(sim->volumes->name == IL_VOLUME_SOLVER_DG);
 	assert(sim->faces->name   == IL_FACE_SOLVER_DG);
 
-	static const double rk4a[] =
-		{  0.0,                             -567301805773.0 /1357537059087.0, -2404267990393.0/2016746695238.0,
-		  -3550918686646.0/2091501179385.0, -1275806237668.0/842570457699.0, };
-	static const double rk4b[] =
-		{  1432997174477.0/9575080441755.0,  5161836677717.0/13612068292357.0, 17201463215490.0/20902069494980.0,
-		   3134564353537.0/4481467310338.0,  2277821191437.0/14882151754819.0, };
-	static const double rk4c[] =
-		{  0.0,                              1432997174477.0/9575080441755.0,  2526269341429.0/6820363962896.0,
-		   2006345519317.0/3224310063776.0,  2802321613138.0/2924317926251.0, };
-
-	UNUSED(rk4c);
+	/* The weight of the rhs of stage `j` in the complete time step is the sum over the subsequent stages `s` of
+	 * rk4b[s] multiplied by the product of rk4a[m] for m = j+1, ..., s. */
+	double b_rk[5] = { 0.0, };
+	for (int j = 0; j < 5; ++j) {
+		double prod_a = 1.0;
+		for (int s = j; s < 5; ++s) {
+			if (s > j)
+				prod_a *= rk4a[s];
+			b_rk[j] += rk4b[s]*prod_a;
+		}
+	}
 
 	double max_rhs = 0.0;
 	for (int rk = 0; rk < 5; rk++) {
-		max_rhs = compute_rhs(sim);
-		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
-			struct Solver_Volume*    s_vol    = (struct Solver_Volume*) curr;
-			struct DG_Solver_Volume* s_vol_dg = (struct DG_Solver_Volume*) curr;
-
-			struct Multiarray_d* sol_coef   = s_vol->sol_coef,
-			                   * sol_coef_p = s_vol_dg->sol_coef_p,
-			                   * rhs        = s_vol->rhs;
-
-			double* data_s   = sol_coef->data,
-			      * data_sp  = sol_coef_p->data,
-			      * data_rhs = rhs->data;
-
-			const ptrdiff_t i_max = compute_size(sol_coef->order,sol_coef->extents);
-			assert(i_max == compute_size(sol_coef_p->order,sol_coef_p->extents));
-			assert(i_max == compute_size(rhs->order,rhs->extents));
-
-			for (ptrdiff_t i = 0; i < i_max; ++i) {
-				data_sp[i] *= rk4a[rk];
-				data_sp[i] += dt*data_rhs[i];
-				data_s[i]  += rk4b[rk]*data_sp[i];
+		const struct Stage_Data s_data = { .dt = dt, .rk = rk, };
+		max_rhs = compute_rhs_update_lts(sim,update_stage_ls_rk_54,&s_data,b_rk[rk]);
+	}
+
+	return max_rhs;
+}
+
+static void limit_lts_level_jumps (const struct Simulation*const sim)
+{
+	for (bool changed = true; changed; ) {
+		changed = false;
+		for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+			const struct Face*const face = (struct Face*) curr;
+			if (face->boundary)
+				continue;
+
+			struct DG_Solver_Volume*const dg_s_vol[2] =
+				{ (struct DG_Solver_Volume*) face->neigh_info[0].volume,
+				  (struct DG_Solver_Volume*) face->neigh_info[1].volume, };
+			const int ind_c = ( dg_s_vol[0]->lts_level > dg_s_vol[1]->lts_level ? 0 : 1 ),
+			          lts_level_max = dg_s_vol[1-ind_c]->lts_level+1;
+			if (dg_s_vol[ind_c]->lts_level > lts_level_max) {
+				dg_s_vol[ind_c]->lts_level = lts_level_max;
+				changed = true;
 			}
-			enforce_positivity_highorder(s_vol,sim);
 		}
 	}
+}
+
+// Level 2 ********************************************************************************************************** //
+
+/** \brief Return the time step of the input volume for the current sub-step of the local time stepping.
+ *  \return The input time step multiplied by 2^\ref DG_Solver_Volume_T::lts_level. */
+static double compute_dt_volume
+	(const double dt,                             ///< The time step of the finest level.
+	 const struct DG_Solver_Volume*const dg_s_vol ///< \ref DG_Solver_Volume_T.
+	);
+
+static double compute_rhs_update_lts
+	(const struct Simulation*const sim, const update_stage_fptr update_stage,
+	 const struct Stage_Data*const stage_data, const double b_rk)
+{
+	const double max_rhs = compute_rhs_update_dg(sim,update_stage,stage_data);
 
+	const struct Test_Case*const test_case = (struct Test_Case*)sim->test_case_rc->tc;
+	if (test_case->n_lts_levels > 1)
+		update_flux_registers_dg(b_rk*stage_data->dt,sim);
 	return max_rhs;
 }
+
+static void update_stage_euler
+	(struct Solver_Volume*const s_vol, const void*const stage_data, const struct Simulation*const sim)
+{
+	const struct Stage_Data*const s_data = stage_data;
+	const double dt_v = compute_dt_volume(s_data->dt,(struct DG_Solver_Volume*)s_vol);
+
+	struct Multiarray_d* sol_coef = s_vol->sol_coef,
+	                   * rhs      = s_vol->rhs;
+
+	double* data_s   = sol_coef->data,
+	      * data_rhs = rhs->data;
+
+	const ptrdiff_t i_max = compute_size(sol_coef->order,sol_coef->extents);
+	assert(i_max == compute_size(rhs->order,rhs->extents));
+
+	for (ptrdiff_t i = 0; i < i_max; ++i)
+		data_s[i] += dt_v*data_rhs[i];
+	enforce_positivity_highorder(s_vol,sim);
+}
+
+static void update_stage_ssp_rk_33
+	(struct Solver_Volume*const s_vol, const void*const stage_data, const struct Simulation*const sim)
+{
+	const struct Stage_Data*const s_data = stage_data;
+	struct DG_Solver_Volume*const s_vol_dg = (struct DG_Solver_Volume*) s_vol;
+	const double dt_v = compute_dt_volume(s_data->dt,s_vol_dg);
+
+	struct Multiarray_d* sol_coef   = s_vol->sol_coef,
+	                   * sol_coef_p = s_vol_dg->sol_coef_p,
+	                   * rhs        = s_vol->rhs;
+
+	double* data_s   = sol_coef->data,
+	      * data_sp  = sol_coef_p->data,
+	      * data_rhs = rhs->data;
+
+	const ptrdiff_t i_max = compute_size(sol_coef->order,sol_coef->extents);
+	assert(i_max == compute_size(sol_coef_p->order,sol_coef_p->extents));
+	assert(i_max == compute_size(rhs->order,rhs->extents));
+
+	switch (s_data->rk) {
+	case 0:
+		for (ptrdiff_t i = 0; i < i_max; ++i) {
+			data_sp[i]  = data_s[i];
+			data_s[i]  += dt_v*data_rhs[i];
+		}
+		break;
+	case 1:
+		for (ptrdiff_t i = 0; i < i_max; ++i)
+			data_s[i] = (1.0/4.0)*(3.0*data_sp[i] + data_s[i] + dt_v*data_rhs[i]);
+		break;
+	case 2:
+		for (ptrdiff_t i = 0; i < i_max; ++i)
+			data_s[i] = (1.0/3.0)*(data_sp[i] + 2.0*data_s[i] + 2.0*dt_v*data_rhs[i]);
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",s_data->rk);
+		break;
+	}
+	enforce_positivity_highorder(s_vol,sim);
+}
+
+static void update_stage_ls_rk_54
+	(struct Solver_Volume*const s_vol, const void*const stage_data, const struct Simulation*const sim)
+{
+	const struct Stage_Data*const s_data = stage_data;
+	struct DG_Solver_Volume*const s_vol_dg = (struct DG_Solver_Volume*) s_vol;
+	const double dt_v = compute_dt_volume(s_data->dt,s_vol_dg);
+	const int rk = s_data->rk;
+
+	struct Multiarray_d* sol_coef   = s_vol->sol_coef,
+	                   * sol_coef_p = s_vol_dg->sol_coef_p,
+	                   * rhs        = s_vol->rhs;
+
+	double* data_s   = sol_coef->data,
+	      * data_sp  = sol_coef_p->data,
+	      * data_rhs = rhs->data;
+
+	const ptrdiff_t i_max = compute_size(sol_coef->order,sol_coef->extents);
+	assert(i_max == compute_size(sol_coef_p->order,sol_coef_p->extents));
+	assert(i_max == compute_size(rhs->order,rhs->extents));
+
+	for (ptrdiff_t i = 0; i < i_max; ++i) {
+		data_sp[i] *= rk4a[rk];
+		data_sp[i] += dt_v*data_rhs[i];
+		data_s[i]  += rk4b[rk]*data_sp[i];
+	}
+	enforce_positivity_highorder(s_vol,sim);
+}
+
+// Level 3 ********************************************************************************************************** //
+
+static double compute_dt_volume (const double dt, const struct DG_Solver_Volume*const dg_s_vol)
+{
+	return dt*(double)(1 << dg_s_vol->lts_level);
+}
@@ -26,6 +26,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "petscvec.h"
 
 #include "macros.h"
+#include "definitions_adaptation.h"
 #include "definitions_intrusive.h"
 #include "definitions_physics.h"
 #include "definitions_test_case.h"
@@ -39,15 +40,21 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "multiarray.h"
 #include "vector.h"
 
+#include "adaptation.h"
 #include "computational_elements.h"
+#include "compute_all_rlhs_dpg.h"
 #include "compute_volume_rlhs_opg.h"
 #include "compute_face_rlhs_opg.h"
 #include "intrusive.h"
 #include "math_functions.h"
 #include "multiarray_operator.h"
 #include "operator.h"
+#include "p_multigrid.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solution_euler.h"
+#include "solution_pool.h"
 #include "solve.h"
 #include "solve_dg.h"
 #include "solve_dpg.h"
@@ -66,6 +73,37 @@ You should have received a copy of the GNU General Public License along with DPG
 #define OUTPUT_STEP       500   ///< Iteration step at which to output the solution if enabled.
 ///\}
 
+/// \brief Container for data relating to the implicit solver which may be reused across implicit steps.
+struct Implicit_Storage {
+	/** Flag for whether the members are reused across implicit steps (see \ref check_persistent_storage). If
+	 *  `false`, the members are constructed and destructed at each step. */
+	const bool persistent;
+
+	struct Solver_Storage_Implicit* ssi; ///< \ref Solver_Storage_Implicit.
+	KSP ksp;                             ///< The Petsc `KSP` context.
+
+	/** \ref Solution_Pool (`NULL` if not used). This is constructed during the first implicit step and persists for
+	 *  all implicit steps as the mesh is not modified while in \ref solve_implicit. */
+	struct Solution_Pool* sol_pool;
+};
+
+/** \brief Check whether the implicit solver storage can be reused across implicit steps.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_persistent_storage
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Check whether a \ref Solution_Pool should be used for the per-volume solution data.
+ *  \return `true` if yes; `false` otherwise. */
+static bool check_solution_pool
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/// \brief Destructor for the members of a \ref Implicit_Storage container.
+static void destructor_Implicit_Storage_members
+	(struct Implicit_Storage*const imp_s ///< Standard.
+	);
+
 /// \brief Constructor for the derived element and computational element lists.
 static void constructor_derived_elements_comp_elements
 	(struct Simulation* sim ///< \ref Simulation.
@@ -79,8 +117,9 @@ static void destructor_derived_elements_comp_elements
 /** \brief Perform one implicit step.
  *  \return The absolute value of the maximum rhs for the current solution. */
 static double implicit_step
-	(const int i_step,            ///< The current implicit step.
-	 const struct Simulation* sim ///< \ref Simulation.
+	(const int i_step,                    ///< The current implicit step.
+	 struct Implicit_Storage*const imp_s, ///< \ref Implicit_Storage.
+	 const struct Simulation* sim         ///< \ref Simulation.
 	);
 
 /** \brief Check the exit conditions.
@@ -90,6 +129,26 @@ static bool check_exit
 	 const double max_rhs               ///< The current maximum value of the rhs term.
 	);
 
+/** \brief Compute the \ref Solver_Volume_T::error_ind values for the converged solution if required for automatic
+ *         adaptation (see \ref Test_Case_T::adapt_marking).
+ *
+ *  The DPG error indicators are computed as part of an additional rlhs computation for the converged solution (see
+ *  \ref Test_Case_T::compute_error_ind) as they require the solution of a dense system for each volume, and are thus
+ *  not computed during the implicit steps. The DG indicators are computed during the marking.
+ */
+static void compute_error_indicators
+	(struct Implicit_Storage*const imp_s, ///< \ref Implicit_Storage.
+	 const struct Simulation*const sim    ///< \ref Simulation.
+	);
+
+/** \brief Adapt the computational elements based on the error indicators if automatic adaptation is enabled and the
+ *         limits on the number of cycles and degrees of freedom have not been reached.
+ *  \return `true` if the computational elements were adapted; `false` otherwise. */
+static bool adapt_solution
+	(const int i_adapt,          ///< The index of the current adaptation cycle.
+	 struct Simulation*const sim ///< \ref Simulation.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 void solve_implicit (struct Simulation* sim)
@@ -97,14 +156,29 @@ void solve_implicit (struct Simulation* sim)
 	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
 	test_case->solver_method_curr = 'i';
 
-	constructor_derived_elements_comp_elements(sim); // destructed
-	for (int i_step = 0; ; ++i_step) {
-		const double max_rhs = implicit_step(i_step,sim);
+	for (int i_adapt = 0; ; ++i_adapt) {
+		constructor_derived_elements_comp_elements(sim); // destructed
+
+		/* The solver storage is constructed during the first implicit step and is thus rebuilt for each adaptation
+		 * cycle as the mesh (and \ref Solver_Volume_T::ind_dof) has been modified. */
+		struct Implicit_Storage imp_s =
+			{ .persistent = check_persistent_storage(sim), .ssi = NULL, .ksp = NULL, .sol_pool = NULL, };
+		for (int i_step = 0; ; ++i_step) {
+			const double max_rhs = implicit_step(i_step,&imp_s,sim);
 
-		if (check_exit(test_case,max_rhs))
+			if (check_exit(test_case,max_rhs))
+				break;
+		}
+		compute_error_indicators(&imp_s,sim);
+
+		destructor_Implicit_Storage_members(&imp_s);
+		if (imp_s.sol_pool)
+			destructor_Solution_Pool(imp_s.sol_pool,sim);
+		destructor_derived_elements_comp_elements(sim);
+
+		if (!adapt_solution(i_adapt,sim))
 			break;
 	}
-	destructor_derived_elements_comp_elements(sim);
 
 	test_case->solver_method_curr = 0;
 }
@@ -189,10 +263,10 @@ static void output_solution
 /** \brief Solve the global system of equations and update the coefficients corresponding to the dof.
  *  \return Petsc error code. */
 static PetscErrorCode solve_and_update
-	(const double max_rhs,                      ///< The maximum of the rhs terms.
-	 const int i_step,                          ///< Defined for \ref implicit_step.
-	 const struct Solver_Storage_Implicit* ssi, ///< \ref Solver_Storage_Implicit.
-	 const struct Simulation* sim               ///< \ref Simulation.
+	(const double max_rhs,                ///< The maximum of the rhs terms.
+	 const int i_step,                    ///< Defined for \ref implicit_step.
+	 struct Implicit_Storage*const imp_s, ///< \ref Implicit_Storage.
+	 const struct Simulation* sim         ///< \ref Simulation.
 	);
 
 /** \brief Check if the pde under consideration is linear.
@@ -201,6 +275,25 @@ static bool check_pde_linear
 	(const int pde_index ///< \ref Test_Case_T::pde_index.
 	);
 
+static bool check_persistent_storage (const struct Simulation*const sim)
+{
+	// The C0 Mat/Vec are constructed from the assembled Mat/Vec at each step.
+	return sim->method != METHOD_OPGC0;
+}
+
+static bool check_solution_pool (const struct Simulation*const sim)
+{
+	return ((struct Test_Case*)sim->test_case_rc->tc)->use_solution_pool;
+}
+
+static void destructor_Implicit_Storage_members (struct Implicit_Storage*const imp_s)
+{
+	if (imp_s->ssi)
+		destructor_Solver_Storage_Implicit(imp_s->ssi);
+	imp_s->ssi = NULL;
+	KSPDestroy(&imp_s->ksp);
+}
+
 static void constructor_derived_elements_comp_elements (struct Simulation* sim)
 {
 	switch (sim->method) {
@@ -229,9 +322,19 @@ static void destructor_derived_elements_comp_elements (struct Simulation* sim)
 	destructor_derived_Elements(sim,IL_ELEMENT_SOLVER);
 }
 
-static double implicit_step (const int i_step, const struct Simulation* sim)
+static double implicit_step (const int i_step, struct Implicit_Storage*const imp_s, const struct Simulation* sim)
 {
-	struct Solver_Storage_Implicit* ssi = constructor_Solver_Storage_Implicit(sim); // destructed
+	if (!imp_s->ssi)
+		imp_s->ssi = constructor_Solver_Storage_Implicit(sim); // destructed
+	else
+		reset_Solver_Storage_Implicit(imp_s->ssi);
+	struct Solver_Storage_Implicit*const ssi = imp_s->ssi;
+
+	if (!imp_s->sol_pool && check_solution_pool(sim)) {
+		imp_s->sol_pool = constructor_Solution_Pool(sim); // destructed
+		get_solver_stats()->members_in_pool = check_members_in_Solution_Pool(imp_s->sol_pool,sim);
+	}
+	++get_solver_stats()->n_steps_i;
 
 	printf("\tCompute rlhs.\n");
 	const double max_rhs = compute_rlhs(sim,ssi);
@@ -242,15 +345,18 @@ static double implicit_step (const int i_step, const struct Simulation* sim)
 			copy_rhs(sim,ssi);
 	}
 
+	start_profile(PROF_ASSEMBLY);
 	petsc_mat_vec_assemble(ssi);
+	stop_profile(PROF_ASSEMBLY);
 	if (OUTPUT_PETSC_AB)
 		output_petsc_mat_vec(ssi->A,ssi->b,sim);
 
 	if (OUTPUT_SOLUTION && i_step == OUTPUT_STEP)
 		output_solution(i_step,(struct Simulation*)sim);
 
-	solve_and_update(max_rhs,i_step,ssi,sim);
-	destructor_Solver_Storage_Implicit(ssi);
+	solve_and_update(max_rhs,i_step,imp_s,sim);
+	if (!imp_s->persistent)
+		destructor_Implicit_Storage_members(imp_s);
 
 	return max_rhs;
 }
@@ -280,22 +386,46 @@ static bool check_exit (const struct Test_Case* test_case, const double max_rhs)
 	return exit_now;
 }
 
-// Level 1 ********************************************************************************************************** //
+static void compute_error_indicators (struct Implicit_Storage*const imp_s, const struct Simulation*const sim)
+{
+	struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	if (test_case->adapt_marking == ADAPT_MARK_NONE || sim->method != METHOD_DPG)
+		return;
+
+	if (!imp_s->ssi)
+		imp_s->ssi = constructor_Solver_Storage_Implicit(sim); // destructed
+	else
+		reset_Solver_Storage_Implicit(imp_s->ssi);
+
+	test_case->compute_error_ind = true;
+	compute_rlhs(sim,imp_s->ssi);
+	test_case->compute_error_ind = false;
+}
 
-#define N_SCHUR 4 ///< The number of sub-blocks extracted for the Schur complement.
+static bool adapt_solution (const int i_adapt, struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	if (test_case->adapt_marking == ADAPT_MARK_NONE || i_adapt >= test_case->adapt_n_max)
+		return false;
 
-/// \brief Container for data relating to Schur complement of the input matrix and vector.
-struct Schur_Data {
-	PetscInt* idx[2]; ///< The indices to be stored in the index sets.
+	const ptrdiff_t n_dof_prev = compute_dof_schur('v',sim);
+	if (test_case->adapt_dof_max > 0 && n_dof_prev >= test_case->adapt_dof_max) {
+		printf("Complete: the adaptation dof budget has been reached.\n");
+		return false;
+	}
 
-	/** The index sets corresponding to the two regions of the square matrix to be decomposed into the Schur
-	 *  complement components. Note that only two index sets are provided as the row and column sets are the same
-	 *  for symmetric matrices. */
-	IS is[2];
+	adapt_hp(sim,ADAPT_S_INDICATOR,NULL);
 
-	Mat* submat;   ///< The array of sub-matrices.
-	Vec subvec[2]; ///< The array of sub-vectors.
-};
+	const ptrdiff_t n_dof = compute_dof_schur('v',sim);
+	printf("Adaptation cycle %d: volume dof %td -> %td.\n",i_adapt,n_dof_prev,n_dof);
+	if (n_dof == n_dof_prev) {
+		printf("Complete: no volumes were marked for adaptation.\n");
+		return false;
+	}
+	return true;
+}
+
+// Level 1 ********************************************************************************************************** //
 
 /// \brief Output a PETSc Vec to the file of given input name.
 static void output_petsc_vec
@@ -303,19 +433,27 @@ static void output_petsc_vec
 	 const char* file_name ///< The file name.
 	);
 
-/// \brief Output the Schur complement sub-matrices and sub-vectors to a file for visualization.
-static void output_petsc_schur
-	(Mat A,                       ///< The petsc Mat.
-	 Vec b,                       ///< The petsc Vec.
-	 const struct Simulation* sim ///< \ref Simulation.
-	);
-
 /** \brief Constructor for the `x` petsc Vec in "Ax = b" which is initialized to `b`.
  *  \return See brief. */
 static Vec constructor_petsc_x
 	(Vec b ///< \ref Solver_Storage_Implicit::b.
 	);
 
+/** \brief Update the operators of the persistent petsc `KSP` context for the current implicit step.
+ *  \return The Petsc error code.
+ *
+ *  As the nonzero pattern of the matrix is unchanged, the symbolic factorization is reused (the Petsc Mat nonzero state
+ *  replaces the deprecated `SAME_NONZERO_PATTERN` flag) and the preconditioner is recomputed once every
+ *  \ref Test_Case_T::lag_pc_i steps. Note that lagging the preconditioner when using the direct solver results in a
+ *  chord-like iteration using the factorization of the Jacobian from a previous step. */
+static PetscErrorCode update_petsc_ksp
+	(KSP ksp,                          ///< The Petsc KSP.
+	 Mat A,                            ///< The matrix defining the linear system.
+	 Mat P,                            ///< The matrix from which the preconditioner is constructed.
+	 const int i_step,                 ///< Defined for \ref implicit_step.
+	 const struct Test_Case* test_case ///< \ref Test_Case_T.
+	);
+
 /// \brief Destructor for the `x` petsc Vec.
 static void destructor_petsc_x
 	(Vec x ///< Standard.
@@ -325,10 +463,18 @@ static void destructor_petsc_x
  *  \return The Petsc error code. */
 static PetscErrorCode constructor_petsc_ksp
 	(KSP*const ksp,               ///< Pointer to the Petsc KSP.
-	 Mat A,                       ///< The matrix.
+	 Mat A,                       ///< The matrix defining the linear system.
+	 Mat P,                       ///< The matrix from which the preconditioner is constructed.
 	 const struct Simulation* sim ///< \ref Simulation.
 	);
 
+/** \brief Update the members of \ref Solver_Stats relating to the lhs matrix and the `KSP` context.
+ *  \return The Petsc error code. */
+static PetscErrorCode update_solver_stats
+	(KSP ksp,                                       ///< The Petsc KSP.
+	 const struct Solver_Storage_Implicit*const ssi ///< Standard.
+	);
+
 /** \brief Convert the input vector of solved values corresponding to the C0 dof to those of the L2 dof by duplicating
  *         entries corresponding to the same node.
  *  \return The Petsc error code or 0 if no error. */
@@ -337,10 +483,20 @@ static PetscErrorCode convert_x_to_L2
 	 const struct Solver_Storage_Implicit*const ssi ///< Standard.
 	 );
 
+/** \brief Replace the input distributed vector of solved values with a sequential copy of the full vector on each of
+ *         the processes.
+ *  \return The Petsc error code or 0 if no error.
+ *
+ *  This is required as the solution coefficients are currently replicated on all processes (see \ref partition.h). */
+static PetscErrorCode gather_x
+	(Vec* x ///< The solution vector.
+	);
+
 /// \brief Update the values of coefficients based on the computed increment.
 static void update_coefs
-	(Vec x,                       ///< Petsc Vec holding the solution coefficient increments.
-	 const struct Simulation* sim ///< \ref Simulation.
+	(Vec x,                               ///< Petsc Vec holding the solution coefficient increments.
+	 struct Solution_Pool*const sol_pool, ///< \ref Implicit_Storage::sol_pool.
+	 const struct Simulation* sim         ///< \ref Simulation.
 	);
 
 /// \brief Display the solver progress.
@@ -351,29 +507,12 @@ static void display_progress
 	 KSP ksp                            ///< Petsc `KSP` context.
 	);
 
-/** \brief Constructor for a \ref Schur_Data container.
- *  \return See brief. */
-static struct Schur_Data* constructor_Schur_Data
-	(Mat A,                       ///< The full PETSc Mat.
-	 Vec b,                       ///< The full PETSc Vec.
-	 const struct Simulation* sim ///< \ref Simulation.
-	);
-
-/// \brief Destructor for a \ref Schur_Data container.
-static void destructor_Schur_Data
-	(Vec b,                        ///< The full PETSc Vec from which the sub-vectors were obtained.
-	 struct Schur_Data* schur_data ///< See brief.
-	);
-
 static void output_petsc_mat_vec (Mat A, Vec b, const struct Simulation* sim)
 {
 	printf("Outputting A and b.\n");
 	output_petsc_mat(A,"A.m");
 	output_petsc_vec(b,"b.m");
-
-	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
-	if (test_case->use_schur_complement)
-		output_petsc_schur(A,b,sim);
+	UNUSED(sim);
 
 	if (EXIT_ON_OUTPUT)
 		EXIT_ERROR("Set OUTPUT_PETSC_AB to 'false' to continue.");
@@ -391,65 +530,36 @@ static void output_solution (const int i_step, struct Simulation*const sim)
 }
 
 static PetscErrorCode solve_and_update
-	(const double max_rhs, const int i_step, const struct Solver_Storage_Implicit* ssi, const struct Simulation* sim)
+	(const double max_rhs, const int i_step, struct Implicit_Storage*const imp_s, const struct Simulation* sim)
 {
-	KSP ksp = NULL;
+	const struct Solver_Storage_Implicit*const ssi = imp_s->ssi;
+	KSP* ksp_ptr = &imp_s->ksp;
 	Vec x = constructor_petsc_x(ssi->b); // destructed
 
 	struct Test_Case* test_case = (struct Test_Case*)sim->test_case_rc->tc;
-	const bool use_schur_complement = test_case->use_schur_complement;
-	if (!use_schur_complement) {
-		printf("\tKSP set up.\n");
-		CHKERRQ(constructor_petsc_ksp(&ksp,ssi->A,sim)); // destructed
-		printf("\tKSP solve.\n");
-		CHKERRQ(KSPSolve(ksp,ssi->b,x));
-	} else {
-		printf("\tCompute Schur.\n");
-		struct Schur_Data* schur_data = constructor_Schur_Data(ssi->A,ssi->b,sim); // destructed
-		Mat A[2][2] = { { schur_data->submat[0], schur_data->submat[1], },
-		                { schur_data->submat[2], schur_data->submat[3], } };
-		Vec b[2] = { schur_data->subvec[0], schur_data->subvec[1], };
-
-		/// \todo Run with '-info' petsc option and check that fill has the appropriate value.
-		const double fill = 1.0;
-
-		Mat A_01_11i,
-		    A_01_11i_10;
-
-		CHKERRQ(MatMatMult(A[0][1], A[1][1],MAT_INITIAL_MATRIX,fill,&A_01_11i));    // destroyed
-		CHKERRQ(MatMatMult(A_01_11i,A[1][0],MAT_INITIAL_MATRIX,fill,&A_01_11i_10)); // destroyed
-
-		CHKERRQ(MatAXPY(A[0][0],-1.0,A_01_11i_10,SAME_NONZERO_PATTERN));
-		CHKERRQ(MatDestroy(&A_01_11i_10));
-
-		CHKERRQ(VecScale(b[1],-1.0));
-		CHKERRQ(MatMultAdd(A_01_11i,b[1],b[0],b[0]));
-		CHKERRQ(MatDestroy(&A_01_11i));
-		CHKERRQ(VecScale(b[1],-1.0));
-
-		Vec x_sub[2];
-		for (int i = 0; i < 2; ++i)
-			CHKERRQ(VecGetSubVector(x,schur_data->is[i],&x_sub[i])); // restored
-
-		printf("\tKSP set up.\n");
-		CHKERRQ(constructor_petsc_ksp(&ksp,A[0][0],sim)); // destructed
-
-		printf("\tKSP solve.\n");
-		CHKERRQ(KSPSolve(ksp,b[0],x_sub[0]));
-
-		Mat A_11i_10;
-		CHKERRQ(MatMatMult(A[1][1],A[1][0],MAT_INITIAL_MATRIX,fill,&A_11i_10)); // destroyed
-
-		CHKERRQ(MatMult(A_11i_10,x_sub[0],x_sub[1]));
-		CHKERRQ(MatDestroy(&A_11i_10));
-		CHKERRQ(VecScale(x_sub[1],-1.0));
-		CHKERRQ(MatMultAdd(A[1][1],b[1],x_sub[1],x_sub[1]));
-
-		for (int i = 0; i < 2; ++i)
-			CHKERRQ(VecRestoreSubVector(x,schur_data->is[i],&x_sub[i]));
-
-		destructor_Schur_Data(ssi->b,schur_data);
-	}
+
+	// For the jfnk method, the operator is matrix-free and ssi->A only holds the blocks used for preconditioning.
+	const bool use_jfnk = test_case->use_jfnk;
+	Mat A = ( use_jfnk ? constructor_petsc_mat_jfnk_dg(ssi,sim) : ssi->A ); // destructed (if jfnk)
+
+	printf("\tKSP set up.\n");
+	// The profiling phases are stopped before checking the error codes such that they are not left open on error.
+	start_profile(PROF_KSP_SETUP);
+	PetscErrorCode ierr = ( !*ksp_ptr ? constructor_petsc_ksp(ksp_ptr,A,ssi->A,sim) // destructed
+	                                  : update_petsc_ksp(*ksp_ptr,A,ssi->A,i_step,test_case) );
+	stop_profile(PROF_KSP_SETUP);
+	CHKERRQ(ierr);
+
+	KSP ksp = *ksp_ptr;
+	CHKERRQ(update_solver_stats(ksp,ssi));
+	printf("\tKSP solve.\n");
+	start_profile(PROF_KSP_SOLVE);
+	ierr = KSPSolve(ksp,ssi->b,x);
+	stop_profile(PROF_KSP_SOLVE);
+	CHKERRQ(ierr);
+	if (use_jfnk)
+		destructor_petsc_mat_jfnk_dg(A);
+
 	if (PRINT_NORM_INF_AB) {
 		PetscReal norm_inf_A = 0,
 		          norm_inf_B = 0;
@@ -458,14 +568,17 @@ static PetscErrorCode solve_and_update
 		printf("A and b inf norms: % .3e % .3e\n",norm_inf_A,norm_inf_B);
 	}
 
+	if (test_case->use_schur_complement)
+		CHKERRQ(back_substitute_x_dpg(&x,sim));
 	if (ssi->n_c0)
 		CHKERRQ(convert_x_to_L2(&x,ssi));
+	if (check_distributed(sim))
+		CHKERRQ(gather_x(&x));
 
-	update_coefs(x,sim);
+	update_coefs(x,imp_s->sol_pool,sim);
 	destructor_petsc_x(x);
 
-	display_progress(test_case,i_step,max_rhs,ksp);
-	CHKERRQ(KSPDestroy(&ksp));
+	display_progress(test_case,i_step,max_rhs,*ksp_ptr);
 	return 0;
 }
 
@@ -488,10 +601,15 @@ static bool check_pde_linear (const int pde_index)
 
 // Level 2 ********************************************************************************************************** //
 
-/// \brief Update the values of \ref Solver_Volume_T::sol_coef based on the computed increment.
+/** \brief Update the values of \ref Solver_Volume_T::sol_coef based on the computed increment.
+ *
+ *  If the \ref Solution_Pool is used and no relaxation/limiting is required to maintain positivity, the update is
+ *  performed using a single AXPY for all volumes.
+ */
 static void update_coef_s_v
-	(Vec x,                       ///< Petsc Vec holding the solution coefficient increments.
-	 const struct Simulation* sim ///< \ref Simulation.
+	(Vec x,                               ///< Petsc Vec holding the solution coefficient increments.
+	 struct Solution_Pool*const sol_pool, ///< \ref Implicit_Storage::sol_pool.
+	 const struct Simulation* sim         ///< \ref Simulation.
 	);
 
 /// \brief Update the values of \ref Solver_Face_T::nf_coef based on the computed increment.
@@ -512,20 +630,6 @@ static void update_coef_test_s_v
 	 const struct Simulation*const sim ///< Standard.
 	);
 
-static void output_petsc_schur (Mat A, Vec b, const struct Simulation* sim)
-{
-	struct Schur_Data* schur_data = constructor_Schur_Data(A,b,sim); // destructed
-	Mat* submat = schur_data->submat;
-
-	for (int i = 0; i < N_SCHUR; ++i) {
-		char mat_name[STRLEN_MIN] = { 0, };
-		sprintf(mat_name,"%c%d%d%s",'A',i/2,i%2,".m");
-		output_petsc_mat(submat[i],mat_name);
-	}
-
-	destructor_Schur_Data(b,schur_data);
-}
-
 static void output_petsc_vec (Vec b, const char* file_name)
 {
 	PetscViewer viewer;
@@ -539,13 +643,8 @@ static void output_petsc_vec (Vec b, const char* file_name)
 
 static Vec constructor_petsc_x (Vec b)
 {
-	PetscInt dof = 0;
-	VecGetSize(b,&dof);
-
 	Vec x = NULL;
-	VecCreateSeq(MPI_COMM_WORLD,dof,&x); // destructed
-	VecSetFromOptions(x);
-	VecSetUp(x);
+	VecDuplicate(b,&x); // destructed
 	VecCopy(b,x);
 
 	VecAssemblyBegin(x);
@@ -554,18 +653,34 @@ static Vec constructor_petsc_x (Vec b)
 	return x;
 }
 
+static PetscErrorCode update_petsc_ksp (KSP ksp, Mat A, Mat P, const int i_step, const struct Test_Case* test_case)
+{
+	CHKERRQ(MatAssemblyBegin(P,MAT_FINAL_ASSEMBLY));
+	CHKERRQ(MatAssemblyEnd(P,MAT_FINAL_ASSEMBLY));
+
+	const PetscBool reuse_pc = ( i_step % test_case->lag_pc_i ? PETSC_TRUE : PETSC_FALSE );
+	if (!reuse_pc)
+		++get_solver_stats()->n_pc_set_up;
+	CHKERRQ(KSPSetReusePreconditioner(ksp,reuse_pc));
+	CHKERRQ(KSPSetOperators(ksp,A,P));
+	CHKERRQ(KSPSetUp(ksp));
+	return 0;
+}
+
 static void destructor_petsc_x (Vec x)
 {
 	VecDestroy(&x);
 }
 
-static PetscErrorCode constructor_petsc_ksp (KSP*const ksp, Mat A, const struct Simulation* sim)
+static PetscErrorCode constructor_petsc_ksp (KSP*const ksp, Mat A, Mat P, const struct Simulation* sim)
 {
-	CHKERRQ(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
-	CHKERRQ(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+	CHKERRQ(MatAssemblyBegin(P,MAT_FINAL_ASSEMBLY));
+	CHKERRQ(MatAssemblyEnd(P,MAT_FINAL_ASSEMBLY));
 
 	CHKERRQ(KSPCreate(MPI_COMM_WORLD,ksp));
-	CHKERRQ(KSPSetOperators(*ksp,A,A));
+	++get_solver_stats()->n_ksp_constructed;
+	++get_solver_stats()->n_pc_set_up;
+	CHKERRQ(KSPSetOperators(*ksp,A,P));
 	CHKERRQ(KSPSetFromOptions(*ksp));
 	CHKERRQ(KSPSetComputeSingularValues(*ksp,PETSC_TRUE));
 
@@ -584,17 +699,48 @@ static PetscErrorCode constructor_petsc_ksp (KSP*const ksp, Mat A, const struct
 			CHKERRQ(PCSetType(pc,PCLU));
 		else
 			CHKERRQ(PCSetType(pc,PCCHOLESKY));
+		if (check_distributed(sim))
+			CHKERRQ(PCFactorSetMatSolverType(pc,MATSOLVERMUMPS));
 		CHKERRQ(PCSetUp(pc));
 		break;
 	} case SOLVER_I_ITERATIVE:
 /// \todo Potentially modify the tolerance used here based on the current residual value.
 //		KSPSetTolerances(*ksp,1e-15,PETSC_DEFAULT,PETSC_DEFAULT,PETSC_DEFAULT);
 		break;
+	case SOLVER_I_P_MG: {
+		PC pc;
+		CHKERRQ(KSPGetPC(*ksp,&pc));
+		CHKERRQ(set_up_pc_p_multigrid(pc,sim));
+		break;
+	} default:
+		EXIT_ERROR("Unsupported: %d\n",solver_type_i);
+		break;
 	}
 	KSPSetUp(*ksp);
 	return 0;
 }
 
+static PetscErrorCode update_solver_stats (KSP ksp, const struct Solver_Storage_Implicit*const ssi)
+{
+	struct Solver_Stats*const stats = get_solver_stats();
+	CHKERRQ(MatGetBlockSize(ssi->A,&stats->block_size));
+
+	Mat A = NULL;
+	CHKERRQ(KSPGetOperators(ksp,&A,NULL));
+	PetscBool is_shell = PETSC_FALSE;
+	CHKERRQ(PetscObjectTypeCompare((PetscObject)A,MATSHELL,&is_shell));
+	stats->op_is_shell = is_shell;
+
+	PC pc;
+	CHKERRQ(KSPGetPC(ksp,&pc));
+	PetscBool is_mg = PETSC_FALSE;
+	CHKERRQ(PetscObjectTypeCompare((PetscObject)pc,PCMG,&is_mg));
+	stats->n_pc_mg = 0;
+	if (is_mg)
+		CHKERRQ(PCMGGetLevels(pc,&stats->n_pc_mg));
+	return 0;
+}
+
 static PetscErrorCode convert_x_to_L2 (Vec* x, const struct Solver_Storage_Implicit*const ssi)
 {
 	assert(get_set_n_var_eq(NULL)[0] == 1); // Add support for multiple variables per node.
@@ -618,14 +764,28 @@ static PetscErrorCode convert_x_to_L2 (Vec* x, const struct Solver_Storage_Impli
 	return 0;
 }
 
-static void update_coefs (Vec x, const struct Simulation* sim)
+static PetscErrorCode gather_x (Vec* x)
+{
+	VecScatter scatter;
+	Vec x_all;
+	CHKERRQ(VecScatterCreateToAll(*x,&scatter,&x_all)); // destroyed/moved
+	CHKERRQ(VecScatterBegin(scatter,*x,x_all,INSERT_VALUES,SCATTER_FORWARD));
+	CHKERRQ(VecScatterEnd(scatter,*x,x_all,INSERT_VALUES,SCATTER_FORWARD));
+	CHKERRQ(VecScatterDestroy(&scatter));
+
+	CHKERRQ(VecDestroy(x));
+	*x = x_all;
+	return 0;
+}
+
+static void update_coefs (Vec x, struct Solution_Pool*const sol_pool, const struct Simulation* sim)
 {
 	switch (sim->method) {
 	case METHOD_DG:
-		update_coef_s_v(x,sim);
+		update_coef_s_v(x,sol_pool,sim);
 		break;
 	case METHOD_DPG:
-		update_coef_s_v(x,sim);
+		update_coef_s_v(x,sol_pool,sim);
 		update_coef_nf_f(x,sim);
 		update_coef_l_mult_v(x,sim);
 		assert(get_set_has_1st_2nd_order(NULL)[1] == false); // Add support.
@@ -675,41 +835,6 @@ static void display_progress (const struct Test_Case* test_case, const int i_ste
 	       i_step,iteration_ksp,emax/emin,reason,max_rhs,max_rhs0);
 }
 
-static struct Schur_Data* constructor_Schur_Data (Mat A, Vec b, const struct Simulation* sim)
-{
-	const ptrdiff_t dof[2] = { compute_dof_schur('k',sim), compute_dof_schur('v',sim), };
-
-	struct Schur_Data* schur_data = malloc(sizeof *schur_data); // free
-
-	PetscInt** idx = schur_data->idx;
-	IS* is = schur_data->is;
-	for (int i = 0; i < 2; ++i) {
-		idx[i] = malloc((size_t)dof[i] * sizeof *idx[i]); // free
-		const PetscInt dof_base = (PetscInt)( i == 0 ? 0 : dof[0] );
-		for (int j = 0; j < dof[i]; ++j)
-			idx[i][j] = dof_base+j;
-		ISCreateGeneral(MPI_COMM_WORLD,(PetscInt)dof[i],idx[i],PETSC_USE_POINTER,&is[i]); // destroyed
-		VecGetSubVector(b,is[i],&schur_data->subvec[i]); // restored
-	}
-
-	IS is_row[N_SCHUR] = { is[0], is[0], is[1], is[1], },
-	   is_col[N_SCHUR] = { is[0], is[1], is[0], is[1], };
-	MatCreateSubMatrices(A,N_SCHUR,is_row,is_col,MAT_INITIAL_MATRIX,&schur_data->submat); // destroyed
-
-	return schur_data;
-}
-
-static void destructor_Schur_Data (Vec b, struct Schur_Data* schur_data)
-{
-	for (int i = 0; i < 2; ++i) {
-		VecRestoreSubVector(b,schur_data->is[i],&schur_data->subvec[i]);
-		ISDestroy(&schur_data->is[i]);
-		free(schur_data->idx[i]);
-	}
-	MatDestroySubMatrices(N_SCHUR,&schur_data->submat);
-	free(schur_data);
-}
-
 // Level 3 ********************************************************************************************************** //
 
 /// \brief Update the input coefficients with the step stored in the PETSc Vec.
@@ -722,8 +847,18 @@ static void update_coef
 	 const struct Simulation* sim       ///< \ref Simulation.
 	);
 
-static void update_coef_s_v (Vec x, const struct Simulation* sim)
+static void update_coef_s_v (Vec x, struct Solution_Pool*const sol_pool, const struct Simulation* sim)
 {
+	if (sol_pool && !test_case_requires_positivity((struct Test_Case*) sim->test_case_rc->tc)) {
+		assert(sizeof(PetscScalar) == sizeof(double));
+
+		const PetscScalar* x_data = NULL;
+		VecGetArrayRead(x,&x_data);
+		add_to_Solution_Pool(sol_pool,1.0,x_data);
+		VecRestoreArrayRead(x,&x_data);
+		return;
+	}
+
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
 		struct Solver_Volume* s_vol = (struct Solver_Volume*)curr;
 
@@ -33,6 +33,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef constructor_Flux_Ref_vol_T
 #undef destructor_Flux_Ref_T
 #undef compute_rhs_v_dg_like_T
+#undef compute_rhs_v_dg_like_batch_T
 #undef constructor_lhs_v_1_T
 #undef constructor_lhs_p_v_2_T
 ///\}
@@ -49,3 +50,6 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef constructor_Flux_Ref
 #undef constructor_flux_ref_T
 #undef get_operator__cv0_vg_vc_T
+#undef constructor_vc_batch_T
+#undef get_vc_batch_T
+#undef get_coef_T
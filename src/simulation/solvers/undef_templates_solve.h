@@ -22,9 +22,13 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef get_operator__tw0_vt_vc_T
 #undef initialize_zero_memory_volumes_T
 #undef update_ind_dof_T
+#undef compute_block_size_T
 
 #undef update_ind_dof_test_T
 #undef constructor_nnz
+#undef constructor_petsc_mat_vec_mpi
+#undef constructor_petsc_mat_seq
+#undef constructor_nnz_block
 #undef compute_dof_volumes
 #undef compute_dof_faces
 #undef compute_dof_volumes_l_mult
@@ -78,6 +78,7 @@ void constructor_derived_Solver_Volume_T (struct Volume* volume_ptr, const struc
 
 	s_vol->rhs   = constructor_empty_Multiarray_T('C',2,(ptrdiff_t[]){0,0}); // destructed
 	s_vol->rhs_0 = NULL;
+	s_vol->error_ind = 0.0;
 	s_vol->test_s_coef = constructor_empty_Multiarray_T('C',2,(ptrdiff_t[]){0,0}); // destructed
 }
 
@@ -98,6 +98,10 @@ struct Solver_Volume_T {
 	struct Multiarray_T* rhs;   ///< The rhs terms.
 	struct Multiarray_T* rhs_0; ///< The rhs terms computed from the initial solution.
 
+	/** The value of the error indicator for the volume. This is set during the computation of the rhs terms for the
+	 *  DPG method and is used for the automatic hp-adaptation (see \ref ADAPT_S_INDICATOR). */
+	double error_ind;
+
 	/** Optimal test function coefficients for the solution. These are included here and not in derived Solver Volumes
 	 *  so that they may be used outside of the solver functions (visualization, comparison, etc). */
 	struct Multiarray_T* test_s_coef;
@@ -55,8 +55,8 @@ You should have received a copy of the GNU General Public License along with DPG
 
 bool using_exact_normals_for_boundary ( )
 {
-	static bool need_input = true;
-	static bool flag       = false;
+	static _Thread_local bool need_input = true;
+	static _Thread_local bool flag       = false;
 	if (need_input) {
 		need_input = false;
 		char line[STRLEN_MAX];
@@ -43,8 +43,8 @@ void constructor_Boundary_Value_T_advection_upwind
 {
 	UNUSED(face);
 
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
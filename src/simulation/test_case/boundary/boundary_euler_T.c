@@ -1306,8 +1306,8 @@ static void read_data_total_tp
 
 static struct BC_Data get_bc_data_back_pressure ( )
 {
-	static struct BC_Data bc_data;
-	static bool need_input = true;
+	static _Thread_local struct BC_Data bc_data;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 		read_data_back_pressure(&bc_data);
@@ -1317,8 +1317,8 @@ static struct BC_Data get_bc_data_back_pressure ( )
 
 static struct BC_Data get_bc_data_total_tp ( )
 {
-	static struct BC_Data bc_data;
-	static bool need_input = true;
+	static _Thread_local struct BC_Data bc_data;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 		read_data_total_tp(&bc_data);
@@ -120,8 +120,8 @@ void constructor_Boundary_Value_T_navier_stokes_no_slip_all_rotating
 {
 	UNUSED(sim); UNUSED(s_face);
 
-	static bool need_input = true;
-	static struct Exact_Boundary_Data eb_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Exact_Boundary_Data eb_data;
 	set_Exact_Boundary_Data(&eb_data,&need_input,NO_SLIP_ALL_ROTATING_RHO_E);
 
 	constructor_Boundary_Value_T_navier_stokes_no_slip_all_general(bv,bv_i,&eb_data);
@@ -133,8 +133,8 @@ void constructor_Boundary_Value_T_navier_stokes_no_slip_flux_adiabatic
 {
 	UNUSED(sim); UNUSED(s_face);
 
-	static bool need_input = true;
-	static struct Exact_Boundary_Data eb_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Exact_Boundary_Data eb_data;
 	set_Exact_Boundary_Data(&eb_data,&need_input,DIABATIC_FLUX_CONSTANT_ZERO);
 
 	constructor_Boundary_Value_T_navier_stokes_no_slip_flux_general(bv,bv_i,&eb_data);
@@ -146,8 +146,8 @@ void constructor_Boundary_Value_T_navier_stokes_no_slip_flux_diabatic
 {
 	UNUSED(sim); UNUSED(s_face);
 
-	static bool need_input = true;
-	static struct Exact_Boundary_Data eb_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Exact_Boundary_Data eb_data;
 	set_Exact_Boundary_Data(&eb_data,&need_input,DIABATIC_FLUX_CONSTANT);
 
 	constructor_Boundary_Value_T_navier_stokes_no_slip_flux_general(bv,bv_i,&eb_data);
@@ -516,7 +516,7 @@ static const Type* compute_uvw_ex_rotating (const Type xyz[DIM], const struct Ex
 	           th = atan2(y,x),
 	           Vt = omega*r;
 
-	static Type uvw[DMAX] = {0.0,};
+	static _Thread_local Type uvw[DMAX] = {0.0,};
 	uvw[0] = -sin(th)*Vt;
 	uvw[1] =  cos(th)*Vt;
 	return uvw;
@@ -52,6 +52,22 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #define SOLVER_I_DIRECT    201 ///< Implicit direct solver (LU; Cholesky if symmetric).
 #define SOLVER_I_ITERATIVE 202 ///< Implicit iterative solver (specification provided in input Petsc options file).
+#define SOLVER_I_P_MG      203 ///< Implicit iterative solver with p-multigrid preconditioning (see \ref p_multigrid.h).
+///\}
+
+///\{ \name Definitions for the available p-multigrid smoothers.
+#define PMG_SMOOTHER_BLOCK_JACOBI 211 ///< Element block Jacobi.
+#define PMG_SMOOTHER_ILU          212 ///< Incomplete LU (block Jacobi with ILU sub-blocks for distributed meshes).
+///\}
+
+///\{ \name Definitions for the available linearization methods of the DPG boundary face Hessian terms.
+#define BC_HESSIAN_CMPLX_STEP  221 ///< Complex step (see \ref get_Simulations_c_dpg).
+#define BC_HESSIAN_JACOBIAN_FD 222 ///< Central finite differences of the analytical boundary face Jacobians.
+///\}
+
+///\{ \name Definitions for the available methods of computing the jfnk matrix-vector products.
+#define JFNK_FINITE_DIFF 231 ///< Forward finite differences of the rhs.
+#define JFNK_CMPLX_STEP  232 ///< Complex step (see \ref constructor_petsc_mat_jfnk_dg).
 ///\}
 
 ///\{ \name Definitions relating to terms included in the LHS matrix to be inverted.
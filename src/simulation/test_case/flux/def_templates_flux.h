@@ -86,6 +86,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define compute_Flux_Euler_100 compute_Flux_Euler_100
 #define compute_Flux_Euler_110 compute_Flux_Euler_110
 #define compute_Flux_Euler_111 compute_Flux_Euler_111
+#define compute_Flux_Data_Euler compute_Flux_Data_Euler
 #define compute_Flux_euler_0 compute_Flux_euler_0
 #define compute_Flux_euler_1 compute_Flux_euler_1
 #define compute_Flux_euler_2 compute_Flux_euler_2
@@ -188,6 +189,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #define compute_Flux_Euler_100 compute_Flux_Euler_100_c
 #define compute_Flux_Euler_110 compute_Flux_Euler_110_c
 #define compute_Flux_Euler_111 compute_Flux_Euler_111_c
+#define compute_Flux_Data_Euler compute_Flux_Data_Euler_c
 #define compute_Flux_euler_0 compute_Flux_euler_0_c
 #define compute_Flux_euler_1 compute_Flux_euler_1_c
 #define compute_Flux_euler_2 compute_Flux_euler_2_c
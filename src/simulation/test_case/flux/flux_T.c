@@ -20,6 +20,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdio.h>
 
 #include "macros.h"
+#include "scratch_arena.h"
 #include "definitions_core.h"
 
 
@@ -91,16 +92,18 @@ struct Flux_T* constructor_Flux_T (const struct Flux_Input_T* flux_i)
 	          n_vr = flux_i->n_var;
 	const ptrdiff_t n_n = ( flux_i->s != NULL ? flux_i->s->extents[0] : flux_i->g->extents[0] );
 
-	struct mutable_Flux_T* flux = calloc(1,sizeof *flux); // returned
+	// Temporaries: allocated from the scratch arena when called from within a scratch scope.
+	struct mutable_Flux_T* flux = calloc_scratch(1,sizeof *flux); // returned
+	flux->in_scratch = in_scratch_scope();
 
 	flux->f = (compute_member[0] ?
-		constructor_zero_Multiarray_T('C',3,(ptrdiff_t[]){n_n,DIM,n_eq})           : NULL); // destructed
+		constructor_zero_Multiarray_T_scratch('C',3,(ptrdiff_t[]){n_n,DIM,n_eq})           : NULL); // destructed
 	flux->df_ds = (compute_member[1] ?
-		constructor_zero_Multiarray_T('C',4,(ptrdiff_t[]){n_n,DIM,n_eq,n_vr})      : NULL); // destructed
+		constructor_zero_Multiarray_T_scratch('C',4,(ptrdiff_t[]){n_n,DIM,n_eq,n_vr})      : NULL); // destructed
 	flux->df_dg = (compute_member[2] ?
-		constructor_zero_Multiarray_T('C',5,(ptrdiff_t[]){n_n,DIM,n_eq,n_vr,DIM})  : NULL); // destructed
+		constructor_zero_Multiarray_T_scratch('C',5,(ptrdiff_t[]){n_n,DIM,n_eq,n_vr,DIM})  : NULL); // destructed
 	flux->d2f_ds2 = (compute_member[3] ?
-		constructor_zero_Multiarray_T('C',5,(ptrdiff_t[]){n_n,DIM,n_eq,n_vr,n_vr}) : NULL); // destructed
+		constructor_zero_Multiarray_T_scratch('C',5,(ptrdiff_t[]){n_n,DIM,n_eq,n_vr,n_vr}) : NULL); // destructed
 
 	flux_i->compute_Flux(flux_i,flux);
 
@@ -113,7 +116,7 @@ void destructor_Flux_T (struct Flux_T* flux)
 	destructor_conditional_const_Multiarray_T(flux->df_ds);
 	destructor_conditional_const_Multiarray_T(flux->df_dg);
 	destructor_conditional_const_Multiarray_T(flux->d2f_ds2);
-	free(flux);
+	free_scratch(flux,flux->in_scratch);
 }
 
 void destructor_conditional_Flux_T (struct Flux_T* flux)
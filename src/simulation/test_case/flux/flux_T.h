@@ -74,6 +74,8 @@ struct Flux_T {
 	const struct const_Multiarray_T* df_ds;   ///< The Jacobian of the fluxes wrt the solution variables.
 	const struct const_Multiarray_T* df_dg;   ///< The Jacobian of the fluxes wrt the solution gradient variables.
 	const struct const_Multiarray_T* d2f_ds2; ///< The Hessian of the fluxes wrt the solution variables.
+
+	const bool in_scratch; ///< Flag for whether the container was allocated from the scratch arena.
 };
 
 /// \brief `mutable` version of \ref Flux_T.
@@ -82,6 +84,8 @@ struct mutable_Flux_T {
 	struct Multiarray_T* df_ds;   ///< See brief.
 	struct Multiarray_T* df_dg;   ///< See brief.
 	struct Multiarray_T* d2f_ds2; ///< See brief.
+
+	bool in_scratch; ///< See brief.
 };
 
 // Interface functions ********************************************************************************************** //
@@ -62,8 +62,8 @@ static compute_Flux_Advection_fptr get_compute_Flux_Advection_fptr
 
 void compute_Flux_T_advection (const struct Flux_Input_T* flux_i, struct mutable_Flux_T* flux)
 {
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
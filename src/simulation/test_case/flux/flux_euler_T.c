@@ -32,28 +32,33 @@ You should have received a copy of the GNU General Public License along with DPG
 #define NEQ  NEQ_EULER  ///< Number of equations.
 #define NVAR NVAR_EULER ///< Number of variables.
 
-/// \brief Container for common data used to compute the fluxes and their Jacobians/Hessians.
+/// \brief Container for common data used to compute the fluxes and their Jacobians/Hessians at a single node.
 struct Flux_Data_Euler {
-	const Type* rhouvw, ///< Array of momentum variables.
-	          * uvw;    ///< Array of velocity variables.
-	const Type rho_inv, ///< Inverse of density.
-	           E,       ///< Total energy.
-	           p,       ///< Pressure.
-	           V2,      ///< Square of the velocity magnitude.
-		     H,       ///< Enthalpy.
-		     alpha,   ///< dp_drho.
-		     beta;    ///< alpha-H.
+	Type rhouvw[DIM], ///< Array of momentum variables.
+	     uvw[DIM];    ///< Array of velocity variables.
+	Type rho_inv, ///< Inverse of density.
+	     E,       ///< Total energy.
+	     p,       ///< Pressure.
+	     V2,      ///< Square of the velocity magnitude.
+	     H,       ///< Enthalpy.
+	     alpha,   ///< dp_drho.
+	     beta;    ///< alpha-H.
 };
 
-/** \brief Pointer to functions computing the required Euler flux members.
+/** \brief Pointer to functions computing the required Euler flux members for all of the input nodes.
  *
- *  \param flux_data  \ref Flux_Data_Euler.
+ *  The specialized functions loop over the nodes such that the selection of the required members is performed only
+ *  once per call and such that the loops can be vectorized (all data is accessed with unit stride in the node index).
+ *
+ *  \param n_n        The number of nodes.
+ *  \param s_ptr      Pointers to the solution variables.
  *  \param f_ptr      Pointers to the flux members.
  *  \param dfds_ptr   Pointers to the flux Jacobian members.
  *  \param d2fds2_ptr Pointers to the flux Hessian members.
  */
 typedef void (*compute_Flux_Euler_fptr)
-	(const struct Flux_Data_Euler*const flux_data,
+	(const ptrdiff_t n_n,
+	 const Type*const s_ptr[NVAR],
 	 Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR],
 	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR]
@@ -71,11 +76,9 @@ static compute_Flux_Euler_fptr get_compute_Flux_Euler_fptr
 void compute_Flux_T_euler (const struct Flux_Input_T* flux_i, struct mutable_Flux_T* flux)
 {
 	const struct const_Multiarray_T*const s = flux_i->s;
-	const Type*const rho_p      = get_col_const_Multiarray_T(0,s),
-	          *const rhouvw_p[] = ARRAY_DIM(get_col_const_Multiarray_T(1,s),
-	                                        get_col_const_Multiarray_T(2,s),
-	                                        get_col_const_Multiarray_T(3,s)),
-	          *const E_p        = get_col_const_Multiarray_T(NVAR-1,s);
+	const Type* s_ptr[NVAR] = { NULL };
+	for (int vr = 0; vr < NVAR; ++vr)
+		s_ptr[vr] = get_col_const_Multiarray_T(vr,s);
 
 	const bool* c_m = flux_i->compute_member;
 
@@ -114,32 +117,7 @@ void compute_Flux_T_euler (const struct Flux_Input_T* flux_i, struct mutable_Flu
 		}}}}
 	}
 
-	const ptrdiff_t n_n = s->extents[0];
-	for (ptrdiff_t n = 0; n < n_n; ++n) {
-		const Type rho      = rho_p[n],
-		           rhouvw[] = ARRAY_DIM(rhouvw_p[0][n],rhouvw_p[1][n],rhouvw_p[2][n]),
-		           E        = E_p[n],
-
-		           rho_inv = 1.0/rho,
-		           uvw[]   = ARRAY_DIM(rho_inv*rhouvw[0],rho_inv*rhouvw[1],rho_inv*rhouvw[2]),
-		           V2      = compute_V2_from_uvw_T(uvw),
-		           p       = GM1*(E-0.5*rho*V2),
-		           H       = (E+p)*rho_inv,
-		           alpha   = 0.5*GM1*V2;
-
-		struct Flux_Data_Euler flux_data =
-			{ .rhouvw  = rhouvw,
-			  .uvw     = uvw,
-			  .rho_inv = rho_inv,
-			  .E       = E,
-			  .p       = p,
-			  .V2      = V2,
-			  .H       = H,
-			  .alpha   = alpha,
-			  .beta    = alpha-H,
-			};
-		compute_flux_euler_n(&flux_data,f_ptr,dfds_ptr,d2fds2_ptr);
-	}
+	compute_flux_euler_n(s->extents[0],s_ptr,f_ptr,dfds_ptr,d2fds2_ptr);
 }
 
 Type compute_V2_from_uvw_T (const Type*const uvw)
@@ -163,26 +141,29 @@ Type compute_V2_from_rhouvw_T (const Type rho, const Type*const rhouvw)
 
 /// \brief Version of \ref compute_Flux_Euler_fptr computing only the flux.
 static void compute_Flux_Euler_100
-	(const struct Flux_Data_Euler*const flux_data, ///< See brief.
-	 Type*const f_ptr[DIM*NEQ],                    ///< See brief.
-	 Type*const dfds_ptr[DIM*NEQ*NVAR],            ///< See brief.
-	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR]      ///< See brief.
+	(const ptrdiff_t n_n,                     ///< See brief.
+	 const Type*const s_ptr[NVAR],            ///< See brief.
+	 Type*const f_ptr[DIM*NEQ],               ///< See brief.
+	 Type*const dfds_ptr[DIM*NEQ*NVAR],       ///< See brief.
+	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR] ///< See brief.
 	);
 
 /// \brief Version of \ref compute_Flux_Euler_fptr computing the flux and Jacobian.
 static void compute_Flux_Euler_110
-	(const struct Flux_Data_Euler*const flux_data, ///< See brief.
-	 Type*const f_ptr[DIM*NEQ],                    ///< See brief.
-	 Type*const dfds_ptr[DIM*NEQ*NVAR],            ///< See brief.
-	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR]      ///< See brief.
+	(const ptrdiff_t n_n,                     ///< See brief.
+	 const Type*const s_ptr[NVAR],            ///< See brief.
+	 Type*const f_ptr[DIM*NEQ],               ///< See brief.
+	 Type*const dfds_ptr[DIM*NEQ*NVAR],       ///< See brief.
+	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR] ///< See brief.
 	);
 
 /// \brief Version of \ref compute_Flux_Euler_fptr computing the flux, Jacobian and Hessian.
 static void compute_Flux_Euler_111
-	(const struct Flux_Data_Euler*const flux_data, ///< See brief.
-	 Type*const f_ptr[DIM*NEQ],                    ///< See brief.
-	 Type*const dfds_ptr[DIM*NEQ*NVAR],            ///< See brief.
-	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR]      ///< See brief.
+	(const ptrdiff_t n_n,                     ///< See brief.
+	 const Type*const s_ptr[NVAR],            ///< See brief.
+	 Type*const f_ptr[DIM*NEQ],               ///< See brief.
+	 Type*const dfds_ptr[DIM*NEQ*NVAR],       ///< See brief.
+	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR] ///< See brief.
 	);
 
 static compute_Flux_Euler_fptr get_compute_Flux_Euler_fptr (const bool*const c_m)
@@ -200,63 +181,99 @@ static compute_Flux_Euler_fptr get_compute_Flux_Euler_fptr (const bool*const c_m
 
 // Level 1 ********************************************************************************************************** //
 
+/** \brief Compute the \ref Flux_Data_Euler for the input node.
+ *  \return See brief. */
+static FORCE_INLINE struct Flux_Data_Euler compute_Flux_Data_Euler
+	(const ptrdiff_t n,           ///< The index of the node.
+	 const Type*const s_ptr[NVAR] ///< Pointers to the solution variables.
+	);
+
 /// \brief Compute the Euler fluxes for the input nodal values.
-static void compute_Flux_euler_0
-	(const struct Flux_Data_Euler*const flux_data, ///< \ref Flux_Data_Euler.
+static FORCE_INLINE void compute_Flux_euler_0
+	(const ptrdiff_t n,                            ///< The index of the node.
+	 const struct Flux_Data_Euler*const flux_data, ///< \ref Flux_Data_Euler.
 	 Type*const f_ptr[DIM*NEQ]                     ///< Pointers to the flux data.
 	);
 
 /// \brief Compute the Euler flux Jacobians for the input nodal values.
-static void compute_Flux_euler_1
-	(const struct Flux_Data_Euler*const flux_data, ///< \ref Flux_Data_Euler.
+static FORCE_INLINE void compute_Flux_euler_1
+	(const ptrdiff_t n,                            ///< The index of the node.
+	 const struct Flux_Data_Euler*const flux_data, ///< \ref Flux_Data_Euler.
 	 Type*const dfds_ptr[DIM*NEQ*NVAR]             ///< Pointers to the flux Jacobian data.
 	);
 
 /// \brief Compute the Euler flux Hessians for the input nodal values.
-static void compute_Flux_euler_2
-	(const struct Flux_Data_Euler*const flux_data, ///< \ref Flux_Data_Euler.
+static FORCE_INLINE void compute_Flux_euler_2
+	(const ptrdiff_t n,                            ///< The index of the node.
+	 const struct Flux_Data_Euler*const flux_data, ///< \ref Flux_Data_Euler.
 	 Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR]      ///< Pointers to the flux Hessian data.
 	);
 
 static void compute_Flux_Euler_100
-	(const struct Flux_Data_Euler*const flux_data, Type*const f_ptr[DIM*NEQ],
+	(const ptrdiff_t n_n, const Type*const s_ptr[NVAR], Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR], Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR])
 {
-	compute_Flux_euler_0(flux_data,f_ptr);
 	UNUSED(dfds_ptr);
 	UNUSED(d2fds2_ptr);
 
-	increment_pointers_T(DIM*NEQ,(const Type**)f_ptr);
+	PRAGMA_OMP(simd)
+	for (ptrdiff_t n = 0; n < n_n; ++n) {
+		const struct Flux_Data_Euler flux_data = compute_Flux_Data_Euler(n,s_ptr);
+		compute_Flux_euler_0(n,&flux_data,f_ptr);
+	}
 }
 
 static void compute_Flux_Euler_110
-	(const struct Flux_Data_Euler*const flux_data, Type*const f_ptr[DIM*NEQ],
+	(const ptrdiff_t n_n, const Type*const s_ptr[NVAR], Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR], Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR])
 {
-	compute_Flux_euler_0(flux_data,f_ptr);
-	compute_Flux_euler_1(flux_data,dfds_ptr);
 	UNUSED(d2fds2_ptr);
 
-	increment_pointers_T(DIM*NEQ,     (const Type**)f_ptr);
-	increment_pointers_T(DIM*NEQ*NVAR,(const Type**)dfds_ptr);
+	PRAGMA_OMP(simd)
+	for (ptrdiff_t n = 0; n < n_n; ++n) {
+		const struct Flux_Data_Euler flux_data = compute_Flux_Data_Euler(n,s_ptr);
+		compute_Flux_euler_0(n,&flux_data,f_ptr);
+		compute_Flux_euler_1(n,&flux_data,dfds_ptr);
+	}
 }
 
 static void compute_Flux_Euler_111
-	(const struct Flux_Data_Euler*const flux_data, Type*const f_ptr[DIM*NEQ],
+	(const ptrdiff_t n_n, const Type*const s_ptr[NVAR], Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR], Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR])
 {
-	compute_Flux_euler_0(flux_data,f_ptr);
-	compute_Flux_euler_1(flux_data,dfds_ptr);
-	compute_Flux_euler_2(flux_data,d2fds2_ptr);
-
-	increment_pointers_T(DIM*NEQ,          (const Type**)f_ptr);
-	increment_pointers_T(DIM*NEQ*NVAR,     (const Type**)dfds_ptr);
-	increment_pointers_T(DIM*NEQ*NVAR*NVAR,(const Type**)d2fds2_ptr);
+	PRAGMA_OMP(simd)
+	for (ptrdiff_t n = 0; n < n_n; ++n) {
+		const struct Flux_Data_Euler flux_data = compute_Flux_Data_Euler(n,s_ptr);
+		compute_Flux_euler_0(n,&flux_data,f_ptr);
+		compute_Flux_euler_1(n,&flux_data,dfds_ptr);
+		compute_Flux_euler_2(n,&flux_data,d2fds2_ptr);
+	}
 }
 
 // Level 2 ********************************************************************************************************** //
 
-static void compute_Flux_euler_0 (const struct Flux_Data_Euler*const flux_data, Type*const f_ptr[DIM*NEQ])
+static FORCE_INLINE struct Flux_Data_Euler compute_Flux_Data_Euler (const ptrdiff_t n, const Type*const s_ptr[NVAR])
+{
+	const Type rho = s_ptr[0][n];
+
+	struct Flux_Data_Euler flux_data;
+	flux_data.rho_inv = 1.0/rho;
+	for (int d = 0; d < DIM; ++d) {
+		flux_data.rhouvw[d] = s_ptr[d+1][n];
+		flux_data.uvw[d]    = flux_data.rho_inv*flux_data.rhouvw[d];
+	}
+	flux_data.E     = s_ptr[NVAR-1][n];
+	flux_data.V2    = compute_V2_from_uvw_T(flux_data.uvw);
+	flux_data.p     = GM1*(flux_data.E-0.5*rho*flux_data.V2);
+	flux_data.H     = (flux_data.E+flux_data.p)*flux_data.rho_inv;
+	flux_data.alpha = 0.5*GM1*flux_data.V2;
+	flux_data.beta  = flux_data.alpha-flux_data.H;
+
+	return flux_data;
+}
+
+static FORCE_INLINE void compute_Flux_euler_0
+	(const ptrdiff_t n, const struct Flux_Data_Euler*const flux_data, Type*const f_ptr[DIM*NEQ])
 {
 	const Type p = flux_data->p,
 	           E = flux_data->E;
@@ -272,32 +289,33 @@ static void compute_Flux_euler_0 (const struct Flux_Data_Euler*const flux_data,
 	int ind = 0;
 
 	// f[:,0]
-	IF_DIM_GE_1( *f_ptr[ind++] += rhou );
-	IF_DIM_GE_2( *f_ptr[ind++] += rhov );
-	IF_DIM_GE_3( *f_ptr[ind++] += rhow );
+	IF_DIM_GE_1( f_ptr[ind++][n] += rhou );
+	IF_DIM_GE_2( f_ptr[ind++][n] += rhov );
+	IF_DIM_GE_3( f_ptr[ind++][n] += rhow );
 
 	// f[:,1]
-	IF_DIM_GE_1( *f_ptr[ind++] += rhou*u + p );
-	IF_DIM_GE_2( *f_ptr[ind++] += rhou*v );
-	IF_DIM_GE_3( *f_ptr[ind++] += rhou*w );
+	IF_DIM_GE_1( f_ptr[ind++][n] += rhou*u + p );
+	IF_DIM_GE_2( f_ptr[ind++][n] += rhou*v );
+	IF_DIM_GE_3( f_ptr[ind++][n] += rhou*w );
 
 	// f[:,2]
-	IF_DIM_GE_2( *f_ptr[ind++] += rhov*u );
-	IF_DIM_GE_2( *f_ptr[ind++] += rhov*v + p );
-	IF_DIM_GE_3( *f_ptr[ind++] += rhov*w );
+	IF_DIM_GE_2( f_ptr[ind++][n] += rhov*u );
+	IF_DIM_GE_2( f_ptr[ind++][n] += rhov*v + p );
+	IF_DIM_GE_3( f_ptr[ind++][n] += rhov*w );
 
 	// f[:,3]
-	IF_DIM_GE_3( *f_ptr[ind++] += rhow*u );
-	IF_DIM_GE_3( *f_ptr[ind++] += rhow*v );
-	IF_DIM_GE_3( *f_ptr[ind++] += rhow*w + p );
+	IF_DIM_GE_3( f_ptr[ind++][n] += rhow*u );
+	IF_DIM_GE_3( f_ptr[ind++][n] += rhow*v );
+	IF_DIM_GE_3( f_ptr[ind++][n] += rhow*w + p );
 
 	// f[:,4]
-	IF_DIM_GE_1( *f_ptr[ind++] += (E+p)*u);
-	IF_DIM_GE_2( *f_ptr[ind++] += (E+p)*v);
-	IF_DIM_GE_3( *f_ptr[ind++] += (E+p)*w);
+	IF_DIM_GE_1( f_ptr[ind++][n] += (E+p)*u);
+	IF_DIM_GE_2( f_ptr[ind++][n] += (E+p)*v);
+	IF_DIM_GE_3( f_ptr[ind++][n] += (E+p)*w);
 }
 
-static void compute_Flux_euler_1 (const struct Flux_Data_Euler*const flux_data, Type*const dfds_ptr[DIM*NEQ*NVAR])
+static FORCE_INLINE void compute_Flux_euler_1
+	(const ptrdiff_t n, const struct Flux_Data_Euler*const flux_data, Type*const dfds_ptr[DIM*NEQ*NVAR])
 {
 	const Type H     = flux_data->H,
 	           alpha = flux_data->alpha,
@@ -311,137 +329,137 @@ static void compute_Flux_euler_1 (const struct Flux_Data_Euler*const flux_data,
 
 	// dfds[:,:,0]
 	// dfds[:,0,0]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
 
 	// dfds[:,1,0]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += -u*u + alpha );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -u*v         );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -u*w         );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += -u*u + alpha );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -u*v         );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -u*w         );
 
 	// dfds[:,2,0]
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -v*u         );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -v*v + alpha );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -v*w         );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -v*u         );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -v*v + alpha );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -v*w         );
 
 	// dfds[:,3,0]
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -w*u         );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -w*v         );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -w*w + alpha );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -w*u         );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -w*v         );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -w*w + alpha );
 
 	// dfds[:,4,0]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += u*beta );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += v*beta );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += w*beta );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += u*beta );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += v*beta );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += w*beta );
 
 	// dfds[:,:,1]
 	// dfds[:,0,1]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += 1.0 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += 1.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
 
 	// dfds[:,1,1]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += -u*GM3 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] +=  v     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  w     );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += -u*GM3 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] +=  v     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  w     );
 
 	// dfds[:,2,1]
-	IF_DIM_GE_2( *dfds_ptr[ind++] +=  v     );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -u*GM1 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  0.0   );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] +=  v     );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -u*GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  0.0   );
 
 	// dfds[:,3,1]
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  w     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  0.0   );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -u*GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  w     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  0.0   );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -u*GM1 );
 
 	// dfds[:,4,1]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += -GM1*u*u + H );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -GM1*u*v     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -GM1*u*w     );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += -GM1*u*u + H );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -GM1*u*v     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -GM1*u*w     );
 
 	// dfds[:,:,2]
 	// dfds[:,0,2]
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 1.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 1.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
 
 	// dfds[:,1,2]
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -v*GM1 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] +=  u     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  0.0   );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -v*GM1 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] +=  u     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  0.0   );
 
 	// dfds[:,2,2]
-	IF_DIM_GE_2( *dfds_ptr[ind++] +=  u     );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -v*GM3 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  w     );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] +=  u     );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -v*GM3 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  w     );
 
 	// dfds[:,3,2]
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  0.0   );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  w     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -v*GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  0.0   );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  w     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -v*GM1 );
 
 	// dfds[:,4,2]
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -GM1*v*u     );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += -GM1*v*v + H );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -GM1*v*w     );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -GM1*v*u     );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += -GM1*v*v + H );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -GM1*v*w     );
 
 	// dfds[:,:,3]
 	// dfds[:,0,3]
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 1.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 1.0 );
 
 	// dfds[:,1,3]
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -w*GM1 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  0.0   );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  u     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -w*GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  0.0   );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  u     );
 
 	// dfds[:,2,3]
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  0.0   );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -w*GM1 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  v     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  0.0   );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -w*GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  v     );
 
 	// dfds[:,3,3]
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  u     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] +=  v     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -w*GM3 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  u     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] +=  v     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -w*GM3 );
 
 	// dfds[:,4,3]
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -GM1*w*u     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -GM1*w*v     );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += -GM1*w*w + H );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -GM1*w*u     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -GM1*w*v     );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += -GM1*w*w + H );
 
 	// dfds[:,:,4]
 	// dfds[:,0,4]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
 
 	// dfds[:,1,4]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += GM1 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += GM1 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
 
 	// dfds[:,2,4]
-	IF_DIM_GE_2( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += GM1 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
 
 	// dfds[:,3,4]
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += GM1 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += GM1 );
 
 	// dfds[:,4,4]
-	IF_DIM_GE_1( *dfds_ptr[ind++] += u*GAMMA );
-	IF_DIM_GE_2( *dfds_ptr[ind++] += v*GAMMA );
-	IF_DIM_GE_3( *dfds_ptr[ind++] += w*GAMMA );
+	IF_DIM_GE_1( dfds_ptr[ind++][n] += u*GAMMA );
+	IF_DIM_GE_2( dfds_ptr[ind++][n] += v*GAMMA );
+	IF_DIM_GE_3( dfds_ptr[ind++][n] += w*GAMMA );
 }
 
-static void compute_Flux_euler_2
-	(const struct Flux_Data_Euler*const flux_data, Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR])
+static FORCE_INLINE void compute_Flux_euler_2
+	(const ptrdiff_t n, const struct Flux_Data_Euler*const flux_data, Type*const d2fds2_ptr[DIM*NEQ*NVAR*NVAR])
 {
 	const Type rho_inv = flux_data->rho_inv,
 	           E       = flux_data->E,
@@ -478,657 +496,657 @@ static void compute_Flux_euler_2
 	// d2fds2[:,:,:,0]
 	// d2fds2[:,:,0,0]
 	// d2fds2[:,0,0,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,0,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += rho_inv*(2.0*u*u - GM1*V2) );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += rho_inv*(2.0*u*v         ) );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += rho_inv*(2.0*u*w         ) );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += rho_inv*(2.0*u*u - GM1*V2) );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += rho_inv*(2.0*u*v         ) );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += rho_inv*(2.0*u*w         ) );
 
 	// d2fds2[:,2,0,0]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += rho_inv*(2.0*v*u         ) );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += rho_inv*(2.0*v*v - GM1*V2) );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += rho_inv*(2.0*v*w         ) );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += rho_inv*(2.0*v*u         ) );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += rho_inv*(2.0*v*v - GM1*V2) );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += rho_inv*(2.0*v*w         ) );
 
 	// d2fds2[:,3,0,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += rho_inv*(2.0*w*u         ) );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += rho_inv*(2.0*w*v         ) );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += rho_inv*(2.0*w*w - GM1*V2) );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += rho_inv*(2.0*w*u         ) );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += rho_inv*(2.0*w*v         ) );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += rho_inv*(2.0*w*w - GM1*V2) );
 
 	// d2fds2[:,4,0,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += u*dbeta_dW[0] - rho_inv*u*beta );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += v*dbeta_dW[0] - rho_inv*v*beta );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += w*dbeta_dW[0] - rho_inv*w*beta );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += u*dbeta_dW[0] - rho_inv*u*beta );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += v*dbeta_dW[0] - rho_inv*v*beta );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += w*dbeta_dW[0] - rho_inv*w*beta );
 
 	// d2fds2[:,:,1,0]
 	// d2fds2[:,0,1,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,1,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] +=  rho_inv*u*GM3 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*v     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*w     );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] +=  rho_inv*u*GM3 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*w     );
 
 	// d2fds2[:,2,1,0]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*v     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv*u*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*v     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv*u*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
 
 	// d2fds2[:,3,1,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*w     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv*u*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*w     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv*u*GM1 );
 
 	// d2fds2[:,4,1,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*u*u + dH_dW[0] );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*u*v            );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*u*w            );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*u*u + dH_dW[0] );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*u*v            );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*u*w            );
 
 	// d2fds2[:,:,2,0]
 	// d2fds2[:,0,2,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,2,0]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv*v*GM1 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*u     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv*v*GM1 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
 
 	// d2fds2[:,2,2,0]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*u     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv*v*GM3 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*w     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*u     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv*v*GM3 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*w     );
 
 	// d2fds2[:,3,2,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*w     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv*v*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*w     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv*v*GM1 );
 
 	// d2fds2[:,4,2,0]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*v*u            );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*v*v + dH_dW[0] );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*v*w            );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*v*u            );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*v*v + dH_dW[0] );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*v*w            );
 
 	// d2fds2[:,:,3,0]
 	// d2fds2[:,0,3,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,3,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv*w*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv*w*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*u     );
 
 	// d2fds2[:,2,3,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv*w*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv*w*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*v     );
 
 	// d2fds2[:,3,3,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*u     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*v     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv*w*GM3 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv*w*GM3 );
 
 	// d2fds2[:,4,3,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*w*u            );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*w*v            );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 2.0*GM1*rho_inv*w*w + dH_dW[0] );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*w*u            );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*w*v            );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 2.0*GM1*rho_inv*w*w + dH_dW[0] );
 
 	// d2fds2[:,:,4,0]
 	// d2fds2[:,0,4,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,4,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,4,0]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,4,0]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,4,0]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += -GAMMA*rho_inv*u );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GAMMA*rho_inv*v );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GAMMA*rho_inv*w );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += -GAMMA*rho_inv*u );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GAMMA*rho_inv*v );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GAMMA*rho_inv*w );
 
 	// d2fds2[:,:,:,1]
 	// d2fds2[:,:,0,1]
 	// d2fds2[:,0,0,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,0,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] +=  u*rho_inv*GM3 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -v*rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -w*rho_inv     );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] +=  u*rho_inv*GM3 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -v*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -w*rho_inv     );
 
 	// d2fds2[:,2,0,1]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -v*rho_inv     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  u*rho_inv*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -v*rho_inv     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  u*rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
 
 	// d2fds2[:,3,0,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -w*rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  u*rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -w*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  u*rho_inv*GM1 );
 
 	// d2fds2[:,4,0,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += u*dbeta_dW[1] + rho_inv*beta );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += v*dbeta_dW[1]                );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += w*dbeta_dW[1]                );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += u*dbeta_dW[1] + rho_inv*beta );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += v*dbeta_dW[1]                );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += w*dbeta_dW[1]                );
 
 	// d2fds2[:,:,1,1]
 	// d2fds2[:,0,1,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,1,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += -rho_inv*GM3 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += -rho_inv*GM3 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,1,1]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,1,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*GM1 );
 
 	// d2fds2[:,4,1,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += -GM1*rho_inv*u*3.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*w     );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u*3.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*w     );
 
 	// d2fds2[:,:,2,1]
 	// d2fds2[:,0,2,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,2,1]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,2,1]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,2,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,4,2,1]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*u     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0               );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0               );
 
 	// d2fds2[:,:,3,1]
 	// d2fds2[:,0,3,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,3,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
 
 	// d2fds2[:,2,3,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,3,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,4,3,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*w     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0               );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*w     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0               );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u     );
 
 	// d2fds2[:,:,4,1]
 	// d2fds2[:,0,4,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,4,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,4,1]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,4,1]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,4,1]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += GAMMA*rho_inv );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += GAMMA*rho_inv );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
 
 	// d2fds2[:,:,:,2]
 	// d2fds2[:,:,0,2]
 	// d2fds2[:,0,0,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,0,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  v*rho_inv*GM1 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -u*rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  v*rho_inv*GM1 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -u*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
 
 	// d2fds2[:,2,0,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -u*rho_inv     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  v*rho_inv*GM3 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -w*rho_inv     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -u*rho_inv     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  v*rho_inv*GM3 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -w*rho_inv     );
 
 	// d2fds2[:,3,0,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -w*rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  v*rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -w*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  v*rho_inv*GM1 );
 
 	// d2fds2[:,4,0,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += u*dbeta_dW[2]                );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += v*dbeta_dW[2] + rho_inv*beta );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += w*dbeta_dW[2]                );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += u*dbeta_dW[2]                );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += v*dbeta_dW[2] + rho_inv*beta );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += w*dbeta_dW[2]                );
 
 	// d2fds2[:,:,1,2]
 	// d2fds2[:,0,1,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,1,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,1,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,1,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,4,1,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*u     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0               );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0               );
 
 	// d2fds2[:,:,2,2]
 	// d2fds2[:,0,2,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,2,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*GM1 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*GM1 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,2,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -rho_inv*GM3 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -rho_inv*GM3 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,2,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*GM1 );
 
 	// d2fds2[:,4,2,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*u     );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += -GM1*rho_inv*v*3.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*w     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u     );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v*3.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*w     );
 
 	// d2fds2[:,:,3,2]
 	// d2fds2[:,0,3,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,3,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,3,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
 
 	// d2fds2[:,3,3,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,4,3,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0               );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0               );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
 
 	// d2fds2[:,:,4,2]
 	// d2fds2[:,0,4,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,4,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,4,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,4,2]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,4,2]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += GAMMA*rho_inv );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += GAMMA*rho_inv );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
 
 	// d2fds2[:,:,:,3]
 	// d2fds2[:,:,0,3]
 	// d2fds2[:,0,0,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,0,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  w*rho_inv*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -u*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  w*rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -u*rho_inv     );
 
 	// d2fds2[:,2,0,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  w*rho_inv*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -v*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  w*rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -v*rho_inv     );
 
 	// d2fds2[:,3,0,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -u*rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -v*rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  w*rho_inv*GM3 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -u*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -v*rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  w*rho_inv*GM3 );
 
 	// d2fds2[:,4,0,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += u*dbeta_dW[3]                );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += v*dbeta_dW[3]                );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += w*dbeta_dW[3] + rho_inv*beta );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += u*dbeta_dW[3]                );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += v*dbeta_dW[3]                );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += w*dbeta_dW[3] + rho_inv*beta );
 
 	// d2fds2[:,:,1,3]
 	// d2fds2[:,0,1,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,1,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
 
 	// d2fds2[:,2,1,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,1,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,4,1,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0               );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0               );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u     );
 
 	// d2fds2[:,:,2,3]
 	// d2fds2[:,0,2,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,2,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,2,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
 
 	// d2fds2[:,3,2,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  rho_inv     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  rho_inv     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,4,2,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0               );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*w     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0               );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*w     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
 
 	// d2fds2[:,:,3,3]
 	// d2fds2[:,0,3,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,3,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,2,3,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*GM1 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*GM1 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
 
 	// d2fds2[:,3,3,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] +=  0.0         );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -rho_inv*GM3 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] +=  0.0         );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -rho_inv*GM3 );
 
 	// d2fds2[:,4,3,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*u     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*v     );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += -GM1*rho_inv*w*3.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*u     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*v     );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += -GM1*rho_inv*w*3.0 );
 
 	// d2fds2[:,:,4,3]
 	// d2fds2[:,0,4,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,4,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,4,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,4,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,4,3]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += GAMMA*rho_inv );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += GAMMA*rho_inv );
 
 	// d2fds2[:,:,:,4]
 	// d2fds2[:,:,0,4]
 	// d2fds2[:,0,0,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,0,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,0,4]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,0,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,0,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += u*dbeta_dW[DIM+1] );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += v*dbeta_dW[DIM+1] );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += w*dbeta_dW[DIM+1] );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += u*dbeta_dW[DIM+1] );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += v*dbeta_dW[DIM+1] );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += w*dbeta_dW[DIM+1] );
 
 	// d2fds2[:,:,1,4]
 	// d2fds2[:,0,1,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,1,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,1,4]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,1,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,1,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += GAMMA*rho_inv );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += GAMMA*rho_inv );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
 
 	// d2fds2[:,:,2,4]
 	// d2fds2[:,0,2,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,2,4]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,2,4]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,2,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,2,4]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += GAMMA*rho_inv );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += GAMMA*rho_inv );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
 
 	// d2fds2[:,:,3,4]
 	// d2fds2[:,0,3,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,3,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,3,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,3,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,3,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0           );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += GAMMA*rho_inv );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0           );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += GAMMA*rho_inv );
 
 	// d2fds2[:,:,4,4]
 	// d2fds2[:,0,4,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,1,4,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,2,4,4]
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,3,4,4]
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 
 	// d2fds2[:,4,4,4]
-	IF_DIM_GE_1( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_2( *d2fds2_ptr[ind++] += 0.0 );
-	IF_DIM_GE_3( *d2fds2_ptr[ind++] += 0.0 );
+	IF_DIM_GE_1( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_2( d2fds2_ptr[ind++][n] += 0.0 );
+	IF_DIM_GE_3( d2fds2_ptr[ind++][n] += 0.0 );
 }
 
 #include "undef_templates_multiarray.h"
@@ -39,7 +39,8 @@ struct Flux_Data_Navier_Stokes;
 
 /** \brief Pointer to functions computing the required Navier-Stokes flux members.
  *
- *  \param flux_data  \ref Flux_Data_Navier_Stokes.
+ *  \param n           The index of the node.
+ *  \param flux_data   \ref Flux_Data_Navier_Stokes.
  *  \param f_ptr       Pointers to the flux members.
  *  \param dfds_ptr    Pointers to the flux Jacobian members (wrt the solution).
  *  \param dfdg_ptr    Pointers to the flux Jacobian members (wrt the solution gradient).
@@ -48,7 +49,8 @@ struct Flux_Data_Navier_Stokes;
  *  \todo  d2fdg2_ptr  Pointers to the flux Hessian members (wrt the gradient).
  */
 typedef void (*compute_Flux_Navier_Stokes_fptr)
-	(const struct Flux_Data_Navier_Stokes*const flux_data,
+	(const ptrdiff_t n,
+	 const struct Flux_Data_Navier_Stokes*const flux_data,
 	 Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR],
 	 Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM]
@@ -247,6 +249,8 @@ void compute_Flux_T_navier_stokes (const struct Flux_Input_T* flux_i, struct mut
 
 	const Real Pr = compute_Pr();
 
+	/* Unlike the Euler fluxes, the node loop is not vectorized as the partials are returned in statically allocated
+	 * (thread-local) storage which is shared by all nodes. */
 	const ptrdiff_t n_n = s->extents[0];
 	for (ptrdiff_t n = 0; n < n_n; ++n) {
 		const Type rho      = rho_p[n],
@@ -275,7 +279,7 @@ void compute_Flux_T_navier_stokes (const struct Flux_Input_T* flux_i, struct mut
 			  .dTs_p = &dTs_p,
 			  .tau_p = &tau_p,
 			};
-		compute_flux_navier_stokes_n(&flux_data,f_ptr,dfds_ptr,dfdg_ptr);
+		compute_flux_navier_stokes_n(n,&flux_data,f_ptr,dfds_ptr,dfdg_ptr);
 	}
 }
 
@@ -284,7 +288,8 @@ void compute_Flux_T_navier_stokes (const struct Flux_Input_T* flux_i, struct mut
 
 /// \brief Version of \ref compute_Flux_Navier_Stokes_fptr computing only the flux.
 static void compute_Flux_Navier_Stokes_100
-	(const struct Flux_Data_Navier_Stokes*const flux_data, ///< See brief.
+	(const ptrdiff_t n,                                    ///< See brief.
+	 const struct Flux_Data_Navier_Stokes*const flux_data, ///< See brief.
 	 Type*const f_ptr[DIM*NEQ],                            ///< See brief.
 	 Type*const dfds_ptr[DIM*NEQ*NVAR],                    ///< See brief.
 	 Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM]                 ///< See brief.
@@ -292,7 +297,8 @@ static void compute_Flux_Navier_Stokes_100
 
 /// \brief Version of \ref compute_Flux_Navier_Stokes_fptr computing the flux and Jacobians.
 static void compute_Flux_Navier_Stokes_111
-	(const struct Flux_Data_Navier_Stokes*const flux_data, ///< See brief.
+	(const ptrdiff_t n,                                    ///< See brief.
+	 const struct Flux_Data_Navier_Stokes*const flux_data, ///< See brief.
 	 Type*const f_ptr[DIM*NEQ],                            ///< See brief.
 	 Type*const dfds_ptr[DIM*NEQ*NVAR],                    ///< See brief.
 	 Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM]                 ///< See brief.
@@ -428,8 +434,8 @@ static compute_Flux_Navier_Stokes_fptr get_compute_Flux_Navier_Stokes_fptr (cons
 
 static bool check_if_mu_is_const ( )
 {
-	static int viscosity_type = VISCOSITY_INVALID;
-	static bool need_input = true;
+	static _Thread_local int viscosity_type = VISCOSITY_INVALID;
+	static _Thread_local bool need_input = true;
 	set_viscosity_type_T(&viscosity_type,&need_input);
 
 	switch (viscosity_type) {
@@ -447,8 +453,8 @@ static bool check_if_mu_is_const ( )
 
 static compute_dmu_ds_fptr get_compute_dmu_ds_fptr ( )
 {
-	static int viscosity_type = VISCOSITY_INVALID;
-	static bool need_input = true;
+	static _Thread_local int viscosity_type = VISCOSITY_INVALID;
+	static _Thread_local bool need_input = true;
 	set_viscosity_type_T(&viscosity_type,&need_input);
 
 	switch (viscosity_type) {
@@ -460,9 +466,9 @@ static compute_dmu_ds_fptr get_compute_dmu_ds_fptr ( )
 
 static Real compute_Pr ( )
 {
-	static Real Pr = 0.0;
+	static _Thread_local Real Pr = 0.0;
 
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 
@@ -486,7 +492,7 @@ static struct Partials_Scalar compute_mu_p
 	(const Type rho, const Type*const rhouvw, const Type E, const struct Partials_Vector*const uvw_p,
 	 const bool*const c_m)
 {
-	static struct Partials_Scalar ps;
+	static _Thread_local struct Partials_Scalar ps;
 
 	compute_mu_fptr_T compute_mu = get_compute_mu_fptr_T();
 	ps.d0 = compute_mu(rho,rhouvw,E);
@@ -510,7 +516,7 @@ static struct Partials_Scalar compute_mu_p
 static struct Partials_Vector compute_uvw_p
 	(const Type rho_inv, const Type*const rhouvw, const bool*const c_m)
 {
-	static struct Partials_Vector pv;
+	static _Thread_local struct Partials_Vector pv;
 
 	pv.d0  = compute_uvw(rho_inv,rhouvw);
 	pv.d1s = ( c_m[1] ? compute_duvw_ds(rho_inv,pv.d0) : NULL );
@@ -527,7 +533,7 @@ static struct Partials_Tensor compute_duvw_p
 	(const Type rho_inv, const struct Partials_Vector*const uvw_p, const Type*const drho,
 	 const Type*const*const drhouvw, const bool*const c_m)
 {
-	static struct Partials_Tensor pt;
+	static _Thread_local struct Partials_Tensor pt;
 
 	pt.d0  = compute_duvw(rho_inv,uvw_p->d0,drho,drhouvw);
 	pt.d1s = ( c_m[1] ? compute_dduvw_ds(rho_inv,uvw_p->d0,drho,drhouvw,uvw_p->d1s) : NULL );
@@ -544,7 +550,7 @@ static struct Partials_Tensor compute_tau_p
 	(const struct Partials_Scalar*const mu_p, const struct Partials_Tensor*const duvw_p, const bool*const c_m,
 	 const bool mu_is_const)
 {
-	static struct Partials_Tensor pt;
+	static _Thread_local struct Partials_Tensor pt;
 
 	pt.d0  = compute_tau(mu_p->d0,duvw_p->d0);
 	pt.d1s = ( c_m[1] ? compute_dtau_ds(mu_p,duvw_p,mu_is_const) : NULL );
@@ -561,7 +567,7 @@ static struct Partials_Vector compute_dTs_p
 	(const Type rho, const Type E, const Type*const drho, const Type*const dE,
 	 const struct Partials_Vector*const uvw_p, const struct Partials_Tensor*const duvw_p, const bool*const c_m)
 {
-	static struct Partials_Vector pv;
+	static _Thread_local struct Partials_Vector pv;
 
 	pv.d0  = compute_dTs(rho,E,uvw_p->d0,drho,dE,duvw_p->d0);
 	pv.d1s = ( c_m[1] ? compute_ddTs_ds(rho,E,drho,dE,uvw_p,duvw_p) : NULL );
@@ -578,44 +584,41 @@ static struct Partials_Vector compute_dTs_p
 
 /// \brief Compute the Navier-Stokes fluxes for the input nodal values.
 static void compute_Flux_navier_stokes_0
-	(const struct Flux_Data_Navier_Stokes*const flux_data, ///< \ref Flux_Data_Navier_Stokes.
+	(const ptrdiff_t n,                                    ///< The index of the node.
+	 const struct Flux_Data_Navier_Stokes*const flux_data, ///< \ref Flux_Data_Navier_Stokes.
 	 Type*const f_ptr[DIM*NEQ]                             ///< Pointers to the flux data.
 	);
 
 /// \brief Compute the Navier-Stokes flux Jacobians wrt the solution for the input nodal values.
 static void compute_Flux_navier_stokes_1s
-	(const struct Flux_Data_Navier_Stokes*const flux_data, ///< \ref Flux_Data_Navier_Stokes.
+	(const ptrdiff_t n,                                    ///< The index of the node.
+	 const struct Flux_Data_Navier_Stokes*const flux_data, ///< \ref Flux_Data_Navier_Stokes.
 	 Type*const dfds_ptr[DIM*NEQ*NVAR]                     ///< Pointers to the flux Jacobian data.
 	);
 
 /// \brief Compute the Navier-Stokes flux Jacobians wrt the solution gradients for the input nodal values.
 static void compute_Flux_navier_stokes_1g
-	(const struct Flux_Data_Navier_Stokes*const flux_data, ///< \ref Flux_Data_Navier_Stokes.
+	(const ptrdiff_t n,                                    ///< The index of the node.
+	 const struct Flux_Data_Navier_Stokes*const flux_data, ///< \ref Flux_Data_Navier_Stokes.
 	 Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM]                 ///< Pointers to the flux Jacobian data.
 	);
 
 static void compute_Flux_Navier_Stokes_100
-	(const struct Flux_Data_Navier_Stokes*const flux_data, Type*const f_ptr[DIM*NEQ],
+	(const ptrdiff_t n, const struct Flux_Data_Navier_Stokes*const flux_data, Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR], Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM])
 {
-	compute_Flux_navier_stokes_0(flux_data,f_ptr);
+	compute_Flux_navier_stokes_0(n,flux_data,f_ptr);
 	UNUSED(dfds_ptr);
 	UNUSED(dfdg_ptr);
-
-	increment_pointers_T(DIM*NEQ,(const Type**)f_ptr);
 }
 
 static void compute_Flux_Navier_Stokes_111
-	(const struct Flux_Data_Navier_Stokes*const flux_data, Type*const f_ptr[DIM*NEQ],
+	(const ptrdiff_t n, const struct Flux_Data_Navier_Stokes*const flux_data, Type*const f_ptr[DIM*NEQ],
 	 Type*const dfds_ptr[DIM*NEQ*NVAR], Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM])
 {
-	compute_Flux_navier_stokes_0(flux_data,f_ptr);
-	compute_Flux_navier_stokes_1s(flux_data,dfds_ptr);
-	compute_Flux_navier_stokes_1g(flux_data,dfdg_ptr);
-
-	increment_pointers_T(DIM*NEQ,         (const Type**)f_ptr);
-	increment_pointers_T(DIM*NEQ*NVAR,    (const Type**)dfds_ptr);
-	increment_pointers_T(DIM*NEQ*NVAR*DIM,(const Type**)dfdg_ptr);
+	compute_Flux_navier_stokes_0(n,flux_data,f_ptr);
+	compute_Flux_navier_stokes_1s(n,flux_data,dfds_ptr);
+	compute_Flux_navier_stokes_1g(n,flux_data,dfdg_ptr);
 }
 
 static const Type* compute_dmu_ds_constant
@@ -645,7 +648,7 @@ static const Type* compute_dmu_ds_sutherland
 	           Ts    = E/rho-0.5*V2,
 	           scale = mus/Ts*(c2/((1+c2/Ts)*Ts)+0.5);
 
-	static Type dmu_ds[NVAR] = {0,};
+	static _Thread_local Type dmu_ds[NVAR] = {0,};
 	for (int vr = 0; vr < NVAR; ++vr) {
 		const Type drho_ds = ( vr == 0      ? 1.0 : 0.0 ),
 		           dE_ds   = ( vr == NVAR-1 ? 1.0 : 0.0 );
@@ -664,7 +667,7 @@ static const Type* compute_uvw (const Type rho_inv, const Type*const rhouvw)
 	IF_DIM_GE_2( const Type rhov = rhouvw[1] );
 	IF_DIM_GE_3( const Type rhow = rhouvw[2] );
 
-	static Type uvw[DIM] = { 0, };
+	static _Thread_local Type uvw[DIM] = { 0, };
 	IF_DIM_GE_1( uvw[0] = rho_inv*rhou; )
 	IF_DIM_GE_2( uvw[1] = rho_inv*rhov; )
 	IF_DIM_GE_3( uvw[2] = rho_inv*rhow; )
@@ -678,7 +681,7 @@ static const Type*const* compute_duvw_ds (const Type rho_inv, const Type*const u
 	IF_DIM_GE_2( const Type v = uvw[1]; )
 	IF_DIM_GE_3( const Type w = uvw[2]; )
 
-	static Type duvw_ds[DIM][NVAR] = {{0,}};
+	static _Thread_local Type duvw_ds[DIM][NVAR] = {{0,}};
 
 	int d = 0;
 	IF_DIM_GE_1( duvw_ds[d][0]      = -rho_inv*u );
@@ -701,21 +704,25 @@ static const Type*const* compute_duvw_ds (const Type rho_inv, const Type*const u
 	IF_DIM_GE_3( duvw_ds[d][3]      =  rho_inv   );
 //	IF_DIM_GE_3( duvw_ds[d][NVAR-1] =  0.0       );
 
-	static const Type*const duvw_ds1[DIM] = ARRAY_DIM( duvw_ds[0], duvw_ds[1], duvw_ds[2] );
+	static _Thread_local const Type* duvw_ds1[DIM];
+	for (int i = 0; i < DIM; ++i)
+		duvw_ds1[i] = duvw_ds[i];
 	return duvw_ds1;
 }
 
 static const Type*const* compute_duvw
 	(const Type rho_inv, const Type*const uvw, const Type*const drho, const Type*const*const drhouvw)
 {
-	static Type duvw[DIM][DIM] = {{0,}};
+	static _Thread_local Type duvw[DIM][DIM] = {{0,}};
 
 	for (int ds = 0; ds < DIM; ++ds) {
 	for (int dx = 0; dx < DIM; ++dx) {
 		duvw[ds][dx] = rho_inv*(drhouvw[ds][dx]-drho[dx]*uvw[ds]);
 	}}
 
-	static const Type*const duvw1[DIM] = ARRAY_DIM( duvw[0], duvw[1], duvw[2] );
+	static _Thread_local const Type* duvw1[DIM];
+	for (int i = 0; i < DIM; ++i)
+		duvw1[i] = duvw[i];
 	return duvw1;
 }
 
@@ -725,7 +732,7 @@ static const Type*const*const* compute_dduvw_ds
 {
 	const Type drho_inv_ds[NVAR] = ARRAY_VAR( -rho_inv*rho_inv, 0.0, 0.0, 0.0, 0.0 );
 
-	static Type dduvw_ds[DIM][DIM][NVAR] = {{{0,}}};
+	static _Thread_local Type dduvw_ds[DIM][DIM][NVAR] = {{{0,}}};
 
 	for (int ds = 0; ds < DIM; ++ds) {
 	for (int dx = 0; dx < DIM; ++dx) {
@@ -734,17 +741,19 @@ static const Type*const*const* compute_dduvw_ds
 		                     + rho_inv*(0.0-drho[dx]*duvw_ds[ds][vr]);
 	}}}
 
-	static const Type*const dduvw_ds2[DIM][DIM] = TENSOR_DIM( dduvw_ds[0][0], dduvw_ds[0][1], dduvw_ds[0][2],
-	                                                          dduvw_ds[1][0], dduvw_ds[1][1], dduvw_ds[1][2],
-	                                                          dduvw_ds[2][0], dduvw_ds[2][1], dduvw_ds[2][2] );
-
-	static const Type*const*const duvw_ds1[DIM] = ARRAY_DIM( dduvw_ds2[0], dduvw_ds2[1], dduvw_ds2[2] );
+	static _Thread_local const Type* dduvw_ds2[DIM][DIM];
+	static _Thread_local const Type*const* duvw_ds1[DIM];
+	for (int i = 0; i < DIM; ++i) {
+		for (int j = 0; j < DIM; ++j)
+			dduvw_ds2[i][j] = dduvw_ds[i][j];
+		duvw_ds1[i] = dduvw_ds2[i];
+	}
 	return duvw_ds1;
 }
 
 static const Type*const*const*const* compute_dduvw_dg (const Type rho_inv, const Type*const uvw)
 {
-	static Type dduvw_dg[DIM][DIM][DIM][NVAR];
+	static _Thread_local Type dduvw_dg[DIM][DIM][DIM][NVAR];
 
 	for (int ds = 0; ds < DIM; ++ds) {
 	for (int dx = 0; dx < DIM; ++dx) {
@@ -755,11 +764,11 @@ static const Type*const*const*const* compute_dduvw_dg (const Type rho_inv, const
 		dduvw_dg[ds][dx][dg][vr] = rho_inv*(ddrhouvw_dg-ddrho_dg*uvw[ds]);
 	}}}}
 
-	static const Type* dduvw_dg_3[DIM][DIM][DIM];
-	static const Type*const* dduvw_dg_2[DIM][DIM];
-	static const Type*const*const* dduvw_dg_1[DIM];
+	static _Thread_local const Type* dduvw_dg_3[DIM][DIM][DIM];
+	static _Thread_local const Type*const* dduvw_dg_2[DIM][DIM];
+	static _Thread_local const Type*const*const* dduvw_dg_1[DIM];
 
-	static bool needs_set = true;
+	static _Thread_local bool needs_set = true;
 	if (needs_set) {
 		needs_set = false;
 		for (int ds = 0; ds < DIM; ++ds) {
@@ -783,7 +792,7 @@ static const Type*const* compute_tau (const Type mu, const Type*const*const duvw
 
 	const Type divV = SUM_DIM(du[0],dv[1],dw[2]);
 
-	static Type tau[DIM][DIM] = {{0,}};
+	static _Thread_local Type tau[DIM][DIM] = {{0,}};
 	IF_DIM_GE_1( tau[0][0] = mu*2.0*(du[0]-divV/3.0) );
 	IF_DIM_GE_2( tau[0][1] = mu*(dv[0]+du[1]) );
 	IF_DIM_GE_3( tau[0][2] = mu*(dw[0]+du[2]) );
@@ -794,7 +803,9 @@ static const Type*const* compute_tau (const Type mu, const Type*const*const duvw
 	IF_DIM_GE_3( tau[2][0] = tau[0][2] );
 	IF_DIM_GE_3( tau[2][1] = tau[1][2] );
 
-	static const Type*const tau_array[DIM] = ARRAY_DIM( tau[0], tau[1], tau[2] );
+	static _Thread_local const Type* tau_array[DIM];
+	for (int i = 0; i < DIM; ++i)
+		tau_array[i] = tau[i];
 	return tau_array;
 }
 
@@ -808,7 +819,7 @@ static const Type*const*const* compute_dtau_ds
 	IF_DIM_GE_2( const Type*const*const ddv_ds = duvw_p->d1s[1]; )
 	IF_DIM_GE_3( const Type*const*const ddw_ds = duvw_p->d1s[2]; )
 
-	static Type dtau_ds[DIM][DIM][NVAR] = {{{0,}}};
+	static _Thread_local Type dtau_ds[DIM][DIM][NVAR] = {{{0,}}};
 
 	for (int vr = 0; vr < NVAR; ++vr) {
 		const Type ddivV_ds = SUM_DIM( ddu_ds[0][vr], ddv_ds[1][vr], ddw_ds[2][vr] );
@@ -842,11 +853,13 @@ static const Type*const*const* compute_dtau_ds
 		IF_DIM_GE_3( dtau_ds[2][1][vr] = dtau_ds[1][2][vr] );
 	}
 
-	static const Type*const dtau_ds2[DIM][DIM] = TENSOR_DIM( dtau_ds[0][0], dtau_ds[0][1], dtau_ds[0][2],
-	                                                         dtau_ds[1][0], dtau_ds[1][1], dtau_ds[1][2],
-	                                                         dtau_ds[2][0], dtau_ds[2][1], dtau_ds[2][2] );
-
-	static const Type*const*const dtau_ds1[DIM] = ARRAY_DIM( dtau_ds2[0], dtau_ds2[1], dtau_ds2[2] );
+	static _Thread_local const Type* dtau_ds2[DIM][DIM];
+	static _Thread_local const Type*const* dtau_ds1[DIM];
+	for (int i = 0; i < DIM; ++i) {
+		for (int j = 0; j < DIM; ++j)
+			dtau_ds2[i][j] = dtau_ds[i][j];
+		dtau_ds1[i] = dtau_ds2[i];
+	}
 	return dtau_ds1;
 }
 
@@ -860,7 +873,7 @@ static const Type*const*const*const* compute_dtau_dg
 	IF_DIM_GE_2( const Type*const*const*const ddv_dg = duvw_p->d1g[1]; )
 	IF_DIM_GE_3( const Type*const*const*const ddw_dg = duvw_p->d1g[2]; )
 
-	static Type dtau_dg[DIM][DIM][DIM][NVAR];
+	static _Thread_local Type dtau_dg[DIM][DIM][DIM][NVAR];
 
 	for (int dg = 0; dg < DIM; ++dg) {
 	for (int vr = 0; vr < NVAR; ++vr) {
@@ -881,11 +894,11 @@ static const Type*const*const*const* compute_dtau_dg
 	}}
 
 
-	static const Type* dtau_dg_3[DIM][DIM][DIM];
-	static const Type*const* dtau_dg_2[DIM][DIM];
-	static const Type*const*const* dtau_dg_1[DIM];
+	static _Thread_local const Type* dtau_dg_3[DIM][DIM][DIM];
+	static _Thread_local const Type*const* dtau_dg_2[DIM][DIM];
+	static _Thread_local const Type*const*const* dtau_dg_1[DIM];
 
-	static bool needs_set = true;
+	static _Thread_local bool needs_set = true;
 	if (needs_set) {
 		needs_set = false;
 		for (int ds = 0; ds < DIM; ++ds) {
@@ -916,7 +929,7 @@ static const Type* compute_dTs
 	IF_DIM_GE_2( const Type* dv = duvw[1] );
 	IF_DIM_GE_3( const Type* dw = duvw[2] );
 
-	static Type dTs[DIM];
+	static _Thread_local Type dTs[DIM];
 	for (int d = 0; d < DIM; ++d) {
 		const Type dE_o_rho = rho_inv2*(dE[d]*rho-E*drho[d]),
 		           dV2      = 2.0*SUM_DIM( u*du[d],v*dv[d],w*dw[d] );
@@ -949,7 +962,7 @@ static const Type*const* compute_ddTs_ds
 	IF_DIM_GE_2( const Type*const*const ddv_ds = duvw_p->d1s[1] );
 	IF_DIM_GE_3( const Type*const*const ddw_ds = duvw_p->d1s[2] );
 
-	static Type ddTs_ds[DIM][NVAR];
+	static _Thread_local Type ddTs_ds[DIM][NVAR];
 	for (int d = 0; d < DIM; ++d) {
 	for (int vr = 0; vr < NVAR; ++vr) {
 		const Type drho_inv2_ds = ( vr == 0      ? -2.0*rho_inv*rho_inv2 : 0.0 ),
@@ -963,7 +976,9 @@ static const Type*const* compute_ddTs_ds
 		ddTs_ds[d][vr] = dE_o_rho_ds-0.5*ddV2_ds;
 	}}
 
-	static const Type*const ddTs_ds_1[DIM] = ARRAY_DIM( ddTs_ds[0], ddTs_ds[1], ddTs_ds[2] );
+	static _Thread_local const Type* ddTs_ds_1[DIM];
+	for (int i = 0; i < DIM; ++i)
+		ddTs_ds_1[i] = ddTs_ds[i];
 	return ddTs_ds_1;
 }
 
@@ -982,7 +997,7 @@ static const Type*const*const* compute_ddTs_dg
 	IF_DIM_GE_2( const Type*const*const*const ddv_dg = duvw_p->d1g[1] );
 	IF_DIM_GE_3( const Type*const*const*const ddw_dg = duvw_p->d1g[2] );
 
-	static Type ddTs_dg[DIM][DIM][NVAR];
+	static _Thread_local Type ddTs_dg[DIM][DIM][NVAR];
 	for (int dx = 0; dx < DIM; ++dx) {
 	for (int dg = 0; dg < DIM; ++dg) {
 	for (int vr = 0; vr < NVAR; ++vr) {
@@ -993,17 +1008,20 @@ static const Type*const*const* compute_ddTs_dg
 		ddTs_dg[dx][dg][vr] = dE_o_rho_dg-0.5*dV2_dg;
 	}}}
 
-	static const Type*const ddTs_dg_2[DIM][DIM] = TENSOR_DIM( ddTs_dg[0][0], ddTs_dg[0][1], ddTs_dg[0][2],
-	                                                          ddTs_dg[1][0], ddTs_dg[1][1], ddTs_dg[1][2],
-	                                                          ddTs_dg[2][0], ddTs_dg[2][1], ddTs_dg[2][2] );
-	static const Type*const*const ddTs_dg_1[DIM] = ARRAY_DIM( ddTs_dg_2[0], ddTs_dg_2[1], ddTs_dg_2[2] );
+	static _Thread_local const Type* ddTs_dg_2[DIM][DIM];
+	static _Thread_local const Type*const* ddTs_dg_1[DIM];
+	for (int i = 0; i < DIM; ++i) {
+		for (int j = 0; j < DIM; ++j)
+			ddTs_dg_2[i][j] = ddTs_dg[i][j];
+		ddTs_dg_1[i] = ddTs_dg_2[i];
+	}
 	return ddTs_dg_1;
 }
 
 // Level 2 ********************************************************************************************************** //
 
 static void compute_Flux_navier_stokes_0
-	(const struct Flux_Data_Navier_Stokes*const flux_data, Type*const f_ptr[DIM*NEQ])
+	(const ptrdiff_t n, const struct Flux_Data_Navier_Stokes*const flux_data, Type*const f_ptr[DIM*NEQ])
 {
 	const Type Pr = flux_data->Pr;
 	const Type mu = flux_data->mu_p->d0;
@@ -1017,30 +1035,30 @@ static void compute_Flux_navier_stokes_0
 
 	// f[:,0]
 	for (int d = 0; d < DIM; ++d)
-		*f_ptr[ind++] -= 0.0;
+		f_ptr[ind++][n] -= 0.0;
 
 	// f[:,1]
 	for (int d = 0; d < DIM; ++d)
-		*f_ptr[ind++] -= tau[0][d];
+		f_ptr[ind++][n] -= tau[0][d];
 
 #if DIM >= 2
 	// f[:,2]
 	for (int d = 0; d < DIM; ++d)
-		*f_ptr[ind++] -= tau[1][d];
+		f_ptr[ind++][n] -= tau[1][d];
 #endif
 #if DIM >= 3
 	// f[:,3]
 	for (int d = 0; d < DIM; ++d)
-		*f_ptr[ind++] -= tau[2][d];
+		f_ptr[ind++][n] -= tau[2][d];
 #endif
 
 	// f[:,4]
 	for (int d = 0; d < DIM; ++d)
-		*f_ptr[ind++] -= GAMMA/Pr*mu*dTs[d] + SUM_DIM( uvw[0]*tau[d][0],uvw[1]*tau[d][1],uvw[2]*tau[d][2] );
+		f_ptr[ind++][n] -= GAMMA/Pr*mu*dTs[d] + SUM_DIM( uvw[0]*tau[d][0],uvw[1]*tau[d][1],uvw[2]*tau[d][2] );
 }
 
 static void compute_Flux_navier_stokes_1s
-	(const struct Flux_Data_Navier_Stokes*const flux_data, Type*const dfds_ptr[DIM*NEQ*NVAR])
+	(const ptrdiff_t n, const struct Flux_Data_Navier_Stokes*const flux_data, Type*const dfds_ptr[DIM*NEQ*NVAR])
 {
 	const Type Pr = flux_data->Pr;
 	const Type mu           = flux_data->mu_p->d0,
@@ -1063,26 +1081,26 @@ static void compute_Flux_navier_stokes_1s
 	for (int vr = 0; vr < NVAR; ++vr) {
 		// dfds[:,0,vr]
 		for (int d = 0; d < DIM; ++d)
-			*dfds_ptr[ind++] -= 0.0;
+			dfds_ptr[ind++][n] -= 0.0;
 
 		// dfds[:,1,vr]
 		for (int d = 0; d < DIM; ++d)
-			*dfds_ptr[ind++] -= dtau_ds[0][d][vr];
+			dfds_ptr[ind++][n] -= dtau_ds[0][d][vr];
 
 #if DIM >= 2
 		// dfds[:,2,vr]
 		for (int d = 0; d < DIM; ++d)
-			*dfds_ptr[ind++] -= dtau_ds[1][d][vr];
+			dfds_ptr[ind++][n] -= dtau_ds[1][d][vr];
 #endif
 #if DIM >= 3
 		// dfds[:,3,vr]
 		for (int d = 0; d < DIM; ++d)
-			*dfds_ptr[ind++] -= dtau_ds[2][d][vr];
+			dfds_ptr[ind++][n] -= dtau_ds[2][d][vr];
 #endif
 
 		// dfds[:,4,vr]
 		for (int d = 0; d < DIM; ++d) {
-			*dfds_ptr[ind++] -= GAMMA/Pr*( dmu_ds[vr]*dTs[d] + mu*ddTs_ds[d][vr] )
+			dfds_ptr[ind++][n] -= GAMMA/Pr*( dmu_ds[vr]*dTs[d] + mu*ddTs_ds[d][vr] )
 			                  + SUM_DIM( duvw_ds[0][vr]*tau[d][0] + uvw[0]*dtau_ds[d][0][vr],
 			                             duvw_ds[1][vr]*tau[d][1] + uvw[1]*dtau_ds[d][1][vr],
 			                             duvw_ds[2][vr]*tau[d][2] + uvw[2]*dtau_ds[d][2][vr] );
@@ -1091,7 +1109,7 @@ static void compute_Flux_navier_stokes_1s
 }
 
 static void compute_Flux_navier_stokes_1g
-	(const struct Flux_Data_Navier_Stokes*const flux_data, Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM])
+	(const ptrdiff_t n, const struct Flux_Data_Navier_Stokes*const flux_data, Type*const dfdg_ptr[DIM*NEQ*NVAR*DIM])
 {
 	const Type Pr = flux_data->Pr;
 	const Type mu                 = flux_data->mu_p->d0,
@@ -1116,27 +1134,27 @@ static void compute_Flux_navier_stokes_1g
 	for (int vr = 0; vr < NVAR; ++vr) {
 		// dfds[:,0,vr,dg]
 		for (int d = 0; d < DIM; ++d)
-			*dfdg_ptr[ind++] -= 0.0;
+			dfdg_ptr[ind++][n] -= 0.0;
 
 		// dfds[:,1,vr,dg]
 		for (int d = 0; d < DIM; ++d)
-			*dfdg_ptr[ind++] -= dtau_dg[0][d][dg][vr];
+			dfdg_ptr[ind++][n] -= dtau_dg[0][d][dg][vr];
 
 #if DIM >= 2
 		// dfds[:,2,vr,dg]
 		for (int d = 0; d < DIM; ++d)
-			*dfdg_ptr[ind++] -= dtau_dg[1][d][dg][vr];
+			dfdg_ptr[ind++][n] -= dtau_dg[1][d][dg][vr];
 #endif
 #if DIM >= 3
 		// dfds[:,3,vr,dg]
 		for (int d = 0; d < DIM; ++d)
-			*dfdg_ptr[ind++] -= dtau_dg[2][d][dg][vr];
+			dfdg_ptr[ind++][n] -= dtau_dg[2][d][dg][vr];
 #endif
 
 		// dfds[:,4,vr,dg]
 		for (int d = 0; d < DIM; ++d) {
 			// Note dmu_dg, duvw_dg assumed to be 0.0.
-			*dfdg_ptr[ind++] -= GAMMA/Pr*mu*ddTs_dg[d][dg][vr]
+			dfdg_ptr[ind++][n] -= GAMMA/Pr*mu*ddTs_dg[d][dg][vr]
 			                  + SUM_DIM( uvw[0]*dtau_dg[d][0][dg][vr],
 			                             uvw[1]*dtau_dg[d][1][dg][vr],
 			                             uvw[2]*dtau_dg[d][2][dg][vr] );
@@ -84,6 +84,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #undef compute_Flux_Euler_100
 #undef compute_Flux_Euler_110
 #undef compute_Flux_Euler_111
+#undef compute_Flux_Data_Euler
 #undef compute_Flux_euler_0
 #undef compute_Flux_euler_1
 #undef compute_Flux_euler_2
@@ -125,9 +125,9 @@ void set_function_pointers_solution_advection_T (struct Test_Case_T* test_case,
 
 struct Sol_Data__Advection_T get_sol_data_advection_T ( )
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
@@ -188,8 +188,8 @@ const struct const_Matrix_R* constructor_b_adv_T
 const Real* compute_b_adv_constant_T (const Type*const xyz)
 {
 	UNUSED(xyz);
-	static bool need_input = true;
-	static Real b_adv[DIM] = {0,};
+	static _Thread_local bool need_input = true;
+	static _Thread_local Real b_adv[DIM] = {0,};
 
 	if (need_input) {
 		need_input = false;
@@ -217,8 +217,8 @@ const Real* compute_b_adv_constant_T (const Type*const xyz)
 
 const Real* compute_b_adv_vortex_T (const Type*const xyz)
 {
-	static bool need_input = true;
-	static Real b_mag = 0;
+	static _Thread_local bool need_input = true;
+	static _Thread_local Real b_mag = 0;
 	if (need_input) {
 		need_input = false;
 
@@ -240,7 +240,7 @@ const Real* compute_b_adv_vortex_T (const Type*const xyz)
 			EXIT_ERROR("Did not find the required number of variables");
 	}
 
-	static Real b_adv[DIM] = {0,};
+	static _Thread_local Real b_adv[DIM] = {0,};
 	assert(DIM == 2);
 
 	const Real x = real_T(xyz[0]),
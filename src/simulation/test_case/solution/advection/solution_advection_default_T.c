@@ -141,8 +141,8 @@ static const struct const_Multiarray_T* constructor_source_advection_default_2d_
 static struct Multiarray_T* constructor_sol_advection_default_T
 	(const struct const_Multiarray_T* xyz, const struct Simulation* sim)
 {
-	static bool parameters_set = false;
-	static mutable_constructor_sol_fptr_T constructor_sol = NULL;
+	static _Thread_local bool parameters_set = false;
+	static _Thread_local mutable_constructor_sol_fptr_T constructor_sol = NULL;
 
 	if (!parameters_set) {
 		parameters_set = true;
@@ -158,8 +158,8 @@ static struct Multiarray_T* constructor_sol_advection_default_T
 static const struct const_Multiarray_T* constructor_source_advection_default_T
 	(const struct const_Multiarray_T* xyz, const struct Simulation* sim)
 {
-	static bool parameters_set = false;
-	static constructor_sol_fptr_T constructor_source = NULL;
+	static _Thread_local bool parameters_set = false;
+	static _Thread_local constructor_sol_fptr_T constructor_source = NULL;
 
 	if (!parameters_set) {
 		parameters_set = true;
@@ -203,8 +203,8 @@ static const struct const_Multiarray_T* constructor_source_advection_default_1d_
 	assert(DIM == 1);
 	assert(xyz->extents[1] == DIM);
 
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
@@ -264,8 +264,8 @@ static const struct const_Multiarray_T* constructor_source_advection_default_2d_
 	assert(DIM == 2);
 	assert(xyz->extents[1] == DIM);
 
-	static bool need_input = true;
-	static struct Sol_Data__Advection_T sol_data;
+	static _Thread_local bool need_input = true;
+	static _Thread_local struct Sol_Data__Advection_T sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_advection_T(&sol_data);
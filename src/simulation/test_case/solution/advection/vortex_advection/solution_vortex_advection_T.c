@@ -68,10 +68,10 @@ static struct Multiarray_T* constructor_sol_vortex_advection
 {
 	assert(DIM == 2);
 
-	static int adv_type = -1;
-	static bool use_constant_solution = false;
+	static _Thread_local int adv_type = -1;
+	static _Thread_local bool use_constant_solution = false;
 
-	static bool requires_input = true;
+	static _Thread_local bool requires_input = true;
 	if (requires_input) {
 		const struct Sol_Data__Advection_T sol_data = get_sol_data_advection_T();
 		if (sol_data.compute_b_adv == compute_b_adv_vortex_T)
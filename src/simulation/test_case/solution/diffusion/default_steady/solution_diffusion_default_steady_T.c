@@ -181,8 +181,8 @@ static const struct const_Multiarray_T* constructor_source_diffusion_default_ste
 static struct Multiarray_T* constructor_sol_diffusion_default_steady
 	(const struct const_Multiarray_T* xyz, const struct Simulation* sim)
 {
-	static bool parameters_set = false;
-	static mutable_constructor_sol_fptr_T constructor_sol = NULL;
+	static _Thread_local bool parameters_set = false;
+	static _Thread_local mutable_constructor_sol_fptr_T constructor_sol = NULL;
 
 	if (!parameters_set) {
 		parameters_set = true;
@@ -198,8 +198,8 @@ static struct Multiarray_T* constructor_sol_diffusion_default_steady
 static struct Multiarray_T* constructor_grad_diffusion_default_steady
 	(const struct const_Multiarray_T* xyz, const struct Simulation* sim)
 {
-	static bool parameters_set = false;
-	static mutable_constructor_sol_fptr_T constructor_grad = NULL;
+	static _Thread_local bool parameters_set = false;
+	static _Thread_local mutable_constructor_sol_fptr_T constructor_grad = NULL;
 
 	if (!parameters_set) {
 		parameters_set = true;
@@ -215,8 +215,8 @@ static struct Multiarray_T* constructor_grad_diffusion_default_steady
 static const struct const_Multiarray_T* constructor_source_diffusion_default_steady
 	(const struct const_Multiarray_T* xyz, const struct Simulation* sim)
 {
-	static bool parameters_set = false;
-	static constructor_sol_fptr_T constructor_source = NULL;
+	static _Thread_local bool parameters_set = false;
+	static _Thread_local constructor_sol_fptr_T constructor_source = NULL;
 
 	if (!parameters_set) {
 		parameters_set = true;
@@ -401,9 +401,9 @@ static void read_data_default_diffusion
 
 static struct Sol_Data__dd get_sol_data ( )
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__dd sol_data;
+	static _Thread_local struct Sol_Data__dd sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_default_diffusion(&sol_data);
@@ -116,9 +116,9 @@ static void read_data_free_stream
 
 static struct Sol_Data__fs get_sol_data ( )
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__fs sol_data;
+	static _Thread_local struct Sol_Data__fs sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_free_stream(&sol_data);
@@ -161,9 +161,9 @@ static void set_data_periodic_vortex
 
 static struct Sol_Data__pv get_sol_data ( )
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__pv sol_data;
+	static _Thread_local struct Sol_Data__pv sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_periodic_vortex(&sol_data);
@@ -219,9 +219,9 @@ const struct const_Multiarray_d* constructor_const_functionals_cd_cl_reference_c
 {
 	UNUSED(sim);
 
-	static double c_dl_ref[2] = {0.0};
+	static _Thread_local double c_dl_ref[2] = {0.0};
 
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 
@@ -268,9 +268,9 @@ static void read_data_specific_gas
 
 static struct Sol_Data__c_dl get_sol_data__c_dl ( )
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__c_dl sol_data;
+	static _Thread_local struct Sol_Data__c_dl sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_c_dl(&sol_data);
@@ -280,9 +280,9 @@ static struct Sol_Data__c_dl get_sol_data__c_dl ( )
 
 static double get_specific_gas_constant ( )
 {
-	static double r_s = 0.0;
+	static _Thread_local double r_s = 0.0;
 
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 		read_data_specific_gas(&r_s);
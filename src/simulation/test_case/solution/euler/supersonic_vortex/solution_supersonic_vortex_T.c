@@ -139,9 +139,9 @@ static void read_data_supersonic_vortex
 
 static struct Sol_Data__sv get_sol_data ( )
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__sv sol_data;
+	static _Thread_local struct Sol_Data__sv sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_supersonic_vortex(&sol_data);
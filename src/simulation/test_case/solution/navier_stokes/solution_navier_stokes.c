@@ -92,9 +92,9 @@ void compute_viscosity (struct Multiarray_d* mu, const struct const_Multiarray_d
 
 double get_normal_flux_Energy ( )
 {
-	static double nf_E = DBL_MIN;
+	static _Thread_local double nf_E = DBL_MIN;
 
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 
@@ -153,9 +153,9 @@ double get_normal_flux_Energy ( )
 
 double get_r_s ( )
 {
-	static double r_s = 0.0;
+	static _Thread_local double r_s = 0.0;
 
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 
@@ -187,8 +187,8 @@ void convert_variables_gradients_T
 
 compute_mu_fptr_T get_compute_mu_fptr_T ( )
 {
-	static int viscosity_type = VISCOSITY_INVALID;
-	static bool need_input = true;
+	static _Thread_local int viscosity_type = VISCOSITY_INVALID;
+	static _Thread_local bool need_input = true;
 	set_viscosity_type_T(&viscosity_type,&need_input);
 
 	switch (viscosity_type) {
@@ -221,9 +221,9 @@ void set_viscosity_type_T (int*const viscosity_type_ptr, bool*const need_input)
 Type compute_mu_constant_T (const Type rho, const Type*const rhouvw, const Type E)
 {
 	UNUSED(rho); UNUSED(rhouvw); UNUSED(E);
-	static Real mu = 0.0;
+	static _Thread_local Real mu = 0.0;
 
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 	if (need_input) {
 		need_input = false;
 
@@ -266,9 +266,9 @@ static void set_data_taylor_couette
 
 static struct Sol_Data__tc get_sol_data (const struct Simulation*const sim)
 {
-	static bool need_input = true;
+	static _Thread_local bool need_input = true;
 
-	static struct Sol_Data__tc sol_data;
+	static _Thread_local struct Sol_Data__tc sol_data;
 	if (need_input) {
 		need_input = false;
 		read_data_taylor_couette(&sol_data);
@@ -0,0 +1,741 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/// \file
+
+#include "bounding_volume_hierarchy.h"
+
+#include <assert.h>
+#include <complex.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include "gsl/gsl_math.h"
+
+#include "macros.h"
+#include "definitions_core.h"
+#include "definitions_elements.h"
+#include "definitions_tol.h"
+
+#include "matrix.h"
+#include "multiarray.h"
+#include "vector.h"
+
+#include "element_solver.h"
+#include "volume_solver.h"
+
+#include "bases.h"
+#include "element.h"
+#include "element_operators.h"
+#include "intrusive.h"
+#include "inverse_mapping.h"
+#include "math_functions.h"
+#include "multiarray_operator.h"
+#include "operator.h"
+#include "simulation.h"
+#include "volume.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define BVH_N_LEAF_MAX 4  ///< The maximum number of volumes referenced by a leaf node.
+#define BVH_STACK_MAX  64 ///< The maximum size of the stack used for the traversal of the hierarchy.
+
+#define BVH_PAD_REL    1e-8 ///< The padding of the bounding boxes relative to their maximum extent.
+
+#define BVH_TOL_INSIDE 1e-10 ///< The tolerance on the distance outside of the standard reference element.
+#define BVH_TOL_NEWTON 1e-13 ///< The tolerance on the Newton update for the curved inverse mapping.
+
+/// \brief Container for a node of the \ref Bounding_Volume_Hierarchy.
+struct BVH_Node {
+	double xyz_min[DIM], ///< The minimum xyz coordinates of the bounding box.
+	       xyz_max[DIM]; ///< The maximum xyz coordinates of the bounding box.
+
+	/** The index of the first entry of \ref Bounding_Volume_Hierarchy::ind_v for leaf nodes and of the right child
+	 *  for interior nodes (the left child immediately follows its parent). */
+	int ind;
+	int n_v; ///< The number of volumes referenced by the node (0 for interior nodes).
+};
+
+/** \brief Container for the affine map from the standard to the reference element coordinates of an element type:
+ *         rst = rst_0 + a_std*rst_std.
+ *
+ *  The maps are computed once for each of the element types present such that no memory is allocated for each query.
+ */
+struct BVH_Map_Std {
+	bool set; ///< Flag for whether the map was set (i.e. whether the element type is present).
+
+	double rst_0[DIM];     ///< The reference coordinates of the origin of the standard reference element.
+	double a_std[DIM*DIM]; ///< The row-major linear part of the map.
+};
+
+/// \brief Set the bounding boxes, geometry order and geometry coefficients of the volumes.
+static void set_volume_data
+	(struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const char type_geom,                       ///< See \ref constructor_Bounding_Volume_Hierarchy.
+	 const struct Simulation*const sim           ///< Standard.
+	);
+
+/// \brief Construct the nodes of the hierarchy.
+static void constructor_nodes
+	(struct Bounding_Volume_Hierarchy*const bvh ///< Standard.
+	);
+
+/** \brief Compute the distance outside of the standard reference element of the input volume for the input node.
+ *  \return See brief (`DBL_MAX` if the inverse mapping did not converge). */
+static double compute_distance_outside
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const int ind_v,                                  ///< The index of the volume.
+	 const double*const xyz,                           ///< The xyz coordinates of the node.
+	 double*const rst_std                              ///< Memory in which to store the standard reference coords.
+	);
+
+/** \brief Find the volume violating the containment condition by the smallest amount among those whose bounding boxes
+ *         are within the input squared distance of the node.
+ *  \return The index of the volume (-1 if the inverse mapping did not converge for any of the candidate volumes). */
+static int find_volume_candidates
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const double*const xyz,                           ///< The xyz coordinates of the node.
+	 const double dist2_max,                           ///< The maximum squared distance to the bounding boxes.
+	 double*const dist_best,                           ///< Memory in which to store the distance outside.
+	 double*const rst_std_best                         ///< Memory in which to store the standard reference coords.
+	);
+
+/** \brief Compute the squared distance from the input node to the closest of the bounding boxes of the volumes.
+ *  \return See brief. */
+static double compute_distance2_nearest_box
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const double*const xyz                            ///< The xyz coordinates of the node.
+	);
+
+/** \brief Compute the squared distance from the input node to the bounding box (0.0 if inside).
+ *  \return See brief. */
+static double compute_distance2_box
+	(const double*const xyz_min, ///< The minimum xyz coordinates of the bounding box.
+	 const double*const xyz_max, ///< The maximum xyz coordinates of the bounding box.
+	 const double*const xyz      ///< The xyz coordinates of the node.
+	);
+
+/// \brief Compute the reference element coordinates of a node from its standard reference element coordinates.
+static void compute_rst_ref_from_map_std
+	(const struct BVH_Map_Std*const map_std, ///< \ref BVH_Map_Std.
+	 const double*const rst_std,             ///< The standard reference element coordinates.
+	 double*const rst                        ///< Memory in which to store the reference element coordinates.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+const struct Bounding_Volume_Hierarchy* constructor_Bounding_Volume_Hierarchy
+	(const struct Intrusive_List*const volumes, const struct Simulation*const sim, const char type_geom)
+{
+	struct Bounding_Volume_Hierarchy*const bvh = calloc(1,sizeof *bvh); // returned
+
+	ptrdiff_t n_v = 0;
+	for (const struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next)
+		++n_v;
+	if (n_v == 0)
+		EXIT_ERROR("Constructing a bounding volume hierarchy for an empty list of volumes.\n");
+
+	const struct Volume**const vols = malloc((size_t)n_v * sizeof *vols); // keep
+	ptrdiff_t v = 0;
+	for (const struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next)
+		vols[v++] = (const struct Volume*) curr;
+
+	*(ptrdiff_t*)&bvh->n_v = n_v;
+	bvh->volumes = vols;
+
+	set_volume_data(bvh,type_geom,sim);
+	constructor_nodes(bvh);
+
+	return bvh;
+}
+
+void destructor_Bounding_Volume_Hierarchy (const struct Bounding_Volume_Hierarchy*const bvh)
+{
+	free((void*)bvh->volumes);
+	free((void*)bvh->boxes);
+	free((void*)bvh->p_g);
+	for (ptrdiff_t v = 0; v < bvh->n_v; ++v) {
+		if (bvh->geom_coef[v])
+			destructor_const_Multiarray_d(bvh->geom_coef[v]);
+	}
+	free((void*)bvh->geom_coef);
+	free((void*)bvh->maps_std);
+	free((void*)bvh->nodes);
+	free((void*)bvh->ind_v);
+	free((void*)bvh);
+}
+
+int find_volume_bvh (const struct Bounding_Volume_Hierarchy*const bvh, const double*const xyz, double*const rst)
+{
+	double dist_best = DBL_MAX;
+	double rst_std_best[DIM] = { 0.0, };
+	int ind_best = find_volume_candidates(bvh,xyz,0.0,&dist_best,rst_std_best);
+
+	if (ind_best == -1) {
+		/* Several volumes generally share the closest bounding box (e.g. the simplices obtained from splitting a
+		 * QUAD) such that all of them are considered. */
+		const double dist2_min = compute_distance2_nearest_box(bvh,xyz);
+		ind_best = find_volume_candidates(bvh,xyz,dist2_min,&dist_best,rst_std_best);
+		if (ind_best == -1)
+			EXIT_ERROR("Did not find a volume for the node: % .3e % .3e % .3e.\n",
+			           xyz[0],( DIM > 1 ? xyz[1] : 0.0 ),( DIM > 2 ? xyz[2] : 0.0 ));
+	}
+
+	if (rst)
+		compute_rst_ref_from_map_std(&bvh->maps_std[bvh->volumes[ind_best]->element->type],rst_std_best,rst);
+	return ind_best;
+}
+
+const struct const_Vector_i* constructor_volume_indices_bvh
+	(const struct Bounding_Volume_Hierarchy*const bvh, const struct const_Matrix_d*const xyz,
+	 struct Matrix_d*const rst)
+{
+	assert(xyz->layout == 'R');
+	assert(xyz->ext_1 == DIM);
+
+	const int n_n = (int) xyz->ext_0;
+	assert(rst == NULL || (rst->layout == 'R' && rst->ext_0 == n_n && rst->ext_1 == DIM));
+
+	struct Vector_i*const ind_v = constructor_empty_Vector_i(n_n); // returned
+
+	PRAGMA_OMP(parallel for schedule(dynamic,CHUNK_OMP))
+	for (int n = 0; n < n_n; ++n) {
+		double*const rst_n = ( rst ? get_row_Matrix_d(n,rst) : NULL );
+		ind_v->data[n] = find_volume_bvh(bvh,get_row_const_Matrix_d(n,xyz),rst_n);
+	}
+	return (struct const_Vector_i*) ind_v;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/** \brief Construct the node of the hierarchy referencing the volumes with indices in [i_0,i_1) of
+ *         \ref Bounding_Volume_Hierarchy::ind_v (and, recursively, all of its children).
+ *  \return The index of the constructed node. */
+static int constructor_node
+	(struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const double*const centroids,               ///< The centroids of the bounding boxes of the volumes.
+	 const int i_0,                              ///< The index of the first volume.
+	 const int i_1                               ///< The index one past the last volume.
+	);
+
+/// \brief Set the \ref BVH_Map_Std for the input element type if it has not yet been set.
+static void set_map_std
+	(struct BVH_Map_Std*const maps_std, ///< The maps for all element types.
+	 const int e_type                   ///< \ref Element::type.
+	);
+
+/** \brief Constructor for the \ref const_Multiarray_T\* of the Bezier coefficients of the high-order geometry of the
+ *         input curved volume.
+ *  \return See brief.
+ *
+ *  Only the real part of the geometry coefficients of complex volumes is used (the geometry is not perturbed when
+ *  using the complex step).
+ */
+static const struct const_Multiarray_d* constructor_geom_coef_bezier
+	(const struct Volume*const vol, ///< \ref Volume.
+	 const char type_geom           ///< See \ref constructor_Bounding_Volume_Hierarchy.
+	);
+
+/** \brief Return the order of the basis of the high-order geometry of the input curved volume.
+ *  \return See brief. */
+static int compute_p_geom_curved
+	(const struct Volume*const vol,    ///< \ref Volume.
+	 const char type_geom,             ///< See \ref constructor_Bounding_Volume_Hierarchy.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Correct the standard reference coordinates of the node using Newton's method on the high-order geometry of
+ *         the curved volume.
+ *  \return `true` if the Newton iterations converged; `false` otherwise. */
+static bool correct_rst_std_curved
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const int ind_v,                                  ///< The index of the volume.
+	 const double*const xyz,                           ///< The xyz coordinates of the node.
+	 double*const rst_std                              ///< The standard reference coordinates to be corrected.
+	);
+
+static void set_volume_data
+	(struct Bounding_Volume_Hierarchy*const bvh, const char type_geom, const struct Simulation*const sim)
+{
+	assert(type_geom == 'v' || type_geom == 'r' || type_geom == 'c');
+	const ptrdiff_t n_v = bvh->n_v;
+
+	double*const boxes = malloc((size_t)(n_v*2*DIM) * sizeof *boxes);                     // keep
+	int*const p_g      = malloc((size_t)n_v * sizeof *p_g);                                // keep
+	const struct const_Multiarray_d** geom_coef = calloc((size_t)n_v,sizeof *geom_coef); // keep
+	struct BVH_Map_Std*const maps_std = calloc(PYR+1,sizeof *maps_std);                  // keep
+
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		const struct Volume*const vol = bvh->volumes[v];
+		set_map_std(maps_std,vol->element->type);
+
+		p_g[v] = 1;
+		if (type_geom != 'v' && vol->curved) {
+			p_g[v]       = compute_p_geom_curved(vol,type_geom,sim);
+			geom_coef[v] = constructor_geom_coef_bezier(vol,type_geom);
+		}
+
+		double*const xyz_min = &boxes[v*2*DIM],
+		      *const xyz_max = &boxes[v*2*DIM+DIM];
+		for (int d = 0; d < DIM; ++d) {
+			xyz_min[d] =  DBL_MAX;
+			xyz_max[d] = -DBL_MAX;
+		}
+
+		const struct const_Multiarray_d*const xyz_ve = vol->xyz_ve;
+		const ptrdiff_t n_ve = xyz_ve->extents[0];
+		for (int i = 0; i < n_ve; ++i) {
+			const double*const data_ve = get_row_const_Multiarray_d(i,xyz_ve);
+			for (int d = 0; d < DIM; ++d) {
+				xyz_min[d] = GSL_MIN(xyz_min[d],data_ve[d]);
+				xyz_max[d] = GSL_MAX(xyz_max[d],data_ve[d]);
+			}
+		}
+
+		// The high-order geometry is contained in the convex hull of its Bezier coefficients.
+		if (geom_coef[v]) {
+			const struct const_Multiarray_d*const g_coef = geom_coef[v];
+			assert(g_coef->layout == 'C');
+			const ptrdiff_t n_g = g_coef->extents[0];
+			for (int d = 0; d < DIM; ++d) {
+				const double*const data_g = get_col_const_Multiarray_d(d,g_coef);
+				for (int n = 0; n < n_g; ++n) {
+					xyz_min[d] = GSL_MIN(xyz_min[d],data_g[n]);
+					xyz_max[d] = GSL_MAX(xyz_max[d],data_g[n]);
+				}
+			}
+		}
+
+		double ext_max = 0.0;
+		for (int d = 0; d < DIM; ++d)
+			ext_max = GSL_MAX(ext_max,xyz_max[d]-xyz_min[d]);
+		const double pad = BVH_PAD_REL*ext_max;
+		for (int d = 0; d < DIM; ++d) {
+			xyz_min[d] -= pad;
+			xyz_max[d] += pad;
+		}
+	}
+
+	bvh->boxes     = boxes;
+	bvh->p_g       = p_g;
+	bvh->geom_coef = geom_coef;
+	bvh->maps_std  = maps_std;
+}
+
+static void constructor_nodes (struct Bounding_Volume_Hierarchy*const bvh)
+{
+	const int n_v = (int) bvh->n_v;
+
+	int*const ind_v = malloc((size_t)n_v * sizeof *ind_v); // keep
+	for (int v = 0; v < n_v; ++v)
+		ind_v[v] = v;
+
+	double*const centroids = malloc((size_t)(n_v*DIM) * sizeof *centroids); // free
+	for (int v = 0; v < n_v; ++v) {
+		const double*const box = &bvh->boxes[v*2*DIM];
+		for (int d = 0; d < DIM; ++d)
+			centroids[v*DIM+d] = 0.5*(box[d]+box[DIM+d]);
+	}
+
+	// A binary tree with at least one volume per leaf has fewer than 2*n_v nodes.
+	bvh->nodes = calloc((size_t)(2*n_v),sizeof(struct BVH_Node)); // keep
+	bvh->ind_v = ind_v;
+
+	constructor_node(bvh,centroids,0,n_v);
+	free(centroids);
+}
+
+static double compute_distance_outside
+	(const struct Bounding_Volume_Hierarchy*const bvh, const int ind_v, const double*const xyz, double*const rst_std)
+{
+	const struct Volume*const vol = bvh->volumes[ind_v];
+	const int e_type = vol->element->type;
+
+	const struct const_Matrix_d xyz_ve = interpret_const_Multiarray_as_Matrix_d(vol->xyz_ve);
+	if (!compute_rst_std_inverse_mapping(e_type,&xyz_ve,xyz,rst_std))
+		return DBL_MAX;
+
+	if (bvh->geom_coef[ind_v] && !correct_rst_std_curved(bvh,ind_v,xyz,rst_std))
+		return DBL_MAX;
+
+	return compute_distance_outside_std(e_type,rst_std);
+}
+
+static int find_volume_candidates
+	(const struct Bounding_Volume_Hierarchy*const bvh, const double*const xyz, const double dist2_max,
+	 double*const dist_best, double*const rst_std_best)
+{
+	int ind_best = -1;
+	*dist_best = DBL_MAX;
+
+	int stack[BVH_STACK_MAX];
+	int n_s = 0;
+	stack[n_s++] = 0;
+	while (n_s > 0 && *dist_best > BVH_TOL_INSIDE) {
+		const int ind_n = stack[--n_s];
+		const struct BVH_Node*const node = &bvh->nodes[ind_n];
+		if (compute_distance2_box(node->xyz_min,node->xyz_max,xyz) > dist2_max)
+			continue;
+
+		if (node->n_v == 0) {
+			assert(n_s+2 <= BVH_STACK_MAX);
+			stack[n_s++] = node->ind;
+			stack[n_s++] = ind_n+1;
+			continue;
+		}
+
+		for (int i = 0; i < node->n_v && *dist_best > BVH_TOL_INSIDE; ++i) {
+			const int ind_v = bvh->ind_v[node->ind+i];
+			const double*const box = &bvh->boxes[ind_v*2*DIM];
+			if (compute_distance2_box(&box[0],&box[DIM],xyz) > dist2_max)
+				continue;
+
+			double rst_std[DIM] = { 0.0, };
+			const double dist = compute_distance_outside(bvh,ind_v,xyz,rst_std);
+			if (dist < *dist_best) {
+				ind_best   = ind_v;
+				*dist_best = dist;
+				for (int d = 0; d < DIM; ++d)
+					rst_std_best[d] = rst_std[d];
+			}
+		}
+	}
+	return ind_best;
+}
+
+static double compute_distance2_nearest_box (const struct Bounding_Volume_Hierarchy*const bvh, const double*const xyz)
+{
+	double dist2_best = DBL_MAX;
+
+	int stack[BVH_STACK_MAX];
+	int n_s = 0;
+	stack[n_s++] = 0;
+	while (n_s > 0) {
+		const int ind_n = stack[--n_s];
+		const struct BVH_Node*const node = &bvh->nodes[ind_n];
+		if (compute_distance2_box(node->xyz_min,node->xyz_max,xyz) >= dist2_best)
+			continue;
+
+		if (node->n_v == 0) {
+			assert(n_s+2 <= BVH_STACK_MAX);
+			stack[n_s++] = node->ind;
+			stack[n_s++] = ind_n+1;
+			continue;
+		}
+
+		for (int i = 0; i < node->n_v; ++i) {
+			const int ind_v = bvh->ind_v[node->ind+i];
+			const double*const box = &bvh->boxes[ind_v*2*DIM];
+			dist2_best = GSL_MIN(dist2_best,compute_distance2_box(&box[0],&box[DIM],xyz));
+		}
+	}
+	assert(dist2_best < DBL_MAX);
+	return dist2_best;
+}
+
+static double compute_distance2_box
+	(const double*const xyz_min, const double*const xyz_max, const double*const xyz)
+{
+	double dist2 = 0.0;
+	for (int d = 0; d < DIM; ++d) {
+		const double diff = GSL_MAX(GSL_MAX(xyz_min[d]-xyz[d],xyz[d]-xyz_max[d]),0.0);
+		dist2 += diff*diff;
+	}
+	return dist2;
+}
+
+static void compute_rst_ref_from_map_std
+	(const struct BVH_Map_Std*const map_std, const double*const rst_std, double*const rst)
+{
+	assert(map_std->set);
+	for (int i = 0; i < DIM; ++i) {
+		rst[i] = map_std->rst_0[i];
+		for (int j = 0; j < DIM; ++j)
+			rst[i] += map_std->a_std[i*DIM+j]*rst_std[j];
+	}
+}
+
+// Level 1 ********************************************************************************************************** //
+
+/** \brief Partially sort the input indices such that the entry in position `nth` is the one which would be there if
+ *         the indices in [i_0,i_1) were sorted by the values of the keys along the input axis (quickselect).
+ *
+ *  The keys are passed explicitly (and not through a `qsort` comparator) such that the function is reentrant.
+ */
+static void select_nth
+	(int*const ind,           ///< The array of indices.
+	 const int i_0,           ///< The index of the first entry.
+	 const int i_1,           ///< The index one past the last entry.
+	 const int nth,           ///< The index of the entry to be placed in sorted position.
+	 const double*const keys, ///< The keys (with `DIM` entries for each index).
+	 const int axis           ///< The axis along which the keys are compared.
+	);
+
+/** \brief Solve the small dense linear system of size `DIM` using Gaussian elimination with partial pivoting.
+ *  \return `true` if the system is non-singular; `false` otherwise. */
+static bool solve_dense_small
+	(double*const a, ///< The row-major system matrix (overwritten).
+	 double*const b  ///< The rhs; overwritten with the solution.
+	);
+
+static int constructor_node
+	(struct Bounding_Volume_Hierarchy*const bvh, const double*const centroids, const int i_0, const int i_1)
+{
+	struct BVH_Node*const nodes = (struct BVH_Node*) bvh->nodes;
+	int*const ind_v = (int*) bvh->ind_v;
+
+	const int ind_n = (int) bvh->n_n;
+	*(ptrdiff_t*)&bvh->n_n += 1;
+	assert(bvh->n_n <= 2*bvh->n_v);
+
+	struct BVH_Node*const node = &nodes[ind_n];
+	double c_min[DIM], c_max[DIM];
+	for (int d = 0; d < DIM; ++d) {
+		node->xyz_min[d] = c_min[d] =  DBL_MAX;
+		node->xyz_max[d] = c_max[d] = -DBL_MAX;
+	}
+	for (int i = i_0; i < i_1; ++i) {
+		const double*const box = &bvh->boxes[ind_v[i]*2*DIM],
+		            *const c   = &centroids[ind_v[i]*DIM];
+		for (int d = 0; d < DIM; ++d) {
+			node->xyz_min[d] = GSL_MIN(node->xyz_min[d],box[d]);
+			node->xyz_max[d] = GSL_MAX(node->xyz_max[d],box[DIM+d]);
+			c_min[d] = GSL_MIN(c_min[d],c[d]);
+			c_max[d] = GSL_MAX(c_max[d],c[d]);
+		}
+	}
+
+	if (i_1-i_0 <= BVH_N_LEAF_MAX) {
+		node->ind = i_0;
+		node->n_v = i_1-i_0;
+		return ind_n;
+	}
+
+	int axis = 0;
+	for (int d = 1; d < DIM; ++d) {
+		if (c_max[d]-c_min[d] > c_max[axis]-c_min[axis])
+			axis = d;
+	}
+
+	const int i_m = (i_0+i_1)/2;
+	select_nth(ind_v,i_0,i_1,i_m,centroids,axis);
+
+	node->n_v = 0;
+	const int ind_l = constructor_node(bvh,centroids,i_0,i_m);
+	assert(ind_l == ind_n+1);
+	MAYBE_UNUSED(ind_l);
+	node->ind = constructor_node(bvh,centroids,i_m,i_1);
+
+	return ind_n;
+}
+
+static void set_map_std (struct BVH_Map_Std*const maps_std, const int e_type)
+{
+	assert(e_type <= PYR);
+	struct BVH_Map_Std*const map_std = &maps_std[e_type];
+	if (map_std->set)
+		return;
+
+	compute_rst_ref_from_rst_std_node(e_type,(double[DIM]){0.0},map_std->rst_0);
+	for (int j = 0; j < DIM; ++j) {
+		double e_j[DIM]   = { 0.0, },
+		       rst_j[DIM] = { 0.0, };
+		e_j[j] = 1.0;
+		compute_rst_ref_from_rst_std_node(e_type,e_j,rst_j);
+		for (int i = 0; i < DIM; ++i)
+			map_std->a_std[i*DIM+j] = rst_j[i]-map_std->rst_0[i];
+	}
+	map_std->set = true;
+}
+
+static const struct const_Multiarray_d* constructor_geom_coef_bezier
+	(const struct Volume*const vol, const char type_geom)
+{
+	const struct Solver_Element*const s_e = (struct Solver_Element*) vol->element;
+
+	const struct const_Multiarray_d* geom_coef = NULL;
+	int p = -1;
+	switch (type_geom) {
+	case 'r': {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) vol;
+		p         = s_vol->p_ref;
+		geom_coef = s_vol->geom_coef;
+		break;
+	} case 'c': {
+		const struct Solver_Volume_c*const s_vol = (struct Solver_Volume_c*) vol;
+		p = s_vol->p_ref;
+
+		const struct const_Multiarray_c*const geom_coef_c = s_vol->geom_coef;
+		struct Multiarray_d*const geom_coef_r =
+			constructor_empty_Multiarray_d(geom_coef_c->layout,geom_coef_c->order,geom_coef_c->extents); // destructed
+		const ptrdiff_t size = compute_size(geom_coef_c->order,geom_coef_c->extents);
+		for (ptrdiff_t i = 0; i < size; ++i)
+			geom_coef_r->data[i] = creal(geom_coef_c->data[i]);
+		geom_coef = (struct const_Multiarray_d*) geom_coef_r;
+		break;
+	} default:
+		EXIT_ERROR("Unsupported: %c\n",type_geom);
+		break;
+	}
+
+	const struct Operator*const ccGB0_vgc_vgc = get_Multiarray_Operator(s_e->ccGB0_vgc_vgc,(ptrdiff_t[]){0,0,p,p});
+	const struct const_Multiarray_d*const geom_coef_b =
+		constructor_mm_NN1_Operator_const_Multiarray_d(ccGB0_vgc_vgc,geom_coef,'C','d',2,NULL); // returned
+	if (type_geom == 'c')
+		destructor_const_Multiarray_d(geom_coef);
+
+	return geom_coef_b;
+}
+
+static int compute_p_geom_curved
+	(const struct Volume*const vol, const char type_geom, const struct Simulation*const sim)
+{
+	const int p_ref = ( type_geom == 'c' ? ((struct Solver_Volume_c*)vol)->p_ref
+	                                     : ((struct Solver_Volume*)vol)->p_ref );
+	struct Op_IO op_io = { .ce = 'v', .kind = 'g', .sc = 'c', .p_op = p_ref, .s_type = vol->element->s_type, };
+	return compute_p_basis(&op_io,sim);
+}
+
+static bool correct_rst_std_curved
+	(const struct Bounding_Volume_Hierarchy*const bvh, const int ind_v, const double*const xyz, double*const rst_std)
+{
+	enum { count_max = 20, }; // The maximum number of Newton steps before assuming no convergence.
+
+	const struct Volume*const vol = bvh->volumes[ind_v];
+	const int e_type = vol->element->type,
+	          s_type = vol->element->s_type,
+	          p_g    = bvh->p_g[ind_v];
+
+	const struct const_Multiarray_d*const g_coef = bvh->geom_coef[ind_v];
+	assert(g_coef->layout == 'C');
+	const ptrdiff_t n_g = g_coef->extents[0];
+
+	const struct BVH_Map_Std*const map_std = &bvh->maps_std[e_type];
+	const double*const a_std = map_std->a_std;
+
+	constructor_basis_fptr constructor_basis = get_constructor_basis_bezier_by_super_type(s_type);
+	constructor_grad_basis_fptr constructor_grad_basis = get_constructor_grad_basis_by_super_type(s_type,"bezier");
+
+	for (int count = 0; count < count_max; ++count) {
+		double rst[DIM] = { 0.0, };
+		compute_rst_ref_from_map_std(map_std,rst_std,rst);
+
+		const struct const_Matrix_d rst_M = { .layout = 'C', .ext_0 = 1, .ext_1 = DIM, .owns_data = false,
+		                                      .data = rst, };
+		const struct const_Matrix_d*const cv0 = constructor_basis(p_g,&rst_M);                       // destructed
+		const struct const_Multiarray_Matrix_d*const cv1 = constructor_grad_basis(p_g,&rst_M); // destructed
+
+		double res[DIM]     = { 0.0, },
+		       jac[DIM*DIM] = { 0.0, };
+		for (int i = 0; i < DIM; ++i) {
+			const double*const data_g = &g_coef->data[i*n_g];
+
+			double xyz_i = 0.0;
+			for (int n = 0; n < n_g; ++n)
+				xyz_i += cv0->data[n]*data_g[n];
+			res[i] = xyz[i]-xyz_i;
+
+			for (int k = 0; k < DIM; ++k) {
+				double dxyz_drst = 0.0;
+				for (int n = 0; n < n_g; ++n)
+					dxyz_drst += cv1->data[k]->data[n]*data_g[n];
+				for (int j = 0; j < DIM; ++j)
+					jac[i*DIM+j] += dxyz_drst*a_std[k*DIM+j];
+			}
+		}
+		destructor_const_Matrix_d(cv0);
+		destructor_const_Multiarray_Matrix_d(cv1);
+
+		if (!solve_dense_small(jac,res))
+			return false;
+
+		for (int d = 0; d < DIM; ++d)
+			rst_std[d] += res[d];
+		if (maximum_abs_d(res,DIM) < BVH_TOL_NEWTON)
+			return true;
+	}
+	return false;
+}
+
+// Level 2 ********************************************************************************************************** //
+
+static void select_nth
+	(int*const ind, const int i_0, const int i_1, const int nth, const double*const keys, const int axis)
+{
+	int l = i_0,
+	    r = i_1-1;
+	while (r > l) {
+		const double pivot = keys[ind[(l+r)/2]*DIM+axis];
+
+		int i = l,
+		    j = r;
+		while (i <= j) {
+			while (keys[ind[i]*DIM+axis] < pivot)
+				++i;
+			while (keys[ind[j]*DIM+axis] > pivot)
+				--j;
+			if (i <= j) {
+				const int tmp = ind[i];
+				ind[i++] = ind[j];
+				ind[j--] = tmp;
+			}
+		}
+
+		if (nth <= j)
+			r = j;
+		else if (nth >= i)
+			l = i;
+		else
+			break;
+	}
+}
+
+static bool solve_dense_small (double*const a, double*const b)
+{
+	for (int k = 0; k < DIM; ++k) {
+		int ind_p = k;
+		for (int i = k+1; i < DIM; ++i) {
+			if (fabs(a[i*DIM+k]) > fabs(a[ind_p*DIM+k]))
+				ind_p = i;
+		}
+		if (fabs(a[ind_p*DIM+k]) < EPS)
+			return false;
+
+		if (ind_p != k) {
+			for (int j = 0; j < DIM; ++j) {
+				const double tmp = a[k*DIM+j];
+				a[k*DIM+j]     = a[ind_p*DIM+j];
+				a[ind_p*DIM+j] = tmp;
+			}
+			const double tmp = b[k];
+			b[k]     = b[ind_p];
+			b[ind_p] = tmp;
+		}
+
+		for (int i = k+1; i < DIM; ++i) {
+			const double scale = a[i*DIM+k]/a[k*DIM+k];
+			for (int j = k; j < DIM; ++j)
+				a[i*DIM+j] -= scale*a[k*DIM+j];
+			b[i] -= scale*b[k];
+		}
+	}
+
+	for (int i = DIM-1; i >= 0; --i) {
+		for (int j = i+1; j < DIM; ++j)
+			b[i] -= a[i*DIM+j]*b[j];
+		b[i] /= a[i*DIM+i];
+	}
+	return true;
+}
@@ -0,0 +1,107 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__bounding_volume_hierarchy_h__INCLUDED
+#define DPG__bounding_volume_hierarchy_h__INCLUDED
+/** \file
+ *  \brief Provides the interface to a bounding volume hierarchy (BVH) used to locate the \ref Volume\*s containing
+ *         arbitrary xyz nodes (e.g. for restart, mesh-to-mesh solution transfer or probes).
+ *
+ *  The hierarchy is constructed once for a given list of volumes from the axis-aligned bounding boxes of
+ *  \ref Volume::xyz_ve, extended to include the Bezier coefficients of the high-order geometry of curved volumes (which
+ *  is contained in their convex hull), using a top-down median split along the longest axis. It is only read after
+ *  construction such that all of the query functions are reentrant and may be called from within threaded regions.
+ *
+ *  The volumes whose bounding boxes contain a node are then tested exactly by inverting the geometry mapping (see
+ *  \ref inverse_mapping.h), using the high-order geometry for curved volumes when it is available.
+ */
+
+#include <stddef.h>
+
+struct Intrusive_List;
+struct Simulation;
+struct Volume;
+struct const_Multiarray_d;
+struct const_Vector_i;
+struct const_Matrix_d;
+struct Matrix_d;
+struct BVH_Node;
+struct BVH_Map_Std;
+
+/// \brief Container for the bounding volume hierarchy of a list of \ref Volume\*s.
+struct Bounding_Volume_Hierarchy {
+	const ptrdiff_t n_v; ///< The number of volumes.
+
+	const struct Volume** volumes; ///< The array of volumes (in the order of the input list).
+	const double* boxes;           ///< The bounding boxes of the volumes (xyz_min followed by xyz_max).
+
+	const int* p_g; ///< The order of the geometry of each of the volumes.
+
+	/// The Bezier coefficients of the geometry of each of the volumes (NULL if the p1 geometry is used for the volume).
+	const struct const_Multiarray_d** geom_coef;
+
+	/// The maps from the standard to the reference element coordinates (indexed by \ref Element::type).
+	const struct BVH_Map_Std* maps_std;
+
+	const ptrdiff_t n_n;          ///< The number of nodes in the hierarchy.
+	const struct BVH_Node* nodes; ///< The nodes of the hierarchy (the root being the first entry).
+	const int* ind_v;             ///< The indices of the volumes referenced by the leaf nodes.
+};
+
+/** \brief Constructor for a \ref Bounding_Volume_Hierarchy of the input list of volumes.
+ *  \return Standard.
+ *
+ *  If `type_geom` is 'r'/'c', the volumes must be real/complex \ref Solver_Volume_T\*s of \ref Solver_Element\*s for
+ *  which the geometry has been set (see \ref set_up_solver_geometry_T) and the high-order geometry corresponding to the
+ *  current value of \ref Solver_Volume_T::p_ref is used for curved volumes. Otherwise, the p1 (vertex) geometry is
+ *  used for all volumes.
+ */
+const struct Bounding_Volume_Hierarchy* constructor_Bounding_Volume_Hierarchy
+	(const struct Intrusive_List*const volumes, ///< The list of volumes.
+	 const struct Simulation*const sim,         ///< Standard.
+	 const char type_geom                       /**< The type of geometry to use. Options: 'v'ertex, 'r'eal
+	                                             *   high-order, 'c'omplex high-order. */
+	);
+
+/// \brief Destructor for a \ref Bounding_Volume_Hierarchy.
+void destructor_Bounding_Volume_Hierarchy
+	(const struct Bounding_Volume_Hierarchy*const bvh ///< Standard.
+	);
+
+/** \brief Find the volume containing the input node.
+ *  \return The index of the volume in \ref Bounding_Volume_Hierarchy::volumes.
+ *
+ *  If the node is not contained in any of the volumes (e.g. for nodes on curved boundaries which are not represented
+ *  identically in both meshes), the volume violating the containment condition by the smallest amount among those
+ *  whose bounding boxes are closest to the node is returned.
+ */
+int find_volume_bvh
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const double*const xyz,                           ///< The xyz coordinates of the node.
+	 double*const rst                                  /**< Memory in which to store the reference coordinates of
+	                                                    *   the node in the volume (ignored if `NULL`). */
+	);
+
+/** \brief Constructor for a \ref const_Vector_T\* of the indices of the volumes containing each of the input nodes
+ *         (see \ref find_volume_bvh).
+ *  \return See brief. */
+const struct const_Vector_i* constructor_volume_indices_bvh
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const struct const_Matrix_d*const xyz,            ///< The xyz coordinates of the nodes (row-major).
+	 struct Matrix_d*const rst                         /**< Memory in which to store the reference coordinates of
+	                                                    *   the nodes (row-major; ignored if `NULL`). */
+	);
+
+#endif // DPG__bounding_volume_hierarchy_h__INCLUDED
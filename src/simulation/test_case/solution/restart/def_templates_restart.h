@@ -31,16 +31,15 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_sol_restart constructor_sol_restart
 #define Restart_Info Restart_Info
 #define get_Restart_Info get_Restart_Info
-#define constructor_indices_vol_background constructor_indices_vol_background
 #define constructor_sol_restart_from_background constructor_sol_restart_from_background
 #define constructor_volume_list constructor_volume_list
 #define initialize_volumes_restart initialize_volumes_restart
-#define initialize_ann_background initialize_ann_background
-#define update_ind_vol_b update_ind_vol_b
 #define initialize_volumes_sol_coef initialize_volumes_sol_coef
-#define get_xyz_node_m_ve get_xyz_node_m_ve
 #define read_sol_coef_bezier read_sol_coef_bezier
-#define get_ind_ve get_ind_ve
+#define initialize_volumes_sol_coef_binary initialize_volumes_sol_coef_binary
+#define get_restart_bin_header get_restart_bin_header
+#define check_volume_binary check_volume_binary
+#define read_sol_coef_bezier_binary read_sol_coef_bezier_binary
 ///\}
 
 #elif TYPE_RC == TYPE_COMPLEX
@@ -58,16 +57,15 @@ You should have received a copy of the GNU General Public License along with DPG
 #define constructor_sol_restart constructor_sol_restart_c
 #define Restart_Info Restart_Info_c
 #define get_Restart_Info get_Restart_Info_c
-#define constructor_indices_vol_background constructor_indices_vol_background_c
 #define constructor_sol_restart_from_background constructor_sol_restart_from_background_c
 #define constructor_volume_list constructor_volume_list_c
 #define initialize_volumes_restart initialize_volumes_restart_c
-#define initialize_ann_background initialize_ann_background_c
-#define update_ind_vol_b update_ind_vol_b_c
 #define initialize_volumes_sol_coef initialize_volumes_sol_coef_c
-#define get_xyz_node_m_ve get_xyz_node_m_ve_c
 #define read_sol_coef_bezier read_sol_coef_bezier_c
-#define get_ind_ve get_ind_ve_c
+#define initialize_volumes_sol_coef_binary initialize_volumes_sol_coef_binary_c
+#define get_restart_bin_header get_restart_bin_header_c
+#define check_volume_binary check_volume_binary_c
+#define read_sol_coef_bezier_binary read_sol_coef_bezier_binary_c
 ///\}
 
 #endif
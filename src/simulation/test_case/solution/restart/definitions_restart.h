@@ -0,0 +1,76 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+
+#ifndef DPG__definitions_restart_h__INCLUDED
+#define DPG__definitions_restart_h__INCLUDED
+/** \file
+ *  \brief Provides the definitions relating to the binary restart files.
+ *
+ *  The binary restart file stores the solution coefficients (in the Bezier basis) of all volumes of the restart mesh
+ *  and is referenced from the `$SolutionCoefficientsBinary` section of the gmsh restart file (which still holds the
+ *  mesh). The file layout (in native byte order) is:
+ *  - a \ref Restart_Bin_Header;
+ *  - a \ref Restart_Bin_Volume entry for each volume (in the order of the volumes of the mesh);
+ *  - the vertex coordinates of all volumes ('R'ow-major, `DIM` coordinates per vertex);
+ *  - the solution coefficients ('C'olumn-major) of all volumes, grouped by the rank of the owning process such that
+ *    each process writes a single contiguous block.
+ *
+ *  All offsets are in bytes from the start of the file and are multiples of `sizeof(double)`.
+ */
+
+#include <stdint.h>
+
+///\{ \name Supported restart file types.
+#define RESTART_GMSH   1 ///< The gmsh restart file (holding the mesh and either the coefficients or a binary reference).
+#define RESTART_BINARY 2 ///< The binary solution coefficients.
+///\}
+
+/// Line length of the text restart files which has enough space for p9, 5 variable, HEX solution data.
+#define LINELEN_MAX (10*10*10*5*25)
+
+///\{ \name Identification of the binary restart files.
+#define RESTART_BIN_MAGIC      "DPGRSTRT"  ///< The leading bytes of the file.
+#define RESTART_BIN_VERSION    1           ///< The current version of the file layout.
+#define RESTART_BIN_BYTE_ORDER 0x01020304  ///< Value used to detect files written with a different byte order.
+///\}
+
+///\{ \name Flags for the binary restart files (\ref Restart_Bin_Header::flags).
+#define RESTART_BIN_FLAG_NONE 0 ///< Uncompressed data.
+///\}
+
+/// \brief Container for the header of the binary restart file.
+struct Restart_Bin_Header {
+	char magic[8];       ///< \ref RESTART_BIN_MAGIC (without the terminating null character).
+	int32_t version;     ///< \ref RESTART_BIN_VERSION.
+	int32_t byte_order;  ///< \ref RESTART_BIN_BYTE_ORDER.
+	int32_t flags;       ///< Options: see above.
+	int32_t dim;         ///< The dimension of the mesh.
+	int64_t n_v;         ///< The number of volumes.
+	int64_t offset_xyz;  ///< The offset of the vertex coordinates.
+	int64_t offset_data; ///< The offset of the solution coefficients.
+};
+
+/// \brief Container for the entry of a volume in the binary restart file.
+struct Restart_Bin_Volume {
+	int32_t e_type;      ///< \ref Element::type.
+	int32_t p_ref;       ///< \ref Solver_Volume_T::p_ref.
+	int64_t n_ve;        ///< The number of vertices.
+	int64_t ext_0;       ///< The number of solution coefficients per variable.
+	int64_t ext_1;       ///< The number of variables.
+	int64_t offset_xyz;  ///< The offset of the vertex coordinates of the volume.
+	int64_t offset_data; ///< The offset of the solution coefficients of the volume.
+};
+
+#endif // DPG__definitions_restart_h__INCLUDED
@@ -19,6 +19,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <assert.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include "gsl/gsl_math.h"
 
 #include "macros.h"
 #include "definitions_core.h"
@@ -47,9 +48,11 @@ typedef struct Newton (*get_Newton_fptr)
 
 /** \brief Pointer \ref Newton update term computing functions.
  *  \param newton \ref Newton.
+ *  \param drst   Memory in which to store the update term.
  */
-typedef const double* (*get_Newton_term_fptr)
-	(const struct Newton*const newton
+typedef void (*get_Newton_term_fptr)
+	(const struct Newton*const newton,
+	 double*const drst
 	);
 
 /// \brief Container for data related to Newton's method.
@@ -70,17 +73,16 @@ struct Inv_Map {
 	get_Newton_term_fptr get_Newton_term; ///< Standard.
 };
 
-/** \brief Constructor for a \ref Inv_Map container.
- *  \return See brief. */
-static const struct Inv_Map* constructor_Inv_Map
+/** \brief Get the statically allocated \ref Inv_Map container for the input element type.
+ *  \return See brief.
+ *
+ *  The containers are constant such that no memory is allocated for each node and that the function may be called from
+ *  within threaded regions.
+ */
+static const struct Inv_Map* get_Inv_Map
 	(const int e_type ///< \ref Element::type.
 	);
 
-/// \brief Destructor for a \ref Inv_Map container.
-static void destructor_Inv_Map
-	(const struct Inv_Map*const im ///< Standard.
-	);
-
 /** \brief Version of \ref get_Newton_fptr for LINEs.
  *  \return See brief. */
 static struct Newton get_Newton_line
@@ -105,16 +107,16 @@ static struct Newton get_Newton_quad
 	 const double*const rst                ///< See brief.
 	);
 
-/** \brief Version of \ref get_Newton_term_fptr for 1 dimensional term.
- *  \return See brief. */
-static const double* get_Newton_term_1d
-	(const struct Newton*const newton ///< See brief.
+/// \brief Version of \ref get_Newton_term_fptr for 1 dimensional term.
+static void get_Newton_term_1d
+	(const struct Newton*const newton, ///< See brief.
+	 double*const drst                 ///< See brief.
 	);
 
-/** \brief Version of \ref get_Newton_term_fptr for 2 dimensional term.
- *  \return See brief. */
-static const double* get_Newton_term_2d
-	(const struct Newton*const newton ///< See brief.
+/// \brief Version of \ref get_Newton_term_fptr for 2 dimensional term.
+static void get_Newton_term_2d
+	(const struct Newton*const newton, ///< See brief.
+	 double*const drst                 ///< See brief.
 	);
 
 /** \brief Constructor for reference rst coordinates from standard reference element reference coordinates.
@@ -134,53 +136,27 @@ static const struct const_Matrix_d* constructor_rst_ref_from_rst_std
 struct Matrix_d* constructor_inverse_mapping_mutable
 	(const int e_type, const struct const_Matrix_d*const xyz_ve, const struct const_Matrix_d*const xyz)
 {
-	/** Newton's method is used here to converge to the rst coordinates which satisfy: xyz = xyz_ve*phi(rst).
-	 *
-	 *  In the case of affine elements (simplices), the algorithm converges in a single iteration as the function
-	 *  above is linear in rst. In other cases, the convergence is quadratic and it is not necessary to treat
-	 *  special cases (such as for parallelogram vertices).
-	 *
-	 *  Please consult [this][SO_inv_map] stack overflow answer for additional details.
-	 *
-	 *  <!-- References: -->
-	 *  [SO_inv_map]: https://stackoverflow.com/a/18332009/5983549
-	 */
-	enum { count_max = 10, }; // The maximum number of Newton steps before assuming no convergence.
-
 	assert(xyz_ve->layout == 'R');
 	assert(xyz->layout == 'R');
 
 	const ptrdiff_t n_n = xyz->ext_0,
 	                dim = xyz->ext_1;
 
-	const struct Inv_Map*const im = constructor_Inv_Map(e_type); // destructed
+	const struct Inv_Map*const im = get_Inv_Map(e_type);
 	assert(dim == im->dim);
 
 	struct Matrix_d*const rst = constructor_empty_Matrix_d('R',n_n,dim); // destructed
-	set_to_value_Matrix_d(rst,im->guess);
-
 	for (int n = 0; n < n_n; ++n) {
-		const double*const data_xyz = get_row_const_Matrix_d(n,xyz);
-		double*const data_rst       = get_row_Matrix_d(n,rst);
-
-		int count = 0;
-		for ( ; count < count_max; ++count) {
-			struct Newton newton = im->get_Newton(xyz_ve,data_xyz,data_rst);
-			if (maximum_abs_d(newton.res,dim) < EPS)
-				break;
-
-			const double*const drst = im->get_Newton_term(&newton);
-			for (int d = 0; d < dim; ++d)
-				data_rst[d] -= drst[d];
-		}
-		assert(count < count_max); // Not yet converged.
+		const bool converged =
+			compute_rst_std_inverse_mapping(e_type,xyz_ve,get_row_const_Matrix_d(n,xyz),get_row_Matrix_d(n,rst));
+		assert(converged); // Not yet converged.
+		MAYBE_UNUSED(converged);
 	}
 
 	transpose_Matrix_d(rst,true);
 	struct Matrix_d*const rst_ref =
 		(struct Matrix_d*) constructor_rst_ref_from_rst_std(im,(struct const_Matrix_d*)rst); // returned
 	destructor_Matrix_d(rst);
-	destructor_Inv_Map(im);
 
 	return rst_ref;
 }
@@ -191,6 +167,81 @@ const struct const_Matrix_d* constructor_inverse_mapping
 	return (struct const_Matrix_d*) constructor_inverse_mapping_mutable(e_type,xyz_ve,xyz);
 }
 
+bool compute_rst_std_inverse_mapping
+	(const int e_type, const struct const_Matrix_d*const xyz_ve, const double*const xyz, double*const rst_std)
+{
+	/** Newton's method is used here to converge to the rst coordinates which satisfy: xyz = xyz_ve*phi(rst).
+	 *
+	 *  In the case of affine elements (simplices), the algorithm converges in a single iteration as the function
+	 *  above is linear in rst. In other cases, the convergence is quadratic and it is not necessary to treat
+	 *  special cases (such as for parallelogram vertices).
+	 *
+	 *  Please consult [this][SO_inv_map] stack overflow answer for additional details.
+	 *
+	 *  <!-- References: -->
+	 *  [SO_inv_map]: https://stackoverflow.com/a/18332009/5983549
+	 */
+	enum { count_max = 10, }; // The maximum number of Newton steps before assuming no convergence.
+
+	assert(xyz_ve->layout == 'R');
+
+	const struct Inv_Map*const im = get_Inv_Map(e_type);
+	const int dim = im->dim;
+
+	for (int d = 0; d < dim; ++d)
+		rst_std[d] = im->guess;
+
+	bool converged = false;
+	for (int count = 0; count < count_max; ++count) {
+		struct Newton newton = im->get_Newton(xyz_ve,xyz,rst_std);
+		if (maximum_abs_d(newton.res,dim) < EPS) {
+			converged = true;
+			break;
+		}
+
+		double drst[DIM] = { 0.0, };
+		im->get_Newton_term(&newton,drst);
+		for (int d = 0; d < dim; ++d)
+			rst_std[d] -= drst[d];
+	}
+
+	return converged;
+}
+
+void compute_rst_ref_from_rst_std_node (const int e_type, const double*const rst_std, double*const rst_ref)
+{
+	const struct Inv_Map*const im = get_Inv_Map(e_type);
+	const int dim = im->dim;
+
+	const struct const_Matrix_d rst_std_M = { .layout = 'C', .ext_0 = 1, .ext_1 = dim, .owns_data = false,
+	                                          .data = rst_std, };
+	const struct const_Matrix_d*const rst_ref_M = constructor_rst_ref_from_rst_std(im,&rst_std_M); // destructed
+	for (int d = 0; d < dim; ++d)
+		rst_ref[d] = rst_ref_M->data[d];
+	destructor_const_Matrix_d(rst_ref_M);
+}
+
+double compute_distance_outside_std (const int e_type, const double*const rst_std)
+{
+	double dist = 0.0;
+	switch (e_type) {
+	case LINE:
+		dist = GSL_MAX(-rst_std[0],rst_std[0]-1.0);
+		break;
+	case TRI:
+		dist = GSL_MAX(GSL_MAX(-rst_std[0],-rst_std[1]),rst_std[0]+rst_std[1]-1.0);
+		break;
+	case QUAD:
+		for (int d = 0; d < 2; ++d)
+			dist = GSL_MAX(dist,GSL_MAX(-rst_std[d],rst_std[d]-1.0));
+		break;
+	default:
+		EXIT_ERROR("Unsupported: %d\n",e_type);
+		break;
+	}
+	return GSL_MAX(dist,0.0);
+}
+
 const struct const_Matrix_d* constructor_basis_std_p1 (const int e_type, const struct const_Matrix_d*const rst_std)
 {
 	const ptrdiff_t n_n = rst_std->ext_0,
@@ -250,43 +301,27 @@ EXIT_ADD_SUPPORT; UNUSED(t);
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
-static const struct Inv_Map* constructor_Inv_Map (const int e_type)
+static const struct Inv_Map* get_Inv_Map (const int e_type)
 {
-	struct Inv_Map*const im = calloc(1,sizeof *im); // free
+	static const struct Inv_Map im_line =
+		{ .dim = 1, .type = LINE, .s_type = ST_TP, .guess = 1.0/2.0,
+		  .get_Newton = get_Newton_line, .get_Newton_term = get_Newton_term_1d, };
+	static const struct Inv_Map im_tri =
+		{ .dim = 2, .type = TRI,  .s_type = ST_SI, .guess = 1.0/3.0,
+		  .get_Newton = get_Newton_tri,  .get_Newton_term = get_Newton_term_2d, };
+	static const struct Inv_Map im_quad =
+		{ .dim = 2, .type = QUAD, .s_type = ST_TP, .guess = 1.0/2.0,
+		  .get_Newton = get_Newton_quad, .get_Newton_term = get_Newton_term_2d, };
 
-	im->type = e_type;
 	switch (e_type) {
-	case LINE:
-		im->dim    = 1;
-		im->s_type = ST_TP;
-		im->guess  = 1.0/2.0;
-		im->get_Newton      = get_Newton_line;
-		im->get_Newton_term = get_Newton_term_1d;
-		break;
-	case TRI:
-		im->dim    = 2;
-		im->s_type = ST_SI;
-		im->guess  = 1.0/3.0;
-		im->get_Newton      = get_Newton_tri;
-		im->get_Newton_term = get_Newton_term_2d;
-		break;
-	case QUAD:
-		im->dim    = 2;
-		im->s_type = ST_TP;
-		im->guess  = 1.0/2.0;
-		im->get_Newton      = get_Newton_quad;
-		im->get_Newton_term = get_Newton_term_2d;
-		break;
+	case LINE: return &im_line; break;
+	case TRI:  return &im_tri;  break;
+	case QUAD: return &im_quad; break;
 	default:
 		EXIT_ERROR("Unsupported: %d\n",e_type);
 		break;
 	}
-	return im;
-}
-
-static void destructor_Inv_Map (const struct Inv_Map*const im)
-{
-	free((void*)im);
+	return NULL;
 }
 
 static struct Newton get_Newton_line
@@ -302,7 +337,7 @@ static struct Newton get_Newton_line
 	            *const p1 = p0+dim;
 	const double r = rst[0];
 
-	static struct Newton newton;
+	struct Newton newton;
 	double*const res = newton.res,
 	      *const jac = newton.jac;
 
@@ -333,7 +368,7 @@ static struct Newton get_Newton_tri
 	const double r = rst[0],
 	             s = rst[1];
 
-	static struct Newton newton;
+	struct Newton newton;
 	double*const res = newton.res,
 	      *const jac = newton.jac;
 
@@ -367,7 +402,7 @@ static struct Newton get_Newton_quad
 	const double r = rst[0],
 	             s = rst[1];
 
-	static struct Newton newton;
+	struct Newton newton;
 	double*const res = newton.res,
 	      *const jac = newton.jac;
 
@@ -385,7 +420,7 @@ static struct Newton get_Newton_quad
 	return newton;
 }
 
-static const double* get_Newton_term_1d (const struct Newton*const newton)
+static void get_Newton_term_1d (const struct Newton*const newton, double*const drst)
 {
 	enum { dim = 1, };
 	const double*const res = newton->res,
@@ -394,17 +429,15 @@ static const double* get_Newton_term_1d (const struct Newton*const newton)
 	const double inv_det_jac = 1.0/(jac[0]);
 	const double inv_jac[] = {  1.0, };
 
-	static double drst[dim] = { 0.0, };
 	for (int i = 0; i < dim; ++i) {
 		drst[i] = 0.0;
 		for (int j = 0; j < dim; ++j)
 			drst[i] += inv_jac[i*dim+j]*res[j];
 		drst[i] *= inv_det_jac;
 	}
-	return drst;
 }
 
-static const double* get_Newton_term_2d (const struct Newton*const newton)
+static void get_Newton_term_2d (const struct Newton*const newton, double*const drst)
 {
 	enum { dim = 2, };
 	const double*const res = newton->res,
@@ -413,14 +446,12 @@ static const double* get_Newton_term_2d (const struct Newton*const newton)
 	const double inv_det_jac = 1.0/(jac[0]*jac[3]-jac[1]*jac[2]);
 	const double inv_jac[] = {  jac[3], -jac[1], -jac[2], jac[0], };
 
-	static double drst[dim] = { 0.0, };
 	for (int i = 0; i < dim; ++i) {
 		drst[i] = 0.0;
 		for (int j = 0; j < dim; ++j)
 			drst[i] += inv_jac[i*dim+j]*res[j];
 		drst[i] *= inv_det_jac;
 	}
-	return drst;
 }
 
 static const struct const_Matrix_d* constructor_rst_ref_from_rst_std
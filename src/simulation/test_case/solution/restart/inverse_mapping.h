@@ -20,6 +20,8 @@ You should have received a copy of the GNU General Public License along with DPG
  *         coordinates, compute the associated reference coordinates).
  */
 
+#include <stdbool.h>
+
 struct Matrix_d;
 struct const_Matrix_d;
 
@@ -40,6 +42,34 @@ const struct const_Matrix_d* constructor_inverse_mapping
 	 const struct const_Matrix_d*const xyz     ///< See brief.
 	);
 
+/** \brief Compute the standard reference element coordinates corresponding to the input physical coordinates of a
+ *         single node.
+ *  \return `true` if the Newton iterations converged; `false` otherwise.
+ *
+ *  Unlike \ref constructor_inverse_mapping_mutable, this function does not assume that the node is located within the
+ *  element and may be called from within threaded regions.
+ */
+bool compute_rst_std_inverse_mapping
+	(const int e_type,                         ///< \ref Element::type.
+	 const struct const_Matrix_d*const xyz_ve, ///< The vertex xyz coordinates.
+	 const double*const xyz,                   ///< The xyz coordinates of the node.
+	 double*const rst_std                      ///< Memory in which to store the standard reference coordinates.
+	);
+
+/// \brief Compute the reference element coordinates of a single node from its standard reference element coordinates.
+void compute_rst_ref_from_rst_std_node
+	(const int e_type,           ///< \ref Element::type.
+	 const double*const rst_std, ///< The standard reference element coordinates.
+	 double*const rst_ref        ///< Memory in which to store the reference element coordinates.
+	);
+
+/** \brief Compute the maximum distance by which the input node lies outside of the standard reference element.
+ *  \return See brief (0.0 if the node is inside the element). */
+double compute_distance_outside_std
+	(const int e_type,          ///< \ref Element::type.
+	 const double*const rst_std ///< The standard reference element coordinates.
+	);
+
 /** \brief Constructor for the matrix of basis functions corresponding to the p1 standard reference element vertices
  *         evaluated at the input reference coordinates.
  *  \return See brief. */
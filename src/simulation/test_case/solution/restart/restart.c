@@ -18,15 +18,16 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include <string.h>
 
+#include "definitions_restart.h"
+
 #include "matrix.h"
 #include "multiarray.h"
 #include "vector.h"
 
-#include "face_solver.h"
 #include "volume_solver.h"
 
-#include "approximate_nearest_neighbor.h"
 #include "bases.h"
+#include "bounding_volume_hierarchy.h"
 #include "computational_elements.h"
 #include "const_cast.h"
 #include "element.h"
@@ -34,6 +35,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "geometry.h"
 #include "intrusive.h"
 #include "inverse_mapping.h"
+#include "mapped_file.h"
 #include "math_functions.h"
 #include "simulation.h"
 #include "solution.h"
@@ -23,7 +23,6 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "macros.h"
 #include "definitions_intrusive.h"
-#include "definitions_h_ref.h"
 #include "definitions_tol.h"
 
 #include "def_templates_restart.h"
@@ -31,7 +30,6 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "def_templates_matrix.h"
 #include "def_templates_multiarray.h"
 
-#include "def_templates_face_solver.h"
 #include "def_templates_volume_solver.h"
 
 #include "def_templates_computational_elements.h"
@@ -97,17 +95,15 @@ const struct const_Multiarray_T* constructor_const_sol_restart_T
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
 
-/** \brief Container for information relating to the solution from which to restart.
- *
- *  The background portion of \ref Restart_Info::sss stores the centroids of the volumes from the restart mesh.
- */
+/// \brief Container for information relating to the solution from which to restart.
 struct Restart_Info {
 	struct Simulation* sim; ///< A minimalist \ref Simulation set up from the restart file.
 
 	const ptrdiff_t n_v;                    ///< The 'n'umber of 'v'olumes.
 	struct Solver_Volume_T** solver_volume; ///< The array of solver volumes.
 
-	struct SSS_ANN* sss; ///< \ref SSS_ANN.
+	/// The \ref Bounding_Volume_Hierarchy of the volumes of the restart mesh.
+	const struct Bounding_Volume_Hierarchy* bvh;
 };
 
 /** \brief Get the pointer to a \ref Restart_Info with members set from the restart file.
@@ -120,20 +116,12 @@ static struct Restart_Info get_Restart_Info
 	(const struct Simulation*const sim ///< Standard.
 	);
 
-/** \brief Constructor for a \ref Vector_T of indices of the background volumes which contain the input nodes.
- *  \return See brief. */
-static const struct const_Vector_i* constructor_indices_vol_background
-	(const struct Restart_Info*const ri,       ///< Standard.
-	 const struct Nodes_Sorted_ANN*const ns,   ///< Standard.
-	 const struct const_Vector_i*const ind_ann ///< Background volume Indices of the approximate nearest neighbors.
-	);
-
 /** \brief Constructor for the \ref Multiarray_T\* of solution data from the stored solution of the background mesh.
  *  \return See brief. */
 static struct Multiarray_T* constructor_sol_restart_from_background
 	(const struct Restart_Info*const ri,          ///< Standard.
-	 const struct Nodes_Sorted_ANN*const ns,      ///< Standard.
 	 const struct const_Vector_i*const ind_vol_b, ///< Indices of the background volumes containing the nodes.
+	 const struct const_Matrix_d*const rst,       ///< Reference coordinates of the nodes in the background volumes.
 	 const struct Simulation*const sim            ///< Standard.
 	);
 
@@ -143,20 +131,18 @@ static struct Multiarray_T* constructor_sol_restart
 	struct Restart_Info ri = get_Restart_Info(sim);
 
 	const struct const_Matrix_T xyz_M = interpret_const_Multiarray_as_Matrix_T(xyz);
-	const struct const_Matrix_R*const xyz_M_R = constructor_copy_const_Matrix_R_Matrix_T(&xyz_M); // destructed
-	const struct Nodes_Sorted_ANN*const ns = constructor_Nodes_Sorted_ANN_with_trans((struct Matrix_R*)xyz_M_R); // d
-	destructor_const_Matrix_R(xyz_M_R);
-
-	struct Input_ANN ann_i = { .nodes_s = ns->nodes, };
-	constructor_SSS_ANN_s(&ann_i,ri.sss); // destructed
-
-	const struct const_Vector_i*const ind_ann   = constructor_ann_indices_from_sss(ri.sss);           // destructed
-	const struct const_Vector_i*const ind_vol_b = constructor_indices_vol_background(&ri,ns,ind_ann); // destructed
-	destructor_const_Vector_i(ind_ann);
-
-	struct Multiarray_T*const sol = constructor_sol_restart_from_background(&ri,ns,ind_vol_b,sim); // returned
-	destructor_Nodes_Sorted_ANN(ns);
-	destructor_SSS_ANN_s(ri.sss);
+	struct Matrix_R*const xyz_R = (struct Matrix_R*) constructor_copy_const_Matrix_R_Matrix_T(&xyz_M); // destructed
+	if (xyz_R->layout != 'R')
+		transpose_Matrix_R(xyz_R,true);
+
+	struct Matrix_R*const rst = constructor_empty_Matrix_R('R',xyz_R->ext_0,DIM); // destructed
+	const struct const_Vector_i*const ind_vol_b =
+		constructor_volume_indices_bvh(ri.bvh,(struct const_Matrix_R*)xyz_R,rst); // destructed
+	destructor_Matrix_R(xyz_R);
+
+	struct Multiarray_T*const sol =
+		constructor_sol_restart_from_background(&ri,ind_vol_b,(struct const_Matrix_R*)rst,sim); // returned
+	destructor_Matrix_R(rst);
 	destructor_const_Vector_i(ind_vol_b);
 
 	return sol;
@@ -174,19 +160,6 @@ static void initialize_volumes_restart
 	(const struct Simulation*const sim ///< Standard.
 	);
 
-/// \brief Initialize the background node portion of \ref Restart_Info::sss.
-static void initialize_ann_background
-	(struct Restart_Info*const ri ///< Standard.
-	);
-
-/** \brief If required, update the index of the background volume to that of the neighbouring volume which is closest
- *         to the search node. */
-static void update_ind_vol_b
-	(int*const ind_vol_b,                ///< Pointer to memory location holding the index of the background volume.
-	 const struct Restart_Info*const ri, ///< Standard.
-	 const Real*const data_node          ///< Pointer to the xyz coordinate data of the search node.
-	);
-
 static struct Restart_Info get_Restart_Info (const struct Simulation*const sim)
 {
 	static bool needs_computation = true;
@@ -204,8 +177,11 @@ static struct Restart_Info get_Restart_Info (const struct Simulation*const sim)
 
 		set_up_solver_geometry_T(ri.sim);
 		set_up_solver_geometry_p1_T(ri.sim);
+
+		// The hierarchy must be constructed before the reference orders are updated from the restart file.
+		const char type_geom = ( TYPE_RC == TYPE_REAL ? 'r' : 'c' );
+		ri.bvh = constructor_Bounding_Volume_Hierarchy(ri.sim->volumes,ri.sim,type_geom); // leaked (static)
 		initialize_volumes_restart(ri.sim);
-		initialize_ann_background(&ri);
 		constructor_volume_list(&ri);
 
 		destructor_derived_Elements(ri.sim,IL_ELEMENT);
@@ -215,63 +191,37 @@ static struct Restart_Info get_Restart_Info (const struct Simulation*const sim)
 	return ri;
 }
 
-static const struct const_Vector_i* constructor_indices_vol_background
-	(const struct Restart_Info*const ri, const struct Nodes_Sorted_ANN*const ns,
-	 const struct const_Vector_i*const ind_ann)
-{
-	const struct const_Matrix_R*const nodes = ns->nodes;
-	assert(nodes->layout == 'R');
-
-	const ptrdiff_t n_n = ns->nodes->ext_0;
-
-	struct Vector_i*const ind_vol_b = (struct Vector_i*) constructor_copy_const_Vector_i(ind_ann); // returned
-	for (int n = 0; n < n_n; ++n) {
-		const Real*const data_node = get_row_const_Matrix_R(n,nodes);
-		update_ind_vol_b(&(ind_vol_b->data[n]),ri,data_node);
-	}
-	return (struct const_Vector_i*) ind_vol_b;
-}
-
 static struct Multiarray_T* constructor_sol_restart_from_background
-	(const struct Restart_Info*const ri, const struct Nodes_Sorted_ANN*const ns,
-	 const struct const_Vector_i*const ind_vol_b, const struct Simulation*const sim)
+	(const struct Restart_Info*const ri, const struct const_Vector_i*const ind_vol_b,
+	 const struct const_Matrix_d*const rst, const struct Simulation*const sim)
 {
-	const struct const_Matrix_R*const nodes = ns->nodes;
-	assert(nodes->layout == 'R');
+	assert(rst->layout == 'R');
 
-	const ptrdiff_t n_n = nodes->ext_0;
-	assert(DIM == nodes->ext_1);
+	const ptrdiff_t n_n = rst->ext_0;
+	assert(DIM == rst->ext_1);
 
 	struct Test_Case_T*const test_case = (struct Test_Case_T*)sim->test_case_rc->tc;
 	const int n_var = test_case->n_var;
 
 	struct Multiarray_T* sol = constructor_empty_Multiarray_T('R',2,(ptrdiff_t[]){n_n,n_var}); // returned
-	struct Matrix_T sol_row = { .layout = 'R', .ext_0 = 1, .ext_1 = n_var, .data = NULL, };
-
-	// Note: Changes are required below if ext_0 != 1 as it is assumed that the matrix is interchangeably
-	//       interpreted as being either row or column major oriented.
-	struct Matrix_R xyz_m = { .layout = 'R', .ext_0 = 1, .ext_1 = DIM, .owns_data = false, .data = NULL, };
-	const struct const_Matrix_R*const xyz = (struct const_Matrix_R*) &xyz_m;
 
+	PRAGMA_OMP(parallel for schedule(dynamic,CHUNK_OMP))
 	for (int n = 0; n < n_n; ++n) {
 		const struct Solver_Volume_T* s_vol_b = ri->solver_volume[ind_vol_b->data[n]];
 		const struct Volume*const vol_b = (struct Volume*) s_vol_b;
 
-		const int e_type = vol_b->element->type;
-		const struct const_Matrix_R xyz_ve_M = interpret_const_Multiarray_as_Matrix_R(vol_b->xyz_ve);
-		xyz_m.data = (Real*) get_row_const_Matrix_R(n,nodes);
-
-		struct Matrix_R*const rst = constructor_inverse_mapping_mutable(e_type,&xyz_ve_M,xyz); // destructed
-		rst->layout = 'C';
+		// Note: Changes are required below if ext_0 != 1 as it is assumed that the matrix is interchangeably
+		//       interpreted as being either row or column major oriented.
+		const struct const_Matrix_R rst_n = { .layout = 'C', .ext_0 = 1, .ext_1 = DIM, .owns_data = false,
+		                                      .data = get_row_const_Matrix_R(n,rst), };
 
 		const int s_type = vol_b->element->s_type;
 		constructor_basis_fptr constructor_basis = get_constructor_basis_bezier_by_super_type(s_type);
 
 		const int p_b = s_vol_b->p_ref;
-		const struct const_Matrix_d*const cv_rst = constructor_basis(p_b,(struct const_Matrix_R*)rst); // dest.
-		destructor_Matrix_R(rst);
+		const struct const_Matrix_d*const cv_rst = constructor_basis(p_b,&rst_n); // destructed
 
-		sol_row.data = get_row_Multiarray_T(ns->indices->data[n],sol);
+		struct Matrix_T sol_row = { .layout = 'R', .ext_0 = 1, .ext_1 = n_var, .data = get_row_Multiarray_T(n,sol), };
 		struct Matrix_T sol_coef_b = interpret_Multiarray_as_Matrix_T(s_vol_b->sol_coef);
 
 		mm_RTT('N','N',1.0,0.0,cv_rst,(struct const_Matrix_T*)&sol_coef_b,&sol_row);
@@ -291,14 +241,14 @@ static void initialize_volumes_sol_coef
 	 const struct Simulation*const sim ///< Standard.
 	);
 
-/** \brief Return a pointer to a statically allocated array holding the vector of the difference between the input node
- *         coordinate data and the xyz vertex data for a vertex lying on the face under consideration.
- *  \return See brief. */
-static const Real* get_xyz_node_m_ve
-	(const int e_type,                            ///< \ref Element::type.
-	 const int ind_lf,                            ///< Index of the face under consideration.
-	 const Real*const xyz_node,                   ///< xyz coordinate data for the search node.
-	 const struct const_Multiarray_R*const xyz_ve ///< \ref Volume::xyz_ve.
+/** \brief Version of \ref initialize_volumes_sol_coef reading from the binary restart file referenced in the input
+ *         restart file (see \ref definitions_restart.h).
+ *
+ *  The binary file is memory mapped such that the coefficients of each volume are obtained using a single bulk copy.
+ */
+static void initialize_volumes_sol_coef_binary
+	(FILE* file,                       ///< Pointer to the restart file.
+	 const struct Simulation*const sim ///< Standard.
 	);
 
 static void constructor_volume_list (struct Restart_Info*const ri)
@@ -320,83 +270,42 @@ static void initialize_volumes_restart (const struct Simulation*const sim)
 
 	char line[STRLEN_MAX];
 	while (fgets(line,sizeof(line),file)) {
-		if (strstr(line,"$SolutionCoefficients"))
+		if (strstr(line,"$SolutionCoefficientsBinary"))
+			initialize_volumes_sol_coef_binary(file,sim);
+		else if (strstr(line,"$SolutionCoefficients"))
 			initialize_volumes_sol_coef(file,sim);
 	}
 	fclose(file);
 }
 
-static void initialize_ann_background (struct Restart_Info*const ri)
-{
-	const struct const_Matrix_d*const xyz_min_max = constructor_volume_xyz_min_max(ri->sim); // destructed
-	const struct const_Matrix_d*const centroids   = constructor_volume_centroids(ri->sim);   // destructed
-
-	ri->sss = calloc(1,sizeof *ri->sss); // keep
-
-	struct Input_ANN ann_i = { .nodes_s = NULL, };
-
-	ann_i.nodes_b = xyz_min_max;
-	constructor_SSS_ANN_xyz(&ann_i,ri->sss); // keep
-	destructor_const_Matrix_d(xyz_min_max);
-
-	ann_i.nodes_b = centroids;
-	constructor_SSS_ANN_b(&ann_i,ri->sss); // keep
-	destructor_const_Matrix_d(centroids);
-}
-
-static void update_ind_vol_b
-	(int*const ind_vol_b, const struct Restart_Info*const ri, const Real*const data_node)
-{
-	bool found = false;
-	while (!found) {
-		const struct Solver_Volume_T* s_vol_b = ri->solver_volume[*ind_vol_b];
-		const struct Volume*const vol_b = (struct Volume*) s_vol_b;
-
-		const int e_type = vol_b->element->type;
-		const struct const_Multiarray_R*const xyz_ve = vol_b->xyz_ve;
-
-		found = true;
-		Real max_n_dot_diff = 0.0;
-		for (int i = 0; i < NFMAX;    ++i) {
-		for (int j = 0; j < NSUBFMAX; ++j) {
-			const struct Face*const face_b = vol_b->faces[i][j];
-			if (face_b == NULL || face_b->boundary)
-				continue;
-			const struct Solver_Face_T*const s_face_b = (struct Solver_Face_T*) face_b;
-
-			const int si = compute_side_index_face(face_b,vol_b);
-			const double scale_n = ( si == 0 ? 1.0 : -1.0 );
-
-			const Type*const data_n_p1      = s_face_b->normals_p1->data;
-			const Real*const data_node_m_ve = get_xyz_node_m_ve(e_type,i,data_node,xyz_ve);
-			const Real n_dot_diff = scale_n*dot_R_from_RT(DIM,data_node_m_ve,data_n_p1);
-
-			if (n_dot_diff > max_n_dot_diff) {
-				*ind_vol_b = get_volume_neighbour(vol_b,face_b)->index;
-				max_n_dot_diff = n_dot_diff;
-				if (abs_R(max_n_dot_diff) > EPS)
-					found = false;
-			}
-		}}
-	}
-}
-
-
 // Level 3 ********************************************************************************************************** //
 
-#define LINELEN_MAX (10*10*10*5*25) ///< Line length which has enough space for p9, 5 variable, HEX solution data.
-
 /// \brief Read the \ref Solver_Volume_T::sol_coef from the current line (assumed to be stored in the bezier basis).
 static void read_sol_coef_bezier
 	(struct Solver_Volume_T*const s_vol, ///< The current volume.
 	 char* line                          ///< The current line of the file.
 	);
 
-/** \brief Return the index of a vertex on the element face under consideration.
+/** \brief Return a pointer to the validated header of the binary restart file.
  *  \return See brief. */
-static int get_ind_ve
-	(const int e_type, ///< \ref Element::type.
-	 const int ind_lf  ///< The index of the face.
+static const struct Restart_Bin_Header* get_restart_bin_header
+	(const struct Mapped_File*const m_file, ///< The mapped binary restart file.
+	 const struct Simulation*const sim      ///< Standard.
+	);
+
+/** \brief Check that the geometry and element type stored for the volume in the binary restart file match those of
+ *         the volume of the restart mesh (i.e. that the volumes are ordered consistently). */
+static void check_volume_binary
+	(const struct Volume*const vol,                ///< The volume of the restart mesh.
+	 const struct Restart_Bin_Volume*const vol_b,  ///< The entry of the volume in the binary restart file.
+	 const struct Mapped_File*const m_file         ///< The mapped binary restart file.
+	);
+
+/// \brief Version of \ref read_sol_coef_bezier reading from the binary restart file.
+static void read_sol_coef_bezier_binary
+	(struct Solver_Volume_T*const s_vol,          ///< The current volume.
+	 const struct Restart_Bin_Volume*const vol_b, ///< The entry of the volume in the binary restart file.
+	 const struct Mapped_File*const m_file        ///< The mapped binary restart file.
 	);
 
 static void initialize_volumes_sol_coef (FILE* file, const struct Simulation*const sim)
@@ -423,17 +332,34 @@ static void initialize_volumes_sol_coef (FILE* file, const struct Simulation*con
 	}
 }
 
-static const Real* get_xyz_node_m_ve
-	(const int e_type, const int ind_lf, const Real*const xyz_node, const struct const_Multiarray_R*const xyz_ve)
+static void initialize_volumes_sol_coef_binary (FILE* file, const struct Simulation*const sim)
 {
-	static Real node_m_ve[DIM] = { 0.0, };
+	char line[STRLEN_MAX];
+	fgets_checked(line,sizeof(line),file);
+
+	char name_b[STRLEN_MAX] = { 0, };
+	sscanf(line,"%s",name_b);
+
+	// The binary file is in the directory of the restart file.
+	const char*const name_r = get_restart_name();
+	const char*const sep = strrchr(name_r,'/');
 
-	const int ind_ve = get_ind_ve(e_type,ind_lf);
+	char name[2*STRLEN_MAX];
+	sprintf(name,"%.*s%s",(int)( sep ? sep-name_r+1 : 0 ),name_r,name_b);
 
-	const Real*const ve_data = get_row_const_Multiarray_R(ind_ve,xyz_ve);
-	for (int d = 0; d < DIM; ++d)
-		node_m_ve[d] = xyz_node[d]-ve_data[d];
-	return node_m_ve;
+	const struct Mapped_File*const m_file = constructor_Mapped_File(name); // destructed
+	if (!m_file)
+		EXIT_ERROR("Could not open the binary restart file: %s\n",name);
+
+	const struct Restart_Bin_Header*const header = get_restart_bin_header(m_file,sim);
+	const struct Restart_Bin_Volume*const vols_b = (const struct Restart_Bin_Volume*) &header[1];
+
+	ptrdiff_t v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+		check_volume_binary((struct Volume*)curr,&vols_b[v],m_file);
+		read_sol_coef_bezier_binary((struct Solver_Volume_T*)curr,&vols_b[v],m_file);
+	}
+	destructor_Mapped_File(m_file);
 }
 
 // Level 4 ********************************************************************************************************** //
@@ -463,45 +389,80 @@ static void read_sol_coef_bezier (struct Solver_Volume_T*const s_vol, char* line
 #endif
 }
 
-static int get_ind_ve (const int e_type, const int ind_lf)
+static const struct Restart_Bin_Header* get_restart_bin_header
+	(const struct Mapped_File*const m_file, const struct Simulation*const sim)
 {
-	switch (e_type) {
-	case LINE:
-		switch (ind_lf) {
-			case H_LINE1_F0: return 0; break;
-			case H_LINE1_F1: return 1; break;
-			default: EXIT_ERROR("Unsupported: %d\n",ind_lf); break;
-		}
-		break;
-	case TRI:
-		switch (ind_lf) {
-			case H_TRI1_F0: return 1; break;
-			case H_TRI1_F1: return 0; break;
-			case H_TRI1_F2: return 0; break;
-			default: EXIT_ERROR("Unsupported: %d\n",ind_lf); break;
-		}
-		break;
-	case QUAD:
-		switch (ind_lf) {
-			case H_QUAD1_F0: return 0; break;
-			case H_QUAD1_F1: return 3; break;
-			case H_QUAD1_F2: return 0; break;
-			case H_QUAD1_F3: return 3; break;
-			default: EXIT_ERROR("Unsupported: %d\n",ind_lf); break;
-		}
-		break;
-	default:
-		EXIT_ERROR("Unsupported: %d\n",e_type);
-		break;
+	if (m_file->size < sizeof(struct Restart_Bin_Header))
+		EXIT_ERROR("The binary restart file is truncated.\n");
+
+	const struct Restart_Bin_Header*const header = m_file->data;
+	if (memcmp(header->magic,RESTART_BIN_MAGIC,sizeof header->magic) != 0)
+		EXIT_ERROR("The input file is not a binary restart file.\n");
+	if (header->byte_order != RESTART_BIN_BYTE_ORDER)
+		EXIT_ERROR("Unsupported: Binary restart file written with a different byte order.\n");
+	if (header->version != RESTART_BIN_VERSION)
+		EXIT_ERROR("Unsupported: %d (version)\n",header->version);
+	if (header->flags != RESTART_BIN_FLAG_NONE)
+		EXIT_ERROR("Unsupported: %d (flags)\n",header->flags);
+	if (header->dim != DIM)
+		EXIT_ERROR("Unsupported: %d (dim)\n",header->dim);
+	if (header->n_v != compute_n_volumes(sim))
+		EXIT_ERROR("Inconsistent number of volumes: %ld, %td.\n",(long)header->n_v,compute_n_volumes(sim));
+
+	const size_t size_table = sizeof *header + (size_t)header->n_v*sizeof(struct Restart_Bin_Volume);
+	if (m_file->size < size_table || (size_t)header->offset_data > m_file->size)
+		EXIT_ERROR("The binary restart file is truncated.\n");
+	return header;
+}
+
+static void check_volume_binary
+	(const struct Volume*const vol, const struct Restart_Bin_Volume*const vol_b,
+	 const struct Mapped_File*const m_file)
+{
+	const struct const_Multiarray_R*const xyz_ve = vol->xyz_ve;
+	const ptrdiff_t size_xyz = compute_size(xyz_ve->order,xyz_ve->extents);
+	assert(xyz_ve->layout == 'R');
+
+	if (vol_b->e_type != vol->element->type || vol_b->n_ve != xyz_ve->extents[0])
+		EXIT_ERROR("Inconsistent element type for volume %d.\n",vol->index);
+	if ((size_t)vol_b->offset_xyz + (size_t)size_xyz*sizeof(double) > m_file->size ||
+	    (size_t)vol_b->offset_data + (size_t)(vol_b->ext_0*vol_b->ext_1)*sizeof(double) > m_file->size)
+		EXIT_ERROR("The binary restart file is truncated.\n");
+
+	const double*const xyz_b = (const double*) BYTE_ADD(m_file->data,vol_b->offset_xyz);
+	for (ptrdiff_t i = 0; i < size_xyz; ++i) {
+		if (fabs(xyz_b[i]-xyz_ve->data[i]) > 1e3*EPS*(1.0+fabs(xyz_b[i])))
+			EXIT_ERROR("Inconsistent vertex coordinates for volume %d.\n",vol->index);
 	}
 }
 
+static void read_sol_coef_bezier_binary
+	(struct Solver_Volume_T*const s_vol, const struct Restart_Bin_Volume*const vol_b,
+	 const struct Mapped_File*const m_file)
+{
+	enum { order = 2, };
+
+	const_cast_i(&s_vol->p_ref,vol_b->p_ref);
+
+	const ptrdiff_t exts[] = { (ptrdiff_t)vol_b->ext_0, (ptrdiff_t)vol_b->ext_1, };
+	struct Multiarray_T*const s_coef = s_vol->sol_coef;
+	resize_Multiarray_T(s_coef,order,exts);
+
+	const double*const data_b = (const double*) BYTE_ADD(m_file->data,vol_b->offset_data);
+#if TYPE_RC == TYPE_REAL
+	memcpy(s_coef->data,data_b,(size_t)compute_size(order,exts) * sizeof *s_coef->data);
+#else
+	const struct const_Multiarray_R s_coef_R =
+		{ .layout = s_coef->layout, .order = order, .extents = exts, .owns_data = false, .data = data_b, };
+	copy_into_Multiarray_T_from_R(s_coef,&s_coef_R);
+#endif
+}
+
 #include "undef_templates_restart.h"
 
 #include "undef_templates_matrix.h"
 #include "undef_templates_multiarray.h"
 
-#include "undef_templates_face_solver.h"
 #include "undef_templates_volume_solver.h"
 
 #include "undef_templates_computational_elements.h"
@@ -20,10 +20,13 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdlib.h>
 #include <string.h>
 #include <float.h>
+#include <limits.h>
+#include "mpi.h"
 
 #include "macros.h"
 #include "definitions_elements.h"
 #include "definitions_mesh.h"
+#include "definitions_restart.h"
 #include "definitions_tol.h"
 
 #include "matrix.h"
@@ -37,16 +40,14 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "file_processing.h"
 #include "intrusive.h"
 #include "mesh_readers.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solution.h"
 #include "test_case.h"
 
 // Static function declarations ************************************************************************************* //
 
-///\{ \name Supported restart file types.
-#define RESTART_GMSH 1
-///\}
-
 /// \brief Write a restart file with the mesh component in gmsh format.
 static void output_restart_gmsh
 	(const struct Simulation*const sim ///< \ref Simulation.
@@ -73,10 +74,32 @@ void output_restart (const struct Simulation*const sim)
 		break;
 	}
 
+	start_profile(PROF_OUTPUT);
 	if (strstr(sim->mesh_name_full,".msh"))
 		output_restart_gmsh(sim);
 	else
 		EXIT_ERROR("Unsupported: %s\n",sim->mesh_name_full);
+	stop_profile(PROF_OUTPUT);
+}
+
+const char* compute_restart_name (const int restart_type, const struct Simulation*const sim)
+{
+	static const char* name_path = "../restart/";
+
+	char ml_p_spec[STRLEN_MIN];
+	sprintf(ml_p_spec,"%s%d%s%d","__ml",sim->ml_p_curr[0],"__p",sim->ml_p_curr[1]);
+
+	char name_ext[STRLEN_MIN];
+	switch (restart_type) {
+		case RESTART_GMSH:   strcpy(name_ext,".msh");                      break;
+		case RESTART_BINARY: strcpy(name_ext,".bin");                      break;
+		default:             EXIT_ERROR("Unsupported: %d\n",restart_type); break;
+	}
+
+	static char output_name[5*STRLEN_MAX];
+	sprintf(output_name,"%s%s%c%s%c%s%s%s",
+	        name_path,sim->pde_name,'/',sim->pde_spec,'/',"restart",ml_p_spec,name_ext);
+	return output_name;
 }
 
 // Static functions ************************************************************************************************* //
@@ -120,13 +143,6 @@ static void destructor_Elements_Info
 	(const struct Elements_Info*const elements_info ///< Standard.
 	);
 
-/** \brief Return the name of the restart file.
- *  \return See brief. */
-static const char* compute_restart_name
-	(const int restart_type,           ///< The type of restart file. See options above.
-	 const struct Simulation*const sim ///< \ref Simulation.
-	);
-
 /// \brief Print the format format to the gmsh file.
 static void fprintf_format_gmsh
 	(FILE* file ///< The file.
@@ -156,24 +172,52 @@ static void fprintf_solution_bezier_gmsh
 	 const struct Simulation*const sim ///< Standard.
 	);
 
+/// \brief Print the reference to the binary restart file to the gmsh file.
+static void fprintf_solution_binary_gmsh
+	(FILE* file,                       ///< The file.
+	 const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Write the solution coefficients in the Bezier basis to the binary restart file.
+ *
+ *  The volume table and vertex coordinates are written by the first process and the solution coefficients of the
+ *  volumes owned by each of the processes are written as a single contiguous block using collective MPI I/O.
+ */
+static void write_solution_bezier_binary
+	(const struct Simulation*const sim ///< Standard.
+	);
+
 static void output_restart_gmsh (const struct Simulation*const sim)
 {
-	const struct Nodes_Info*const ni    = constructor_Nodes_Info(sim);    // destructed
-	const struct Elements_Info*const ei = constructor_Elements_Info(sim); // destructed
+	const bool binary = get_set_restart_binary(NULL);
+
+	// The mesh is identical on all processes and is written by the first process.
+	if (sim->mpi_rank == 0) {
+		const struct Nodes_Info*const ni    = constructor_Nodes_Info(sim);    // destructed
+		const struct Elements_Info*const ei = constructor_Elements_Info(sim); // destructed
 
-	const char*const f_name = compute_restart_name(RESTART_GMSH,sim);
+		const char*const f_name = compute_restart_name(RESTART_GMSH,sim);
 
-	FILE* file = fopen_create_dir(f_name); // closed
+		FILE* file = fopen_create_dir(f_name); // closed
 
-	fprintf_format_gmsh(file);
-	fprintf_nodes_gmsh(file,ni);
-	fprintf_elements_gmsh(file,ni,ei);
-	fprintf_solution_bezier_gmsh(file,sim);
+		fprintf_format_gmsh(file);
+		fprintf_nodes_gmsh(file,ni);
+		fprintf_elements_gmsh(file,ni,ei);
+		if (!binary)
+			fprintf_solution_bezier_gmsh(file,sim);
+		else
+			fprintf_solution_binary_gmsh(file,sim);
 
-	fclose(file);
+		fclose(file);
 
-	destructor_Nodes_Info(ni);
-	destructor_Elements_Info(ei);
+		destructor_Nodes_Info(ni);
+		destructor_Elements_Info(ei);
+	}
+
+	if (binary) {
+		MPI_Barrier(MPI_COMM_WORLD); // The output directory is created above.
+		write_solution_bezier_binary(sim);
+	}
 }
 
 // Level 1 ********************************************************************************************************** //
@@ -278,26 +322,6 @@ static void destructor_Elements_Info (const struct Elements_Info*const elements_
 	free((void*)elements_info);
 }
 
-static const char* compute_restart_name
-	(const int restart_type, const struct Simulation*const sim)
-{
-	static const char* name_path = "../restart/";
-
-	char ml_p_spec[STRLEN_MIN];
-	sprintf(ml_p_spec,"%s%d%s%d","__ml",sim->ml_p_curr[0],"__p",sim->ml_p_curr[1]);
-
-	char name_ext[STRLEN_MIN];
-	switch (restart_type) {
-		case RESTART_GMSH: strcpy(name_ext,".msh");                      break;
-		default:           EXIT_ERROR("Unsupported: %d\n",restart_type); break;
-	}
-
-	static char output_name[5*STRLEN_MAX];
-	sprintf(output_name,"%s%s%c%s%c%s%s%s",
-	        name_path,sim->pde_name,'/',sim->pde_spec,'/',"restart",ml_p_spec,name_ext);
-	return output_name;
-}
-
 static void fprintf_format_gmsh (FILE* file)
 {
 	fprintf(file,"$MeshFormat\n");
@@ -314,7 +338,7 @@ static void fprintf_nodes_gmsh (FILE* file, const struct Nodes_Info*const ni)
 		const double*const data_n = get_row_const_Matrix_d(n,ni->nodes);
 		fprintf(file,"%d",n+1);
 		for (int d = 0; d < DMAX; ++d)
-			fprintf(file," %g",( d < DIM ? data_n[d] : 0.0 ));
+			fprintf(file," %.17g",( d < DIM ? data_n[d] : 0.0 ));
 		fprintf(file,"\n");
 	}
 	fprintf(file,"$EndNodes\n");
@@ -410,3 +434,121 @@ static void fprintf_solution_bezier_gmsh (FILE* file, const struct Simulation*co
 	}
 	fprintf(file,"$EndSolutionCoefficients\n");
 }
+
+static void fprintf_solution_binary_gmsh (FILE* file, const struct Simulation*const sim)
+{
+	// Only the file name is stored as the binary file is placed in the directory of the restart file.
+	const char*const f_name = compute_restart_name(RESTART_BINARY,sim);
+	const char*const sep = strrchr(f_name,'/');
+
+	fprintf(file,"$SolutionCoefficientsBinary\n");
+	fprintf(file,"%s\n",( sep ? sep+1 : f_name ));
+	fprintf(file,"$EndSolutionCoefficientsBinary\n");
+}
+
+static void write_solution_bezier_binary (const struct Simulation*const sim)
+{
+	const ptrdiff_t n_v = compute_n_volumes(sim);
+	const int n_ranks = sim->mpi_size;
+
+	// The volume table is computed identically on all processes such that no communication is required.
+	struct Restart_Bin_Volume*const vols_b = calloc((size_t)n_v,sizeof *vols_b); // free
+
+	int64_t size_xyz = 0,
+	        size_data_rank[n_ranks+1];
+	for (int r = 0; r <= n_ranks; ++r)
+		size_data_rank[r] = 0;
+
+	int ml = -1;
+	ptrdiff_t v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+		const struct Volume*const vol          = (struct Volume*) curr;
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		const ptrdiff_t*const ext = s_vol->sol_coef->extents;
+
+		if (v == 0)
+			ml = s_vol->ml;
+		if (ml != s_vol->ml)
+			EXIT_ERROR("Unsupported h-adapted mesh output as this is currently unsupported by the mesh readers.");
+
+		struct Restart_Bin_Volume*const vol_b = &vols_b[v];
+		vol_b->e_type = vol->element->type;
+		vol_b->p_ref  = s_vol->p_ref;
+		vol_b->n_ve   = vol->xyz_ve->extents[0];
+		vol_b->ext_0  = ext[0];
+		vol_b->ext_1  = ext[1];
+
+		vol_b->offset_xyz  = size_xyz;
+		vol_b->offset_data = size_data_rank[vol->rank+1];
+		size_xyz                     += vol_b->n_ve*DIM*(int64_t)sizeof(double);
+		size_data_rank[vol->rank+1] += vol_b->ext_0*vol_b->ext_1*(int64_t)sizeof(double);
+	}
+
+	struct Restart_Bin_Header header = { .version = RESTART_BIN_VERSION, .byte_order = RESTART_BIN_BYTE_ORDER,
+	                                     .flags = RESTART_BIN_FLAG_NONE, .dim = DIM, .n_v = n_v, };
+	memcpy(header.magic,RESTART_BIN_MAGIC,sizeof header.magic);
+	header.offset_xyz  = (int64_t)(sizeof header + (size_t)n_v*sizeof *vols_b);
+	header.offset_data = header.offset_xyz+size_xyz;
+
+	size_data_rank[0] = header.offset_data;
+	for (int r = 0; r < n_ranks; ++r)
+		size_data_rank[r+1] += size_data_rank[r];
+	const int64_t*const offset_rank = size_data_rank;
+
+	v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+		const struct Volume*const vol = (struct Volume*) curr;
+		vols_b[v].offset_xyz  += header.offset_xyz;
+		vols_b[v].offset_data += offset_rank[vol->rank];
+	}
+
+	const char*const f_name = compute_restart_name(RESTART_BINARY,sim);
+	MPI_File f;
+	if (MPI_File_open(MPI_COMM_WORLD,f_name,MPI_MODE_CREATE|MPI_MODE_WRONLY,MPI_INFO_NULL,&f) != MPI_SUCCESS)
+		EXIT_ERROR("Could not open the binary restart file: %s\n",f_name);
+	MPI_File_set_size(f,(MPI_Offset)offset_rank[n_ranks]); // Truncates any previous file.
+
+	if (sim->mpi_rank == 0) {
+		MPI_File_write_at(f,0,&header,(int)sizeof header,MPI_BYTE,MPI_STATUS_IGNORE);
+		MPI_File_write_at(f,(MPI_Offset)sizeof header,vols_b,(int)((size_t)n_v*sizeof *vols_b),MPI_BYTE,
+		                  MPI_STATUS_IGNORE);
+
+		double*const xyz = malloc((size_t)size_xyz); // free
+		v = 0;
+		for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+			const struct const_Multiarray_d*const xyz_ve = ((struct Volume*)curr)->xyz_ve;
+			assert(xyz_ve->layout == 'R');
+			memcpy(BYTE_ADD(xyz,vols_b[v].offset_xyz-header.offset_xyz),xyz_ve->data,
+			       (size_t)(vols_b[v].n_ve*DIM)*sizeof *xyz);
+		}
+		MPI_File_write_at(f,(MPI_Offset)header.offset_xyz,xyz,(int)(size_xyz/(int64_t)sizeof *xyz),MPI_DOUBLE,
+		                  MPI_STATUS_IGNORE);
+		free(xyz);
+	}
+
+	// The coefficients of the owned volumes are contiguous in the file.
+	const int rank = sim->mpi_rank;
+	const int64_t size_data = offset_rank[rank+1]-offset_rank[rank];
+	double*const data = malloc((size_t)size_data); // free
+	v = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next, ++v) {
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
+
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+		struct Multiarray_d*const s_coef = constructor_s_coef_bezier(s_vol,sim); // destructed
+		assert(s_coef->layout == 'C');
+		assert(s_coef->extents[0] == vols_b[v].ext_0 && s_coef->extents[1] == vols_b[v].ext_1);
+
+		memcpy(BYTE_ADD(data,vols_b[v].offset_data-offset_rank[rank]),s_coef->data,
+		       (size_t)(vols_b[v].ext_0*vols_b[v].ext_1)*sizeof *data);
+		destructor_Multiarray_d(s_coef);
+	}
+	assert(size_data/(int64_t)sizeof *data <= INT_MAX);
+	MPI_File_write_at_all(f,(MPI_Offset)offset_rank[rank],data,(int)(size_data/(int64_t)sizeof *data),MPI_DOUBLE,
+	                      MPI_STATUS_IGNORE);
+	MPI_File_close(&f);
+
+	free(data);
+	free(vols_b);
+}
@@ -26,4 +26,11 @@ void output_restart
 	(const struct Simulation*const sim ///< \ref Simulation.
 	);
 
+/** \brief Return the statically allocated name of the restart file for the current mesh level and polynomial order.
+ *  \return See brief. */
+const char* compute_restart_name
+	(const int restart_type,           ///< The type of restart file. Options: see \ref definitions_restart.h.
+	 const struct Simulation*const sim ///< \ref Simulation.
+	);
+
 #endif // DPG__restart_writers_h__INCLUDED
@@ -17,6 +17,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "test_case.h"
 
+#include "macros.h"
 #include "definitions_dpg.h"
 #include "definitions_test_case.h"
 
@@ -128,10 +129,36 @@ bool outputting_restart ( )
 	return output_restart;
 }
 
+bool get_set_restart_binary (const bool*const new_val)
+{
+	static bool need_input = true;
+	static bool output_binary = false;
+	if (need_input) {
+		need_input = false;
+		char line[STRLEN_MAX];
+		char restart_format[STRLEN_MAX] = "text";
+		FILE* input_file = fopen_input('t',NULL,NULL); // closed
+		while (fgets(line,sizeof(line),input_file)) {
+			if (strstr(line,"restart_format")) read_skip_c(line,restart_format);
+		}
+		fclose(input_file);
+
+		if (strcmp(restart_format,"binary") == 0)
+			output_binary = true;
+		else if (strcmp(restart_format,"text") != 0)
+			EXIT_ERROR("Unsupported: %s\n",restart_format);
+	}
+
+	if (new_val)
+		output_binary = *new_val;
+	return output_binary;
+}
+
 const int* get_set_n_var_eq (const int*const new_vals)
 {
 	static int n_var_eq[2] = { -1, -1, };
 	if (new_vals) {
+		EXIT_IF_IN_PARALLEL;
 		for (int i = 0; i < 2; ++i) {
 			assert(new_vals[i] > 0);
 			assert(new_vals[i] <= DIM+2);
@@ -145,6 +172,7 @@ const bool* get_set_has_1st_2nd_order (const bool*const new_vals)
 {
 	static bool has_1st_2nd_order[2] = { false, false, };
 	if (new_vals) {
+		EXIT_IF_IN_PARALLEL;
 		for (int i = 0; i < 2; ++i)
 			has_1st_2nd_order[i] = new_vals[i];
 	}
@@ -154,8 +182,10 @@ const bool* get_set_has_1st_2nd_order (const bool*const new_vals)
 int get_set_pde_index (const int*const new_val)
 {
 	static int pde_index = -1;
-	if (new_val)
+	if (new_val) {
+		EXIT_IF_IN_PARALLEL;
 		pde_index = *new_val;
+	}
 	return pde_index;
 }
 
@@ -76,6 +76,16 @@ bool using_restart ( );
  *  \return See brief. */
 bool outputting_restart ( );
 
+/** \brief Return a statically allocated `bool` flag indicating whether the solution coefficients of the restart file
+ *         should be outputted in binary format (see \ref definitions_restart.h).
+ *  \return `true` if the `restart_format` is "binary"; `false` otherwise (the default "text" format).
+ *
+ *  Passing a non-NULL value for `new_val` sets the statically allocated value to that pointed to by the input.
+ */
+bool get_set_restart_binary
+	(const bool*const new_val ///< Pointer to new value.
+	);
+
 /** \brief Return a statically allocated array of `int*` holding the values of the number of variables/equations.
  *  \return See brief.
  *
@@ -21,6 +21,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <string.h>
 
 #include "macros.h"
+#include "definitions_adaptation.h"
 #include "definitions_core.h"
 #include "definitions_dpg.h"
 #include "definitions_test_case.h"
@@ -264,14 +265,27 @@ static void read_test_case_parameters (struct Test_Case_T* test_case, const stru
 	char line[STRLEN_MAX];
 	FILE* input_file = NULL;
 
+	const_cast_b(&test_case->use_solution_pool,true);
+	const_cast_b(&test_case->use_volume_batching,true);
+
 	input_file = fopen_input('t',NULL,NULL); // closed
 	while (fgets(line,sizeof(line),input_file)) {
 		read_skip_convert_const_i(line,"solver_proc",  &test_case->solver_proc,  &count_found);
 		read_skip_convert_const_i(line,"solver_type_e",&test_case->solver_type_e,NULL);
 		read_skip_convert_const_i(line,"solver_type_i",&test_case->solver_type_i,NULL);
 		read_skip_convert_const_i(line,"lhs_terms",    &test_case->lhs_terms,    NULL);
+		if (strstr(line,"lag_pc_i")) read_skip_const_i(line,&test_case->lag_pc_i);
+		read_skip_convert_const_i(line,"pmg_smoother",&test_case->pmg_smoother,NULL);
+		read_skip_convert_const_i(line,"bc_hessian",  &test_case->bc_hessian,  NULL);
+		read_skip_convert_const_i(line,"jfnk_method", &test_case->jfnk_method, NULL);
 		read_skip_string_count_const_d("cfl_initial",&count_tmp,line,&test_case->cfl_initial);
 
+		read_skip_convert_const_i(line,"adapt_marking",&test_case->adapt_marking,NULL);
+		if (strstr(line,"adapt_n_max"))      read_skip_const_i(line,&test_case->adapt_n_max);
+		if (strstr(line,"adapt_dof_max"))    read_skip_const_i(line,&test_case->adapt_dof_max);
+		if (strstr(line,"adapt_theta"))      read_skip_const_d(line,&test_case->adapt_theta,1,false);
+		if (strstr(line,"adapt_smoothness")) read_skip_const_d(line,&test_case->adapt_smoothness,1,false);
+
 		read_skip_convert_const_i(line,"geom_parametrization",&test_case->geom_parametrization,NULL);
 
 		read_skip_convert_const_i(line,"num_flux_1st",&test_case->ind_num_flux[0],NULL);
@@ -281,8 +295,14 @@ static void read_test_case_parameters (struct Test_Case_T* test_case, const stru
 
 		if (strstr(line,"time_final")) read_skip_const_d(line,&test_case->time_final,1,false);
 		if (strstr(line,"time_step"))  read_skip_const_d(line,&test_case->dt,1,false);
+		read_skip_string_count_const_d("cfl_e",&count_tmp,line,&test_case->cfl_e);
+		if (strstr(line,"n_lts_levels")) read_skip_const_i(line,&test_case->n_lts_levels);
+		if (strstr(line,"use_volume_batching")) read_skip_const_b(line,&test_case->use_volume_batching);
 
 		if (strstr(line,"use_schur_complement")) read_skip_const_b(line,&test_case->use_schur_complement);
+		if (strstr(line,"use_block_matrix"))     read_skip_const_b(line,&test_case->use_block_matrix);
+		if (strstr(line,"use_jfnk"))             read_skip_const_b(line,&test_case->use_jfnk);
+		if (strstr(line,"use_solution_pool"))    read_skip_const_b(line,&test_case->use_solution_pool);
 
 		if (strstr(line,"display_progress")) read_skip_const_b(line,&test_case->display_progress);
 		if (strstr(line,"has_functional"))   read_skip_const_b(line,&test_case->has_functional);
@@ -306,14 +326,21 @@ static void read_test_case_parameters (struct Test_Case_T* test_case, const stru
 static void correct_invalid_test_case_parameters (struct Test_Case_T* test_case, const struct Simulation* sim)
 {
 	switch (sim->method) {
-	case METHOD_DG:  // fallthrough
+	case METHOD_DG:
+		const_cast_b(&test_case->use_schur_complement,false);
+		break;
 	case METHOD_OPG: // fallthrough
 	case METHOD_OPGC0:
 		const_cast_b(&test_case->use_schur_complement,false);
+		const_cast_b(&test_case->use_block_matrix,false); // The C0/test dof are not blocked.
+		const_cast_b(&test_case->use_jfnk,false);
+		// The solution coefficients are updated from the test function coefficients.
+		const_cast_b(&test_case->use_solution_pool,false);
 		break;
 	case METHOD_DPG:
 	case METHOD_L2_PROJ:
-		break; // Do nothing.
+		const_cast_b(&test_case->use_jfnk,false);
+		break;
 	default:
 		EXIT_ERROR("Unsupported: %d\n",sim->method);
 		break;
@@ -344,6 +371,65 @@ static void correct_invalid_test_case_parameters (struct Test_Case_T* test_case,
 		EXIT_ERROR("Unsupported: %d\n",test_case->lhs_terms);
 		break;
 	}
+
+	if (test_case->lag_pc_i <= 0)
+		const_cast_i(&test_case->lag_pc_i,1);
+
+	if (test_case->n_lts_levels <= 0)
+		const_cast_i(&test_case->n_lts_levels,1);
+
+	if (test_case->bc_hessian == 0)
+		const_cast_i(&test_case->bc_hessian,BC_HESSIAN_CMPLX_STEP);
+
+	if (test_case->jfnk_method == 0)
+		const_cast_i(&test_case->jfnk_method,JFNK_FINITE_DIFF);
+
+	if (test_case->adapt_marking != ADAPT_MARK_NONE) {
+		if (sim->method != METHOD_DG && sim->method != METHOD_DPG)
+			EXIT_ERROR("Unsupported: %d\n",sim->method);
+		if (test_case->has_functional)
+			EXIT_ERROR("Unsupported: goal-oriented adaptation requires an adjoint solver.\n");
+
+		if (test_case->adapt_n_max <= 0)
+			const_cast_i(&test_case->adapt_n_max,1);
+		if (!(test_case->adapt_theta > 0.0 && test_case->adapt_theta <= 1.0))
+			const_cast_d(&test_case->adapt_theta,0.5);
+		if (!(test_case->adapt_smoothness > 0.0))
+			const_cast_d(&test_case->adapt_smoothness,1.0);
+	}
+
+	// The CFL constrained time step is computed using the maximum wave speed of the Euler equations.
+	if (test_case->cfl_e > 0.0 || test_case->n_lts_levels > 1) {
+		if (sim->method != METHOD_DG)
+			EXIT_ERROR("Unsupported: %d\n",sim->method);
+		if (test_case->pde_index != PDE_EULER && test_case->pde_index != PDE_NAVIER_STOKES)
+			EXIT_ERROR("Unsupported: %d\n",test_case->pde_index);
+	}
+	if (test_case->n_lts_levels > 1 && !(test_case->cfl_e > 0.0))
+		EXIT_ERROR("Unsupported: Set a positive cfl_e for local time stepping.\n");
+
+	// The Schur complement sub-matrices are extracted using scalar index sets.
+	if (test_case->use_schur_complement)
+		const_cast_b(&test_case->use_block_matrix,false);
+
+	// Only the element-local blocks of the lhs matrix are available for the factorization.
+	if (test_case->use_jfnk && test_case->solver_type_i == SOLVER_I_DIRECT)
+		EXIT_ERROR("Unsupported: Use the iterative implicit solver with the jfnk method.\n");
+
+	// The complex \ref Simulation used for the complex step is constructed from the mesh of the control file.
+	if (test_case->use_jfnk && test_case->jfnk_method == JFNK_CMPLX_STEP &&
+	    test_case->adapt_marking != ADAPT_MARK_NONE)
+		EXIT_ERROR("Unsupported: Use finite differences for the jfnk method with adaptation.\n");
+
+	if (test_case->solver_type_i == SOLVER_I_P_MG) {
+		// The coarse level operators are computed from the full lhs matrix in scalar (AIJ) format.
+		if (sim->method != METHOD_DG || test_case->use_jfnk)
+			EXIT_ERROR("Unsupported: p-multigrid is only available for the dg method without jfnk.\n");
+		const_cast_b(&test_case->use_block_matrix,false);
+
+		if (test_case->pmg_smoother == 0)
+			const_cast_i(&test_case->pmg_smoother,PMG_SMOOTHER_BLOCK_JACOBI);
+	}
 }
 
 static const bool* get_compute_member_Flux_Input
@@ -88,6 +88,10 @@ struct Test_Case_T {
 	// Solver related parameters
 	char solver_method_curr; ///< The current solver method. Options: 'e'xplicit, 'i'mplicit.
 
+	/** Flag for whether the \ref Solver_Volume_T::error_ind values should be computed during the rlhs computation. Only
+	 *  set while computing the error indicators of the converged solution (see \ref Test_Case_T::adapt_marking). */
+	bool compute_error_ind;
+
 	/// The type of solver procedure to be used for the simulation. Options: See definitions_test_case.h.
 	const int solver_proc;
 
@@ -98,18 +102,92 @@ struct Test_Case_T {
 	const double time_final; ///< The final time.
 	const double dt;         ///< The time increment at each stage of the explicit solve.
 
+	/** The target CFL number for the explicit solve. If positive, the time step is recomputed at each step such that
+	 *  the maximum of the local CFL numbers is equal to this value (see \ref compute_dt_cfl_dg) and
+	 *  \ref Test_Case_T::dt is ignored. */
+	const double cfl_e;
+
+	/** The number of levels used for the explicit local time stepping. The time steps of the levels differ by factors
+	 *  of 2 and each volume is advanced using the largest of these time steps not exceeding its local CFL constrained
+	 *  time step (requires a positive \ref Test_Case_T::cfl_e) such that the levels of neighbouring volumes differ by
+	 *  at most one. A value of 1 results in global time stepping. */
+	const int n_lts_levels;
+
+	/** Flag for whether the rhs-only volume terms of the dg method should be computed for batches of volumes sharing
+	 *  the same operators (default: `true`; see \ref compute_rhs_v_dg_like_batch_T). Only used with the standard
+	 *  operator format. */
+	const bool use_volume_batching;
+
 	// Parameters for implicit simulations.
 	/** Flag for whether the Schur complement should be used for the global system solve. This option is available
 	 *  whenever it is possible for certain degrees of freedom to be statically condensed out of the global
-	 *  system. */
+	 *  system.
+	 *
+	 *  For the DPG method, the volume dof are condensed element-locally during the assembly such that the global
+	 *  system only holds the face and Lagrange multiplier dof; the volume dof are then recovered by local
+	 *  back-substitution (see \ref back_substitute_x_dpg). */
 	const bool use_schur_complement;
 
+	/** Flag for whether the global system matrix should be stored in block sparse (BAIJ) format with the element
+	 *  blocks (see \ref compute_block_size_T). Only has an effect for the dg method on meshes with a single element
+	 *  type and uniform order. */
+	const bool use_block_matrix;
+
+	/** Flag for whether the 'J'acobian-'f'ree 'N'ewton-'K'rylov method should be used for the implicit dg solver. If
+	 *  enabled, the action of the lhs matrix is computed from perturbations of the rhs (see
+	 *  \ref constructor_petsc_mat_jfnk_dg) and only the element-local blocks of the lhs matrix are assembled for use
+	 *  in the preconditioner. */
+	const bool use_jfnk;
+
+	/// The method used to compute the jfnk matrix-vector products (default: \ref JFNK_FINITE_DIFF).
+	const int jfnk_method;
+
 	// Parameters for explicit/implicit simulations.
 	const int solver_type_i; ///< The implicit solver type. Options: See definitions_test_case.h.
 
+	/** Flag for whether the per-volume solution data should be stored contiguously in a \ref Solution_Pool during the
+	 *  dg/dpg solves (default: `true`). */
+	const bool use_solution_pool;
+
+	/** The number of implicit steps over which the preconditioner (or the factorization for the direct solver) is
+	 *  reused before being recomputed. A value of 1 (the default) results in the recomputation at every step. */
+	const int lag_pc_i;
+
+	/// The smoother used on the fine levels of the p-multigrid preconditioner (see \ref SOLVER_I_P_MG).
+	const int pmg_smoother;
+
+	/** The method used to linearize the boundary face terms of the DPG lhs wrt the solution coefficients for nonlinear
+	 *  pdes (default: \ref BC_HESSIAN_CMPLX_STEP). Options: See definitions_test_case.h.
+	 *
+	 *  \ref BC_HESSIAN_JACOBIAN_FD does not require the complex \ref Simulation\*s but is only accurate to
+	 *  \f$ \mathcal{O}(h^2) \f$ in the finite difference step. */
+	const int bc_hessian;
+
 	/// Parameter relating to the terms to be included in the LHS matrix. Options: See definitions_test_case.h.
 	const int lhs_terms;
 
+	/** The marking strategy used for the automatic hp-adaptation performed each time that the implicit solver has
+	 *  converged (see \ref ADAPT_S_INDICATOR). Options: see \ref definitions_adaptation.h.
+	 *
+	 *  The error indicators are given by the norm of the DPG error representation function for the DPG method and by
+	 *  the mesh size weighted norm of the strong residual in the volume combined with the norm of the jump in the
+	 *  solution over the volume faces for the DG method (for which the discrete residual vanishes at convergence).
+	 *
+	 *  The indicators are not weighted by an adjoint solution (no adjoint solver is available) and automatic adaptation
+	 *  is thus not supported for test cases with \ref Test_Case_T::has_functional set. */
+	const int adapt_marking;
+
+	const int adapt_n_max;   ///< The maximum number of automatic adaptation cycles.
+	const int adapt_dof_max; ///< The volume dof budget of the automatic adaptation (no limit if not positive).
+
+	/** The marking fraction: the fraction of the total squared error for \ref ADAPT_MARK_DORFLER and the fraction of
+	 *  the volumes for \ref ADAPT_MARK_FIXED_FRACTION. */
+	const double adapt_theta;
+
+	/** The minimal decay rate of the modal content of the solution between the two highest orders for which a marked
+	 *  volume is considered smooth and is p-refined (h-refined otherwise). */
+	const double adapt_smoothness;
+
 	const double cfl_initial; ///< Initial CFL number in case \ref LHS_CFL_RAMPING is selected.
 
 	/// Integer indices of the 1st/2nd order numerical fluxes. See \ref definitions_test_case.h
@@ -18,6 +18,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "visualization.h"
 
 #include <assert.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -46,6 +47,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "multiarray_operator.h"
 #include "nodes_plotting.h"
 #include "operator.h"
+#include "partition.h"
+#include "profiling.h"
 #include "simulation.h"
 #include "solution.h"
 #include "solution_euler.h"
@@ -76,7 +79,40 @@ void output_visualization (struct Simulation* sim, const int vis_type)
 	assert(list_is_derived_from("solver",'f',sim));
 	assert(list_is_derived_from("solver",'e',sim));
 
+	start_profile(PROF_OUTPUT);
 	output_visualization_paraview(sim,vis_type);
+	stop_profile(PROF_OUTPUT);
+}
+
+const struct Vtk_Options* get_set_vtk_options (const struct Vtk_Options*const new_options)
+{
+	static bool need_input = true;
+	static struct Vtk_Options vtk_options = { .binary = false, .lagrange = false, };
+	if (need_input) {
+		need_input = false;
+		char line[STRLEN_MAX];
+		char vtk_format[STRLEN_MAX] = "ascii",
+		     vtk_cells[STRLEN_MAX]  = "linear";
+		FILE* input_file = fopen_input('t',NULL,NULL); // closed
+		while (fgets(line,sizeof(line),input_file)) {
+			if (strstr(line,"vtk_format")) read_skip_c(line,vtk_format);
+			if (strstr(line,"vtk_cells"))  read_skip_c(line,vtk_cells);
+		}
+		fclose(input_file);
+
+		if (strcmp(vtk_format,"binary") == 0)
+			vtk_options.binary = true;
+		else if (strcmp(vtk_format,"ascii") != 0)
+			EXIT_ERROR("Unsupported: %s\n",vtk_format);
+
+		if (strcmp(vtk_cells,"lagrange") == 0)
+			vtk_options.lagrange = true;
+		else if (strcmp(vtk_cells,"linear") != 0)
+			EXIT_ERROR("Unsupported: %s\n",vtk_cells);
+	}
+	if (new_options)
+		vtk_options = *new_options;
+	return &vtk_options;
 }
 
 // Static functions ************************************************************************************************* //
@@ -241,6 +277,8 @@ static void output_visualization_vtk_geom
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
 		struct Volume* vol          = (struct Volume*)curr;
 		struct Solver_Volume* s_vol = (struct Solver_Volume*)curr;
+		if (!is_volume_owned(vol,sim))
+			continue;
 
 		const struct Solver_Element* s_e   = (struct Solver_Element*) vol->element;
 		const struct Plotting_Element* p_e = &s_e->p_e;
@@ -290,6 +328,8 @@ static void output_visualization_vtk_normals (const struct Simulation* sim)
 	fprint_vtk_header_footer(s_file,false,'h',"PolyData");
 	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
 		struct Solver_Face* face = (struct Solver_Face*)curr;
+		if (!is_volume_owned(((struct Face*)curr)->neigh_info[0].volume,sim))
+			continue;
 
 		fprint_vtk_piece_normals(s_file,'s','s',face->xyz_fc,face->normals_fc);
 		fprint_vtk_piece_normals(s_file,'s','e',NULL,NULL);
@@ -335,6 +375,8 @@ static void output_visualization_vtk_sol (const struct Simulation* sim)
 	fprint_vtk_header_footer(s_file,false,'h',"UnstructuredGrid");
 	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
 		struct Solver_Volume* s_vol = (struct Solver_Volume*)curr;
+		if (!is_volume_owned((struct Volume*)curr,sim))
+			continue;
 
 		const struct Volume_Data_Vis*const vdv = constructor_VDV(s_vol,test_case,sim); // destructed
 
@@ -432,6 +474,49 @@ static void fprint_vtk_piece_other_euler
 	 const char*const data_name                  ///< The name of the data.
 	);
 
+/** \brief Set the connectivity and types of the cells to be used for the volume plotting nodes.
+ *
+ *  The VTK Lagrange cell is used if enabled and supported for the element; the linear sub-elements are used otherwise.
+ */
+static void set_vtk_cells
+	(const struct const_Plotting_Nodes*const p_nodes,       ///< \ref Plotting_Nodes.
+	 const struct const_Multiarray_Vector_i**const connect, ///< Set to the cell connectivity.
+	 const struct const_Vector_i**const vtk_types           ///< Set to the cell types.
+	);
+
+/// \brief Print the vtk cells (connectivity, offsets and types) of a piece to the file.
+static void fprint_vtk_Cells
+	(FILE* file,                                          ///< The file.
+	 const struct const_Multiarray_Vector_i*const connect, ///< The cell connectivity.
+	 const struct const_Vector_i*const vtk_types           ///< The cell types.
+	);
+
+/** \brief Start the next sub-piece of the \ref Vtk_Piece_Binary.
+ *
+ *  A sub-piece holds the contribution of a single computational element to the piece.
+ */
+static void start_vtk_sub_piece
+	(const ptrdiff_t n_points, ///< The number of points of the sub-piece.
+	 const ptrdiff_t n_cells   ///< The number of cells of the sub-piece.
+	);
+
+/// \brief Append data to the next data array of the current sub-piece of the \ref Vtk_Piece_Binary.
+static void append_vtk_array
+	(const char group,      ///< Defined in \ref Vtk_Array_Binary.
+	 const char*const type, ///< Defined in \ref Vtk_Array_Binary.
+	 const char*const name, ///< Defined in \ref Vtk_Array_Binary.
+	 const int n_comp,      ///< Defined in \ref Vtk_Array_Binary.
+	 const void*const data, ///< The data.
+	 const size_t size      ///< The size of the data in bytes.
+	);
+
+/** \brief Print the xml description of the \ref Vtk_Piece_Binary followed by the appended data to the file, and reset
+ *         the piece. */
+static void fprint_vtk_piece_binary
+	(FILE* file,                    ///< The file.
+	 const char*const vtk_type_part ///< Defined for \ref fprint_vtk_header_footer.
+	);
+
 static const struct Volume_Data_Vis* constructor_VDV
 	(const struct Solver_Volume*const s_vol, const struct Test_Case*const test_case,
 	 const struct Simulation*const sim)
@@ -573,7 +658,8 @@ static void fprint_vtk_header_footer
 	if (hf_type == 'h') {
 		fprintf_tn(file,0,"<?xml version=\"1.0\"?>");
 
-		sprintf(string_i,"%s%s%s","<VTKFile type=\"",vtk_type,"\" version=\"0.1\" byte_order=\"LittleEndian\">");
+		sprintf(string_i,"%s%s%s%s","<VTKFile type=\"",vtk_type,"\" version=\"0.1\" byte_order=\"LittleEndian\"",
+		        (!is_parallel && get_set_vtk_options(NULL)->binary ? " header_type=\"UInt64\">" : ">"));
 		fprintf_tn(file,0,string_i);
 
 		if (is_parallel)
@@ -582,8 +668,12 @@ static void fprint_vtk_header_footer
 			sprintf(string_i,"%s%s%s","<",vtk_type,">");
 		fprintf_tn(file,0,string_i);
 	} else if (hf_type == 'f') {
-		sprintf(string_i,"%s%s%s","</",vtk_type,">");
-		fprintf_tn(file,0,string_i);
+		if (!is_parallel && get_set_vtk_options(NULL)->binary) {
+			fprint_vtk_piece_binary(file,vtk_type);
+		} else {
+			sprintf(string_i,"%s%s%s","</",vtk_type,">");
+			fprintf_tn(file,0,string_i);
+		}
 		fprintf_tn(file,0,"</VTKFile>");
 	} else {
 		EXIT_ERROR("Unsupported: %c\n",hf_type);
@@ -615,32 +705,24 @@ static void fprint_vtk_piece_geom
 			const struct const_Multiarray_Vector_i* connect = NULL;
 			const struct const_Vector_i* vtk_types          = NULL;
 			if (geom_type == 'v') {
-				connect = p_nodes->connect;
-				vtk_types = p_nodes->vtk_types;
+				set_vtk_cells(p_nodes,&connect,&vtk_types);
 			} else if (geom_type == 'e') {
 				connect = p_nodes->connect_e;
 				vtk_types = p_nodes->vtk_types_e;
 			}
 
-			fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfCells=\"%td\">\n",
-			             xyz->extents[0],connect->extents[0]);
+			if (!get_set_vtk_options(NULL)->binary) {
+				fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfCells=\"%td\">\n",
+				             xyz->extents[0],connect->extents[0]);
+			} else {
+				start_vtk_sub_piece(xyz->extents[0],connect->extents[0]);
+			}
 			fprint_vtk_Points(file,sp_type,xyz);
 
-			fprintf_tn(file,1,"<Cells>");
-				fprintf_tn(file,2,"<DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">");
-				fprint_const_Multiarray_Vector_i(file,2,connect);
-				fprintf_tn(file,2,"</DataArray>");
-
-				fprintf_tn(file,2,"<DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">");
-				fprint_const_Multiarray_Vector_i_offsets(file,2,connect);
-				fprintf_tn(file,2,"</DataArray>");
-
-				fprintf_tn(file,2,"<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">");
-				fprint_const_Vector_i(file,2,vtk_types);
-				fprintf_tn(file,2,"</DataArray>");
-			fprintf_tn(file,1,"</Cells>");
+			fprint_vtk_Cells(file,connect,vtk_types);
 		} else if (se_type == 'e') {
-			fprintf_tn(file,0,"</Piece>\n");
+			if (!get_set_vtk_options(NULL)->binary)
+				fprintf_tn(file,0,"</Piece>\n");
 		}
 	}
 }
@@ -662,12 +744,17 @@ static void fprint_vtk_piece_normals
 		}
 	} else if (sp_type == 's') {
 		if (se_type == 's') {
-			fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfVerts=\"0\" NumberOfLines=\"0\" "
-			             "NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n",xyz->extents[0]);
+			if (!get_set_vtk_options(NULL)->binary) {
+				fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfVerts=\"0\" NumberOfLines=\"0\" "
+				             "NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n",xyz->extents[0]);
+			} else {
+				start_vtk_sub_piece(xyz->extents[0],0);
+			}
 			fprint_vtk_Points(file,sp_type,xyz);
 			fprint_vtk_DataArray_d(file,sp_type,"Normals",normals,true,'v');
 		} else if (se_type == 'e') {
-			fprintf_tn(file,0,"</Piece>\n");
+			if (!get_set_vtk_options(NULL)->binary)
+				fprintf_tn(file,0,"</Piece>\n");
 		}
 	}
 }
@@ -766,28 +853,22 @@ static void fprint_vtk_piece_sol_grad
 			const struct const_Multiarray_d*const xyz       = vdv->xyz_p;
 			const struct const_Plotting_Nodes*const p_nodes = vdv->p_nodes;
 
-			const struct const_Multiarray_Vector_i* connect = p_nodes->connect;
-			const struct const_Vector_i* vtk_types          = p_nodes->vtk_types;
+			const struct const_Multiarray_Vector_i* connect = NULL;
+			const struct const_Vector_i* vtk_types          = NULL;
+			set_vtk_cells(p_nodes,&connect,&vtk_types);
 
-			fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfCells=\"%td\">\n",
-			             xyz->extents[0],connect->extents[0]);
+			if (!get_set_vtk_options(NULL)->binary) {
+				fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfCells=\"%td\">\n",
+				             xyz->extents[0],connect->extents[0]);
+			} else {
+				start_vtk_sub_piece(xyz->extents[0],connect->extents[0]);
+			}
 			fprint_vtk_Points(file,sp_type,xyz);
 
-			fprintf_tn(file,1,"<Cells>");
-				fprintf_tn(file,2,"<DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">");
-				fprint_const_Multiarray_Vector_i(file,2,connect);
-				fprintf_tn(file,2,"</DataArray>");
-
-				fprintf_tn(file,2,"<DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">");
-				fprint_const_Multiarray_Vector_i_offsets(file,2,connect);
-				fprintf_tn(file,2,"</DataArray>");
-
-				fprintf_tn(file,2,"<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">");
-				fprint_const_Vector_i(file,2,vtk_types);
-				fprintf_tn(file,2,"</DataArray>");
-			fprintf_tn(file,1,"</Cells>");
+			fprint_vtk_Cells(file,connect,vtk_types);
 
-			fprintf_tn(file,1,"<PointData Scalars=\"Scalars\" Vectors=\"Vectors\">");
+			if (!get_set_vtk_options(NULL)->binary)
+				fprintf_tn(file,1,"<PointData Scalars=\"Scalars\" Vectors=\"Vectors\">");
 
 			struct Multiarray_i*const data_i =
 				constructor_empty_Multiarray_i(sol->layout,2,(ptrdiff_t[]){sol->extents[0],1}); // destructed
@@ -857,9 +938,11 @@ static void fprint_vtk_piece_sol_grad
 					break;
 				}
 			}
-			fprintf_tn(file,1,"</PointData>");
+			if (!get_set_vtk_options(NULL)->binary)
+				fprintf_tn(file,1,"</PointData>");
 		} else if (se_type == 'e') {
-			fprintf_tn(file,0,"</Piece>\n");
+			if (!get_set_vtk_options(NULL)->binary)
+				fprintf_tn(file,0,"</Piece>\n");
 		}
 	}
 }
@@ -883,10 +966,76 @@ void fprint_const_Multiarray_i_vtk_point
 	 const char data_type                ///< See brief.
 	);
 
+#define VTK_N_ARRAYS_MAX 64 ///< The maximum number of data arrays of a piece written in the appended binary format.
+
+/// \brief Container for a data array of a piece written in the appended raw binary format.
+struct Vtk_Array_Binary {
+	char group;            ///< The group of the array. Options: 'p'oints, 'c'ells, point 'd'ata.
+	char type[STRLEN_MIN]; ///< The vtk data type.
+	char name[STRLEN_MIN]; ///< The name of the array (may be empty).
+	int n_comp;            ///< The number of components.
+
+	char* data;      ///< The raw data.
+	size_t size,     ///< The size of the data in bytes.
+	       capacity; ///< The capacity of the data buffer in bytes.
+};
+
+/** \brief Container for the single piece of the output file of each process when the output is written in the
+ *         appended raw binary format.
+ *
+ *  Each computational element contributes a sub-piece having an identical sequence of data arrays. The data of each
+ *  sub-piece is appended to that of the previous sub-pieces such that all of the elements are output as a single
+ *  piece. This significantly reduces the size of the xml description (and the time required by the visualization
+ *  software to load the file) compared to the output of one piece for each element.
+ */
+struct Vtk_Piece_Binary {
+	ptrdiff_t n_points,  ///< The total number of points.
+	          n_cells,   ///< The total number of cells.
+	          n_connect, ///< The total number of entries of the cell connectivity.
+	          ind_p_sp;  ///< The index of the first point of the current sub-piece.
+
+	int n_arrays,  ///< The number of data arrays.
+	    ind_array; ///< The index of the next data array of the current sub-piece.
+
+	struct Vtk_Array_Binary arrays[VTK_N_ARRAYS_MAX]; ///< The data arrays.
+};
+
+/** \brief Get the pointer to the statically allocated \ref Vtk_Piece_Binary.
+ *  \return See brief. */
+static struct Vtk_Piece_Binary* get_vtk_piece_binary ( );
+
+/// \brief Print the opening tag of the group of data arrays of the \ref Vtk_Piece_Binary to the file.
+static void fprint_vtk_group_binary
+	(FILE* file,         ///< The file.
+	 const char group,   ///< Defined in \ref Vtk_Array_Binary.
+	 const char se_type  ///< Type indicator for 's'tart or 'e'nd.
+	);
+
+/** \brief Append the data of a \ref const_Multiarray_T to the next data array of the current sub-piece of the
+ *         \ref Vtk_Piece_Binary, converting it to the format used by \ref fprint_const_Multiarray_d_vtk_point. */
+static void append_const_Multiarray_d_vtk_point
+	(const char group,                   ///< Defined in \ref Vtk_Array_Binary.
+	 const char*const name,              ///< Defined in \ref Vtk_Array_Binary.
+	 const struct const_Multiarray_d* a, ///< Standard.
+	 const char data_type                ///< Defined for \ref fprint_vtk_DataArray_d.
+	);
+
+/// \brief `int` version of \ref append_const_Multiarray_d_vtk_point.
+static void append_const_Multiarray_i_vtk_point
+	(const char group,                   ///< See brief.
+	 const char*const name,              ///< See brief.
+	 const struct const_Multiarray_i* a, ///< See brief.
+	 const char data_type                ///< See brief.
+	);
+
 void fprint_vtk_Points (FILE* file, const char sp_type, const struct const_Multiarray_d* xyz)
 {
 	// Note: Points **must** have 3 values.
 	assert(sp_type == 's' || sp_type == 'p');
+	if (sp_type == 's' && get_set_vtk_options(NULL)->binary) {
+		append_const_Multiarray_d_vtk_point('p',"",xyz,'v');
+		return;
+	}
 
 	static char points_name[STRLEN_MIN] = { 0, };
 	if (sp_type == 's')
@@ -908,6 +1057,10 @@ void fprint_vtk_DataArray_d
 {
 	assert(sp_type == 's' || sp_type == 'p');
 	assert(data_type == 'v' || data_type == 's');
+	if (sp_type == 's' && get_set_vtk_options(NULL)->binary) {
+		append_const_Multiarray_d_vtk_point('d',data_name,data,data_type);
+		return;
+	}
 
 	static char pointdata_name[STRLEN_MIN] = { 0, };
 	if (include_hf) {
@@ -939,6 +1092,10 @@ void fprint_vtk_DataArray_i
 {
 	assert(sp_type == 's' || sp_type == 'p');
 	assert(data_type == 's');
+	if (sp_type == 's' && get_set_vtk_options(NULL)->binary) {
+		append_const_Multiarray_i_vtk_point('d',data_name,data,data_type);
+		return;
+	}
 
 	static char pointdata_name[STRLEN_MIN] = { 0, };
 	if (include_hf) {
@@ -1171,6 +1328,156 @@ static void fprint_vtk_piece_other_euler
 	}
 }
 
+static void set_vtk_cells
+	(const struct const_Plotting_Nodes*const p_nodes, const struct const_Multiarray_Vector_i**const connect,
+	 const struct const_Vector_i**const vtk_types)
+{
+	if (get_set_vtk_options(NULL)->lagrange && p_nodes->connect_l) {
+		*connect   = p_nodes->connect_l;
+		*vtk_types = p_nodes->vtk_types_l;
+	} else {
+		*connect   = p_nodes->connect;
+		*vtk_types = p_nodes->vtk_types;
+	}
+}
+
+static void fprint_vtk_Cells
+	(FILE* file, const struct const_Multiarray_Vector_i*const connect, const struct const_Vector_i*const vtk_types)
+{
+	if (!get_set_vtk_options(NULL)->binary) {
+		fprintf_tn(file,1,"<Cells>");
+			fprintf_tn(file,2,"<DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">");
+			fprint_const_Multiarray_Vector_i(file,2,connect);
+			fprintf_tn(file,2,"</DataArray>");
+
+			fprintf_tn(file,2,"<DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">");
+			fprint_const_Multiarray_Vector_i_offsets(file,2,connect);
+			fprintf_tn(file,2,"</DataArray>");
+
+			fprintf_tn(file,2,"<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">");
+			fprint_const_Vector_i(file,2,vtk_types);
+			fprintf_tn(file,2,"</DataArray>");
+		fprintf_tn(file,1,"</Cells>");
+		return;
+	}
+
+	struct Vtk_Piece_Binary*const piece = get_vtk_piece_binary();
+
+	const ptrdiff_t n_cells = compute_size(connect->order,connect->extents);
+	ptrdiff_t n_connect = 0;
+	for (ptrdiff_t i = 0; i < n_cells; ++i)
+		n_connect += connect->data[i]->ext_0;
+
+	int32_t*const conn_b    = malloc((size_t)n_connect * sizeof *conn_b);    // free
+	int32_t*const offsets_b = malloc((size_t)n_cells   * sizeof *offsets_b); // free
+	uint8_t*const types_b   = malloc((size_t)n_cells   * sizeof *types_b);   // free
+	for (ptrdiff_t i = 0, ind = 0; i < n_cells; ++i) {
+		const struct const_Vector_i*const connect_i = connect->data[i];
+		for (ptrdiff_t j = 0; j < connect_i->ext_0; ++j)
+			conn_b[ind++] = (int32_t)(piece->ind_p_sp+connect_i->data[j]);
+		offsets_b[i] = (int32_t)(piece->n_connect+ind);
+		types_b[i]   = (uint8_t)vtk_types->data[i];
+	}
+	piece->n_connect += n_connect;
+
+	append_vtk_array('c',"Int32","connectivity",1,conn_b,(size_t)n_connect*sizeof *conn_b);
+	append_vtk_array('c',"Int32","offsets",1,offsets_b,(size_t)n_cells*sizeof *offsets_b);
+	append_vtk_array('c',"UInt8","types",1,types_b,(size_t)n_cells*sizeof *types_b);
+
+	free(conn_b);
+	free(offsets_b);
+	free(types_b);
+}
+
+static void start_vtk_sub_piece (const ptrdiff_t n_points, const ptrdiff_t n_cells)
+{
+	struct Vtk_Piece_Binary*const piece = get_vtk_piece_binary();
+	assert(piece->n_arrays == 0 || piece->ind_array == piece->n_arrays); // Same arrays for all sub-pieces.
+
+	piece->ind_p_sp   = piece->n_points;
+	piece->n_points  += n_points;
+	piece->n_cells   += n_cells;
+	piece->ind_array  = 0;
+}
+
+static void append_vtk_array
+	(const char group, const char*const type, const char*const name, const int n_comp, const void*const data,
+	 const size_t size)
+{
+	struct Vtk_Piece_Binary*const piece = get_vtk_piece_binary();
+
+	const int ind_a = piece->ind_array++;
+	struct Vtk_Array_Binary*const array = &piece->arrays[ind_a];
+	if (ind_a == piece->n_arrays) {
+		if (piece->n_arrays == VTK_N_ARRAYS_MAX)
+			EXIT_ERROR("Increase VTK_N_ARRAYS_MAX.\n");
+		++piece->n_arrays;
+
+		array->group  = group;
+		array->n_comp = n_comp;
+		strcpy(array->type,type);
+		strcpy(array->name,name);
+	}
+	assert(array->group == group && strcmp(array->name,name) == 0);
+
+	if (array->size+size > array->capacity) {
+		array->capacity = 2*(array->size+size);
+		array->data = realloc(array->data,array->capacity); // free
+	}
+	memcpy(array->data+array->size,data,size);
+	array->size += size;
+}
+
+static void fprint_vtk_piece_binary (FILE* file, const char*const vtk_type_part)
+{
+	struct Vtk_Piece_Binary*const piece = get_vtk_piece_binary();
+
+	if (strcmp(vtk_type_part,"PolyData") == 0) {
+		fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfVerts=\"0\" NumberOfLines=\"0\" "
+		             "NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n",piece->n_points);
+	} else {
+		fprintf(file,"\n<Piece NumberOfPoints=\"%td\" NumberOfCells=\"%td\">\n",piece->n_points,piece->n_cells);
+	}
+
+	// Each array is preceded by its size in bytes in the appended data.
+	size_t offset = 0;
+	char group = 0;
+	for (int i = 0; i < piece->n_arrays; ++i) {
+		const struct Vtk_Array_Binary*const array = &piece->arrays[i];
+		if (array->group != group) {
+			if (group)
+				fprint_vtk_group_binary(file,group,'e');
+			group = array->group;
+			fprint_vtk_group_binary(file,group,'s');
+		}
+
+		fprintf(file,"\t\t<DataArray type=\"%s\"",array->type);
+		if (array->name[0])
+			fprintf(file," Name=\"%s\"",array->name);
+		if (array->n_comp > 1)
+			fprintf(file," NumberOfComponents=\"%d\"",array->n_comp);
+		fprintf(file," format=\"appended\" offset=\"%zu\"/>\n",offset);
+
+		offset += sizeof(uint64_t)+array->size;
+	}
+	if (group)
+		fprint_vtk_group_binary(file,group,'e');
+	fprintf_tn(file,0,"</Piece>");
+
+	fprintf(file,"</%s>\n",vtk_type_part);
+	fprintf(file,"<AppendedData encoding=\"raw\">\n_");
+	for (int i = 0; i < piece->n_arrays; ++i) {
+		struct Vtk_Array_Binary*const array = &piece->arrays[i];
+		const uint64_t size = array->size;
+		fwrite(&size,sizeof(size),1,file);
+		fwrite(array->data,1,array->size,file);
+		free(array->data);
+	}
+	fprintf(file,"\n</AppendedData>\n");
+
+	memset(piece,0,sizeof *piece);
+}
+
 // Level 4 ********************************************************************************************************** //
 
 void fprint_const_Multiarray_d_vtk_point
@@ -1277,3 +1584,67 @@ void fprint_const_Multiarray_i_vtk_point
 		EXIT_ERROR("Unsupported: %c.\n",data_type);
 	}
 }
+
+static struct Vtk_Piece_Binary* get_vtk_piece_binary ( )
+{
+	static struct Vtk_Piece_Binary piece;
+	return &piece;
+}
+
+static void fprint_vtk_group_binary (FILE* file, const char group, const char se_type)
+{
+	const char* group_name = NULL;
+	switch (group) {
+		case 'p': group_name = "Points";    break;
+		case 'c': group_name = "Cells";     break;
+		case 'd': group_name = "PointData"; break;
+		default:
+			EXIT_ERROR("Unsupported: %c\n",group);
+			break;
+	}
+	fprintf(file,"\t<%s%s>\n",(se_type == 's' ? "" : "/"),group_name);
+}
+
+static void append_const_Multiarray_d_vtk_point
+	(const char group, const char*const name, const struct const_Multiarray_d* a, const char data_type)
+{
+	assert(data_type == 'v' || data_type == 's');
+	assert(a->order == 2);
+
+	const ptrdiff_t ext_0 = a->extents[0],
+	                ext_1 = a->extents[1];
+
+	const int n_comp = ( data_type == 'v' ? 3 : 1 );
+	assert(data_type == 'v' || ext_1 == 1);
+
+	const size_t size = (size_t)(ext_0*n_comp) * sizeof(float);
+	float*const data_f = malloc(size); // free
+	for (ptrdiff_t i = 0; i < ext_0; ++i) {
+	for (ptrdiff_t j = 0; j < n_comp; ++j) {
+		float val = 0.0f;
+		if (j < ext_1) {
+			const double val_d = ( a->layout == 'R' ? a->data[i*ext_1+j] : a->data[i+j*ext_0] );
+			val = (float)( fabs(val_d) < EPS ? EPS : val_d );
+		}
+		data_f[i*n_comp+j] = val;
+	}}
+	append_vtk_array(group,"Float32",name,n_comp,data_f,size);
+	free(data_f);
+}
+
+static void append_const_Multiarray_i_vtk_point
+	(const char group, const char*const name, const struct const_Multiarray_i* a, const char data_type)
+{
+	assert(data_type == 's');
+	assert(a->order == 2);
+	assert(a->extents[1] == 1);
+
+	const ptrdiff_t ext_0 = a->extents[0];
+
+	const size_t size = (size_t)ext_0 * sizeof(int32_t);
+	int32_t*const data_i = malloc(size); // free
+	for (ptrdiff_t i = 0; i < ext_0; ++i)
+		data_i[i] = (int32_t)a->data[i];
+	append_vtk_array(group,"Int32",name,1,data_i,size);
+	free(data_i);
+}
@@ -22,12 +22,36 @@ You should have received a copy of the GNU General Public License along with DPG
  *  For example, for the unstructured Paraview format, both '.pvtu' and '.vtu' files are generated.
  */
 
+#include <stdbool.h>
+
 struct Simulation;
 
+/// \brief Container for the vtk output options.
+struct Vtk_Options {
+	bool binary;   ///< Flag for whether the output should be written in the appended raw binary format.
+	bool lagrange; ///< Flag for whether the volumes should be output as VTK Lagrange cells (where supported).
+};
+
 /// \brief Output the visualization of the specified output.
 void output_visualization
 	(struct Simulation* sim, ///< \ref Simulation.
 	 const int vis_type      ///< The type of visualization. Options: see \ref definitions_visualization.h.
 	);
 
+/** \brief Get a pointer to the statically allocated \ref Vtk_Options, reading them from the test case file on the first
+ *         call.
+ *  \return See brief.
+ *
+ *  The options are:
+ *  - `vtk_format`: "ascii" (default: one piece per volume) or "binary" (a single piece for each process with the data
+ *                  stored in the appended raw format);
+ *  - `vtk_cells`:  "linear" (default: the linear sub-elements of the plotting nodes) or "lagrange" (a single VTK
+ *                  Lagrange cell for each volume, see \ref Plotting_Nodes::connect_l).
+ *
+ *  Passing a non-NULL value for `new_options` sets the statically allocated value to that pointed to by the input.
+ */
+const struct Vtk_Options* get_set_vtk_options
+	(const struct Vtk_Options*const new_options ///< Pointer to the new options.
+	);
+
 #endif // DPG__visualization_h__INCLUDED
@@ -22,6 +22,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
+#include "gsl/gsl_math.h"
 
 #include "macros.h"
 #include "definitions_adaptation.h"
@@ -34,6 +36,8 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "test_support_multiarray.h"
 #include "test_support_vector.h"
 
+#include "volume_solver.h"
+
 #include "multiarray.h"
 #include "vector.h"
 
@@ -315,5 +319,39 @@ void adapt_to_maximum_refinement (struct Simulation*const sim, const struct Inte
 	set_ml_p_curr(ml_ref[1],p_ref[1],sim);
 }
 
+const struct const_Vector_d* constructor_sol_coef_Vector_d (const struct Simulation*const sim)
+{
+	ptrdiff_t n_dof = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Multiarray_d*const s_coef = ((struct Solver_Volume*)curr)->sol_coef;
+		n_dof += compute_size(s_coef->order,s_coef->extents);
+	}
+
+	struct Vector_d*const sol_coef = constructor_empty_Vector_d(n_dof); // returned
+
+	ptrdiff_t ind = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Multiarray_d*const s_coef = ((struct Solver_Volume*)curr)->sol_coef;
+		const ptrdiff_t size = compute_size(s_coef->order,s_coef->extents);
+		for (ptrdiff_t i = 0; i < size; ++i)
+			sol_coef->data[ind+i] = s_coef->data[i];
+		ind += size;
+	}
+	return (const struct const_Vector_d*) sol_coef;
+}
+
+double compute_norm_diff_rel_inf_Vector_d (const struct const_Vector_d*const a, const struct const_Vector_d*const b)
+{
+	assert(a->ext_0 == b->ext_0);
+
+	double norm_a = 0.0,
+	       norm_diff = 0.0;
+	for (ptrdiff_t i = 0; i < a->ext_0; ++i) {
+		norm_a    = GSL_MAX(norm_a,fabs(a->data[i]));
+		norm_diff = GSL_MAX(norm_diff,fabs(a->data[i]-b->data[i]));
+	}
+	return ( norm_a > 0.0 ? norm_diff/norm_a : norm_diff );
+}
+
 // Static functions ************************************************************************************************* //
 // Level 0 ********************************************************************************************************** //
@@ -23,6 +23,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 struct Test_Info;
 struct Simulation;
+struct const_Vector_d;
 
 /// Container for integration test related parameters
 struct Integration_Test_Info {
@@ -102,4 +103,18 @@ void adapt_to_maximum_refinement
 	 const struct Integration_Test_Info*const int_test_info ///< Standard.
 	);
 
+/** \brief Constructor for a \ref const_Vector_T\* holding the concatenated solution coefficients of all volumes (in
+ *         the order of \ref Simulation::volumes).
+ *  \return See brief. */
+const struct const_Vector_d* constructor_sol_coef_Vector_d
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Compute the infinity norm of the difference of the input vectors relative to that of the first input.
+ *  \return See brief. */
+double compute_norm_diff_rel_inf_Vector_d
+	(const struct const_Vector_d*const a, ///< Input 0.
+	 const struct const_Vector_d*const b  ///< Input 1.
+	);
+
 #endif // DPG__test_integration_h__INCLUDED
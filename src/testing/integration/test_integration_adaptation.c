@@ -0,0 +1,92 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "core.h"
+#include "simulation.h"
+#include "solve.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the automatic hp-adaptation based on the error indicators
+ *        (\ref test_integration_adaptation.c).
+ *  \return 0 on success.
+ *
+ *  The simulation is solved for the input control file, for which \ref Test_Case_T::adapt_marking and
+ *  \ref Test_Case_T::adapt_dof_max must be set, and the number of volume degrees of freedom of the final mesh is checked
+ *  to have increased without exceeding the dof budget. As the implicit solver only returns once the residual exit
+ *  criteria are satisfied, this also checks that the solver converges on each of the adapted meshes.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 3,"Invalid number of input arguments");
+
+	const char* petsc_options_name = set_petsc_options_name(argv[2]);
+	PetscInitialize(&argc,&argv,petsc_options_name,PETSC_NULL);
+
+	const char* ctrl_name = argv[1];
+
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name);
+
+	const int p  = int_test_info->p_ref[0],
+	          ml = int_test_info->ml[0],
+	          p_prev  = p-1,
+	          ml_prev = ml-1;
+
+	const int adapt_type = int_test_info->adapt_type;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+
+	struct Simulation* sim = NULL;
+	structor_simulation(&sim,'c',adapt_type,p,ml,p_prev,ml_prev,ctrl_name_curr,'r',false); // destructed
+
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	assert_condition_message(test_case->adapt_marking != ADAPT_MARK_NONE && test_case->adapt_dof_max > 0,
+	                         "This test requires a test case with automatic adaptation and a dof budget.");
+	const ptrdiff_t n_dof_max = test_case->adapt_dof_max;
+
+	const ptrdiff_t n_dof_i = compute_dof_schur('v',sim);
+	solve_for_solution(sim);
+	const ptrdiff_t n_dof = compute_dof_schur('v',sim);
+
+	structor_simulation(&sim,'d',ADAPT_0,p,ml,p_prev,ml_prev,NULL,'r',false);
+
+	const bool pass = (n_dof_i < n_dof && n_dof <= n_dof_max);
+	if (!pass)
+		printf("Volume dof: %td (initial), %td (final), %td (budget).\n",n_dof_i,n_dof,n_dof_max);
+
+	destructor_Integration_Test_Info(int_test_info);
+
+	PetscFinalize();
+
+	assert_condition(pass);
+	OUTPUT_SUCCESS;
+}
@@ -0,0 +1,241 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include "gsl/gsl_math.h"
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+#include "definitions_intrusive.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "volume.h"
+#include "volume_solver.h"
+#include "volume_solver_adaptive.h"
+
+#include "matrix.h"
+#include "multiarray.h"
+
+#include "adaptation.h"
+#include "computational_elements.h"
+#include "core.h"
+#include "intrusive.h"
+#include "simulation.h"
+#include "solution.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define P_MARK 3 ///< The order of the solution for which the volumes are marked.
+
+/** \brief Return the signed distance-like value of the input coordinates with respect to the line along which the
+ *         solution is discontinuous.
+ *  \return See brief. */
+static double compute_dist_singular
+	(const double x, ///< The x-coordinate.
+	 const double y  ///< The y-coordinate.
+	);
+
+/** \brief Set the solution of each volume to the L2 projection of the exact solution of the test case with an added
+ *         unit jump along the line given by \ref compute_dist_singular.
+ */
+static void set_sol_singular
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Check whether the input volume is intersected by the line along which the solution is discontinuous.
+ *  \return `true` if the volume is intersected; `false` otherwise. */
+static bool check_volume_singular
+	(const struct Volume*const vol ///< \ref Volume.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the marking of volumes for the automatic hp-adaptation
+ *        (\ref test_integration_adaptation_marking.c).
+ *  \return 0 on success.
+ *
+ *  The solution is set to the exact solution of the test case with an added discontinuity along a line which does not
+ *  pass through any of the mesh vertices and the volumes are marked using the \ref ADAPT_MARK_FIXED_FRACTION strategy.
+ *  The test checks that:
+ *  - the expected number of volumes is marked;
+ *  - the error indicators of all of the marked volumes are at least as large as those of the unmarked volumes;
+ *  - marked volumes intersected by the discontinuity are h-refined while the other marked volumes, in which the
+ *    solution is smooth, are p-refined (see \ref Test_Case_T::adapt_smoothness).
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 3,"Invalid number of input arguments");
+
+	const char* petsc_options_name = set_petsc_options_name(argv[2]);
+	PetscInitialize(&argc,&argv,petsc_options_name,PETSC_NULL);
+
+	const char* ctrl_name = argv[1];
+
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name);
+
+	const int p  = int_test_info->p_ref[0],
+	          ml = int_test_info->ml[0],
+	          p_prev  = p-1,
+	          ml_prev = ml-1;
+
+	const int adapt_type = int_test_info->adapt_type;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+
+	struct Simulation* sim = NULL;
+	structor_simulation(&sim,'c',adapt_type,p,ml,p_prev,ml_prev,ctrl_name_curr,'r',false); // destructed
+
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	assert_condition_message(test_case->adapt_marking == ADAPT_MARK_FIXED_FRACTION && test_case->adapt_dof_max <= 0,
+	                         "This test requires fixed fraction marking without a dof budget.");
+	assert_condition_message(sim->p_ref[0] <= P_MARK-2 && P_MARK < sim->p_ref[1],
+	                         "The modal decay and p-refinement must be available for the marking order.");
+
+	for (int p_curr = p; p_curr < P_MARK; ++p_curr)
+		adapt_hp(sim,ADAPT_S_P_REFINE,NULL);
+	set_sol_singular(sim);
+
+	constructor_derived_computational_elements(sim,IL_SOLVER_ADAPTIVE); // destructed
+	mark_volumes_indicator(sim);
+
+	ptrdiff_t n_v = 0,
+	          n_mark = 0,
+	          n_h = 0;
+	double error_ind_mark_min   = DBL_MAX,
+	       error_ind_unmark_max = 0.0;
+	bool pass_hp = true;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Volume*const vol               = (struct Volume*) curr;
+		const struct Solver_Volume*const s_vol      = (struct Solver_Volume*) curr;
+		struct Adaptive_Solver_Volume*const a_s_vol = (struct Adaptive_Solver_Volume*) curr;
+
+		++n_v;
+		if (a_s_vol->adapt_type == ADAPT_NONE) {
+			error_ind_unmark_max = GSL_MAX(error_ind_unmark_max,s_vol->error_ind);
+			continue;
+		}
+		++n_mark;
+		error_ind_mark_min = GSL_MIN(error_ind_mark_min,s_vol->error_ind);
+
+		const bool singular = check_volume_singular(vol);
+		const int adapt_type_expected = ( singular ? ADAPT_H_REFINE : ADAPT_P_REFINE );
+		if (a_s_vol->adapt_type != adapt_type_expected) {
+			pass_hp = false;
+			printf("Volume %d (singular: %d, error indicator: % .3e): adapt_type %d (expected: %d).\n",
+			       vol->index,singular,s_vol->error_ind,a_s_vol->adapt_type,adapt_type_expected);
+		}
+		if (singular)
+			++n_h;
+
+		// Reset such that the volumes are not modified.
+		a_s_vol->adapt_type = ADAPT_NONE;
+	}
+	destructor_derived_computational_elements(sim,IL_SOLVER);
+
+	const bool pass_n_mark  = (n_mark == (ptrdiff_t)ceil(test_case->adapt_theta*(double)n_v)),
+	           pass_ranking = (error_ind_mark_min >= error_ind_unmark_max),
+	           pass_cover   = (n_h > 0 && n_h < n_mark);
+	if (!pass_n_mark)
+		printf("Marked %td of %td volumes.\n",n_mark,n_v);
+	if (!pass_ranking)
+		printf("Error indicators: % .3e (min marked), % .3e (max unmarked).\n",error_ind_mark_min,error_ind_unmark_max);
+	if (!pass_cover)
+		printf("The marked volumes should include both singular (%td) and smooth (%td) volumes.\n",n_h,n_mark-n_h);
+
+	structor_simulation(&sim,'d',ADAPT_0,p,ml,p_prev,ml_prev,NULL,'r',false);
+	destructor_Integration_Test_Info(int_test_info);
+
+	PetscFinalize();
+
+	assert_condition_message(pass_n_mark,"Incorrect number of marked volumes.");
+	assert_condition_message(pass_ranking,"Marked volumes do not follow the error indicator ranking.");
+	assert_condition_message(pass_cover,"Both h- and p-refinement must be tested.");
+	assert_condition_message(pass_hp,"Incorrect choice of h- or p-refinement.");
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static double compute_dist_singular (const double x, const double y)
+{
+	return x+0.3*y-0.1;
+}
+
+static void set_sol_singular (const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	assert(test_case->n_var == 1);
+
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+
+		const struct const_Multiarray_d*const xyz_vc = constructor_xyz_vc_interp(s_vol,sim); // destructed
+		struct Multiarray_d*const u_vc = (struct Multiarray_d*) test_case->constructor_sol(xyz_vc,sim); // destructed
+
+		const ptrdiff_t n_vc = xyz_vc->extents[0];
+		const double*const x = get_col_const_Multiarray_d(0,xyz_vc),
+		            *const y = get_col_const_Multiarray_d(1,xyz_vc);
+		for (int i = 0; i < n_vc; ++i) {
+			if (compute_dist_singular(x[i],y[i]) > 0.0)
+				u_vc->data[i] += 1.0;
+		}
+		destructor_const_Multiarray_d(xyz_vc);
+
+		const struct const_Matrix_d*const proj_s = constructor_l2_proj_operator_s(s_vol,NULL); // destructed
+		const struct const_Matrix_d u_vc_M = interpret_const_Multiarray_as_Matrix_d((struct const_Multiarray_d*)u_vc);
+		const struct const_Matrix_d*const s_coef =
+			constructor_mm_const_Matrix_d('N','N',1.0,proj_s,&u_vc_M,'C'); // destructed
+		destructor_const_Matrix_d(proj_s);
+		destructor_Multiarray_d(u_vc);
+
+		struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+		assert(sol_coef->layout == 'C');
+		assert(compute_size(sol_coef->order,sol_coef->extents) == s_coef->ext_0*s_coef->ext_1);
+		for (int i = 0; i < s_coef->ext_0*s_coef->ext_1; ++i)
+			sol_coef->data[i] = s_coef->data[i];
+		destructor_const_Matrix_d(s_coef);
+	}
+}
+
+static bool check_volume_singular (const struct Volume*const vol)
+{
+	const struct const_Multiarray_d*const xyz_ve = vol->xyz_ve;
+	assert(xyz_ve->layout == 'R');
+
+	const ptrdiff_t n_ve = xyz_ve->extents[0];
+
+	bool has_pos = false,
+	     has_neg = false;
+	for (int ve = 0; ve < n_ve; ++ve) {
+		const double*const xyz = get_row_const_Multiarray_d(ve,xyz_ve);
+		if (compute_dist_singular(xyz[0],xyz[1]) > 0.0)
+			has_pos = true;
+		else
+			has_neg = true;
+	}
+	return has_pos && has_neg;
+}
@@ -207,18 +207,21 @@ int main
 		struct F_Ptrs_and_Data* f_ptrs_data = constructor_F_Ptrs_and_Data(sim); // destructed
 
 		if (i == 0) {
+			struct Test_Case* test_case = (struct Test_Case*) sim->test_case_rc->tc;
+			const_cast_b(&test_case->use_schur_complement,false); // Otherwise the volume dof are condensed out of A.
+
 			ssi[i] = constructor_Solver_Storage_Implicit(sim); // destructed
 
-			struct Test_Case* test_case = (struct Test_Case*) sim->test_case_rc->tc;
 			test_case->solver_method_curr = 'i';
-			const_cast_b(&test_case->use_schur_complement,false); // Otherwise A is modified.
 
 			perturb_solution(sim);
 			compute_lhs_analytical(sim,ssi[i],f_ptrs_data);
 		} else {
+			struct Test_Case_c* test_case = (struct Test_Case_c*) sim->test_case_rc->tc;
+			const_cast_b(&test_case->use_schur_complement,false);
+
 			ssi[i] = constructor_Solver_Storage_Implicit_c(sim); // destructed
 
-			struct Test_Case_c* test_case = (struct Test_Case_c*) sim->test_case_rc->tc;
 			test_case->solver_method_curr = f_ptrs_data->solver_method_cmplx;
 
 			perturb_solution(sim);
@@ -255,6 +258,16 @@ static void structor_derived_Elements
 	 const char mode                            ///< Mode of operation. Options: 'c'onstructor, 'd'estructor.
 	);
 
+/** \brief Check that the DPG lhs computed using the complex \ref Simulation\*s cached by \ref get_Simulations_c_dpg
+ *         matches that computed when they were constructed (i.e. by the first call to \ref compute_all_rlhs_dpg).
+ *
+ *  The check is skipped if the complex simulations are not used (see \ref Test_Case_T::bc_hessian). */
+static void check_cached_sims_c_dpg
+	(struct Simulation* sim,                   ///< \ref Simulation.
+	 struct Solver_Storage_Implicit* ssi,      ///< \ref Solver_Storage_Implicit holding the lhs of the first call.
+	 const struct F_Ptrs_and_Data* f_ptrs_data ///< \ref F_Ptrs_and_Data.
+	);
+
 static struct F_Ptrs_and_Data* constructor_F_Ptrs_and_Data (const struct Simulation* sim)
 {
 	struct F_Ptrs_and_Data* f_ptrs_data = malloc(sizeof *f_ptrs_data); // destructed
@@ -332,7 +345,9 @@ static void compute_lhs_analytical
 		}
 		break;
 	case METHOD_DPG:
+		assert(sim->sims_c_dpg == NULL);
 		f_ptrs_data->compute_all_lhs(sim,ssi,sim->volumes);
+		check_cached_sims_c_dpg(sim,ssi,f_ptrs_data);
 		break;
 	case METHOD_OPG:
 		switch (CHECK_LIN) {
@@ -373,8 +388,11 @@ static void check_linearizations
 	(struct Test_Info*const test_info, const struct Solver_Storage_Implicit* ssi[2], const struct Simulation* sim)
 {
 	UNUSED(test_info);
-	bool pass        = true;
-	const double tol = 4e-13;
+	bool pass = true;
+
+	// The finite differences of the analytical Jacobians are only accurate to approximately EPS^(2/3).
+	const struct Test_Case_c*const test_case = (struct Test_Case_c*) sim->test_case_rc->tc;
+	const double tol = ( test_case->bc_hessian == BC_HESSIAN_JACOBIAN_FD ? 1e-8 : 4e-13 );
 
 	const double diff = norm_diff_petsc_Mat(ssi[0]->A,ssi[1]->A,false);
 	if (diff > tol) {
@@ -438,3 +456,25 @@ static void structor_derived_Elements
 		break;
 	}
 }
+
+static void check_cached_sims_c_dpg
+	(struct Simulation* sim, struct Solver_Storage_Implicit* ssi, const struct F_Ptrs_and_Data* f_ptrs_data)
+{
+	if (sim->sims_c_dpg == NULL)
+		return;
+
+	struct Solver_Storage_Implicit*const ssi_cached = constructor_Solver_Storage_Implicit(sim); // destructed
+	f_ptrs_data->compute_all_lhs(sim,ssi_cached,sim->volumes);
+
+	petsc_mat_vec_assemble(ssi);
+	petsc_mat_vec_assemble(ssi_cached);
+
+	// Only differences from the order of the threaded assembly are expected.
+	const double tol  = 1e2*EPS;
+	const double diff = norm_diff_petsc_Mat(ssi->A,ssi_cached->A,false);
+	destructor_Solver_Storage_Implicit(ssi_cached);
+
+	if (diff > tol)
+		printf("cached: % .3e (tol = % .3e).\n",diff,tol);
+	assert_condition_message(diff <= tol,"cached complex simulations");
+}
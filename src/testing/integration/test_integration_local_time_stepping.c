@@ -0,0 +1,208 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_tol.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "volume_solver.h"
+
+#include "matrix.h"
+#include "multiarray.h"
+#include "vector.h"
+
+#include "core.h"
+#include "intrusive.h"
+#include "simulation.h"
+#include "solution.h"
+#include "solve.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+/// The tolerance for the relative difference of the integrals of the conserved variables.
+#define TOL_CONSERVATION (1e3*EPS)
+
+/** The maximum ratio of the difference between the solutions computed with local and global time stepping to the
+ *  change of the solution computed with global time stepping over the simulation. */
+#define TOL_ACCURACY 1e-1
+
+/// \brief Container for the results of an unsteady explicit solve.
+struct LTS_Results {
+	const struct const_Vector_d* sol_coef_0; ///< The concatenated initial solution coefficients.
+	const struct const_Vector_d* sol_coef;   ///< The concatenated solution coefficients at the final time.
+
+	/// The integrals of each of the conserved variables over the domain at the final time.
+	const struct const_Vector_d* integral;
+
+	int n_lts_levels; ///< \ref Solver_Stats::n_lts_levels.
+};
+
+/** \brief Constructor for the \ref LTS_Results of the unsteady explicit solve for the input control file.
+ *  \return See brief. */
+static struct LTS_Results constructor_LTS_Results
+	(const char*const ctrl_name ///< The name of the control file.
+	);
+
+/// \brief Destructor for the members of \ref LTS_Results.
+static void destructor_LTS_Results
+	(const struct LTS_Results*const lts_res ///< \ref LTS_Results.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the explicit local time stepping
+ *        (\ref test_integration_local_time_stepping.c).
+ *  \return 0 on success.
+ *
+ *  The unsteady simulation is solved for the reference control file, using global time stepping, and for the control
+ *  file using multiple levels of local time stepping on the same periodic mesh, whose volumes on the left half of the
+ *  domain are half the width of those on the right half. The test checks that:
+ *  - multiple levels were only used for the second solve;
+ *  - the integrals of the conserved variables over the domain agree to rounding error. As the global time stepping is
+ *    conservative and the domain is periodic, this verifies the conservation of the local time stepping (using the flux
+ *    registers);
+ *  - the solutions agree to a small fraction of the change of the solution over the simulation (the local time stepping
+ *    is only first order accurate in time at the interfaces between the levels).
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 4,"Invalid number of input arguments");
+
+	const char* petsc_options_name = set_petsc_options_name(argv[3]);
+	PetscInitialize(&argc,&argv,petsc_options_name,PETSC_NULL);
+
+	const struct LTS_Results lts_res[2] =
+		{ constructor_LTS_Results(argv[1]), constructor_LTS_Results(argv[2]), }; // destructed
+
+	const double diff_integral = compute_norm_diff_rel_inf_Vector_d(lts_res[0].integral,lts_res[1].integral),
+	             diff_sol      = compute_norm_diff_rel_inf_Vector_d(lts_res[0].sol_coef,lts_res[1].sol_coef),
+	             change_sol    = compute_norm_diff_rel_inf_Vector_d(lts_res[0].sol_coef,lts_res[0].sol_coef_0);
+
+	const bool conservative = diff_integral < TOL_CONSERVATION,
+	           accurate     = diff_sol < TOL_ACCURACY*change_sol;
+	if (!conservative) {
+		printf("Relative difference of the integrals of the conserved variables: % .3e (tol: % .3e).\n",
+		       diff_integral,TOL_CONSERVATION);
+		print_const_Vector_d(lts_res[0].integral);
+		print_const_Vector_d(lts_res[1].integral);
+	}
+	if (!accurate) {
+		printf("Relative difference of the solutions: % .3e (tol: % .3e).\n",
+		       diff_sol,TOL_ACCURACY*change_sol);
+	}
+
+	const int n_lts_levels[2] = { lts_res[0].n_lts_levels, lts_res[1].n_lts_levels, };
+	destructor_LTS_Results(&lts_res[0]);
+	destructor_LTS_Results(&lts_res[1]);
+
+	PetscFinalize();
+
+	assert_condition_message(n_lts_levels[0] == 1,"Local time stepping was used for the reference solve.");
+	assert_condition_message(n_lts_levels[1] > 1,"Local time stepping was not used.");
+	assert_condition_message(conservative,"Not conservative.");
+	assert_condition_message(accurate,"Not accurate.");
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/** \brief Constructor for the \ref const_Vector_T\* holding the integrals of each of the conserved variables over the
+ *         domain.
+ *  \return See brief.
+ *
+ *  The integrals are computed as the sum of the entries of the product of the mass matrix and the solution coefficients
+ *  of each volume, relying on the partition of unity property of the solution basis.
+ */
+static const struct const_Vector_d* constructor_integral_sol
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+static struct LTS_Results constructor_LTS_Results (const char*const ctrl_name)
+{
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name); // destructed
+
+	const int p          = int_test_info->p_ref[0],
+	          ml         = int_test_info->ml[0],
+	          adapt_type = int_test_info->adapt_type;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+
+	struct Simulation* sim = NULL;
+	structor_simulation(&sim,'c',adapt_type,p,ml,p-1,ml-1,ctrl_name_curr,'r',false); // destructed
+
+	struct LTS_Results lts_res;
+
+	set_initial_solution(sim);
+	lts_res.sol_coef_0 = constructor_sol_coef_Vector_d(sim); // destructed
+
+	solve_for_solution(sim);
+	lts_res.sol_coef     = constructor_sol_coef_Vector_d(sim); // destructed
+	lts_res.integral     = constructor_integral_sol(sim);      // destructed
+	lts_res.n_lts_levels = get_solver_stats()->n_lts_levels;
+
+	structor_simulation(&sim,'d',adapt_type,p,ml,p-1,ml-1,NULL,'r',false);
+	destructor_Integration_Test_Info(int_test_info);
+
+	return lts_res;
+}
+
+static void destructor_LTS_Results (const struct LTS_Results*const lts_res)
+{
+	destructor_const_Vector_d(lts_res->sol_coef_0);
+	destructor_const_Vector_d(lts_res->sol_coef);
+	destructor_const_Vector_d(lts_res->integral);
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static const struct const_Vector_d* constructor_integral_sol (const struct Simulation*const sim)
+{
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	const int n_var = test_case->n_var;
+
+	struct Vector_d*const integral = constructor_zero_Vector_d(n_var); // returned
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) curr;
+
+		const struct const_Matrix_d*const mass = constructor_mass(s_vol); // destructed
+		const struct const_Vector_d*const mass_sum = constructor_sum_const_Vector_d_const_Matrix_d('R',mass); // dest.
+		destructor_const_Matrix_d(mass);
+
+		const struct const_Multiarray_d*const s_coef = (struct const_Multiarray_d*) s_vol->sol_coef;
+		assert(s_coef->layout == 'C');
+		assert(s_coef->extents[0] == mass_sum->ext_0);
+		assert(s_coef->extents[1] == n_var);
+
+		for (int var = 0; var < n_var; ++var) {
+			const struct const_Vector_d s_coef_var = { .ext_0 = mass_sum->ext_0, .owns_data = false,
+			                                           .data = get_col_const_Multiarray_d(var,s_coef), };
+			integral->data[var] += dot_product_Vector_d(1.0,mass_sum,&s_coef_var);
+		}
+		destructor_const_Vector_d(mass_sum);
+	}
+	return (struct const_Vector_d*) integral;
+}
@@ -62,6 +62,13 @@ static bool compare_members_Mesh
 	 const struct Mesh*const mesh      ///< \ref Mesh.
 	);
 
+/** \brief Compare members of the \ref Mesh_Data read from the mesh file with those read from the reference mesh file.
+ *  \return 1 if tests passed. */
+static bool compare_members_Mesh_Data
+	(const struct Mesh_Data*const mesh_data,    ///< The \ref Mesh_Data.
+	 const struct Mesh_Data*const mesh_data_ref ///< The reference \ref Mesh_Data.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 /** \test Performs integration testing for the mesh processing (\ref test_integration_mesh.c).
@@ -71,6 +78,9 @@ static bool compare_members_Mesh
  *  - \ref Mesh_Data;
  *  - \ref Mesh_Connectivity;
  *  - \ref Mesh_Vertices.
+ *
+ *  If a reference mesh is passed as an additional argument, the \ref Mesh_Data is instead compared with that read from
+ *  the reference mesh (used to check that the other gmsh file formats are read identically to the 2.2 ascii format).
  */
 int main
 	(int argc,   ///< Standard.
@@ -79,9 +89,10 @@ int main
 {
 	PetscInitialize(&argc,&argv,PETSC_NULL,PETSC_NULL);
 
-	assert_condition_message(argc == 3,"Invalid number of input arguments");
+	assert_condition_message(argc == 3 || argc == 4,"Invalid number of input arguments");
 	const char*const mesh_name = argv[1],
-	          *const ctrl_name = argv[2];
+	          *const ctrl_name = argv[2],
+	          *const mesh_name_ref = ( argc == 4 ? argv[3] : NULL );
 
 	struct Simulation*const sim = constructor_Simulation(ctrl_name);
 	destructor_Simulation(sim);
@@ -91,7 +102,18 @@ int main
 	struct Mesh_Input* mesh_input = constructor_Mesh_Input(mesh_name); // destructed
 	struct Mesh* mesh             = constructor_Mesh(mesh_input,NULL); // destructed
 
-	const bool pass = compare_members_Mesh(&test_info,mesh_input->mesh_name_full,mesh);
+	bool pass = false;
+	if (!mesh_name_ref) {
+		pass = compare_members_Mesh(&test_info,mesh_input->mesh_name_full,mesh);
+	} else {
+		struct Mesh_Input* mesh_input_ref = constructor_Mesh_Input(mesh_name_ref); // destructed
+		struct Mesh* mesh_ref             = constructor_Mesh(mesh_input_ref,NULL); // destructed
+
+		pass = compare_members_Mesh_Data(mesh->mesh_data,mesh_ref->mesh_data);
+
+		destructor_Mesh(mesh_ref);
+		destructor_Mesh_Input(mesh_input_ref);
+	}
 
 	destructor_Mesh(mesh);
 	destructor_Mesh_Input(mesh_input);
@@ -160,9 +182,10 @@ static struct Mesh_Input* constructor_Mesh_Input (const char*const mesh_name)
 	mesh_input->geom_name      = malloc(STRLEN_MAX * sizeof *mesh_input->geom_name);      // free
 	mesh_input->geom_spec      = malloc(STRLEN_MAX * sizeof *mesh_input->geom_spec);      // free
 
-	if (strstr(mesh_name,"blended_2d_mixed.msh")) {
+	// The meshes in the other gmsh file formats are named with a suffix (e.g. "__v41_binary").
+	if (strstr(mesh_name,"blended_2d_mixed")) {
 		set_Mesh_Input_no_sim(mesh_input,2,DOM_BLENDED,true,mesh_name,"n-cylinder_hollow_section","");
-	} else if (strstr(mesh_name,"straight_2d_quad_periodic.msh")) {
+	} else if (strstr(mesh_name,"straight_2d_quad_periodic")) {
 		set_Mesh_Input_no_sim(mesh_input,2,DOM_STRAIGHT,false,mesh_name,"","");
 	} else if (strstr(mesh_name,"parametric_2d_quad_periodic_reflected.msh")) {
 		set_Mesh_Input_no_sim(mesh_input,2,DOM_PARAMETRIC,false,mesh_name,"","");
@@ -264,6 +287,38 @@ static bool compare_members_Mesh
 	return pass;
 }
 
+static bool compare_members_Mesh_Data
+	(const struct Mesh_Data*const mesh_data, const struct Mesh_Data*const mesh_data_ref)
+{
+	bool pass = true;
+
+	const struct Mesh_Data*const md   = mesh_data,
+	                      *const md_r = mesh_data_ref;
+	const bool has_periodic = (md->periodic_corr != NULL);
+	if ((diff_Vector_i((struct Vector_i*)md->elem_per_dim,(struct Vector_i*)md_r->elem_per_dim) != 0)             ||
+	    (diff_Matrix_d((struct Matrix_d*)md->nodes,(struct Matrix_d*)md_r->nodes,NODETOL_MESH) != 0)              ||
+	    (diff_Vector_i((struct Vector_i*)md->elem_types,(struct Vector_i*)md_r->elem_types) != 0)                 ||
+	    (diff_Matrix_i((struct Matrix_i*)md->elem_tags,(struct Matrix_i*)md_r->elem_tags) != 0)                   ||
+	    (diff_Multiarray_Vector_i((struct Multiarray_Vector_i*)md->node_nums,
+	                              (struct Multiarray_Vector_i*)md_r->node_nums) != 0)                             ||
+	    (has_periodic != (md_r->periodic_corr != NULL))                                                           ||
+	    (has_periodic && diff_Matrix_i((struct Matrix_i*)md->periodic_corr,(struct Matrix_i*)md_r->periodic_corr)))
+	{
+		pass = false;
+		expect_condition(pass,"mesh data");
+
+		print_diff_Vector_i((struct Vector_i*)md->elem_per_dim,(struct Vector_i*)md_r->elem_per_dim);
+		print_diff_Matrix_d((struct Matrix_d*)md->nodes,(struct Matrix_d*)md_r->nodes,NODETOL_MESH);
+		print_diff_Vector_i((struct Vector_i*)md->elem_types,(struct Vector_i*)md_r->elem_types);
+		print_diff_Matrix_i((struct Matrix_i*)md->elem_tags,(struct Matrix_i*)md_r->elem_tags);
+		print_diff_Multiarray_Vector_i((struct Multiarray_Vector_i*)md->node_nums,
+		                               (struct Multiarray_Vector_i*)md_r->node_nums);
+		if (has_periodic && md_r->periodic_corr)
+			print_diff_Matrix_i((struct Matrix_i*)md->periodic_corr,(struct Matrix_i*)md_r->periodic_corr);
+	}
+	return pass;
+}
+
 // Level 1 ********************************************************************************************************** //
 
 static void set_Mesh_Input_no_sim
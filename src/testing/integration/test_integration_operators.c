@@ -0,0 +1,302 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "petscsys.h"
+
+#include "test_base.h"
+#include "test_support.h"
+#include "test_support_matrix.h"
+
+#include "macros.h"
+#include "definitions_alloc.h"
+#include "definitions_elements.h"
+#include "definitions_tol.h"
+
+#include "matrix.h"
+#include "multiarray.h"
+
+#include "element.h"
+#include "element_operators.h"
+#include "multiarray_operator.h"
+#include "operator.h"
+#include "simulation.h"
+
+// Static function declarations ************************************************************************************* //
+
+/// \brief Container for the names of the inputs to \ref constructor_operators.
+struct Operator_Names {
+	const char* type;  ///< The name of the operator type.
+	const char* in;    ///< The name of the operator input.
+	const char* out;   ///< The name of the operator output.
+	const char* range; ///< The name of the operator range.
+};
+
+/** \brief Function pointer to a function testing the operators of the given type for an element.
+ *  \return `true` if the test passed; `false` otherwise.
+ *
+ *  \param op_names \ref Operator_Names.
+ *  \param element  \ref const_Element.
+ *  \param sim      \ref Simulation.
+ */
+typedef bool (*test_operators_fptr)
+	(const struct Operator_Names*const op_names,
+	 const struct const_Element*const element,
+	 const struct Simulation*const sim
+	);
+
+/** \brief Run the input test for a selection of the operators used by the solver for each of the present elements whose
+ *         operators are not constructed from tensor-products of sub-element operators.
+ *  \return See \ref test_operators_fptr. */
+static bool test_operators_elements
+	(const test_operators_fptr test_operators, ///< \ref test_operators_fptr.
+	 const struct Simulation*const sim         ///< \ref Simulation.
+	);
+
+/** \brief Version of \ref test_operators_fptr checking that the operators constructed on first access (see
+ *         \ref constructor_operators_lazy) are identical to those constructed with the container.
+ *
+ *  The lazy operators are accessed in reverse order such that the construction of the operators for each derivative
+ *  group is triggered by the last of its members.
+ */
+static bool test_operators_lazy
+	(const struct Operator_Names*const op_names, ///< See brief.
+	 const struct const_Element*const element,  ///< See brief.
+	 const struct Simulation*const sim          ///< See brief.
+	);
+
+/** \brief Version of \ref test_operators_fptr checking that the operators read from the operator cache (see
+ *         \ref operator_cache.h) are identical to those computed without the cache.
+ *
+ *  The operators are constructed three times: without the cache (the reference), with an empty cache (such that the
+ *  operators are computed and written) and again with the cache (such that all operators are read from the files
+ *  written in the previous step).
+ */
+static bool test_operators_cache
+	(const struct Operator_Names*const op_names, ///< See brief.
+	 const struct const_Element*const element,  ///< See brief.
+	 const struct Simulation*const sim          ///< See brief.
+	);
+
+/** \brief Get the statically allocated name of the directory used for the operator cache test.
+ *  \return See brief. */
+static const char* get_op_cache_dir_test ( );
+
+/// \brief Remove the operator cache directory used for the test along with all of its files.
+static void remove_op_cache_dir_test ( );
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the construction of the element operators
+ *        (\ref test_integration_operators.c).
+ *  \return 0 on success.
+ *
+ *  The following tests are available:
+ *  - "lazy": operators constructed on first access are compared with those constructed with the container;
+ *  - "cache": operators written to and read back from the operator cache are compared with those computed directly.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	PetscInitialize(&argc,&argv,PETSC_NULL,PETSC_NULL);
+
+	assert_condition_message(argc == 3,"Invalid number of input arguments");
+	const char* test_name = argv[1];
+	const char* ctrl_name = argv[2];
+
+	struct Test_Info test_info = { .n_warn = 0, };
+
+	struct Simulation*const sim = constructor_Simulation(ctrl_name); // destructed
+
+	bool pass = false;
+	if (strcmp(test_name,"lazy") == 0) {
+		pass = test_operators_elements(test_operators_lazy,sim);
+	} else if (strcmp(test_name,"cache") == 0) {
+		assert(get_set_op_cache_dir(NULL)[0] == '\0');
+		pass = test_operators_elements(test_operators_cache,sim);
+		remove_op_cache_dir_test();
+	} else {
+		EXIT_ERROR("Invalid test name: %s\n",test_name);
+	}
+
+	destructor_Simulation(sim);
+
+	assert_condition_message(pass,test_name);
+	output_warning_count(&test_info);
+
+	PetscFinalize();
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/** \brief Check whether the standard operators of the two input \ref Multiarray_Operator\*s are identical, printing
+ *         the difference for any which are not.
+ *  \return `true` if identical; `false` otherwise.
+ *
+ *  Operators which are not set in `op_a` (those not included in the operator range) are not accessed in `op_b`.
+ */
+static bool check_equal_Multiarray_Operator
+	(const struct Multiarray_Operator*const op_a, ///< Input 0.
+	 const struct Multiarray_Operator*const op_b, ///< Input 1.
+	 const bool reverse                           ///< Flag for whether the operators should be accessed in reverse.
+	);
+
+static bool test_operators_elements (const test_operators_fptr test_operators, const struct Simulation*const sim)
+{
+	static const struct Operator_Names op_names[] =
+		{ { .type = "cv0", .in = "vsA", .out = "vcs", .range = "H_CF_P_PM1", },
+		  { .type = "cv1", .in = "vtA", .out = "vcc", .range = "H_1_P_PM0",  },
+		  { .type = "tw1", .in = "vtA", .out = "vcc", .range = "H_1_P_PM0",  },
+		  { .type = "cv0", .in = "vgs", .out = "vsA", .range = "H_1_P_1P",   },
+		  { .type = "cv0", .in = "vgc", .out = "vsA", .range = "H_1_P_PM0",  },
+		  { .type = "cv0", .in = "vsA", .out = "fcc", .range = "H_CF_P_PM1", },
+		  { .type = "tw0", .in = "vtA", .out = "fcs", .range = "H_CF_P_PM1", },
+		};
+	const int n_op_names = (int)(sizeof(op_names)/sizeof(*op_names));
+
+	bool pass = true;
+	for (const struct const_Intrusive_Link* curr = sim->elements->first; curr; curr = curr->next) {
+		const struct const_Element*const element = (const struct const_Element*) curr;
+		if (!element->present)
+			continue;
+
+		switch (element->type) {
+		case LINE: case TRI: case TET: case PYR:
+			for (int i = 0; i < n_op_names; ++i) {
+				if (!test_operators(&op_names[i],element,sim)) {
+					printf("Operators: %s_%s_%s (%s), element type: %d.\n",
+					       op_names[i].type,op_names[i].in,op_names[i].out,op_names[i].range,element->type);
+					pass = false;
+				}
+			}
+			break;
+		default:
+			break; // The operators are constructed from the sub-element operators.
+		}
+	}
+	return pass;
+}
+
+static bool test_operators_lazy
+	(const struct Operator_Names*const op_names, const struct const_Element*const element,
+	 const struct Simulation*const sim)
+{
+	const struct Operator_Names*const o = op_names;
+	const struct Multiarray_Operator*const op_e = constructor_operators(o->type,o->in,o->out,o->range,element,sim);
+	const struct Multiarray_Operator*const op_l =
+		constructor_operators_lazy(o->type,o->in,o->out,o->range,element,sim);
+
+	const bool pass = check_equal_Multiarray_Operator(op_e,op_l,true);
+
+	destructor_Multiarray_Operator(op_e);
+	destructor_Multiarray_Operator(op_l);
+	return pass;
+}
+
+static bool test_operators_cache
+	(const struct Operator_Names*const op_names, const struct const_Element*const element,
+	 const struct Simulation*const sim)
+{
+	const struct Operator_Names*const o = op_names;
+
+	get_set_op_cache_dir("");
+	const struct Multiarray_Operator*const op_r = constructor_operators(o->type,o->in,o->out,o->range,element,sim);
+
+	get_set_op_cache_dir(get_op_cache_dir_test());
+	const struct Multiarray_Operator*const op_w = constructor_operators(o->type,o->in,o->out,o->range,element,sim),
+	                                *const op_c = constructor_operators(o->type,o->in,o->out,o->range,element,sim);
+	get_set_op_cache_dir("");
+
+	bool pass = check_equal_Multiarray_Operator(op_r,op_w,false) && check_equal_Multiarray_Operator(op_r,op_c,false);
+
+	const ptrdiff_t size = compute_size(op_c->order,op_c->extents);
+	for (ptrdiff_t ind = 0; ind < size; ++ind) {
+		if (op_r->data[ind]->op_std == NULL)
+			continue;
+
+		if (op_w->data[ind]->op_std_map != NULL || op_c->data[ind]->op_std_map == NULL) {
+			printf("Operator index: %td was %s.\n",ind,(op_c->data[ind]->op_std_map ? "not written" : "not read"));
+			pass = false;
+		}
+	}
+
+	destructor_Multiarray_Operator(op_r);
+	destructor_Multiarray_Operator(op_w);
+	destructor_Multiarray_Operator(op_c);
+	return pass;
+}
+
+static const char* get_op_cache_dir_test ( )
+{
+	static char op_cache_dir[STRLEN_MIN] = "";
+	if (op_cache_dir[0] == '\0')
+		sprintf(op_cache_dir,"op_cache_test_%ld",(long)getpid());
+	return op_cache_dir;
+}
+
+static void remove_op_cache_dir_test ( )
+{
+	const char*const op_cache_dir = get_op_cache_dir_test();
+	DIR*const dir = opendir(op_cache_dir);
+	if (dir == NULL)
+		return;
+
+	char file_name[STRLEN_MAX];
+	for (const struct dirent* entry = readdir(dir); entry; entry = readdir(dir)) {
+		if (strcmp(entry->d_name,".") == 0 || strcmp(entry->d_name,"..") == 0)
+			continue;
+		snprintf(file_name,STRLEN_MAX,"%s/%s",op_cache_dir,entry->d_name);
+		remove(file_name);
+	}
+	closedir(dir);
+	rmdir(op_cache_dir);
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static bool check_equal_Multiarray_Operator
+	(const struct Multiarray_Operator*const op_a, const struct Multiarray_Operator*const op_b, const bool reverse)
+{
+	assert(op_a->order == op_b->order);
+	for (int i = 0; i < op_a->order; ++i)
+		assert(op_a->extents[i] == op_b->extents[i]);
+
+	bool pass = true;
+	const ptrdiff_t size = compute_size(op_a->order,op_a->extents);
+	for (ptrdiff_t j = 0; j < size; ++j) {
+		const ptrdiff_t ind = ( reverse ? size-1-j : j );
+		if (op_a->data[ind]->op_std == NULL)
+			continue;
+
+		const struct const_Matrix_d*const op_std_a = get_Multiarray_Operator_ind(op_a,ind)->op_std,
+		                           *const op_std_b = get_Multiarray_Operator_ind(op_b,ind)->op_std;
+		if (diff_const_Matrix_d(op_std_a,op_std_b,EPS)) {
+			printf("Operator index: %td.\n",ind);
+			print_diff_const_Matrix_d(op_std_a,op_std_b,EPS);
+			pass = false;
+		}
+	}
+	return pass;
+}
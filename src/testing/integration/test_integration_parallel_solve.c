@@ -0,0 +1,183 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include "mpi.h"
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+#include "definitions_alloc.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "vector.h"
+
+#include "core.h"
+#include "file_processing.h"
+#include "simulation.h"
+#include "solve.h"
+
+// Static function declarations ************************************************************************************* //
+
+/** The tolerance for the relative difference between the serial and parallel solutions. The preconditioners differ
+ *  depending on the number of processes (block Jacobi) such that the solutions only agree to the nonlinear solver
+ *  tolerance. */
+#define TOL_PARALLEL 1e-10
+
+/** \brief Get the name of the file holding the solution coefficients computed using a single process.
+ *  \return See brief. */
+static const char* get_file_name_sol_coef_serial
+	(const char*const ctrl_name ///< The name of the control file.
+	);
+
+/// \brief Output the input solution coefficients to the file (only on the master process).
+static void output_sol_coef
+	(const struct const_Vector_d*const sol_coef, ///< The solution coefficients.
+	 const char*const ctrl_name                  ///< The name of the control file.
+	);
+
+/** \brief Constructor for a \ref const_Vector_T\* holding the solution coefficients read from the file output by
+ *         \ref output_sol_coef.
+ *  \return See brief. */
+static const struct const_Vector_d* constructor_sol_coef_serial
+	(const char*const ctrl_name ///< The name of the control file.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the solution computed using multiple mpi processes
+ *        (\ref test_integration_parallel_solve.c).
+ *  \return 0 on success (when the parallel solution agrees with the serial solution).
+ *
+ *  The test is run in two stages:
+ *  - "serial": the simulation is solved using a single process and the solution coefficients are output;
+ *  - "mpi":    the simulation is solved using multiple processes and the solution coefficients (which are replicated
+ *              on all processes, see \ref partition.h) are compared with those of the serial solve.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 4,"Invalid number of input arguments");
+
+	const char* petsc_options_name = set_petsc_options_name(argv[3]);
+	PetscInitialize(&argc,&argv,petsc_options_name,PETSC_NULL);
+
+	const char*const mode      = argv[1],
+	          *const ctrl_name = argv[2];
+
+	int mpi_size = -1;
+	MPI_Comm_size(MPI_COMM_WORLD,&mpi_size);
+
+	const bool is_serial = (strcmp(mode,"serial") == 0);
+	if (is_serial)
+		assert_condition_message(mpi_size == 1,"The serial solve must be run on a single process");
+	else if (strcmp(mode,"mpi") == 0)
+		assert_condition_message(mpi_size > 1,"The parallel solve must be run on multiple processes");
+	else
+		EXIT_ERROR("Unsupported: %s\n",mode);
+
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name);
+
+	const int p  = int_test_info->p_ref[0],
+	          ml = int_test_info->ml[0],
+	          adapt_type = int_test_info->adapt_type;
+
+	struct Simulation* sim = NULL;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+	structor_simulation(&sim,'c',adapt_type,p,ml,p-1,ml-1,ctrl_name_curr,'r',false); // destructed
+
+	solve_for_solution(sim);
+	const struct const_Vector_d*const sol_coef = constructor_sol_coef_Vector_d(sim); // destructed
+
+	structor_simulation(&sim,'d',ADAPT_0,p,ml,p-1,ml-1,NULL,'r',false);
+
+	bool pass = true;
+	if (is_serial) {
+		output_sol_coef(sol_coef,ctrl_name);
+	} else {
+		const struct const_Vector_d*const sol_coef_s = constructor_sol_coef_serial(ctrl_name); // destructed
+
+		pass = (sol_coef->ext_0 == sol_coef_s->ext_0);
+		if (pass) {
+			const double norm_diff = compute_norm_diff_rel_inf_Vector_d(sol_coef_s,sol_coef);
+			pass = (norm_diff < TOL_PARALLEL);
+			if (!pass)
+				printf("Relative difference of the serial and parallel solutions: % .3e (tol: % .3e).\n",
+				       norm_diff,TOL_PARALLEL);
+		}
+		destructor_const_Vector_d(sol_coef_s);
+	}
+	destructor_const_Vector_d(sol_coef);
+
+	destructor_Integration_Test_Info(int_test_info);
+
+	PetscFinalize();
+
+	assert_condition(pass);
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static const char* get_file_name_sol_coef_serial (const char*const ctrl_name)
+{
+	static char file_name[STRLEN_MAX];
+	sprintf(file_name,"%s%s%s","../output/parallel_solve/sol_coef__",extract_name(ctrl_name,false),".txt");
+	return file_name;
+}
+
+static void output_sol_coef (const struct const_Vector_d*const sol_coef, const char*const ctrl_name)
+{
+	int mpi_rank = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD,&mpi_rank);
+	if (mpi_rank != 0)
+		return;
+
+	FILE* file = fopen_create_dir(get_file_name_sol_coef_serial(ctrl_name)); // closed
+	fprintf(file,"%td\n",sol_coef->ext_0);
+	for (ptrdiff_t i = 0; i < sol_coef->ext_0; ++i)
+		fprintf(file,"% .17e\n",sol_coef->data[i]);
+	fclose(file);
+}
+
+static const struct const_Vector_d* constructor_sol_coef_serial (const char*const ctrl_name)
+{
+	FILE* file = fopen_checked(get_file_name_sol_coef_serial(ctrl_name)); // closed
+
+	char line[STRLEN_MAX];
+	ptrdiff_t ext_0 = 0;
+	fgets_checked(line,sizeof(line),file);
+	if (sscanf(line,"%td",&ext_0) != 1)
+		EXIT_ERROR("Failed to read the number of solution coefficients.\n");
+
+	struct Vector_d*const sol_coef = constructor_empty_Vector_d(ext_0); // returned
+	for (ptrdiff_t i = 0; i < ext_0; ++i) {
+		fgets_checked(line,sizeof(line),file);
+		if (sscanf(line,"%lf",&sol_coef->data[i]) != 1)
+			EXIT_ERROR("Failed to read solution coefficient %td.\n",i);
+	}
+	fclose(file);
+
+	return (const struct const_Vector_d*) sol_coef;
+}
@@ -0,0 +1,433 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "gsl/gsl_math.h"
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+#include "definitions_mesh.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "face.h"
+#include "face_solver.h"
+#include "volume.h"
+#include "volume_solver.h"
+
+#include "multiarray.h"
+
+#include "adaptation.h"
+#include "const_cast.h"
+#include "core.h"
+#include "intrusive.h"
+#include "reordering.h"
+#include "simulation.h"
+#include "solve.h"
+
+// Static function declarations ************************************************************************************* //
+
+/// \brief Container for measures of the bandwidth of the global system matrix.
+struct Bandwidth {
+	ptrdiff_t max; ///< The bandwidth.
+	double mean;   ///< The average over the rows of the distance of the last non-zero entry from the diagonal.
+};
+
+/** \brief Shuffle the volumes and faces, updating their indices and the global dof indices.
+ *
+ *  The position of each link in the shuffled list is set to a multiple of a stride which is coprime with the number of
+ *  links such that neighbouring elements are generally far apart in the shuffled list.
+ */
+static void shuffle_computational_elements
+	(struct Simulation*const sim ///< Standard.
+	);
+
+/// \brief Reorder the computational elements, updating the face colouring and the dof indices as in \ref adapt_hp.
+static void reorder_computational_elements_full
+	(struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Check that the volumes and faces are a permutation of those of the input arrays (if present) and that their
+ *         indices and global dof indices are consistent with the order of the lists, printing the failures.
+ *  \return `true` if the checks pass; `false` otherwise. */
+static bool check_order
+	(const struct Simulation*const sim,             ///< Standard.
+	 struct Intrusive_Link*const*const volumes_ref, ///< The volumes before reordering (or `NULL`).
+	 const ptrdiff_t n_v_ref,                       ///< The number of volumes before reordering.
+	 struct Intrusive_Link*const*const faces_ref,   ///< The faces before reordering (or `NULL`).
+	 const ptrdiff_t n_f_ref                        ///< The number of faces before reordering.
+	);
+
+/** \brief Compute the \ref Bandwidth of the volume coupling of the global system matrix for the current dof indices.
+ *  \return See brief. */
+static struct Bandwidth compute_bandwidth
+	(const struct Simulation*const sim ///< Standard.
+	);
+
+/** \brief Check whether the \ref Bandwidth of the ordered mesh is smaller than that of the shuffled mesh, printing the
+ *         failures.
+ *  \return `true` if the check passes; `false` otherwise.
+ *
+ *  The maximum bandwidth is only required to be reduced for the \ref REORDER_RCM ordering as the space-filling curves
+ *  generally have some neighbouring volumes at the extremities of the curve.
+ */
+static bool check_bandwidth
+	(const struct Bandwidth*const bw,         ///< The bandwidth of the ordered mesh.
+	 const struct Bandwidth*const bw_shuffle, ///< The bandwidth of the shuffled mesh.
+	 const int reorder_type                   ///< \ref Simulation::reorder_type.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the reordering of the computational elements
+ *        (\ref test_integration_reordering.c).
+ *  \return 0 on success.
+ *
+ *  For each of the \ref REORDER_HILBERT, \ref REORDER_MORTON and \ref REORDER_RCM options, the volumes and faces of
+ *  the mesh are shuffled and then reordered. The test checks that:
+ *  - the reordered volumes and faces are a permutation of the shuffled volumes and faces;
+ *  - \ref Volume::index, \ref Face::index and the global dof indices are consistent with the order of the lists and
+ *    the faces are ordered by their neighbouring volumes;
+ *  - the bandwidth of the global system matrix is reduced with respect to that of the shuffled mesh (see
+ *    \ref check_bandwidth).
+ *
+ *  The mesh is then h-refined using \ref adapt_hp, which re-runs the reordering, and the checks are repeated for the
+ *  refined mesh (using a shuffled copy of the refined mesh as the reference for the bandwidth).
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 3,"Invalid number of input arguments");
+
+	const char* petsc_options_name = set_petsc_options_name(argv[2]);
+	PetscInitialize(&argc,&argv,petsc_options_name,PETSC_NULL);
+
+	const char* ctrl_name = argv[1];
+
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name);
+
+	const int p  = int_test_info->p_ref[0],
+	          ml = int_test_info->ml[0],
+	          p_prev  = p-1,
+	          ml_prev = ml-1;
+
+	const int adapt_type = int_test_info->adapt_type;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+
+	struct Simulation* sim = NULL;
+	structor_simulation(&sim,'c',adapt_type,p,ml,p_prev,ml_prev,ctrl_name_curr,'r',false); // destructed
+
+	const int reorder_types[] = { REORDER_HILBERT, REORDER_MORTON, REORDER_RCM, };
+	const int n_r = (int)(sizeof(reorder_types)/sizeof(*reorder_types));
+	assert_condition_message(sim->ml[1]-ml >= n_r,"The mesh must be h-refined once for each of the options.");
+
+	bool pass = true;
+	for (int r = 0; r < n_r; ++r) {
+		const int reorder_type = reorder_types[r];
+		const_cast_i(&sim->reorder_type,reorder_type);
+		printf("Reorder type: %d.\n",reorder_type);
+
+		shuffle_computational_elements(sim);
+		const struct Bandwidth bw_shuffle = compute_bandwidth(sim);
+
+		ptrdiff_t n_v = 0,
+		          n_f = 0;
+		struct Intrusive_Link**const volumes = constructor_array_Link(sim->volumes,&n_v); // free
+		struct Intrusive_Link**const faces   = constructor_array_Link(sim->faces,&n_f);   // free
+
+		reorder_computational_elements_full(sim);
+		const struct Bandwidth bw = compute_bandwidth(sim);
+		if (!check_order(sim,volumes,n_v,faces,n_f))
+			pass = false;
+		if (!check_bandwidth(&bw,&bw_shuffle,reorder_type))
+			pass = false;
+		free(volumes);
+		free(faces);
+
+		adapt_hp(sim,ADAPT_S_H_REFINE,NULL);
+		const struct Bandwidth bw_adapt = compute_bandwidth(sim);
+		if (!check_order(sim,NULL,0,NULL,0))
+			pass = false;
+
+		shuffle_computational_elements(sim);
+		const struct Bandwidth bw_adapt_shuffle = compute_bandwidth(sim);
+		if (!check_bandwidth(&bw_adapt,&bw_adapt_shuffle,reorder_type))
+			pass = false;
+	}
+
+	structor_simulation(&sim,'d',ADAPT_0,p,ml,p_prev,ml_prev,NULL,'r',false);
+	destructor_Integration_Test_Info(int_test_info);
+
+	PetscFinalize();
+
+	assert_condition(pass);
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/// \brief Relink the input list in the order of the input array of links.
+static void relink_list
+	(struct Intrusive_List*const lst,         ///< The list.
+	 struct Intrusive_Link*const*const links, ///< The links in the new order.
+	 const ptrdiff_t n_l                      ///< The number of links.
+	);
+
+/** \brief Constructor for an array of the links of the input list in the shuffled order (see
+ *         \ref shuffle_computational_elements).
+ *  \return See brief. */
+static struct Intrusive_Link** constructor_links_shuffled
+	(const struct Intrusive_List*const lst, ///< The list.
+	 ptrdiff_t*const n_l                    ///< Set to the number of links in the list.
+	);
+
+static void shuffle_computational_elements (struct Simulation*const sim)
+{
+	struct Intrusive_List*const lists[] = { sim->volumes, sim->faces, };
+	for (int i = 0; i < 2; ++i) {
+		ptrdiff_t n_l = 0;
+		struct Intrusive_Link**const links = constructor_links_shuffled(lists[i],&n_l); // free
+		relink_list(lists[i],links,n_l);
+		free(links);
+	}
+	update_index_volumes(sim);
+	update_index_faces(sim);
+	update_Face_Colouring(sim);
+	update_ind_dof_d(sim);
+}
+
+static void reorder_computational_elements_full (struct Simulation*const sim)
+{
+	reorder_computational_elements(sim);
+	update_Face_Colouring(sim);
+	update_ind_dof_d(sim);
+}
+
+static bool check_order
+	(const struct Simulation*const sim, struct Intrusive_Link*const*const volumes_ref, const ptrdiff_t n_v_ref,
+	 struct Intrusive_Link*const*const faces_ref, const ptrdiff_t n_f_ref)
+{
+	bool pass = true;
+
+	ptrdiff_t n_v = 0,
+	          n_f = 0;
+	struct Intrusive_Link**const volumes = constructor_array_Link(sim->volumes,&n_v); // free
+	struct Intrusive_Link**const faces   = constructor_array_Link(sim->faces,&n_f);   // free
+
+	// Permutation
+	if (volumes_ref) {
+		bool pass_perm = (n_v == n_v_ref);
+		for (ptrdiff_t v = 0; pass_perm && v < n_v; ++v) {
+			const int index = ((struct Volume*)volumes_ref[v])->index;
+			if (index < 0 || index >= n_v || volumes[index] != volumes_ref[v])
+				pass_perm = false;
+		}
+		if (!pass_perm) {
+			pass = false;
+			printf("The reordered volumes are not a permutation of the input volumes.\n");
+		}
+	}
+	if (faces_ref) {
+		bool pass_perm = (n_f == n_f_ref);
+		for (ptrdiff_t f = 0; pass_perm && f < n_f; ++f) {
+			const int index = ((struct Face*)faces_ref[f])->index;
+			if (index < 0 || index >= n_f || faces[index] != faces_ref[f])
+				pass_perm = false;
+		}
+		if (!pass_perm) {
+			pass = false;
+			printf("The reordered faces are not a permutation of the input faces.\n");
+		}
+	}
+
+	// Indices
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		const struct Volume*const vol = (struct Volume*) volumes[v];
+		if (vol->index != v) {
+			pass = false;
+			printf("Volume at position %td has index %d.\n",v,vol->index);
+		}
+	}
+
+	int ind_v_prev[2] = { -1, -1, };
+	for (ptrdiff_t f = 0; f < n_f; ++f) {
+		const struct Face*const face = (struct Face*) faces[f];
+		if (face->index != f) {
+			pass = false;
+			printf("Face at position %td has index %d.\n",f,face->index);
+		}
+
+		const int ind_0 = face->neigh_info[0].volume->index,
+		          ind_1 = ( face->neigh_info[1].volume ? face->neigh_info[1].volume->index : ind_0 );
+		const int ind_v[2] = { GSL_MIN(ind_0,ind_1), GSL_MAX(ind_0,ind_1), };
+		if (ind_v[0] < ind_v_prev[0] || (ind_v[0] == ind_v_prev[0] && ind_v[1] < ind_v_prev[1])) {
+			pass = false;
+			printf("Face %td (volumes: %d %d) is not ordered by its neighbouring volumes.\n",f,ind_v[0],ind_v[1]);
+		}
+		ind_v_prev[0] = ind_v[0];
+		ind_v_prev[1] = ind_v[1];
+	}
+
+	// Degrees of freedom
+	ptrdiff_t dof = 0;
+	for (ptrdiff_t f = 0; f < n_f; ++f) {
+		const struct Solver_Face*const s_face = (struct Solver_Face*) faces[f];
+		const struct Multiarray_d*const nf_coef = s_face->nf_coef;
+		const ptrdiff_t size = compute_size(nf_coef->order,nf_coef->extents);
+		if (size == 0)
+			continue;
+
+		if (s_face->ind_dof != dof) {
+			pass = false;
+			printf("Face %td has dof index %td (expected: %td).\n",f,s_face->ind_dof,dof);
+		}
+		dof += size;
+	}
+
+	dof = ( n_v > 0 ? ((struct Solver_Volume*)volumes[0])->ind_dof : 0 );
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		const struct Solver_Volume*const s_vol = (struct Solver_Volume*) volumes[v];
+		if (s_vol->ind_dof != dof) {
+			pass = false;
+			printf("Volume %td has dof index %td (expected: %td).\n",v,s_vol->ind_dof,dof);
+		}
+		const struct Multiarray_d*const sol_coef = s_vol->sol_coef;
+		dof += compute_size(sol_coef->order,sol_coef->extents);
+	}
+	if (dof != compute_dof(sim)) {
+		pass = false;
+		printf("The volume dof end at %td (expected: %td).\n",dof,compute_dof(sim));
+	}
+
+	free(volumes);
+	free(faces);
+	return pass;
+}
+
+static struct Bandwidth compute_bandwidth (const struct Simulation*const sim)
+{
+	const ptrdiff_t n_v = compute_n_volumes(sim);
+	ptrdiff_t*const bw_v = calloc((size_t)n_v,sizeof *bw_v); // free
+
+	for (struct Intrusive_Link* curr = sim->faces->first; curr; curr = curr->next) {
+		const struct Face*const face = (struct Face*) curr;
+		if (face->neigh_info[1].volume == NULL)
+			continue;
+
+		const struct Solver_Volume*const s_vol[2] = { (struct Solver_Volume*) face->neigh_info[0].volume,
+		                                              (struct Solver_Volume*) face->neigh_info[1].volume, };
+		for (int i = 0; i < 2; ++i) {
+			// Distance of the last column of the neighbouring block from the diagonal for the rows of the volume.
+			const struct Multiarray_d*const sol_coef[2] = { s_vol[i]->sol_coef, s_vol[1-i]->sol_coef, };
+			const ptrdiff_t n_dof[2] = { compute_size(sol_coef[0]->order,sol_coef[0]->extents),
+			                             compute_size(sol_coef[1]->order,sol_coef[1]->extents), };
+			const ptrdiff_t ind_dof[2] = { s_vol[i]->ind_dof, s_vol[1-i]->ind_dof, };
+
+			const ptrdiff_t bw = ( ind_dof[1] > ind_dof[0] ? ind_dof[1]+n_dof[1]-ind_dof[0]-1
+			                                               : ind_dof[0]+n_dof[0]-ind_dof[1]-1 );
+			const int index = ((struct Volume*)s_vol[i])->index;
+			bw_v[index] = GSL_MAX(bw_v[index],bw);
+		}
+	}
+
+	struct Bandwidth bandwidth = { .max = 0, .mean = 0.0, };
+	for (ptrdiff_t v = 0; v < n_v; ++v) {
+		bandwidth.max   = GSL_MAX(bandwidth.max,bw_v[v]);
+		bandwidth.mean += (double)bw_v[v];
+	}
+	bandwidth.mean /= (double)n_v;
+	free(bw_v);
+
+	return bandwidth;
+}
+
+static bool check_bandwidth
+	(const struct Bandwidth*const bw, const struct Bandwidth*const bw_shuffle, const int reorder_type)
+{
+	printf("Bandwidth (max/mean): %td/%.2f (shuffled: %td/%.2f).\n",bw->max,bw->mean,bw_shuffle->max,bw_shuffle->mean);
+
+	bool pass = (bw->mean < bw_shuffle->mean);
+	if (reorder_type == REORDER_RCM && !(bw->max < bw_shuffle->max))
+		pass = false;
+
+	if (!pass)
+		printf("The bandwidth was not reduced.\n");
+	return pass;
+}
+
+// Level 1 ********************************************************************************************************** //
+
+/** \brief Compute the greatest common divisor of the inputs.
+ *  \return See brief. */
+static ptrdiff_t compute_gcd
+	(ptrdiff_t a, ///< The first input.
+	 ptrdiff_t b  ///< The second input.
+	);
+
+static void relink_list
+	(struct Intrusive_List*const lst, struct Intrusive_Link*const*const links, const ptrdiff_t n_l)
+{
+	struct Intrusive_Link* prev = NULL;
+	for (ptrdiff_t i = 0; i < n_l; ++i) {
+		struct Intrusive_Link*const curr = links[i];
+		curr->prev = prev;
+		if (prev)
+			prev->next = curr;
+		else
+			lst->first = curr;
+		prev = curr;
+	}
+	if (prev)
+		prev->next = NULL;
+	lst->last = prev;
+}
+
+static struct Intrusive_Link** constructor_links_shuffled (const struct Intrusive_List*const lst, ptrdiff_t*const n_l)
+{
+	struct Intrusive_Link**const links = constructor_array_Link(lst,n_l); // free
+
+	const ptrdiff_t n = *n_l;
+	ptrdiff_t stride = GSL_MAX(n/3,1);
+	while (compute_gcd(stride,n) != 1)
+		++stride;
+
+	struct Intrusive_Link**const links_s = malloc((size_t)n * sizeof *links_s); // returned
+	for (ptrdiff_t i = 0; i < n; ++i)
+		links_s[i] = links[(i*stride)%n];
+	free(links);
+
+	return links_s;
+}
+
+// Level 2 ********************************************************************************************************** //
+
+static ptrdiff_t compute_gcd (ptrdiff_t a, ptrdiff_t b)
+{
+	while (b != 0) {
+		const ptrdiff_t t = a%b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
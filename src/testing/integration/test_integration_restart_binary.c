@@ -0,0 +1,170 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+#include "definitions_restart.h"
+#include "definitions_tol.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "file_processing.h"
+#include "mapped_file.h"
+#include "restart_writers.h"
+#include "simulation.h"
+#include "solution.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+/** \brief Check whether the solution coefficients stored in the binary restart file are identical to those of the text
+ *         restart file (up to the precision of the text format), printing the first difference if not.
+ *  \return `true` if identical; `false` otherwise. */
+static bool check_equal_restart_binary_text
+	(const char*const name_b, ///< The name of the binary restart file.
+	 const char*const name_t  ///< The name of the text restart file.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the binary restart file format (\ref test_integration_restart_binary.c).
+ *  \return 0 on success.
+ *
+ *  The analytical solution on the finest mesh level and polynomial order is output in both the binary and the text
+ *  format and the solution coefficients read back from the binary file are compared with those of the text file. The
+ *  binary restart file is output last such that it may subsequently be used for \ref test_integration_restart.c.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	PetscInitialize(&argc,&argv,PETSC_NULL,PETSC_NULL);
+	assert_condition_message(argc == 2,"Invalid number of input arguments");
+
+	const char*const ctrl_name = argv[1];
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name); // destructed
+
+	const int p  = int_test_info->p_ref[0];
+	const int ml = int_test_info->ml[0];
+	const int p_prev  = p-1;
+	const int ml_prev = ml-1;
+
+	const int adapt_type = int_test_info->adapt_type;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+
+	struct Simulation* sim = NULL;
+	const char type_rc = 'r';
+	structor_simulation(&sim,'c',adapt_type,p,ml,p_prev,ml_prev,ctrl_name_curr,type_rc,true); // destructed
+
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	assert_condition_message(test_case->has_analytical && outputting_restart() && get_set_restart_binary(NULL),
+	                         "This test requires a binary restart output test case having an analytical solution.");
+
+	adapt_to_maximum_refinement(sim,int_test_info);
+	set_initial_solution(sim);
+
+	char name_b[STRLEN_MAX] = { 0, },
+	     name_t[STRLEN_MAX] = { 0, };
+	strcpy(name_b,compute_restart_name(RESTART_BINARY,sim));
+	strcpy(name_t,compute_restart_name(RESTART_GMSH,sim));
+
+	// The text output overwrites the gmsh file of the binary output but not the binary file.
+	const bool binary[] = { true, false, };
+	for (int i = 0; i < 2; ++i) {
+		get_set_restart_binary(&binary[i]);
+		output_restart(sim);
+	}
+	const bool pass = check_equal_restart_binary_text(name_b,name_t);
+
+	get_set_restart_binary(&binary[0]);
+	output_restart(sim);
+
+	structor_simulation(&sim,'d',ADAPT_0,p,ml,p_prev,ml_prev,NULL,type_rc,false);
+	destructor_Integration_Test_Info(int_test_info);
+
+	assert_condition(pass);
+
+	PetscFinalize();
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static bool check_equal_restart_binary_text (const char*const name_b, const char*const name_t)
+{
+	const struct Mapped_File*const m_file = constructor_Mapped_File(name_b); // destructed
+	assert_condition_message(m_file != NULL,"Could not open the binary restart file.");
+
+	const struct Restart_Bin_Header*const header = m_file->data;
+	assert_condition(m_file->size >= sizeof *header);
+	assert_condition(memcmp(header->magic,RESTART_BIN_MAGIC,sizeof header->magic) == 0);
+	assert_condition(header->version == RESTART_BIN_VERSION && header->flags == RESTART_BIN_FLAG_NONE);
+	const struct Restart_Bin_Volume*const vols_b = (const struct Restart_Bin_Volume*) &header[1];
+
+	FILE* file = fopen_checked(name_t); // closed
+	char*const line = malloc(LINELEN_MAX * sizeof *line); // free
+	while (fgets(line,LINELEN_MAX,file) && !strstr(line,"$SolutionCoefficients"))
+		;
+	fgets_checked(line,LINELEN_MAX,file);
+	const ptrdiff_t n_v = strtol(line,NULL,10);
+
+	bool pass = (n_v == header->n_v);
+	for (ptrdiff_t v = 0; pass && v < n_v; ++v) {
+		fgets_checked(line,LINELEN_MAX,file);
+		char* line_p = line;
+		discard_line_values(&line_p,1);
+
+		int data_i[3] = { 0, };
+		read_line_values_i(&line_p,3,data_i,false);
+
+		const struct Restart_Bin_Volume*const vol_b = &vols_b[v];
+		if (data_i[0] != vol_b->p_ref || data_i[1] != vol_b->ext_0 || data_i[2] != vol_b->ext_1) {
+			printf("Volume %td: Inconsistent p_ref/extents.\n",v);
+			pass = false;
+			break;
+		}
+
+		const ptrdiff_t size = data_i[1]*data_i[2];
+		double*const data_t = malloc((size_t)size * sizeof *data_t); // free
+		read_line_values_d(&line_p,size,data_t);
+
+		const double*const data_b = (const double*) BYTE_ADD(m_file->data,vol_b->offset_data);
+		for (ptrdiff_t i = 0; i < size; ++i) {
+			if (fabs(data_b[i]-data_t[i]) > 1e1*EPS*(1.0+fabs(data_t[i]))) {
+				printf("Volume %td, coefficient %td: % .15e (binary) != % .15e (text).\n",v,i,data_b[i],data_t[i]);
+				pass = false;
+				break;
+			}
+		}
+		free(data_t);
+	}
+	free(line);
+	fclose(file);
+	destructor_Mapped_File(m_file);
+
+	return pass;
+}
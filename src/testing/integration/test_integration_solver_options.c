@@ -0,0 +1,278 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "gsl/gsl_math.h"
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+#include "definitions_test_case.h"
+#include "definitions_tol.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+
+#include "volume_solver.h"
+
+#include "multiarray.h"
+#include "vector.h"
+
+#include "core.h"
+#include "intrusive.h"
+#include "simulation.h"
+#include "solve.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+/** \brief Function pointer to a function checking whether the tested option was used by the most recent solve.
+ *  \return `true` if yes; `false` otherwise.
+ *
+ *  \param stats \ref Solver_Stats.
+ */
+typedef bool (*check_engaged_fptr)
+	(const struct Solver_Stats*const stats
+	);
+
+/// \brief Container for the data relating to a solver option which should not change the computed solution.
+struct Solver_Option {
+	const char* name;                 ///< The name of the option (as passed on the command line).
+	check_engaged_fptr check_engaged; ///< \ref check_engaged_fptr.
+};
+
+/** \brief Get the \ref Solver_Option corresponding to the input name.
+ *  \return See brief. */
+static struct Solver_Option get_Solver_Option
+	(const char*const name ///< The name of the option.
+	);
+
+/** \brief Constructor for the solution coefficients computed for the input control file, also checking whether the
+ *         tested option was used.
+ *  \return See brief. */
+static const struct const_Vector_d* constructor_sol_coef_solve
+	(const char*const ctrl_name,             ///< The name of the control file.
+	 const struct Solver_Option*const s_opt, ///< \ref Solver_Option.
+	 bool*const engaged,                     ///< Set to the result of \ref Solver_Option::check_engaged.
+	 double*const tol                        ///< Set to the tolerance from \ref compute_tol_solver_options.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for solver options which should not change the computed solution
+ *        (\ref test_integration_solver_options.c).
+ *  \return 0 on success (when the solutions computed with and without the option agree).
+ *
+ *  The simulation is solved for the reference control file, whose test case data file does not use the option, and
+ *  for the option control file, whose test case data file enables it, and the solution coefficients of all volumes are
+ *  compared. The \ref Solver_Stats are used to check that the option was used only for the second solve. As the
+ *  implicit solver (and the explicit solver for steady cases with an unreachable final time) only returns once the
+ *  residual exit criteria are satisfied, this also checks that the solver converges to the reference solution when the
+ *  option is enabled.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 5,"Invalid number of input arguments");
+
+	const char* petsc_options_name = set_petsc_options_name(argv[4]);
+	PetscInitialize(&argc,&argv,petsc_options_name,PETSC_NULL);
+
+	const struct Solver_Option s_opt = get_Solver_Option(argv[1]);
+	const char*const ctrl_names[] = { argv[2], argv[3], };
+
+	const struct const_Vector_d* sol_coef[2] = { NULL, NULL, };
+	bool engaged[2] = { false, false, };
+	double tol = 0.0;
+	for (int i = 0; i < 2; ++i)
+		sol_coef[i] = constructor_sol_coef_solve(ctrl_names[i],&s_opt,&engaged[i],&tol); // destructed
+
+	const double norm_diff = compute_norm_diff_rel_inf_Vector_d(sol_coef[0],sol_coef[1]);
+	const bool differs = !(norm_diff < tol);
+	if (differs)
+		printf("Relative difference of the solutions (%s): % .3e (tol: % .3e).\n",s_opt.name,norm_diff,tol);
+	destructor_const_Vector_d(sol_coef[0]);
+	destructor_const_Vector_d(sol_coef[1]);
+
+	PetscFinalize();
+
+	assert_condition_message(!engaged[0],"The option was used for the reference solve.");
+	assert_condition_message(engaged[1],"The option was not used.");
+	assert_condition_message(!differs,s_opt.name);
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/// \brief Version of \ref check_engaged_fptr checking \ref Solver_Stats::members_in_pool.
+static bool check_engaged_solution_pool
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/// \brief Version of \ref check_engaged_fptr checking that \ref Solver_Stats::n_volume_batches is positive.
+static bool check_engaged_volume_batching
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/// \brief Version of \ref check_engaged_fptr checking that \ref Solver_Stats::block_size is greater than one.
+static bool check_engaged_block_matrix
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/// \brief Version of \ref check_engaged_fptr checking \ref Solver_Stats::op_is_shell.
+static bool check_engaged_jfnk
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/** \brief Version of \ref check_engaged_fptr checking \ref Solver_Stats::op_is_shell and that
+ *         \ref Solver_Stats::n_mult_cmplx_step is positive. */
+static bool check_engaged_jfnk_cmplx_step
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/** \brief Version of \ref check_engaged_fptr checking that the `KSP` context was reused for all implicit steps and
+ *         that the preconditioner was not recomputed for all of them (\ref Test_Case_T::lag_pc_i). */
+static bool check_engaged_lag_pc
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/// \brief Version of \ref check_engaged_fptr checking that \ref Solver_Stats::n_lts_levels is greater than one.
+static bool check_engaged_lts_levels
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/// \brief Version of \ref check_engaged_fptr checking that \ref Solver_Stats::n_pc_mg is greater than one.
+static bool check_engaged_p_mg
+	(const struct Solver_Stats*const stats ///< See brief.
+	);
+
+/** \brief Compute the tolerance for the relative difference between the solutions computed with and without the
+ *         option.
+ *  \return See brief. */
+static double compute_tol_solver_options
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+static struct Solver_Option get_Solver_Option (const char*const name)
+{
+	static const struct Solver_Option s_opts[] =
+		{ { .name = "solution_pool",     .check_engaged = check_engaged_solution_pool,   },
+		  { .name = "volume_batching",   .check_engaged = check_engaged_volume_batching, },
+		  { .name = "block_matrix",      .check_engaged = check_engaged_block_matrix,    },
+		  { .name = "jfnk",              .check_engaged = check_engaged_jfnk,            },
+		  { .name = "jfnk_cmplx_step",   .check_engaged = check_engaged_jfnk_cmplx_step, },
+		  { .name = "lag_pc",            .check_engaged = check_engaged_lag_pc,          },
+		  { .name = "lts_levels",        .check_engaged = check_engaged_lts_levels,      },
+		  { .name = "p_mg_block_jacobi", .check_engaged = check_engaged_p_mg,            },
+		  { .name = "p_mg_ilu",          .check_engaged = check_engaged_p_mg,            },
+		  { .name = "p_mg_single_p",     .check_engaged = check_engaged_p_mg,            },
+		};
+
+	const int n_opts = (int)(sizeof(s_opts)/sizeof(*s_opts));
+	for (int i = 0; i < n_opts; ++i) {
+		if (strcmp(name,s_opts[i].name) == 0)
+			return s_opts[i];
+	}
+	EXIT_ERROR("Unsupported: %s\n",name);
+}
+
+static const struct const_Vector_d* constructor_sol_coef_solve
+	(const char*const ctrl_name, const struct Solver_Option*const s_opt, bool*const engaged, double*const tol)
+{
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name); // destructed
+
+	const int p_min = int_test_info->p_ref[0],
+	          p_max = int_test_info->p_ref[1],
+	          ml    = int_test_info->ml[0];
+
+	const int adapt_type = int_test_info->adapt_type;
+
+	// The simulation is set up for the highest order of the test range (using p-refinement for ADAPT_P).
+	struct Simulation* sim = NULL;
+	for (int p = p_min; p <= p_max; ++p) {
+		const int ml_prev = ( p == p_min ? ml-1 : ml );
+		const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+		structor_simulation(&sim,'c',adapt_type,p,ml,p-1,ml_prev,ctrl_name_curr,'r',false); // destructed
+	}
+
+	solve_for_solution(sim);
+	*engaged = s_opt->check_engaged(get_solver_stats());
+	*tol     = compute_tol_solver_options(sim);
+	const struct const_Vector_d*const sol_coef = constructor_sol_coef_Vector_d(sim); // returned
+
+	structor_simulation(&sim,'d',ADAPT_0,p_max,ml,p_max-1,ml-1,NULL,'r',false);
+	destructor_Integration_Test_Info(int_test_info);
+
+	return sol_coef;
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static bool check_engaged_solution_pool (const struct Solver_Stats*const stats)
+{
+	return stats->members_in_pool;
+}
+
+static bool check_engaged_volume_batching (const struct Solver_Stats*const stats)
+{
+	return stats->n_volume_batches > 0;
+}
+
+static bool check_engaged_block_matrix (const struct Solver_Stats*const stats)
+{
+	return stats->block_size > 1;
+}
+
+static bool check_engaged_jfnk (const struct Solver_Stats*const stats)
+{
+	return stats->op_is_shell;
+}
+
+static bool check_engaged_jfnk_cmplx_step (const struct Solver_Stats*const stats)
+{
+	return stats->op_is_shell && stats->n_mult_cmplx_step > 0;
+}
+
+static bool check_engaged_lag_pc (const struct Solver_Stats*const stats)
+{
+	return stats->n_steps_i > 1 && stats->n_ksp_constructed == 1 && stats->n_pc_set_up < stats->n_steps_i;
+}
+
+static bool check_engaged_lts_levels (const struct Solver_Stats*const stats)
+{
+	return stats->n_lts_levels > 1;
+}
+
+static bool check_engaged_p_mg (const struct Solver_Stats*const stats)
+{
+	return stats->n_pc_mg > 1;
+}
+
+static double compute_tol_solver_options (const struct Simulation*const sim)
+{
+	/* The steady solutions are only converged to the residual exit criterion of the solver such that the solutions
+	 * computed with and without the option (using different preconditioners, Jacobians or local time steps) agree to
+	 * a multiple of it. The unsteady solutions only differ by the rounding errors accumulated over the time steps
+	 * (from the different order of the floating point operations). */
+	const struct Test_Case*const test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	const double exit_crit = ( test_case->solver_proc == SOLVER_E ? test_case->exit_tol_e : test_case->exit_ratio_i );
+	return GSL_MAX(1e3*exit_crit,1e-12);
+}
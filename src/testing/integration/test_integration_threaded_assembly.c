@@ -0,0 +1,245 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "petscsys.h"
+
+#include "macros.h"
+#include "definitions_adaptation.h"
+#include "definitions_intrusive.h"
+#include "definitions_tol.h"
+
+#include "test_base.h"
+#include "test_integration.h"
+#include "test_support_math_functions.h"
+#include "test_support_solve.h"
+
+#include "face.h"
+#include "volume.h"
+#include "volume_solver.h"
+
+#include "multiarray.h"
+#include "vector.h"
+
+#include "computational_elements.h"
+#include "compute_grad_coef_dg.h"
+#include "compute_face_rlhs_dg.h"
+#include "compute_volume_rlhs_dg.h"
+#include "intrusive.h"
+#include "simulation.h"
+#include "solve.h"
+#include "test_case.h"
+
+// Static function declarations ************************************************************************************* //
+
+/// The tolerance for the differences between the rhs/lhs terms computed using one and multiple threads.
+#define TOL_THREADS 1e2*EPS
+
+/** \brief Check that each face is included in exactly one colour of the \ref Simulation::face_colouring and that
+ *         faces of the same colour do not share any neighbouring volumes, printing the violations.
+ *  \return `true` if the checks pass; `false` otherwise. */
+static bool check_face_colouring
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+/** \brief Compute the DG rhs and lhs terms for the current solution using the input number of threads.
+ *  \return The \ref Solver_Storage_Implicit holding the assembled lhs. */
+static struct Solver_Storage_Implicit* constructor_rlhs_dg
+	(struct Simulation*const sim, ///< \ref Simulation.
+	 const int n_threads          ///< The number of threads.
+	);
+
+/** \brief Constructor for a \ref const_Vector_T\* holding the concatenated rhs terms of all volumes.
+ *  \return See brief. */
+static const struct const_Vector_d* constructor_rhs_Vector
+	(const struct Simulation*const sim ///< \ref Simulation.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the threaded assembly of the DG rhs and lhs terms
+ *        (\ref test_integration_threaded_assembly.c).
+ *  \return 0 on success.
+ *
+ *  The test must be run with multiple OpenMP threads (e.g. `OMP_NUM_THREADS=4`). It checks that the face colouring
+ *  used for the threaded face loop is valid and that the rhs and lhs terms computed using all of the available threads
+ *  match those computed using a single thread (for which the face colouring is not used).
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 2,"Invalid number of input arguments");
+	PetscInitialize(&argc,&argv,PETSC_NULL,PETSC_NULL);
+
+	const int n_threads = MAX_THREADS_OMP;
+	assert_condition_message(n_threads > 1,"Multiple threads are required (e.g. OMP_NUM_THREADS=4)");
+
+	const char*const ctrl_name = argv[1];
+	struct Integration_Test_Info* int_test_info = constructor_Integration_Test_Info(ctrl_name);
+
+	const int p  = int_test_info->p_ref[0],
+	          ml = int_test_info->ml[0],
+	          adapt_type = int_test_info->adapt_type;
+
+	struct Simulation* sim = NULL;
+	const char*const ctrl_name_curr = set_file_name_curr(adapt_type,p,ml,false,ctrl_name);
+	structor_simulation(&sim,'c',adapt_type,p,ml,p-1,ml-1,ctrl_name_curr,'r',false); // destructed
+	assert_condition_message(sim->method == METHOD_DG,"Only the DG method uses the threaded assembly");
+
+	bool pass = check_face_colouring(sim);
+
+	constructor_derived_Elements(sim,IL_ELEMENT_SOLVER_DG);       // destructed
+	constructor_derived_computational_elements(sim,IL_SOLVER_DG); // destructed
+
+	struct Test_Case* test_case = (struct Test_Case*) sim->test_case_rc->tc;
+	test_case->solver_method_curr = 'i';
+	perturb_solution(sim);
+
+	struct Solver_Storage_Implicit* ssi[2] = { NULL, NULL, };
+	const struct const_Vector_d* rhs[2] = { NULL, NULL, };
+	for (int i = 0; i < 2; ++i) {
+		ssi[i] = constructor_rlhs_dg(sim,( i == 0 ? 1 : n_threads )); // destructed
+		rhs[i] = constructor_rhs_Vector(sim); // destructed
+	}
+	test_case->solver_method_curr = 0;
+
+	const double diff_rhs = compute_norm_diff_rel_inf_Vector_d(rhs[0],rhs[1]),
+	             diff_lhs = norm_diff_petsc_Mat(ssi[0]->A,ssi[1]->A,false);
+	if (!(diff_rhs < TOL_THREADS && diff_lhs < TOL_THREADS)) {
+		pass = false;
+		printf("Differences of the rhs/lhs terms (1 vs. %d threads): % .3e % .3e (tol: % .3e).\n",
+		       n_threads,diff_rhs,diff_lhs,TOL_THREADS);
+	}
+
+	for (int i = 0; i < 2; ++i) {
+		destructor_Solver_Storage_Implicit(ssi[i]);
+		destructor_const_Vector_d(rhs[i]);
+	}
+
+	destructor_derived_computational_elements(sim,IL_SOLVER);
+	destructor_derived_Elements(sim,IL_ELEMENT_SOLVER);
+
+	structor_simulation(&sim,'d',ADAPT_0,p,ml,p-1,ml-1,NULL,'r',false);
+	destructor_Integration_Test_Info(int_test_info);
+
+	PetscFinalize();
+
+	assert_condition(pass);
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static bool check_face_colouring (const struct Simulation*const sim)
+{
+	const struct Face_Colouring*const f_col = sim->face_colouring;
+	if (!f_col) {
+		printf("The face colouring was not constructed.\n");
+		return false;
+	}
+
+	ptrdiff_t n_f = 0;
+	struct Intrusive_Link**const links = constructor_array_Link(sim->faces,&n_f); // free
+
+	int n_v = 0;
+	for (const struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const int index = ((struct Volume*)curr)->index;
+		if (index >= n_v)
+			n_v = index+1;
+	}
+
+	// The colour of the last face found to neighbour each volume and the number of times that each face was found.
+	int*const colour_v = malloc((size_t)n_v * sizeof *colour_v); // free
+	int*const count_f  = calloc((size_t)n_f,sizeof *count_f);    // free
+	for (int v = 0; v < n_v; ++v)
+		colour_v[v] = -1;
+
+	bool pass = (f_col->n_f == n_f && f_col->ind_colour[f_col->n_colours] == n_f);
+	for (int c = 0; pass && c < f_col->n_colours; ++c) {
+		for (ptrdiff_t i = f_col->ind_colour[c]; i < f_col->ind_colour[c+1]; ++i) {
+			const ptrdiff_t ind_f = f_col->ind_f[i];
+			++count_f[ind_f];
+
+			const struct Face*const face = (struct Face*) links[ind_f];
+			for (int j = 0; j < 2; ++j) {
+				const struct Volume*const vol = face->neigh_info[j].volume;
+				if (!vol)
+					continue;
+				if (colour_v[vol->index] == c) {
+					printf("Volume %d neighbours multiple faces of colour %d.\n",vol->index,c);
+					pass = false;
+				}
+				colour_v[vol->index] = c;
+			}
+		}
+	}
+
+	for (ptrdiff_t f = 0; pass && f < n_f; ++f) {
+		if (count_f[f] != 1) {
+			printf("Face %td is included in %d colours.\n",f,count_f[f]);
+			pass = false;
+		}
+	}
+
+	free(colour_v);
+	free(count_f);
+	free(links);
+	return pass;
+}
+
+static struct Solver_Storage_Implicit* constructor_rlhs_dg (struct Simulation*const sim, const int n_threads)
+{
+	SET_THREADS_OMP(n_threads);
+	update_Face_Colouring(sim);
+	assert((n_threads > 1) == (sim->face_colouring != NULL));
+
+	struct Solver_Storage_Implicit*const ssi = constructor_Solver_Storage_Implicit(sim); // returned
+
+	initialize_zero_memory_volumes(sim->volumes);
+	compute_grad_coef_dg(sim,sim->volumes,sim->faces);
+	compute_volume_rlhs_dg(sim,ssi,sim->volumes);
+	compute_face_rlhs_dg(sim,ssi,sim->faces);
+	petsc_mat_vec_assemble(ssi);
+
+	return ssi;
+}
+
+static const struct const_Vector_d* constructor_rhs_Vector (const struct Simulation*const sim)
+{
+	ptrdiff_t n_rhs = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Multiarray_d*const rhs = ((struct Solver_Volume*)curr)->rhs;
+		n_rhs += compute_size(rhs->order,rhs->extents);
+	}
+
+	struct Vector_d*const rhs_V = constructor_empty_Vector_d(n_rhs); // returned
+
+	ptrdiff_t ind = 0;
+	for (struct Intrusive_Link* curr = sim->volumes->first; curr; curr = curr->next) {
+		const struct Multiarray_d*const rhs = ((struct Solver_Volume*)curr)->rhs;
+		const ptrdiff_t size = compute_size(rhs->order,rhs->extents);
+		for (ptrdiff_t i = 0; i < size; ++i)
+			rhs_V->data[ind+i] = rhs->data[i];
+		ind += size;
+	}
+	return (const struct const_Vector_d*) rhs_V;
+}
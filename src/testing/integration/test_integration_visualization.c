@@ -0,0 +1,381 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "petscsys.h"
+
+#include "test_base.h"
+#include "test_support_vector.h"
+
+#include "macros.h"
+#include "definitions_intrusive.h"
+#include "definitions_visualization.h"
+
+#include "vector.h"
+
+#include "computational_elements.h"
+#include "file_processing.h"
+#include "geometry.h"
+#include "simulation.h"
+#include "solution.h"
+#include "visualization.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define N_ARRAYS_MAX_TEST 64 ///< The maximum number of data arrays in a \ref Vtk_Data_Test.
+
+/** \brief Container for the data arrays read from a serial vtk xml file.
+ *
+ *  The data of all pieces is concatenated, with the cell connectivity and offsets being converted to the global
+ *  numbering used by the appended binary format.
+ */
+struct Vtk_Data_Test {
+	int n_arrays; ///< The number of data arrays.
+
+	char names[N_ARRAYS_MAX_TEST][STRLEN_MIN]; ///< The names of the data arrays ("Points" for the unnamed points).
+	struct Vector_d* data[N_ARRAYS_MAX_TEST];  ///< The data of the data arrays.
+};
+
+/** \brief Output the visualization of the specified type using the ascii and binary formats and check whether the data
+ *         arrays of the serial output file are identical (up to the precision of the `Float32` format).
+ *  \return `true` if identical; `false` otherwise. */
+static bool test_vtk_format
+	(struct Simulation*const sim,   ///< \ref Simulation.
+	 const int vis_type,            ///< Defined for \ref output_visualization.
+	 const char*const name_part,    ///< The name of the serial output file without the rank and extension.
+	 const char*const extension_vtk ///< The extension of the serial output file.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs integration testing for the vtk visualization output formats (\ref test_integration_visualization.c).
+ *  \return 0 on success.
+ *
+ *  The geometry, normals and solution outputs are written using both `vtk_format` options (see
+ *  \ref get_set_vtk_options) and the data arrays of the ascii (one piece per volume) and appended binary (one piece per
+ *  process) files are compared. This is done for both `vtk_cells` options.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	PetscInitialize(&argc,&argv,PETSC_NULL,PETSC_NULL);
+
+	assert_condition_message(argc == 2,"Invalid number of input arguments");
+	const char* ctrl_name = argv[1];
+
+	struct Simulation*const sim = constructor_Simulation(ctrl_name); // destructed
+
+	constructor_derived_computational_elements(sim,IL_SOLVER); // destructed
+	constructor_derived_Elements(sim,IL_ELEMENT_SOLVER);       // destructed
+
+	set_up_solver_geometry(sim);
+	set_initial_solution(sim);
+
+	char name_sol[STRLEN_MAX] = { 0, };
+	sprintf(name_sol,"%s/%s/sol_v__%s",sim->pde_name,sim->pde_spec,extract_name(sim->ctrl_name_full,true));
+
+	bool pass = true;
+	const bool lagrange[] = { false, true, };
+	for (int i = 0; i < 2; ++i) {
+		struct Vtk_Options vtk_options = *get_set_vtk_options(NULL);
+		vtk_options.lagrange = lagrange[i];
+		get_set_vtk_options(&vtk_options);
+
+		if (!(test_vtk_format(sim,VIS_GEOM_VOLUMES,"geom_v","vtu") &&
+		      test_vtk_format(sim,VIS_GEOM_VOLUMES,"geom_e","vtu") &&
+		      test_vtk_format(sim,VIS_NORMALS,"normals","vtp") &&
+		      test_vtk_format(sim,VIS_SOLUTION,name_sol,"vtu")))
+		{
+			printf("vtk_cells: %s.\n",(lagrange[i] ? "lagrange" : "linear"));
+			pass = false;
+		}
+	}
+
+	destructor_derived_computational_elements(sim,IL_BASE);
+	destructor_derived_Elements(sim,IL_ELEMENT);
+
+	destructor_Simulation(sim);
+
+	assert_condition(pass);
+
+	PetscFinalize();
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+/** \brief Constructor for a \ref Vtk_Data_Test from a serial vtk xml file written in the ascii format.
+ *  \return See brief. */
+static struct Vtk_Data_Test* constructor_Vtk_Data_Test_ascii
+	(const char*const file_name ///< The name of the file.
+	);
+
+/** \brief Constructor for a \ref Vtk_Data_Test from a serial vtk xml file written in the appended binary format.
+ *  \return See brief. */
+static struct Vtk_Data_Test* constructor_Vtk_Data_Test_binary
+	(const char*const file_name ///< The name of the file.
+	);
+
+/// \brief Destructor for a \ref Vtk_Data_Test.
+static void destructor_Vtk_Data_Test
+	(struct Vtk_Data_Test*const vtk_d ///< Standard.
+	);
+
+/** \brief Check whether the data arrays of the input \ref Vtk_Data_Test\*s are identical up to the input tolerance,
+ *         printing the difference if not.
+ *  \return `true` if identical; `false` otherwise. */
+static bool check_equal_Vtk_Data_Test
+	(const struct Vtk_Data_Test*const vtk_a, ///< Input 0.
+	 const struct Vtk_Data_Test*const vtk_b, ///< Input 1.
+	 const double tol                        ///< The tolerance.
+	);
+
+static bool test_vtk_format
+	(struct Simulation*const sim, const int vis_type, const char*const name_part, const char*const extension_vtk)
+{
+	char file_name[STRLEN_MAX] = { 0, };
+	sprintf(file_name,"../output/paraview/%s_%d.%s",name_part,sim->mpi_rank,extension_vtk);
+
+	struct Vtk_Data_Test* vtk_d[2] = { NULL, NULL, };
+	const bool binary[] = { false, true, };
+	for (int i = 0; i < 2; ++i) {
+		struct Vtk_Options vtk_options = *get_set_vtk_options(NULL);
+		vtk_options.binary = binary[i];
+		get_set_vtk_options(&vtk_options);
+
+		output_visualization(sim,vis_type);
+		vtk_d[i] = ( !binary[i] ? constructor_Vtk_Data_Test_ascii(file_name)    // destructed
+		                        : constructor_Vtk_Data_Test_binary(file_name) ); // destructed
+	}
+
+	// The Float32 data is printed with 9 significant digits in the ascii format.
+	const bool pass = check_equal_Vtk_Data_Test(vtk_d[0],vtk_d[1],1e-6);
+	if (!pass)
+		printf("File: %s.\n",file_name);
+
+	destructor_Vtk_Data_Test(vtk_d[0]);
+	destructor_Vtk_Data_Test(vtk_d[1]);
+	return pass;
+}
+
+// Level 1 ********************************************************************************************************** //
+
+/** \brief Constructor for a null-terminated string holding the contents of the file.
+ *  \return See brief. */
+static char* constructor_file_contents
+	(const char*const file_name ///< The name of the file.
+	);
+
+/** \brief Read the value of the attribute of the xml tag starting at the input position.
+ *  \return `true` if the attribute was found; `false` otherwise. */
+static bool read_xml_attribute
+	(const char*const tag,  ///< The position of the start of the xml tag.
+	 const char*const attr, ///< The name of the attribute.
+	 char*const value       ///< Set to the value of the attribute.
+	);
+
+/** \brief Get the data of the data array of the \ref Vtk_Data_Test with the input name, adding a new data array if not
+ *         already present.
+ *  \return See brief. */
+static struct Vector_d* get_Vtk_Data_Test_array
+	(struct Vtk_Data_Test*const vtk_d, ///< \ref Vtk_Data_Test.
+	 const char*const name             ///< The name of the data array.
+	);
+
+static struct Vtk_Data_Test* constructor_Vtk_Data_Test_ascii (const char*const file_name)
+{
+	char*const file_s = constructor_file_contents(file_name); // free
+	struct Vtk_Data_Test*const vtk_d = calloc(1,sizeof *vtk_d); // returned
+
+	ptrdiff_t ind_p = 0, // The index of the first point of the current piece.
+	          ind_c = 0; // The index of the first connectivity entry of the current piece.
+	for (const char* piece = strstr(file_s,"<Piece "); piece; piece = strstr(piece+1,"<Piece ")) {
+		char value[STRLEN_MAX] = { 0, };
+		if (!read_xml_attribute(piece,"NumberOfPoints",value))
+			EXIT_ERROR("Did not find the number of points of the piece.\n");
+		const ptrdiff_t n_p = strtol(value,NULL,10);
+
+		const char*const piece_end = strstr(piece,"</Piece>");
+		ptrdiff_t n_c = 0;
+		for (const char* array = strstr(piece,"<DataArray"); array && array < piece_end;
+		     array = strstr(array+1,"<DataArray"))
+		{
+			char name[STRLEN_MAX] = "Points";
+			read_xml_attribute(array,"Name",name);
+			struct Vector_d*const data = get_Vtk_Data_Test_array(vtk_d,name);
+
+			const bool is_connect = (strcmp(name,"connectivity") == 0);
+			const ptrdiff_t shift = ( is_connect ? ind_p : ( strcmp(name,"offsets") == 0 ? ind_c : 0 ) );
+
+			const char* val = strchr(array,'>')+1;
+			char* end = NULL;
+			for (double d = strtod(val,&end); end != val; val = end, d = strtod(val,&end)) {
+				push_back_Vector_d(data,d+(double)shift,false,false);
+				if (is_connect)
+					++n_c;
+			}
+		}
+		ind_p += n_p;
+		ind_c += n_c;
+	}
+	free(file_s);
+
+	return vtk_d;
+}
+
+static struct Vtk_Data_Test* constructor_Vtk_Data_Test_binary (const char*const file_name)
+{
+	char*const file_s = constructor_file_contents(file_name); // free
+	struct Vtk_Data_Test*const vtk_d = calloc(1,sizeof *vtk_d); // returned
+
+	const char*const appended = strstr(file_s,"<AppendedData");
+	assert_condition_message(appended != NULL,"Did not find the appended data.");
+	const char*const data_a = strchr(appended,'_')+1;
+
+	for (const char* array = strstr(file_s,"<DataArray"); array && array < appended;
+	     array = strstr(array+1,"<DataArray"))
+	{
+		char name[STRLEN_MAX]   = "Points",
+		     type[STRLEN_MAX]   = { 0, },
+		     offset[STRLEN_MAX] = { 0, };
+		read_xml_attribute(array,"Name",name);
+		if (!(read_xml_attribute(array,"type",type) && read_xml_attribute(array,"offset",offset)))
+			EXIT_ERROR("Did not find the type and offset of the data array.\n");
+		struct Vector_d*const data = get_Vtk_Data_Test_array(vtk_d,name);
+
+		const char* data_p = data_a+strtol(offset,NULL,10);
+		uint64_t size = 0;
+		memcpy(&size,data_p,sizeof size);
+		data_p += sizeof size;
+
+		if (strcmp(type,"Float32") == 0) {
+			for (uint64_t i = 0; i < size/sizeof(float); ++i) {
+				float val = 0.0f;
+				memcpy(&val,data_p+i*sizeof val,sizeof val);
+				push_back_Vector_d(data,(double)val,false,false);
+			}
+		} else if (strcmp(type,"Int32") == 0) {
+			for (uint64_t i = 0; i < size/sizeof(int32_t); ++i) {
+				int32_t val = 0;
+				memcpy(&val,data_p+i*sizeof val,sizeof val);
+				push_back_Vector_d(data,(double)val,false,false);
+			}
+		} else if (strcmp(type,"UInt8") == 0) {
+			for (uint64_t i = 0; i < size; ++i)
+				push_back_Vector_d(data,(double)(uint8_t)data_p[i],false,false);
+		} else {
+			EXIT_ERROR("Unsupported: %s\n",type);
+		}
+	}
+	free(file_s);
+
+	return vtk_d;
+}
+
+static void destructor_Vtk_Data_Test (struct Vtk_Data_Test*const vtk_d)
+{
+	for (int i = 0; i < vtk_d->n_arrays; ++i)
+		destructor_Vector_d(vtk_d->data[i]);
+	free(vtk_d);
+}
+
+static bool check_equal_Vtk_Data_Test
+	(const struct Vtk_Data_Test*const vtk_a, const struct Vtk_Data_Test*const vtk_b, const double tol)
+{
+	if (vtk_a->n_arrays != vtk_b->n_arrays) {
+		printf("Different number of data arrays: %d, %d.\n",vtk_a->n_arrays,vtk_b->n_arrays);
+		return false;
+	}
+
+	bool pass = true;
+	for (int i = 0; i < vtk_a->n_arrays; ++i) {
+		if (strcmp(vtk_a->names[i],vtk_b->names[i]) != 0) {
+			printf("Different data array names: %s, %s.\n",vtk_a->names[i],vtk_b->names[i]);
+			pass = false;
+		} else if (diff_Vector_d(vtk_a->data[i],vtk_b->data[i],tol)) {
+			printf("Data array: %s.\n",vtk_a->names[i]);
+			print_diff_Vector_d(vtk_a->data[i],vtk_b->data[i],tol);
+			pass = false;
+		}
+	}
+	return pass;
+}
+
+// Level 2 ********************************************************************************************************** //
+
+static char* constructor_file_contents (const char*const file_name)
+{
+	FILE* file = fopen_checked(file_name); // closed
+
+	fseek(file,0,SEEK_END);
+	const long size = ftell(file);
+	rewind(file);
+
+	char*const file_s = malloc((size_t)(size+1) * sizeof *file_s); // returned
+	if (fread(file_s,1,(size_t)size,file) != (size_t)size)
+		EXIT_ERROR("Error reading: %s\n",file_name);
+	file_s[size] = '\0';
+
+	fclose(file);
+	return file_s;
+}
+
+static bool read_xml_attribute (const char*const tag, const char*const attr, char*const value)
+{
+	const char*const tag_end = strchr(tag,'>');
+	assert(tag_end != NULL);
+
+	char pattern[STRLEN_MAX] = { 0, };
+	sprintf(pattern," %s=\"",attr);
+
+	const char*const attr_start = strstr(tag,pattern);
+	if (attr_start == NULL || attr_start > tag_end)
+		return false;
+
+	const char*const val_start = attr_start+strlen(pattern),
+	          *const val_end   = strchr(val_start,'"');
+	const size_t len = (size_t)(val_end-val_start);
+	assert(len < STRLEN_MAX);
+
+	strncpy(value,val_start,len);
+	value[len] = '\0';
+	return true;
+}
+
+static struct Vector_d* get_Vtk_Data_Test_array (struct Vtk_Data_Test*const vtk_d, const char*const name)
+{
+	for (int i = 0; i < vtk_d->n_arrays; ++i) {
+		if (strcmp(vtk_d->names[i],name) == 0)
+			return vtk_d->data[i];
+	}
+
+	if (vtk_d->n_arrays == N_ARRAYS_MAX_TEST)
+		EXIT_ERROR("Increase N_ARRAYS_MAX_TEST.\n");
+
+	const int ind = vtk_d->n_arrays++;
+	assert(strlen(name) < STRLEN_MIN);
+	strcpy(vtk_d->names[ind],name);
+	vtk_d->data[ind] = constructor_empty_Vector_d(0); // destructed
+	return vtk_d->data[ind];
+}
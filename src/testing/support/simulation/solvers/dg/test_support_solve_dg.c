@@ -272,6 +272,7 @@ struct Solver_Storage_Implicit* constructor_Solver_Storage_Implicit_dg_S (const
 	const ptrdiff_t dof_solve = nnz->ext_0;
 
 	struct Solver_Storage_Implicit*const ssi = calloc(1,sizeof *ssi); // free
+	ssi->ind_dof_range[1] = (PetscInt)dof_solve;
 
 	MatCreateSeqAIJ(MPI_COMM_WORLD,(PetscInt)dof_solve,(PetscInt)dof_solve,0,nnz->data,&ssi->A); // destructed
 	MatSetFromOptions(ssi->A);
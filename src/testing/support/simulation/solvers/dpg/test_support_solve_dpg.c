@@ -239,10 +239,11 @@ static Mat constructor_Mat_S_dpg (const struct Simulation*const sim)
 struct Solver_Storage_Implicit* constructor_Solver_Storage_Implicit_dpg_S (const struct Simulation*const sim)
 {
 	update_ind_dof_d(sim);
-	struct Vector_i*const nnz = constructor_nnz_dpg(true,sim); // destructed
+	struct Vector_i*const nnz = constructor_nnz_dpg(true,false,sim); // destructed
 	const ptrdiff_t dof_solve = nnz->ext_0;
 
 	struct Solver_Storage_Implicit*const ssi = calloc(1,sizeof *ssi); // free
+	ssi->ind_dof_range[1] = (PetscInt)dof_solve;
 
 	MatCreateSeqAIJ(MPI_COMM_WORLD,(PetscInt)dof_solve,(PetscInt)dof_solve,0,nnz->data,&ssi->A); // destructed
 	MatSetFromOptions(ssi->A);
@@ -0,0 +1,207 @@
+/* {{{
+This file is part of DPGSolver.
+
+DPGSolver is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or any later version.
+
+DPGSolver is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+Public License for more details.
+
+You should have received a copy of the GNU General Public License along with DPGSolver.  If not, see
+<http://www.gnu.org/licenses/>.
+}}} */
+/** \file
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_base.h"
+#include "test_support.h"
+#include "test_support_matrix.h"
+
+#include "macros.h"
+#include "definitions_core.h"
+#include "definitions_elements.h"
+#include "definitions_intrusive.h"
+#include "definitions_tol.h"
+
+#include "const_cast.h"
+#include "matrix.h"
+#include "multiarray.h"
+
+#include "bounding_volume_hierarchy.h"
+#include "element.h"
+#include "intrusive.h"
+#include "inverse_mapping.h"
+#include "simulation.h"
+#include "volume.h"
+
+// Static function declarations ************************************************************************************* //
+
+#define N_V_TEST 3 ///< The number of volumes of the test mesh.
+#define D_TEST   2 ///< The dimension of the test mesh.
+
+/// \brief Container for a node to be located in the test mesh.
+struct Node_BVH {
+	double xyz[DMAX]; ///< The xyz coordinates of the node.
+
+	/// The indices of the volumes which may be returned (-1 for unused entries).
+	int ind_v[2];
+};
+
+/** \brief Constructor for the list of \ref Volume\*s of the test mesh, a QUAD followed by two TRIs covering
+ *         [0,2]x[0,1].
+ *  \return See brief. */
+static struct Intrusive_List* constructor_Volumes_tri_quad
+	(const struct const_Intrusive_List*const elements ///< \ref Simulation::elements.
+	);
+
+/// \brief Destructor for the list of \ref Volume\*s constructed by \ref constructor_Volumes_tri_quad.
+static void destructor_Volumes_tri_quad
+	(struct Intrusive_List*const volumes ///< Standard.
+	);
+
+/** \brief Check whether the volume found for the input node is one of those which is expected and whether the
+ *         reference coordinates are those obtained from the inverse mapping of the volume found, printing the node
+ *         otherwise.
+ *  \return `true` if the checks pass; `false` otherwise. */
+static bool check_node_bvh
+	(const struct Bounding_Volume_Hierarchy*const bvh, ///< Standard.
+	 const struct Node_BVH*const node                  ///< \ref Node_BVH.
+	);
+
+// Interface functions ********************************************************************************************** //
+
+/** \test Performs unit testing for the location of nodes in a mesh using the bounding volume hierarchy
+ *        (\ref test_unit_bounding_volume_hierarchy.c).
+ *  \return 0 on success.
+ *
+ *  The test checks that the expected volumes are found for nodes in the interior of the volumes, on the faces and
+ *  vertices shared by several volumes, on the domain boundary and just outside of the domain for a mesh of mixed TRI
+ *  and QUAD volumes. The nodes just outside of the domain are not contained in any of the bounding boxes and are
+ *  adjacent to TRIs whose bounding boxes are identical, such that the correct volume is only found if all of the
+ *  volumes sharing the closest bounding box are considered.
+ */
+int main
+	(int argc,   ///< Standard.
+	 char** argv ///< Standard.
+	)
+{
+	assert_condition_message(argc == 2,"Invalid number of input arguments");
+	assert_condition_message(strcmp(argv[1],"tri_quad") == 0,"Invalid test name");
+	assert_condition_message(DIM == D_TEST,"This test must be run in 2D");
+
+	const struct const_Intrusive_List*const elements = constructor_Elements(DIM); // destructed
+	struct Intrusive_List*const volumes = constructor_Volumes_tri_quad(elements); // destructed
+
+	static const struct Simulation sim;
+	const struct Bounding_Volume_Hierarchy*const bvh = constructor_Bounding_Volume_Hierarchy(volumes,&sim,'v'); // d.
+	assert_condition(bvh->n_v == N_V_TEST);
+
+	const double eps = 1e-6;
+	const struct Node_BVH nodes[] =
+		{ // Interior.
+		  { .xyz = { 0.5,     0.5,     }, .ind_v = { 0, -1, }, },
+		  { .xyz = { 5.0/3.0, 1.0/3.0, }, .ind_v = { 1, -1, }, },
+		  { .xyz = { 4.0/3.0, 2.0/3.0, }, .ind_v = { 2, -1, }, },
+		  // Shared faces and vertices.
+		  { .xyz = { 1.0,     0.5,     }, .ind_v = { 0,  2, }, },
+		  { .xyz = { 1.5,     0.5,     }, .ind_v = { 1,  2, }, },
+		  { .xyz = { 1.0,     1.0,     }, .ind_v = { 0,  2, }, },
+		  { .xyz = { 2.0,     1.0,     }, .ind_v = { 1,  2, }, },
+		  // Domain boundary.
+		  { .xyz = { 0.5,     0.0,     }, .ind_v = { 0, -1, }, },
+		  { .xyz = { 2.0,     0.5,     }, .ind_v = { 1, -1, }, },
+		  { .xyz = { 1.5,     1.0,     }, .ind_v = { 2, -1, }, },
+		  { .xyz = { 0.0,     0.0,     }, .ind_v = { 0, -1, }, },
+		  // Just outside of the domain.
+		  { .xyz = { -eps,    0.5,     }, .ind_v = { 0, -1, }, },
+		  { .xyz = { 2.0+eps, 0.25,    }, .ind_v = { 1, -1, }, },
+		  { .xyz = { 1.5,     -eps,    }, .ind_v = { 1, -1, }, },
+		  { .xyz = { 1.25,    1.0+eps, }, .ind_v = { 2, -1, }, },
+		};
+	const int n_n = (int)(sizeof(nodes)/sizeof(*nodes));
+
+	bool pass = true;
+	for (int n = 0; n < n_n; ++n) {
+		if (!check_node_bvh(bvh,&nodes[n]))
+			pass = false;
+	}
+
+	destructor_Bounding_Volume_Hierarchy(bvh);
+	destructor_Volumes_tri_quad(volumes);
+	destructor_const_Elements(elements);
+
+	assert_condition(pass);
+	OUTPUT_SUCCESS;
+}
+
+// Static functions ************************************************************************************************* //
+// Level 0 ********************************************************************************************************** //
+
+static struct Intrusive_List* constructor_Volumes_tri_quad (const struct const_Intrusive_List*const elements)
+{
+	const int e_types[N_V_TEST] = { QUAD, TRI, TRI, };
+	const int n_ve[N_V_TEST]    = { 4,    3,   3,   };
+	const double xyz_ve[N_V_TEST][4*D_TEST] =
+		{ { 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 1.0, },
+		  { 1.0, 0.0, 2.0, 0.0, 2.0, 1.0, },
+		  { 1.0, 0.0, 2.0, 1.0, 1.0, 1.0, },
+		};
+
+	struct Intrusive_List*const volumes = constructor_empty_IL(IL_VOLUME,NULL); // returned
+	for (int v = 0; v < N_V_TEST; ++v) {
+		struct Volume*const vol = calloc(1,sizeof *vol); // destructed
+
+		const_cast_i(&vol->index,v);
+		const_cast_const_Element(&vol->element,get_element_by_type(elements,e_types[v]));
+
+		struct Multiarray_d*const xyz_ve_v = constructor_empty_Multiarray_d('R',2,(ptrdiff_t[]){n_ve[v],D_TEST}); // m.
+		for (int i = 0; i < n_ve[v]*D_TEST; ++i)
+			xyz_ve_v->data[i] = xyz_ve[v][i];
+		const_constructor_move_const_Multiarray_d(&vol->xyz_ve,(struct const_Multiarray_d*)xyz_ve_v);
+
+		push_back_IL(volumes,(struct Intrusive_Link*)vol);
+	}
+	return volumes;
+}
+
+static void destructor_Volumes_tri_quad (struct Intrusive_List*const volumes)
+{
+	for (const struct Intrusive_Link* curr = volumes->first; curr; curr = curr->next)
+		destructor_const_Multiarray_d(((struct Volume*)curr)->xyz_ve);
+	destructor_IL(volumes,true);
+}
+
+static bool check_node_bvh (const struct Bounding_Volume_Hierarchy*const bvh, const struct Node_BVH*const node)
+{
+	double rst[DMAX] = { 0.0, };
+	const int ind_v = find_volume_bvh(bvh,node->xyz,rst);
+
+	bool pass = (ind_v == node->ind_v[0] || ind_v == node->ind_v[1]);
+	if (pass) {
+		const struct Volume*const vol = bvh->volumes[ind_v];
+		const struct const_Matrix_d xyz_ve = interpret_const_Multiarray_as_Matrix_d(vol->xyz_ve);
+		const struct const_Matrix_d xyz = { .layout = 'R', .ext_0 = 1, .ext_1 = D_TEST, .owns_data = false,
+		                                    .data = node->xyz, };
+		const struct const_Matrix_d rst_M = { .layout = 'R', .ext_0 = 1, .ext_1 = D_TEST, .owns_data = false,
+		                                      .data = rst, };
+
+		const struct const_Matrix_d*const rst_i = constructor_inverse_mapping(vol->element->type,&xyz_ve,&xyz); // d.
+		if (diff_const_Matrix_d(rst_i,&rst_M,1e3*EPS)) {
+			print_diff_const_Matrix_d(rst_i,&rst_M,1e3*EPS);
+			pass = false;
+		}
+		destructor_const_Matrix_d(rst_i);
+	}
+
+	if (!pass)
+		printf("Node: % .3e % .3e, volume found: %d (expected: %d or %d).\n",
+		       node->xyz[0],node->xyz[1],ind_v,node->ind_v[0],node->ind_v[1]);
+	return pass;
+}
@@ -29,8 +29,11 @@ You should have received a copy of the GNU General Public License along with DPG
 #include "definitions_tol.h"
 
 #include "matrix.h"
+#include "multiarray.h"
 #include "vector.h"
 
+#include "scratch_arena.h"
+
 // Static function declarations ************************************************************************************* //
 
 /// \brief Provides unit tests for the matrix-matrix multiplication functions.
@@ -48,6 +51,11 @@ static void test_unit_matrix_mm_diag
 	(struct Test_Info*const test_info ///< \ref Test_Info.
 	);
 
+/// \brief Provides unit tests for the containers constructed from the scratch arena (\ref scratch_arena.h).
+static void test_unit_scratch_arena
+	(struct Test_Info*const test_info ///< \ref Test_Info.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 /** \test Performs unit testing for the containers (\ref test_unit_containers.c).
@@ -67,6 +75,8 @@ int main
 		test_unit_matrix_mv(&test_info);
 	else if (strcmp(test_name,"matrix_mm_diag") == 0)
 		test_unit_matrix_mm_diag(&test_info);
+	else if (strcmp(test_name,"scratch_arena") == 0)
+		test_unit_scratch_arena(&test_info);
 	else
 		EXIT_ERROR("Invalid test name: %s\n",test_name);
 
@@ -263,3 +273,46 @@ static void test_unit_matrix_mm_diag (struct Test_Info*const test_info)
 
 	assert_condition(pass);
 }
+
+static void test_unit_scratch_arena (struct Test_Info*const test_info)
+{
+	UNUSED(test_info);
+	bool pass = true;
+
+	// Outside of a scope: heap memory.
+	struct Matrix_d* a_h = constructor_empty_Matrix_d_scratch('R',4,3); // destructed
+	if (a_h->in_scratch || is_scratch_memory(a_h) || is_scratch_memory(a_h->data))
+		pass = false;
+	destructor_Matrix_d(a_h);
+
+	// Inside of a scope: arena memory (including the growth beyond the initial block size) which is zero initialized
+	// where required and released when the scope is closed.
+	for (int i = 0; i < 2; ++i) {
+		const struct Scratch_Scope scope = open_scratch_scope();
+
+		const ptrdiff_t n_n = 1000*(i+1);
+		struct Multiarray_d* b = constructor_zero_Multiarray_d_scratch('C',3,(ptrdiff_t[]){n_n,3,5}); // destructed
+		struct Matrix_d* c     = constructor_empty_Matrix_d_scratch('C',n_n,10);                       // destructed
+
+		if (!b->in_scratch || !c->in_scratch ||
+		    !is_scratch_memory(b) || !is_scratch_memory(b->data) || !is_scratch_memory(c->data) ||
+		    ((size_t)b->data % 64) != 0)
+			pass = false;
+
+		const ptrdiff_t size = compute_size(b->order,b->extents);
+		for (ptrdiff_t j = 0; j < size; ++j) {
+			if (b->data[j] != 0.0)
+				pass = false;
+		}
+		for (ptrdiff_t j = 0; j < c->ext_0*c->ext_1; ++j)
+			c->data[j] = 1.0;
+
+		destructor_Multiarray_d(b);
+		destructor_Matrix_d(c);
+
+		close_scratch_scope(scope);
+	}
+	destructor_scratch_arena();
+
+	assert_condition(pass);
+}
@@ -18,6 +18,7 @@ You should have received a copy of the GNU General Public License along with DPG
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
 
 #include "test_base.h"
 #include "test_support.h"
@@ -26,6 +27,7 @@ You should have received a copy of the GNU General Public License along with DPG
 
 #include "macros.h"
 #include "definitions_alloc.h"
+#include "definitions_element_operators.h"
 #include "definitions_tol.h"
 
 #include "multiarray.h"
@@ -49,6 +51,19 @@ static void test_unit_apply_tp
 	 const char*const e_type           ///< \ref Element::type.
 	);
 
+/** \brief Provides unit tests for the application of tensor-product operators having a sub-operator only in the first
+ *         coordinate direction, comparing with the application of the standard operator. */
+static void test_unit_apply_tp_single_direction
+	(struct Test_Info*const test_info ///< \ref Test_Info.
+	);
+
+/** \brief Compare the time required for the application of operators in the standard ('d') and the tensor-product
+ *         ('t') formats for increasing polynomial order, additionally checking that the results are equal. */
+static void test_unit_benchmark_tp
+	(struct Test_Info*const test_info, ///< \ref Test_Info.
+	 const char*const e_type           ///< \ref Element::type.
+	);
+
 // Interface functions ********************************************************************************************** //
 
 /** \test Performs unit testing for tensor-product operators (\ref test_unit_operators_tp.c).
@@ -75,6 +90,14 @@ int main
 		test_unit_apply_tp(&test_info,"hex");
 	else if (strcmp(test_name,"apply_wedge") == 0)
 		test_unit_apply_tp(&test_info,"wedge");
+	else if (strcmp(test_name,"apply_single_direction") == 0)
+		test_unit_apply_tp_single_direction(&test_info);
+	else if (strcmp(test_name,"benchmark_quad") == 0)
+		test_unit_benchmark_tp(&test_info,"quad");
+	else if (strcmp(test_name,"benchmark_hex") == 0)
+		test_unit_benchmark_tp(&test_info,"hex");
+	else if (strcmp(test_name,"benchmark_wedge") == 0)
+		test_unit_benchmark_tp(&test_info,"wedge");
 	else
 		EXIT_ERROR("Invalid test name: %s\n",test_name);
 	output_warning_count(&test_info);
@@ -137,10 +160,13 @@ static void test_unit_apply_tp(struct Test_Info*const test_info, const char*cons
 	sprintf(var_name,"%s%s",e_type,"_ops_tp");
 	const struct const_Multiarray_Matrix_d* ops_tp =
 		constructor_file_name_const_Multiarray_Matrix_d(var_name,file_name_full); // destructed
+	const struct const_Matrix_d*const op_std = constructor_op_std(ops_tp); // destructed
+	const struct const_Matrix_CSR_d*const op_csr = constructor_sparse_const_Matrix_CSR_d(op_std,OP_CSR_TOL); // dest.
 	struct Operator op =
-		{ .ops_tp = ops_tp,
-		  .op_std = constructor_op_std(ops_tp), // destructed
-		  .op_csr = NULL, };
+		{ .ops_tp     = ops_tp,
+		  .op_std     = op_std,
+		  .op_csr     = op_csr,
+		  .op_csr_mkl = constructor_sparse_matrix_mkl(op_csr), }; // destructed
 
 	sprintf(var_name,"%s%s",e_type,"_b");
 	const struct const_Multiarray_d* b_r =
@@ -153,24 +179,153 @@ static void test_unit_apply_tp(struct Test_Info*const test_info, const char*cons
 	const struct const_Multiarray_d* c_std = constructor_mm_NN1C_const_Multiarray_d(op.op_std,b_r); // destructed
 	const struct const_Multiarray_d* c_tp  = constructor_mm_tp_NN1C_const_Multiarray_d(op.ops_tp,b_r); // destructed
 
+	struct Multiarray_d* c_op = constructor_empty_Multiarray_d('C',c_std->order,c_std->extents); // destructed
+	mm_NN1C_Operator_Multiarray_d(&op,b_r,c_op,'t',b_r->order,NULL,NULL);
+
+	struct Multiarray_d* c_csr = constructor_empty_Multiarray_d('C',c_std->order,c_std->extents); // destructed
+	mm_NN1C_Operator_Multiarray_d(&op,b_r,c_csr,'c',b_r->order,NULL,NULL);
+
 	destructor_const_Matrix_d(op.op_std);
 	destructor_const_Multiarray_Matrix_d(op.ops_tp);
+	destructor_const_Matrix_CSR_d(op.op_csr);
+	destructor_sparse_matrix_mkl(op.op_csr_mkl);
 	destructor_const_Multiarray_d(b_r);
 
-	tol = (double[]) { EPS, EPS, };
+	tol = (double[]) { EPS, EPS, EPS, EPS, };
 	differences = (bool[])
 		{ diff_const_Multiarray_d(c_r,c_std,tol[0]),
 		  diff_const_Multiarray_d(c_r,c_tp,tol[1]),
+		  diff_const_Multiarray_d(c_r,(struct const_Multiarray_d*)c_op,tol[2]),
+		  diff_const_Multiarray_d(c_r,(struct const_Multiarray_d*)c_csr,tol[3]),
 		};
-	if (check_diff(2,differences,&pass)) {
+	if (check_diff(4,differences,&pass)) {
 		if (differences[0])
 			print_diff_const_Multiarray_d(c_r,c_std,tol[0]);
 		if (differences[1])
 			print_diff_const_Multiarray_d(c_r,c_tp,tol[1]);
+		if (differences[2])
+			print_diff_const_Multiarray_d(c_r,(struct const_Multiarray_d*)c_op,tol[2]);
+		if (differences[3])
+			print_diff_const_Multiarray_d(c_r,(struct const_Multiarray_d*)c_csr,tol[3]);
 	}
 	assert_condition(pass);
 
 	destructor_const_Multiarray_d(c_r);
 	destructor_const_Multiarray_d(c_std);
 	destructor_const_Multiarray_d(c_tp);
+	destructor_Multiarray_d(c_op);
+	destructor_Multiarray_d(c_csr);
+}
+
+/** \brief Constructor for a row-major \ref Matrix_d\* with random entries in [0,1).
+ *  \return Standard. */
+static struct Matrix_d* constructor_random_Matrix_d
+	(const ptrdiff_t ext_0, ///< Defined in \ref Matrix_d.
+	 const ptrdiff_t ext_1  ///< Defined in \ref Matrix_d.
+	);
+
+static void test_unit_apply_tp_single_direction (struct Test_Info*const test_info)
+{
+	sprintf(test_info->name,"%s","Operators - apply tp (single direction)");
+
+	const int n_var = 3;
+
+	struct Multiarray_Matrix_d* ops_tp = constructor_empty_Multiarray_Matrix_d(false,1,(ptrdiff_t[]){2}); // dest.
+	ops_tp->data[0] = constructor_random_Matrix_d(5,4); // destructed
+
+	const struct Operator op =
+		{ .ops_tp = (struct const_Multiarray_Matrix_d*) ops_tp,
+		  .op_std = constructor_op_std((struct const_Multiarray_Matrix_d*)ops_tp), // destructed
+		  .op_csr = NULL, };
+
+	struct Multiarray_d* b = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){op.op_std->ext_1,n_var}); // dest.
+	for (ptrdiff_t i = 0; i < compute_size(b->order,b->extents); ++i)
+		b->data[i] = ((double) rand())/((double) RAND_MAX+1);
+
+	const char op_format[] = { 'd', 't', };
+	struct Multiarray_d* c[2] = { NULL, NULL, };
+	for (int f = 0; f < 2; ++f) {
+		c[f] = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){op.op_std->ext_0,n_var}); // destructed
+		mm_NN1C_Operator_Multiarray_d(&op,(struct const_Multiarray_d*)b,c[f],op_format[f],2,NULL,NULL);
+	}
+
+	const bool pass = !diff_Multiarray_d(c[0],c[1],EPS);
+	if (!pass)
+		print_diff_Multiarray_d(c[0],c[1],EPS);
+
+	destructor_const_Matrix_d(op.op_std);
+	destructor_Multiarray_Matrix_d(ops_tp);
+	destructor_Multiarray_d(b);
+	for (int f = 0; f < 2; ++f)
+		destructor_Multiarray_d(c[f]);
+	assert_condition(pass);
+}
+
+static void test_unit_benchmark_tp (struct Test_Info*const test_info, const char*const e_type)
+{
+	sprintf(test_info->name,"%s%s%s","Operators - benchmark tp (",e_type,")");
+
+	const bool is_wedge = (strcmp(e_type,"wedge") == 0);
+	const int d = (strcmp(e_type,"quad") == 0 ? 2 : 3);
+
+	const int p_max = 8,
+	          n_var = 5,
+	          n_rep = 10;
+
+	bool pass = true;
+	printf("\n%s (p, time 'd', time 't', speedup):\n",e_type);
+	for (int p = 1; p <= p_max; ++p) {
+		// Sub-operators have an additional row to emulate interpolation to a larger set of nodes.
+		struct Multiarray_Matrix_d* ops_tp = constructor_empty_Multiarray_Matrix_d(false,1,(ptrdiff_t[]){d}); // dest.
+		for (int i = 0; i < d; ++i) {
+			if (is_wedge && i == 1)
+				continue;
+			const ptrdiff_t n = ( (is_wedge && i == 0) ? (p+1)*(p+2)/2 : p+1 );
+			ops_tp->data[i] = constructor_random_Matrix_d(n+1,n); // destructed
+		}
+
+		const struct Operator op =
+			{ .ops_tp = (struct const_Multiarray_Matrix_d*) ops_tp,
+			  .op_std = constructor_op_std((struct const_Multiarray_Matrix_d*)ops_tp), // destructed
+			  .op_csr = NULL, };
+
+		struct Multiarray_d* b = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){op.op_std->ext_1,n_var}); // d.
+		for (ptrdiff_t i = 0; i < compute_size(b->order,b->extents); ++i)
+			b->data[i] = ((double) rand())/((double) RAND_MAX+1);
+
+		const char op_format[] = { 'd', 't', };
+		double time[2] = { 0.0, 0.0, };
+		struct Multiarray_d* c[2] = { NULL, NULL, };
+		for (int f = 0; f < 2; ++f) {
+			c[f] = constructor_empty_Multiarray_d('C',2,(ptrdiff_t[]){op.op_std->ext_0,n_var}); // destructed
+
+			const clock_t t_start = clock();
+			for (int r = 0; r < n_rep; ++r)
+				mm_NN1C_Operator_Multiarray_d(&op,(struct const_Multiarray_d*)b,c[f],op_format[f],2,NULL,NULL);
+			time[f] = ((double)(clock()-t_start))/CLOCKS_PER_SEC/n_rep;
+		}
+		printf("%2d % .3e % .3e % .2f\n",p,time[0],time[1],time[0]/time[1]);
+
+		if (diff_Multiarray_d(c[0],c[1],1e2*EPS)) {
+			pass = false;
+			print_diff_Multiarray_d(c[0],c[1],1e2*EPS);
+		}
+
+		destructor_const_Matrix_d(op.op_std);
+		destructor_Multiarray_Matrix_d(ops_tp);
+		destructor_Multiarray_d(b);
+		for (int f = 0; f < 2; ++f)
+			destructor_Multiarray_d(c[f]);
+	}
+	assert_condition(pass);
+}
+
+// Level 1 ********************************************************************************************************** //
+
+static struct Matrix_d* constructor_random_Matrix_d (const ptrdiff_t ext_0, const ptrdiff_t ext_1)
+{
+	struct Matrix_d* a = constructor_empty_Matrix_d('R',ext_0,ext_1); // returned
+	for (ptrdiff_t i = 0; i < ext_0*ext_1; ++i)
+		a->data[i] = ((double) rand())/((double) RAND_MAX+1);
+	return a;
 }